@@ -0,0 +1,259 @@
+#define _POSIX_C_SOURCE 200809L // imports clock_gettime
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define MULTI_QUEUE_DATA_TYPE int
+#define MULTI_QUEUE_COUNT 32
+#define BINARY_HEAP_SIZE (1 << 20)
+#include <priority/multi_queue.h>
+
+// compares multi queue against one binary heap behind one mutex, with 1, 2, 4 and 8 threads
+// throughput: each thread repeatedly pops an element and pushes it back with a larger priority (hold model)
+// rank error: threads drain a queue of distinct keys, each pop's rank is the number of keys still queued that are less than it
+
+#define BENCHMARK_THREADS_MAX 8
+#define BENCHMARK_PREFILL (1 << 16)
+#define BENCHMARK_OPERATIONS (1 << 21)
+#define BENCHMARK_DRAIN (1 << 18)
+
+typedef struct locked_heap {
+    binary_heap_s heap;
+    pthread_mutex_t lock;
+} locked_heap_s;
+
+typedef struct benchmark_queue {
+    multi_queue_s multi;
+    locked_heap_s single;
+    bool is_multi;
+} benchmark_queue_s;
+
+typedef struct benchmark_worker {
+    benchmark_queue_s * queue;
+    uint64_t seed;
+    size_t operations;
+    int * keys; // popped keys in pop order for rank error
+    double * times; // pop timestamp for each popped key
+    size_t count;
+} benchmark_worker_s;
+
+static int compare_int(const int one, const int two) {
+    return (one > two) - (one < two);
+}
+
+static void destroy_int(int * element) {
+    (void)(element);
+}
+
+static double now(void) {
+    struct timespec spec = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &spec);
+    return (double)(spec.tv_sec) + ((double)(spec.tv_nsec) * 1e-9);
+}
+
+static void push(benchmark_queue_s * queue, const int element, uint64_t * seed) {
+    if (queue->is_multi) {
+        push_multi_queue(&(queue->multi), element, seed);
+        return;
+    }
+
+    pthread_mutex_lock(&(queue->single.lock));
+    push_binary_heap(&(queue->single.heap), element);
+    pthread_mutex_unlock(&(queue->single.lock));
+}
+
+static bool pop(benchmark_queue_s * queue, int * element, uint64_t * seed) {
+    if (queue->is_multi) {
+        return pop_multi_queue(&(queue->multi), element, seed);
+    }
+
+    pthread_mutex_lock(&(queue->single.lock));
+    const bool found = !is_empty_binary_heap(queue->single.heap);
+    if (found) {
+        (*element) = pop_binary_heap(&(queue->single.heap));
+    }
+    pthread_mutex_unlock(&(queue->single.lock));
+
+    return found;
+}
+
+static void * hold_worker(void * args) {
+    benchmark_worker_s * worker = args;
+
+    for (size_t i = 0; i < worker->operations; ++i) {
+        int element = 0;
+        if (pop(worker->queue, &element, &(worker->seed))) {
+            worker->seed = (worker->seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+            push(worker->queue, element + (int)((worker->seed >> 33) % 1024), &(worker->seed));
+        }
+    }
+
+    return NULL;
+}
+
+static void * drain_worker(void * args) {
+    benchmark_worker_s * worker = args;
+
+    int element = 0;
+    while (pop(worker->queue, &element, &(worker->seed))) {
+        worker->keys[worker->count] = element;
+        worker->times[worker->count] = now();
+        worker->count++;
+    }
+
+    return NULL;
+}
+
+typedef struct timed_key {
+    double time;
+    int key;
+} timed_key_s;
+
+static int compare_timed_key(const void * one, const void * two) {
+    const double a = ((const timed_key_s *)(one))->time, b = ((const timed_key_s *)(two))->time;
+    return (a > b) - (a < b);
+}
+
+static benchmark_queue_s create_queue(const bool is_multi) {
+    benchmark_queue_s queue = { .is_multi = is_multi, };
+    if (is_multi) {
+        queue.multi = create_multi_queue(compare_int);
+    } else {
+        queue.single.heap = create_binary_heap(compare_int);
+        pthread_mutex_init(&(queue.single.lock), NULL);
+    }
+
+    return queue;
+}
+
+static void destroy_queue(benchmark_queue_s * queue) {
+    if (queue->is_multi) {
+        destroy_multi_queue(&(queue->multi), destroy_int);
+    } else {
+        destroy_binary_heap(&(queue->single.heap), destroy_int);
+        pthread_mutex_destroy(&(queue->single.lock));
+    }
+}
+
+static double throughput(const bool is_multi, const size_t thread_count) {
+    benchmark_queue_s queue = create_queue(is_multi);
+
+    uint64_t seed = 42;
+    for (int i = 0; i < BENCHMARK_PREFILL; ++i) {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+        push(&queue, (int)((seed >> 33) % BENCHMARK_PREFILL), &seed);
+    }
+
+    pthread_t threads[BENCHMARK_THREADS_MAX];
+    benchmark_worker_s workers[BENCHMARK_THREADS_MAX];
+    const double start = now();
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers[i] = (benchmark_worker_s) { .queue = &queue, .seed = i + 1, .operations = BENCHMARK_OPERATIONS / thread_count, };
+        pthread_create(threads + i, NULL, hold_worker, workers + i);
+    }
+    for (size_t i = 0; i < thread_count; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    const double elapsed = now() - start;
+
+    destroy_queue(&queue);
+
+    return (double)(BENCHMARK_OPERATIONS) / elapsed / 1e6;
+}
+
+static void rank_error(const bool is_multi, const size_t thread_count, double * mean, size_t * max) {
+    benchmark_queue_s queue = create_queue(is_multi);
+
+    // push distinct keys in shuffled order
+    int * keys = malloc(BENCHMARK_DRAIN * sizeof(int));
+    for (int i = 0; i < BENCHMARK_DRAIN; ++i) {
+        keys[i] = i;
+    }
+    uint64_t seed = 42;
+    for (size_t i = BENCHMARK_DRAIN - 1; i > 0; --i) {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+        const size_t j = (size_t)((seed >> 33) % (i + 1));
+        const int temporary = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temporary;
+    }
+    for (int i = 0; i < BENCHMARK_DRAIN; ++i) {
+        push(&queue, keys[i], &seed);
+    }
+
+    pthread_t threads[BENCHMARK_THREADS_MAX];
+    benchmark_worker_s workers[BENCHMARK_THREADS_MAX];
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers[i] = (benchmark_worker_s) {
+            .queue = &queue, .seed = i + 1, .count = 0,
+            .keys = malloc(BENCHMARK_DRAIN * sizeof(int)), .times = malloc(BENCHMARK_DRAIN * sizeof(double)),
+        };
+        pthread_create(threads + i, NULL, drain_worker, workers + i);
+    }
+    for (size_t i = 0; i < thread_count; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    // merge pops of all threads into one global order by timestamp
+    timed_key_s * order = malloc(BENCHMARK_DRAIN * sizeof(timed_key_s));
+    size_t count = 0;
+    for (size_t i = 0; i < thread_count; ++i) {
+        for (size_t j = 0; j < workers[i].count; ++j) {
+            order[count++] = (timed_key_s) { .time = workers[i].times[j], .key = workers[i].keys[j], };
+        }
+        free(workers[i].keys);
+        free(workers[i].times);
+    }
+    qsort(order, count, sizeof(timed_key_s), compare_timed_key);
+
+    // fenwick tree counts keys still in queue, rank of popped key is the count of lesser keys
+    size_t * tree = calloc(BENCHMARK_DRAIN + 1, sizeof(size_t));
+    for (size_t i = 1; i <= BENCHMARK_DRAIN; ++i) {
+        tree[i]++;
+        const size_t parent = i + (i & (~i + 1));
+        if (parent <= BENCHMARK_DRAIN) {
+            tree[parent] += tree[i];
+        }
+    }
+
+    double sum = 0.0;
+    (*max) = 0;
+    for (size_t i = 0; i < count; ++i) {
+        size_t rank = 0;
+        for (size_t k = (size_t)(order[i].key); k > 0; k -= k & (~k + 1)) {
+            rank += tree[k];
+        }
+        for (size_t k = (size_t)(order[i].key) + 1; k <= BENCHMARK_DRAIN; k += k & (~k + 1)) {
+            tree[k]--;
+        }
+
+        sum += (double)(rank);
+        if (rank > (*max)) {
+            (*max) = rank;
+        }
+    }
+    (*mean) = sum / (double)(count);
+
+    free(tree);
+    free(order);
+    free(keys);
+    destroy_queue(&queue);
+}
+
+int main(void) {
+    printf("%-8s %-12s %14s %16s %14s\n", "threads", "queue", "Mops/s", "mean rank err", "max rank err");
+    for (size_t thread_count = 1; thread_count <= BENCHMARK_THREADS_MAX; thread_count *= 2) {
+        for (int is_multi = 0; is_multi < 2; ++is_multi) {
+            const double rate = throughput(is_multi, thread_count);
+
+            double mean = 0.0;
+            size_t max = 0;
+            rank_error(is_multi, thread_count, &mean, &max);
+
+            printf("%-8zu %-12s %14.2f %16.2f %14zu\n", thread_count, is_multi ? "multi_queue" : "single_lock", rate, mean, max);
+        }
+    }
+
+    return 0;
+}
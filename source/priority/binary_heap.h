@@ -59,6 +59,17 @@
 #   error Size cannot be zero.
 #endif
 
+#ifndef BINARY_HEAP_ARITY
+// redefine using #define BINARY_HEAP_ARITY [children count], e.g. 4 or 8 so that fewer levels are sifted through
+// siblings share one cache line only if 'BINARY_HEAP_ALLOC' returns cache line aligned memory (e.g. aligned_alloc) and
+// 'BINARY_HEAP_ARITY * sizeof(BINARY_HEAP_DATA_TYPE)' divides the cache line size, malloc alone doesn't guarantee it
+#   define BINARY_HEAP_ARITY 2
+#elif BINARY_HEAP_ARITY < 2
+#   error Arity must be at least two.
+#endif
+
+// define BINARY_HEAP_ADDRESSABLE to keep a stable handle for each pushed element, used to change or remove it later
+
 /// Function pointer that creates a deep element copy.
 typedef BINARY_HEAP_DATA_TYPE (*copy_binary_heap_fn)    (const BINARY_HEAP_DATA_TYPE element);
 /// Function pointer that destroys a deep element.
@@ -74,6 +85,10 @@ typedef struct binary_heap {
     BINARY_HEAP_DATA_TYPE * elements; // elements array
     compare_binary_heap_fn compare; // compare function to push, pop and heapify heap
     size_t size; // size of heap
+#ifdef BINARY_HEAP_ADDRESSABLE
+    size_t * handles; // handle of element at each array index, free handles follow heap's size
+    size_t * positions; // array index of element for each handle
+#endif
 } binary_heap_s;
 
 /// Creates a binary heap data structure.
@@ -82,10 +97,27 @@ typedef struct binary_heap {
 static inline binary_heap_s create_binary_heap(const compare_binary_heap_fn compare) {
     BINARY_HEAP_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
 
+    // array starts with 'BINARY_HEAP_ARITY - 1' unused elements, so that each node's children begin at a multiple of arity
+    BINARY_HEAP_DATA_TYPE * elements = BINARY_HEAP_ALLOC((BINARY_HEAP_SIZE + BINARY_HEAP_ARITY - 1) * sizeof(BINARY_HEAP_DATA_TYPE));
+    BINARY_HEAP_ASSERT(elements && "[ERROR] Memory allocation failed.");
+
     const binary_heap_s heap = {
-        .elements = BINARY_HEAP_ALLOC(BINARY_HEAP_SIZE * sizeof(BINARY_HEAP_DATA_TYPE)), .size = 0, .compare = compare,
+        .elements = elements + (BINARY_HEAP_ARITY - 1), .size = 0, .compare = compare,
+#ifdef BINARY_HEAP_ADDRESSABLE
+        .handles = BINARY_HEAP_ALLOC(BINARY_HEAP_SIZE * sizeof(size_t)),
+        .positions = BINARY_HEAP_ALLOC(BINARY_HEAP_SIZE * sizeof(size_t)),
+#endif
     };
-    BINARY_HEAP_ASSERT(heap.elements && "[ERROR] Memory allocation failed.");
+
+#ifdef BINARY_HEAP_ADDRESSABLE
+    BINARY_HEAP_ASSERT(heap.handles && "[ERROR] Memory allocation failed.");
+    BINARY_HEAP_ASSERT(heap.positions && "[ERROR] Memory allocation failed.");
+
+    // handles and positions are inverse permutations, thus each handle starts free at its own index
+    for (size_t i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        heap.handles[i] = heap.positions[i] = i;
+    }
+#endif
 
     return heap;
 }
@@ -107,7 +139,11 @@ static inline void destroy_binary_heap(binary_heap_s * heap, const destroy_binar
 
     heap->size = 0;
     heap->compare = NULL;
-    BINARY_HEAP_FREE(heap->elements);
+    BINARY_HEAP_FREE(heap->elements - (BINARY_HEAP_ARITY - 1));
+#ifdef BINARY_HEAP_ADDRESSABLE
+    BINARY_HEAP_FREE(heap->handles);
+    BINARY_HEAP_FREE(heap->positions);
+#endif
 }
 
 /// Clears the heap and all its elements.
@@ -161,11 +197,26 @@ static inline binary_heap_s copy_binary_heap(const binary_heap_s heap, const cop
     BINARY_HEAP_ASSERT(heap.size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
     BINARY_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
 
+    BINARY_HEAP_DATA_TYPE * elements = BINARY_HEAP_ALLOC((BINARY_HEAP_SIZE + BINARY_HEAP_ARITY - 1) * sizeof(BINARY_HEAP_DATA_TYPE));
+    BINARY_HEAP_ASSERT(elements && "[ERROR] Memory allocation failed.");
+
     binary_heap_s replica = {
-        .elements = BINARY_HEAP_ALLOC(BINARY_HEAP_SIZE * sizeof(BINARY_HEAP_DATA_TYPE)),
+        .elements = elements + (BINARY_HEAP_ARITY - 1),
         .compare = heap.compare, .size = 0,
+#ifdef BINARY_HEAP_ADDRESSABLE
+        .handles = BINARY_HEAP_ALLOC(BINARY_HEAP_SIZE * sizeof(size_t)),
+        .positions = BINARY_HEAP_ALLOC(BINARY_HEAP_SIZE * sizeof(size_t)),
+#endif
     };
-    BINARY_HEAP_ASSERT(replica.elements && "[ERROR] Memory allocation failed.");
+
+#ifdef BINARY_HEAP_ADDRESSABLE
+    BINARY_HEAP_ASSERT(replica.handles && "[ERROR] Memory allocation failed.");
+    BINARY_HEAP_ASSERT(replica.positions && "[ERROR] Memory allocation failed.");
+
+    // copied elements keep their handles
+    memcpy(replica.handles, heap.handles, BINARY_HEAP_SIZE * sizeof(size_t));
+    memcpy(replica.positions, heap.positions, BINARY_HEAP_SIZE * sizeof(size_t));
+#endif
 
     for (replica.size = 0; replica.size < heap.size; replica.size++) {
         replica.elements[replica.size] = copy(heap.elements[replica.size]);
@@ -214,23 +265,125 @@ static inline void push_binary_heap(binary_heap_s * heap, const BINARY_HEAP_DATA
     BINARY_HEAP_ASSERT(heap->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
     BINARY_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
-    // push element to the top of the elements array
-    memcpy(heap->elements + heap->size, &element, sizeof(BINARY_HEAP_DATA_TYPE));
-
-    // while current top child index is not zero and current element is greater than its parent
-    for (size_t child = heap->size, parent = (child - 1) / 2; child && heap->compare(heap->elements[child], heap->elements[parent]) < 0;) {
-        // swap current child element with parent
-        BINARY_HEAP_DATA_TYPE temporary = heap->elements[child];
-        heap->elements[child] = heap->elements[parent];
-        heap->elements[parent] = temporary;
+#ifdef BINARY_HEAP_ADDRESSABLE
+    const size_t handle = heap->handles[heap->size]; // new element takes the first free handle
+#endif
 
-        // change current child to parent and parent to grand-parent
-        child = parent;
-        parent = (child - 1) / 2;
+    // move hole from the top of the elements array up while element is less than hole's parent
+    size_t hole = heap->size;
+    for (size_t parent = (hole - 1) / BINARY_HEAP_ARITY; hole && heap->compare(element, heap->elements[parent]) < 0; parent = (hole - 1) / BINARY_HEAP_ARITY) {
+        // shift parent down into hole instead of swapping, element is written only once into the final hole
+        heap->elements[hole] = heap->elements[parent];
+#ifdef BINARY_HEAP_ADDRESSABLE
+        heap->handles[hole] = heap->handles[parent];
+        heap->positions[heap->handles[hole]] = hole;
+#endif
+        hole = parent;
     }
+    memcpy(heap->elements + hole, &element, sizeof(BINARY_HEAP_DATA_TYPE));
+#ifdef BINARY_HEAP_ADDRESSABLE
+    heap->handles[hole] = handle;
+    heap->positions[handle] = hole;
+#endif
     heap->size++;
 }
 
+/// Pushes an array of elements onto heap.
+/// @param heap Binary heap data structure.
+/// @param array Array of elements to push into heap.
+/// @param count Number of elements in array.
+static inline void push_many_binary_heap(binary_heap_s * heap, const BINARY_HEAP_DATA_TYPE * array, const size_t count) {
+    BINARY_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    BINARY_HEAP_ASSERT((array || !count) && "[ERROR] 'array' parameter is NULL.");
+    BINARY_HEAP_ASSERT(heap->size + count <= BINARY_HEAP_SIZE && "[ERROR] Push will exceed maximum size.");
+
+    BINARY_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    if (!count) {
+        return;
+    }
+
+    memcpy(heap->elements + heap->size, array, sizeof(BINARY_HEAP_DATA_TYPE) * count);
+#ifdef BINARY_HEAP_ADDRESSABLE
+    // pushed elements take the first free handles
+    for (size_t i = heap->size; i < heap->size + count; ++i) {
+        heap->positions[heap->handles[i]] = i;
+    }
+#endif
+
+    const size_t start = heap->size;
+    heap->size += count;
+
+    // sifting each pushed element up costs up to 'count * depth' steps, while heapifying everything costs about 'size'
+    size_t depth = 0;
+    for (size_t s = heap->size; s > 1; s /= BINARY_HEAP_ARITY) {
+        depth++;
+    }
+
+    if (count * depth < heap->size) {
+        for (size_t index = start; index < heap->size; ++index) {
+            // move hole of pushed element up while element is less than hole's parent
+            size_t hole = index;
+            BINARY_HEAP_DATA_TYPE element = heap->elements[hole];
+#ifdef BINARY_HEAP_ADDRESSABLE
+            const size_t handle = heap->handles[hole];
+#endif
+            for (size_t parent = (hole - 1) / BINARY_HEAP_ARITY; hole && heap->compare(element, heap->elements[parent]) < 0; parent = (hole - 1) / BINARY_HEAP_ARITY) {
+                heap->elements[hole] = heap->elements[parent];
+#ifdef BINARY_HEAP_ADDRESSABLE
+                heap->handles[hole] = heap->handles[parent];
+                heap->positions[heap->handles[hole]] = hole;
+#endif
+                hole = parent;
+            }
+            heap->elements[hole] = element;
+#ifdef BINARY_HEAP_ADDRESSABLE
+            heap->handles[hole] = handle;
+            heap->positions[handle] = hole;
+#endif
+        }
+
+        return;
+    }
+
+    // sift down each node that has children, starting from the last one, i.e. ceil((size - 1) / arity) nodes
+    for (size_t reverse_index = (heap->size + BINARY_HEAP_ARITY - 2) / BINARY_HEAP_ARITY; reverse_index; --reverse_index) {
+        size_t hole = reverse_index - 1;
+        BINARY_HEAP_DATA_TYPE element = heap->elements[hole];
+#ifdef BINARY_HEAP_ADDRESSABLE
+        const size_t handle = heap->handles[hole];
+#endif
+        for (size_t child = (BINARY_HEAP_ARITY * hole) + 1; child < heap->size; child = (BINARY_HEAP_ARITY * hole) + 1) {
+            // find the smallest child among all siblings, siblings are continuous in array
+            const size_t end = (child + BINARY_HEAP_ARITY) < heap->size ? (child + BINARY_HEAP_ARITY) : heap->size;
+            for (size_t sibling = child + 1; sibling < end; ++sibling) {
+                if (heap->compare(heap->elements[child], heap->elements[sibling]) > 0) {
+                    child = sibling;
+                }
+            }
+            // if smallest child is greater, then hole is properly set and thus break from loop
+            if (heap->compare(heap->elements[child], element) > 0) {
+                break;
+            }
+
+            // shift smallest child up into hole
+            heap->elements[hole] = heap->elements[child];
+#ifdef BINARY_HEAP_ADDRESSABLE
+            heap->handles[hole] = heap->handles[child];
+            heap->positions[heap->handles[hole]] = hole;
+#endif
+            hole = child;
+        }
+        heap->elements[hole] = element;
+#ifdef BINARY_HEAP_ADDRESSABLE
+        heap->handles[hole] = handle;
+        heap->positions[handle] = hole;
+#endif
+    }
+}
+
 /// Pops and returns root element from heap.
 /// @param heap Binary heap data structure.
 /// @return Root element in heap as specified by its compare function.
@@ -242,26 +395,45 @@ static inline BINARY_HEAP_DATA_TYPE pop_binary_heap(binary_heap_s * heap) {
     BINARY_HEAP_ASSERT(heap->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
     BINARY_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
-    // save root element and put last element in its place
+    // save root element and move hole left by it down for last element
     BINARY_HEAP_DATA_TYPE removed = heap->elements[0];
     heap->size--;
-    heap->elements[0] = heap->elements[heap->size];
+    BINARY_HEAP_DATA_TYPE last = heap->elements[heap->size];
+#ifdef BINARY_HEAP_ADDRESSABLE
+    const size_t removed_handle = heap->handles[0], last_handle = heap->handles[heap->size];
+#endif
 
-    for (size_t parent = 0, child = (2 * parent) + 1; child < heap->size; parent = child, child = (2 * parent) + 1) {
-        // if right child is a valid index and it is smaller than left child change left child to right one
-        if ((child + 1) < heap->size && heap->compare(heap->elements[child], heap->elements[child + 1]) > 0) {
-            child++;
+    size_t hole = 0;
+    for (size_t child = (BINARY_HEAP_ARITY * hole) + 1; child < heap->size; child = (BINARY_HEAP_ARITY * hole) + 1) {
+        // find the smallest child among all siblings, siblings are continuous in array
+        const size_t end = (child + BINARY_HEAP_ARITY) < heap->size ? (child + BINARY_HEAP_ARITY) : heap->size;
+        for (size_t sibling = child + 1; sibling < end; ++sibling) {
+            if (heap->compare(heap->elements[child], heap->elements[sibling]) > 0) {
+                child = sibling;
+            }
         }
-        // if child is greater, then parent is properly set and thus break from loop
-        if (heap->compare(heap->elements[child], heap->elements[parent]) > 0) {
+        // if smallest child is greater, then hole is properly set and thus break from loop
+        if (heap->compare(heap->elements[child], last) > 0) {
             break;
         }
 
-        // swap current parent element with greatest child
-        BINARY_HEAP_DATA_TYPE temporary = heap->elements[child];
-        heap->elements[child] = heap->elements[parent];
-        heap->elements[parent] = temporary;
+        // shift smallest child up into hole
+        heap->elements[hole] = heap->elements[child];
+#ifdef BINARY_HEAP_ADDRESSABLE
+        heap->handles[hole] = heap->handles[child];
+        heap->positions[heap->handles[hole]] = hole;
+#endif
+        hole = child;
     }
+    heap->elements[hole] = last;
+#ifdef BINARY_HEAP_ADDRESSABLE
+    heap->handles[hole] = last_handle;
+    heap->positions[last_handle] = hole;
+
+    // removed element's handle becomes the first free one
+    heap->handles[heap->size] = removed_handle;
+    heap->positions[removed_handle] = heap->size;
+#endif
 
     return removed;
 }
@@ -292,38 +464,50 @@ static inline BINARY_HEAP_DATA_TYPE replace_binary_heap(const binary_heap_s heap
     BINARY_HEAP_ASSERT(heap.size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
     BINARY_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
 
-    const BINARY_HEAP_DATA_TYPE replaced = heap.elements[index];
-    memcpy(heap.elements + index, &element, sizeof(BINARY_HEAP_DATA_TYPE));
+    BINARY_HEAP_DATA_TYPE replaced = heap.elements[index];
+#ifdef BINARY_HEAP_ADDRESSABLE
+    const size_t handle = heap.handles[index]; // new element keeps replaced element's handle
+#endif
 
+    size_t hole = index;
     if (heap.compare(replaced, element) > 0) { // if new element is decreased perform down-heapify
-        // while current top child index is not zero and current element is greater than its parent
-        for (size_t child = index, parent = (child - 1) / 2; child && heap.compare(heap.elements[child], heap.elements[parent]) < 0;) {
-            // swap current child element with parent
-            BINARY_HEAP_DATA_TYPE temporary = heap.elements[child];
-            heap.elements[child] = heap.elements[parent];
-            heap.elements[parent] = temporary;
-
-            // change current child to parent and parent to grand-parent
-            child = parent;
-            parent = (child - 1) / 2;
+        // move hole up while element is less than hole's parent
+        for (size_t parent = (hole - 1) / BINARY_HEAP_ARITY; hole && heap.compare(element, heap.elements[parent]) < 0; parent = (hole - 1) / BINARY_HEAP_ARITY) {
+            heap.elements[hole] = heap.elements[parent];
+#ifdef BINARY_HEAP_ADDRESSABLE
+            heap.handles[hole] = heap.handles[parent];
+            heap.positions[heap.handles[hole]] = hole;
+#endif
+            hole = parent;
         }
     } else { // else the element is increased and up-heapify is performed
-        for (size_t parent = index, child = (2 * parent) + 1; child < heap.size; parent = child, child = (2 * parent) + 1) {
-            // if right child is a valid index and it is smaller than left child change left child to right one
-            if ((child + 1) < heap.size && heap.compare(heap.elements[child], heap.elements[child + 1]) > 0) {
-                child++;
+        for (size_t child = (BINARY_HEAP_ARITY * hole) + 1; child < heap.size; child = (BINARY_HEAP_ARITY * hole) + 1) {
+            // find the smallest child among all siblings, siblings are continuous in array
+            const size_t end = (child + BINARY_HEAP_ARITY) < heap.size ? (child + BINARY_HEAP_ARITY) : heap.size;
+            for (size_t sibling = child + 1; sibling < end; ++sibling) {
+                if (heap.compare(heap.elements[child], heap.elements[sibling]) > 0) {
+                    child = sibling;
+                }
             }
-            // if child is greater, then parent is properly set and thus break from loop
-            if (heap.compare(heap.elements[child], heap.elements[parent]) > 0) {
+            // if smallest child is greater, then hole is properly set and thus break from loop
+            if (heap.compare(heap.elements[child], element) > 0) {
                 break;
             }
 
-            // swap current parent element with greatest child
-            BINARY_HEAP_DATA_TYPE temporary = heap.elements[child];
-            heap.elements[child] = heap.elements[parent];
-            heap.elements[parent] = temporary;
+            // shift smallest child up into hole
+            heap.elements[hole] = heap.elements[child];
+#ifdef BINARY_HEAP_ADDRESSABLE
+            heap.handles[hole] = heap.handles[child];
+            heap.positions[heap.handles[hole]] = hole;
+#endif
+            hole = child;
         }
     }
+    memcpy(heap.elements + hole, &element, sizeof(BINARY_HEAP_DATA_TYPE));
+#ifdef BINARY_HEAP_ADDRESSABLE
+    heap.handles[hole] = handle;
+    heap.positions[handle] = hole;
+#endif
 
     return replaced;
 }
@@ -346,61 +530,386 @@ static inline void meld_binary_heap(binary_heap_s * restrict destination, binary
     BINARY_HEAP_ASSERT(source->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
     BINARY_HEAP_ASSERT(source->elements && "[ERROR] 'elements' pointer is NULL.");
 
-    memcpy(destination->elements + destination->size, source->elements, sizeof(BINARY_HEAP_DATA_TYPE) * source->size);
-    destination->size += source->size;
+    // source's elements take destination's free handles if addressable, thus handles returned by source become invalid
+    push_many_binary_heap(destination, (const BINARY_HEAP_DATA_TYPE *)(source->elements), source->size);
     source->size = 0;
+}
 
-    const size_t start_index = (destination->size / 2) - 1;
-    for (size_t i = 0; i <= start_index; ++i) {
-        const size_t reverse_index = start_index - i;
-        for (size_t parent = reverse_index, child = (2 * parent) + 1; child < destination->size; parent = child, child = (2 * parent) + 1) {
-            // if right child is a valid index and it is smaller than left child change left child to right one
-            if ((child + 1) < destination->size && destination->compare(destination->elements[child], destination->elements[child + 1]) > 0) {
-                child++;
+/// Patches up heap in the case that its heap properties are broken.
+/// @param heap Binary heap data structure.
+/// @note Only call this function in the case of an event that breaks the heap properties by modifying its elements,
+/// like foreach and map.
+static inline void patch_binary_heap(const binary_heap_s heap) {
+    BINARY_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap.size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // sift down each node that has children, starting from the last one, i.e. ceil((size - 1) / arity) nodes
+    for (size_t reverse_index = (heap.size + BINARY_HEAP_ARITY - 2) / BINARY_HEAP_ARITY; reverse_index; --reverse_index) {
+        size_t hole = reverse_index - 1;
+        BINARY_HEAP_DATA_TYPE element = heap.elements[hole];
+#ifdef BINARY_HEAP_ADDRESSABLE
+        const size_t handle = heap.handles[hole];
+#endif
+        for (size_t child = (BINARY_HEAP_ARITY * hole) + 1; child < heap.size; child = (BINARY_HEAP_ARITY * hole) + 1) {
+            // find the smallest child among all siblings, siblings are continuous in array
+            const size_t end = (child + BINARY_HEAP_ARITY) < heap.size ? (child + BINARY_HEAP_ARITY) : heap.size;
+            for (size_t sibling = child + 1; sibling < end; ++sibling) {
+                if (heap.compare(heap.elements[child], heap.elements[sibling]) > 0) {
+                    child = sibling;
+                }
             }
-            // if child is greater, then parent is properly set and thus break from loop
-            if (destination->compare(destination->elements[child], destination->elements[parent]) > 0) {
+            // if smallest child is greater, then hole is properly set and thus break from loop
+            if (heap.compare(heap.elements[child], element) > 0) {
                 break;
             }
 
-            // swap current parent element with greatest child
-            BINARY_HEAP_DATA_TYPE temporary = destination->elements[child];
-            destination->elements[child] = destination->elements[parent];
-            destination->elements[parent] = temporary;
+            // shift smallest child up into hole
+            heap.elements[hole] = heap.elements[child];
+#ifdef BINARY_HEAP_ADDRESSABLE
+            heap.handles[hole] = heap.handles[child];
+            heap.positions[heap.handles[hole]] = hole;
+#endif
+            hole = child;
         }
+        heap.elements[hole] = element;
+#ifdef BINARY_HEAP_ADDRESSABLE
+        heap.handles[hole] = handle;
+        heap.positions[handle] = hole;
+#endif
     }
 }
 
-/// Patches up heap in the case that its heap properties are broken.
+/// Offers element to heap that keeps at most 'k' elements that are last in compare order, e.g. k largest for a minimum heap.
 /// @param heap Binary heap data structure.
-/// @note Only call this function in the case of an event that breaks the heap properties by modifying its elements,
-/// like foreach and map.
-static inline void patch_binary_heap(const binary_heap_s heap) {
+/// @param k Maximum number of kept elements.
+/// @param element Element to offer.
+/// @param destroy Function pointer to destroy evicted root element.
+/// @return 'true' if element was kept, 'false' if it was rejected.
+/// @note Root is the least kept element, thus a full heap rejects element with a single comparison against it, else
+/// root is destroyed and element replaces it in place. Rejected element stays owned by caller.
+static inline bool offer_binary_heap(binary_heap_s * heap, const size_t k, const BINARY_HEAP_DATA_TYPE element, const destroy_binary_heap_fn destroy) {
+    BINARY_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    BINARY_HEAP_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    BINARY_HEAP_ASSERT(k && "[ERROR] 'k' parameter is zero.");
+    BINARY_HEAP_ASSERT(k <= BINARY_HEAP_SIZE && "[ERROR] 'k' parameter exceeds maximum heap size.");
+    BINARY_HEAP_ASSERT(heap->size <= k && "[ERROR] Heap has more than 'k' elements.");
+
+    BINARY_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    if (heap->size < k) { // if heap isn't filled up to 'k' elements then element is always kept
+        push_binary_heap(heap, element);
+        return true;
+    }
+
+    if (heap->compare(element, heap->elements[0]) <= 0) { // if element doesn't come after least kept one reject it
+        return false;
+    }
+    destroy(heap->elements); // destroy evicted root before its slot is overwritten
+
+#ifdef BINARY_HEAP_ADDRESSABLE
+    // evicted root's handle becomes free and element takes the first free one, or the evicted one if heap is full
+    size_t handle = heap->handles[0];
+    if (heap->size != BINARY_HEAP_SIZE) {
+        handle = heap->handles[heap->size];
+        heap->handles[heap->size] = heap->handles[0];
+        heap->positions[heap->handles[0]] = heap->size;
+    }
+#endif
+
+    // move hole left by evicted root down for element
+    size_t hole = 0;
+    for (size_t child = (BINARY_HEAP_ARITY * hole) + 1; child < heap->size; child = (BINARY_HEAP_ARITY * hole) + 1) {
+        // find the smallest child among all siblings, siblings are continuous in array
+        const size_t end = (child + BINARY_HEAP_ARITY) < heap->size ? (child + BINARY_HEAP_ARITY) : heap->size;
+        for (size_t sibling = child + 1; sibling < end; ++sibling) {
+            if (heap->compare(heap->elements[child], heap->elements[sibling]) > 0) {
+                child = sibling;
+            }
+        }
+        // if smallest child is greater, then hole is properly set and thus break from loop
+        if (heap->compare(heap->elements[child], element) > 0) {
+            break;
+        }
+
+        // shift smallest child up into hole
+        heap->elements[hole] = heap->elements[child];
+#ifdef BINARY_HEAP_ADDRESSABLE
+        heap->handles[hole] = heap->handles[child];
+        heap->positions[heap->handles[hole]] = hole;
+#endif
+        hole = child;
+    }
+    memcpy(heap->elements + hole, &element, sizeof(BINARY_HEAP_DATA_TYPE));
+#ifdef BINARY_HEAP_ADDRESSABLE
+    heap->handles[hole] = handle;
+    heap->positions[handle] = hole;
+#endif
+
+    return true;
+}
+
+/// Offers an array of elements to heap that keeps at most 'k' elements that are last in compare order.
+/// @param heap Binary heap data structure.
+/// @param k Maximum number of kept elements.
+/// @param array Array of elements to offer.
+/// @param count Number of elements in array.
+/// @param destroy Function pointer to destroy each evicted root element.
+/// @return Number of kept elements, including ones that were later evicted by array's next elements.
+static inline size_t offer_many_binary_heap(binary_heap_s * heap, const size_t k, const BINARY_HEAP_DATA_TYPE * array, const size_t count, const destroy_binary_heap_fn destroy) {
+    BINARY_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    BINARY_HEAP_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+    BINARY_HEAP_ASSERT(k && "[ERROR] 'k' parameter is zero.");
+    BINARY_HEAP_ASSERT(k <= BINARY_HEAP_SIZE && "[ERROR] 'k' parameter exceeds maximum heap size.");
+    BINARY_HEAP_ASSERT(heap->size <= k && "[ERROR] Heap has more than 'k' elements.");
+    BINARY_HEAP_ASSERT((array || !count) && "[ERROR] 'array' parameter is NULL.");
+
+    BINARY_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // fill heap up to 'k' elements in one batch, which heapifies instead of sifting each element when cheaper
+    const size_t fill = (k - heap->size) < count ? (k - heap->size) : count;
+    push_many_binary_heap(heap, array, fill);
+
+    size_t kept = fill;
+    for (size_t i = fill; i < count; ++i) {
+        // skip run of rejected elements by comparing only against root, heap is written only when element is kept
+        if (heap->compare(array[i], heap->elements[0]) <= 0) {
+            continue;
+        }
+        offer_binary_heap(heap, k, array[i], destroy);
+        kept++;
+    }
+
+    return kept;
+}
+
+/// Sorts heap's elements array in compare order, which keeps heap property, so that foreach and map see sorted elements.
+/// @param heap Binary heap data structure.
+/// @note Sorts in place without allocating, e.g. to emit the final elements kept by offer in order.
+static inline void sort_binary_heap(binary_heap_s * heap) {
+    BINARY_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+
+    BINARY_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // heapsort by popping each root into the array index freed by pop, pop also moves its handle there, thus array ends
+    // up sorted from last to first in compare order
+    const size_t size = heap->size;
+    while (heap->size) {
+        const BINARY_HEAP_DATA_TYPE removed = pop_binary_heap(heap);
+        memcpy(heap->elements + heap->size, &removed, sizeof(BINARY_HEAP_DATA_TYPE));
+    }
+    heap->size = size;
+
+    // reverse array into compare order
+    for (size_t first = 0, last = size ? size - 1 : 0; first < last; ++first, --last) {
+        BINARY_HEAP_DATA_TYPE element = heap->elements[first];
+        heap->elements[first] = heap->elements[last];
+        heap->elements[last] = element;
+#ifdef BINARY_HEAP_ADDRESSABLE
+        const size_t handle = heap->handles[first];
+        heap->handles[first] = heap->handles[last];
+        heap->handles[last] = handle;
+        heap->positions[heap->handles[first]] = first;
+        heap->positions[heap->handles[last]] = last;
+#endif
+    }
+}
+
+#ifdef BINARY_HEAP_ADDRESSABLE
+
+/// Pushes element onto heap and returns its handle.
+/// @param heap Binary heap data structure.
+/// @param element Element to push into heap.
+/// @return Handle of element that stays valid until the element is popped or removed.
+static inline size_t push_handle_binary_heap(binary_heap_s * heap, const BINARY_HEAP_DATA_TYPE element) {
+    BINARY_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    BINARY_HEAP_ASSERT(heap->size != BINARY_HEAP_SIZE && "[ERROR] Can't push to full heap.");
+
+    BINARY_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // push always takes the first free handle
+    const size_t handle = heap->handles[heap->size];
+    push_binary_heap(heap, element);
+
+    return handle;
+}
+
+/// Checks if handle references an element in heap.
+/// @param heap Binary heap data structure.
+/// @param handle Handle returned by push.
+/// @return 'true' if element of handle wasn't popped or removed, 'false' otherwise.
+static inline bool contains_handle_binary_heap(const binary_heap_s heap, const size_t handle) {
+    BINARY_HEAP_ASSERT(handle < BINARY_HEAP_SIZE && "[ERROR] Handle out of heap size bounds.");
+
     BINARY_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
     BINARY_HEAP_ASSERT(heap.size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
     BINARY_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
 
-    const size_t start_index = (heap.size / 2) - 1;
-    for (size_t i = 0; i <= start_index; ++i) {
-        const size_t reverse_index = start_index - i;
-        for (size_t parent = reverse_index, child = (2 * parent) + 1; child < heap.size; parent = child, child = (2 * parent) + 1) {
-            // if right child is a valid index and it is smaller than left child change left child to right one
-            if ((child + 1) < heap.size && heap.compare(heap.elements[child], heap.elements[child + 1]) > 0) {
-                child++;
-            }
-            // if child is greater, then parent is properly set and thus break from loop
-            if (heap.compare(heap.elements[child], heap.elements[parent]) > 0) {
-                break;
+    return heap.positions[handle] < heap.size && heap.handles[heap.positions[handle]] == handle;
+}
+
+/// Returns element referenced by handle without removing it.
+/// @param heap Binary heap data structure.
+/// @param handle Handle returned by push.
+/// @return Element of handle.
+static inline BINARY_HEAP_DATA_TYPE get_handle_binary_heap(const binary_heap_s heap, const size_t handle) {
+    BINARY_HEAP_ASSERT(handle < BINARY_HEAP_SIZE && "[ERROR] Handle out of heap size bounds.");
+    BINARY_HEAP_ASSERT(heap.positions[handle] < heap.size && heap.handles[heap.positions[handle]] == handle && "[ERROR] Handle isn't in heap.");
+
+    BINARY_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap.size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return heap.elements[heap.positions[handle]];
+}
+
+/// Replaces element referenced by handle with a lesser or equal one and moves it up.
+/// @param heap Binary heap data structure.
+/// @param handle Handle returned by push.
+/// @param element Element not greater than the replaced one.
+/// @return Replaced element.
+static inline BINARY_HEAP_DATA_TYPE decrease_key_binary_heap(const binary_heap_s heap, const size_t handle, const BINARY_HEAP_DATA_TYPE element) {
+    BINARY_HEAP_ASSERT(handle < BINARY_HEAP_SIZE && "[ERROR] Handle out of heap size bounds.");
+    BINARY_HEAP_ASSERT(heap.positions[handle] < heap.size && heap.handles[heap.positions[handle]] == handle && "[ERROR] Handle isn't in heap.");
+
+    BINARY_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap.size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    size_t hole = heap.positions[handle];
+    BINARY_HEAP_DATA_TYPE replaced = heap.elements[hole];
+    BINARY_HEAP_ASSERT(heap.compare(element, replaced) <= 0 && "[ERROR] Element is greater than replaced one.");
+
+    // move hole up while element is less than hole's parent
+    for (size_t parent = (hole - 1) / BINARY_HEAP_ARITY; hole && heap.compare(element, heap.elements[parent]) < 0; parent = (hole - 1) / BINARY_HEAP_ARITY) {
+        heap.elements[hole] = heap.elements[parent];
+        heap.handles[hole] = heap.handles[parent];
+        heap.positions[heap.handles[hole]] = hole;
+        hole = parent;
+    }
+    memcpy(heap.elements + hole, &element, sizeof(BINARY_HEAP_DATA_TYPE));
+    heap.handles[hole] = handle;
+    heap.positions[handle] = hole;
+
+    return replaced;
+}
+
+/// Replaces element referenced by handle with a greater or equal one and moves it down.
+/// @param heap Binary heap data structure.
+/// @param handle Handle returned by push.
+/// @param element Element not less than the replaced one.
+/// @return Replaced element.
+static inline BINARY_HEAP_DATA_TYPE increase_key_binary_heap(const binary_heap_s heap, const size_t handle, const BINARY_HEAP_DATA_TYPE element) {
+    BINARY_HEAP_ASSERT(handle < BINARY_HEAP_SIZE && "[ERROR] Handle out of heap size bounds.");
+    BINARY_HEAP_ASSERT(heap.positions[handle] < heap.size && heap.handles[heap.positions[handle]] == handle && "[ERROR] Handle isn't in heap.");
+
+    BINARY_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap.size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    size_t hole = heap.positions[handle];
+    BINARY_HEAP_DATA_TYPE replaced = heap.elements[hole];
+    BINARY_HEAP_ASSERT(heap.compare(element, replaced) >= 0 && "[ERROR] Element is less than replaced one.");
+
+    // move hole down while smallest child is not greater than element
+    for (size_t child = (BINARY_HEAP_ARITY * hole) + 1; child < heap.size; child = (BINARY_HEAP_ARITY * hole) + 1) {
+        // find the smallest child among all siblings, siblings are continuous in array
+        const size_t end = (child + BINARY_HEAP_ARITY) < heap.size ? (child + BINARY_HEAP_ARITY) : heap.size;
+        for (size_t sibling = child + 1; sibling < end; ++sibling) {
+            if (heap.compare(heap.elements[child], heap.elements[sibling]) > 0) {
+                child = sibling;
             }
+        }
+        // if smallest child is greater, then hole is properly set and thus break from loop
+        if (heap.compare(heap.elements[child], element) > 0) {
+            break;
+        }
+
+        // shift smallest child up into hole
+        heap.elements[hole] = heap.elements[child];
+        heap.handles[hole] = heap.handles[child];
+        heap.positions[heap.handles[hole]] = hole;
+        hole = child;
+    }
+    memcpy(heap.elements + hole, &element, sizeof(BINARY_HEAP_DATA_TYPE));
+    heap.handles[hole] = handle;
+    heap.positions[handle] = hole;
+
+    return replaced;
+}
+
+/// Removes and returns element referenced by handle from heap.
+/// @param heap Binary heap data structure.
+/// @param handle Handle returned by push.
+/// @return Removed element.
+static inline BINARY_HEAP_DATA_TYPE remove_handle_binary_heap(binary_heap_s * heap, const size_t handle) {
+    BINARY_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    BINARY_HEAP_ASSERT(heap->size && "[ERROR] Can't remove from empty heap.");
+    BINARY_HEAP_ASSERT(handle < BINARY_HEAP_SIZE && "[ERROR] Handle out of heap size bounds.");
+    BINARY_HEAP_ASSERT(heap->positions[handle] < heap->size && heap->handles[heap->positions[handle]] == handle && "[ERROR] Handle isn't in heap.");
 
-            // swap current parent element with greatest child
-            BINARY_HEAP_DATA_TYPE temporary = heap.elements[child];
-            heap.elements[child] = heap.elements[parent];
-            heap.elements[parent] = temporary;
+    BINARY_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    BINARY_HEAP_ASSERT(heap->size <= BINARY_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    BINARY_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // save removed element and move hole left by it either up or down for last element
+    size_t hole = heap->positions[handle];
+    BINARY_HEAP_DATA_TYPE removed = heap->elements[hole];
+    heap->size--;
+    BINARY_HEAP_DATA_TYPE element = heap->elements[heap->size];
+    const size_t last_handle = heap->handles[heap->size];
+
+    if (hole != heap->size) { // if removed element isn't the last one then last element fills its hole
+        if (heap->compare(element, removed) < 0) {
+            for (size_t parent = (hole - 1) / BINARY_HEAP_ARITY; hole && heap->compare(element, heap->elements[parent]) < 0; parent = (hole - 1) / BINARY_HEAP_ARITY) {
+                heap->elements[hole] = heap->elements[parent];
+                heap->handles[hole] = heap->handles[parent];
+                heap->positions[heap->handles[hole]] = hole;
+                hole = parent;
+            }
+        } else {
+            for (size_t child = (BINARY_HEAP_ARITY * hole) + 1; child < heap->size; child = (BINARY_HEAP_ARITY * hole) + 1) {
+                // find the smallest child among all siblings, siblings are continuous in array
+                const size_t end = (child + BINARY_HEAP_ARITY) < heap->size ? (child + BINARY_HEAP_ARITY) : heap->size;
+                for (size_t sibling = child + 1; sibling < end; ++sibling) {
+                    if (heap->compare(heap->elements[child], heap->elements[sibling]) > 0) {
+                        child = sibling;
+                    }
+                }
+                // if smallest child is greater, then hole is properly set and thus break from loop
+                if (heap->compare(heap->elements[child], element) > 0) {
+                    break;
+                }
+
+                // shift smallest child up into hole
+                heap->elements[hole] = heap->elements[child];
+                heap->handles[hole] = heap->handles[child];
+                heap->positions[heap->handles[hole]] = hole;
+                hole = child;
+            }
         }
+        heap->elements[hole] = element;
+        heap->handles[hole] = last_handle;
+        heap->positions[last_handle] = hole;
     }
+
+    // removed element's handle becomes the first free one
+    heap->handles[heap->size] = handle;
+    heap->positions[handle] = heap->size;
+
+    return removed;
 }
 
+#endif
+
 #else
 
 #error Cannot include multiple headers in same unit.
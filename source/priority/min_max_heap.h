@@ -0,0 +1,433 @@
+#ifndef MIN_MAX_HEAP_H
+#define MIN_MAX_HEAP_H
+
+/*
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+    For more information, please refer to <https://unlicense.org>
+*/
+
+#include <stddef.h>  // imports size_t
+#include <stdbool.h> // imports bool
+#include <string.h>  // imports memcpy
+
+#ifndef MIN_MAX_HEAP_DATA_TYPE
+// redefine using #define MIN_MAX_HEAP_DATA_TYPE [type]
+#   define MIN_MAX_HEAP_DATA_TYPE void*
+#endif
+
+#ifndef MIN_MAX_HEAP_ASSERT
+#   include <assert.h>  // imports assert for debugging
+// redefine using #define MIN_MAX_HEAP_DATA_TYPE [assert]
+#   define MIN_MAX_HEAP_ASSERT assert
+#endif
+
+#if !defined(MIN_MAX_HEAP_ALLOC) && !defined(MIN_MAX_HEAP_FREE)
+#   include <stdlib.h>
+#   define MIN_MAX_HEAP_ALLOC malloc
+#   define MIN_MAX_HEAP_FREE free
+#elif !defined(MIN_MAX_HEAP_ALLOC)
+#   error Must also define MIN_MAX_HEAP_ALLOC.
+#elif !defined(MIN_MAX_HEAP_FREE)
+#   error Must also define MIN_MAX_HEAP_FREE.
+#endif
+
+#ifndef MIN_MAX_HEAP_SIZE
+#   define MIN_MAX_HEAP_SIZE (1 << 10)
+#elif MIN_MAX_HEAP_SIZE <= 0
+#   error Size cannot be zero.
+#endif
+
+/// Function pointer that creates a deep element copy.
+typedef MIN_MAX_HEAP_DATA_TYPE (*copy_min_max_heap_fn)    (const MIN_MAX_HEAP_DATA_TYPE element);
+/// Function pointer that destroys a deep element.
+typedef void                   (*destroy_min_max_heap_fn) (MIN_MAX_HEAP_DATA_TYPE * element);
+/// 'less than', else a positive number if 'more than'.
+typedef int                    (*compare_min_max_heap_fn) (const MIN_MAX_HEAP_DATA_TYPE one, const MIN_MAX_HEAP_DATA_TYPE two);
+/// Function pointer that changes an element pointer using void pointer arguments if needed. Returns true if operation should continue.
+typedef bool                   (*operate_min_max_heap_fn) (MIN_MAX_HEAP_DATA_TYPE * element, void * args);
+/// @brief Function pointer to manage an array of graph elements based on generic arguments.
+typedef void                   (*manage_min_max_heap_fn)  (MIN_MAX_HEAP_DATA_TYPE * array, const size_t size, void * args);
+
+typedef struct min_max_heap {
+    MIN_MAX_HEAP_DATA_TYPE * elements; // elements array, nodes on even depths are less and on odd depths are greater than descendants
+    compare_min_max_heap_fn compare; // compare function to push, pop and heapify heap
+    size_t size; // size of heap
+} min_max_heap_s;
+
+/// Creates a min-max heap data structure.
+/// @param compare Function pointer to compare elements for heap.
+/// @return New min-max heap.
+static inline min_max_heap_s create_min_max_heap(const compare_min_max_heap_fn compare) {
+    MIN_MAX_HEAP_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+
+    const min_max_heap_s heap = {
+        .elements = MIN_MAX_HEAP_ALLOC(MIN_MAX_HEAP_SIZE * sizeof(MIN_MAX_HEAP_DATA_TYPE)),
+        .size = 0, .compare = compare,
+    };
+    MIN_MAX_HEAP_ASSERT(heap.elements && "[ERROR] Memory allocation failed.");
+
+    return heap;
+}
+
+/// Destroys the heap and all its elements.
+/// @param heap Min-max heap data structure.
+/// @param destroy Function pointer to destroy each element in heap.
+static inline void destroy_min_max_heap(min_max_heap_s * heap, const destroy_min_max_heap_fn destroy) {
+    MIN_MAX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    MIN_MAX_HEAP_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    MIN_MAX_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap->size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    for (MIN_MAX_HEAP_DATA_TYPE * e = heap->elements; e < heap->elements + heap->size; e++) {
+        destroy(e);
+    }
+
+    heap->size = 0;
+    heap->compare = NULL;
+    MIN_MAX_HEAP_FREE(heap->elements);
+}
+
+/// Clears the heap and all its elements.
+/// @param heap Min-max heap data structure.
+/// @param destroy Function pointer to destroy each element in heap.
+static inline void clear_min_max_heap(min_max_heap_s * heap, const destroy_min_max_heap_fn destroy) {
+    MIN_MAX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    MIN_MAX_HEAP_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    MIN_MAX_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap->size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    for (MIN_MAX_HEAP_DATA_TYPE * e = heap->elements; e < heap->elements + heap->size; e++) {
+        destroy(e);
+    }
+
+    heap->size = 0;
+}
+
+/// Checks if heap is empty.
+/// @param heap Min-max heap data structure.
+/// @return 'true' if heap is empty, 'false' otherwise.
+static inline bool is_empty_min_max_heap(const min_max_heap_s heap) {
+    MIN_MAX_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap.size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return !(heap.size);
+}
+
+/// Checks if heap is full.
+/// @param heap Min-max heap data structure.
+/// @return 'true' if heap is full, 'false' otherwise.
+static inline bool is_full_min_max_heap(const min_max_heap_s heap) {
+    MIN_MAX_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap.size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return (heap.size == MIN_MAX_HEAP_SIZE);
+}
+
+/// Creates a copy of the specified heap.
+/// @param heap Min-max heap data structure.
+/// @param copy Function pointer to create a deep or shallow copy of each element in heap.
+/// @return Copy of specified heap.
+static inline min_max_heap_s copy_min_max_heap(const min_max_heap_s heap, const copy_min_max_heap_fn copy) {
+    MIN_MAX_HEAP_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+
+    MIN_MAX_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap.size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    min_max_heap_s replica = {
+        .elements = MIN_MAX_HEAP_ALLOC(MIN_MAX_HEAP_SIZE * sizeof(MIN_MAX_HEAP_DATA_TYPE)),
+        .compare = heap.compare, .size = 0,
+    };
+    MIN_MAX_HEAP_ASSERT(replica.elements && "[ERROR] Memory allocation failed.");
+
+    for (replica.size = 0; replica.size < heap.size; replica.size++) {
+        replica.elements[replica.size] = copy(heap.elements[replica.size]);
+    }
+
+    return replica;
+}
+
+/// Iterates over each element in heap in in array index order.
+/// @param heap Min-max heap data structure.
+/// @param operate Function pointer to operate on each element in heap using generic argumenst.
+/// @param args Generic void pointer arguments for operate function pointer.
+static inline void foreach_min_max_heap(const min_max_heap_s heap, const operate_min_max_heap_fn operate, void * args) {
+    MIN_MAX_HEAP_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    MIN_MAX_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap.size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // for each element in heap call operate function pointer on it until each element was operated successfully
+    for (MIN_MAX_HEAP_DATA_TYPE * e = heap.elements; (e < heap.elements + heap.size) && operate(e, args); e++) {}
+}
+
+/// Maps heap element into array to manage.
+/// @param heap Min-max heap data structure.
+/// @param manage Function pointer to manage array of heap elements using heap's size and generic arguments.
+/// @param args Generic void pointer arguments for manage function pointer.
+static inline void map_min_max_heap(const min_max_heap_s heap, const manage_min_max_heap_fn manage, void * args) {
+    MIN_MAX_HEAP_ASSERT(manage && "[ERROR] 'manage' parameter is NULL.");
+
+    MIN_MAX_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap.size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    manage(heap.elements, heap.size, args);
+}
+
+/// Pushes element onto heap.
+/// @param heap Min-max heap data structure.
+/// @param element Element to push into heap.
+static inline void push_min_max_heap(min_max_heap_s * heap, const MIN_MAX_HEAP_DATA_TYPE element) {
+    MIN_MAX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    MIN_MAX_HEAP_ASSERT(heap->size != MIN_MAX_HEAP_SIZE && "[ERROR] Can't push to full heap.");
+
+    MIN_MAX_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap->size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    size_t hole = heap->size;
+    heap->size++;
+
+    // hole is on a min level if its depth is even
+    bool min = true;
+    for (size_t n = hole + 1; n > 1; n >>= 1) {
+        min = !min;
+    }
+
+    // if element is on the wrong side of its parent, move parent into hole and continue from parent's level instead
+    if (hole) {
+        const size_t parent = (hole - 1) / 2;
+        const int comparison = heap->compare(element, heap->elements[parent]);
+        if (min ? comparison > 0 : comparison < 0) {
+            heap->elements[hole] = heap->elements[parent];
+            hole = parent;
+            min = !min;
+        }
+    }
+
+    // move hole up through grandparents on the same level kind while element comes before them
+    while (hole > 2) {
+        const size_t grandparent = (((hole - 1) / 2) - 1) / 2;
+        const int comparison = heap->compare(element, heap->elements[grandparent]);
+        if (min ? comparison >= 0 : comparison <= 0) {
+            break;
+        }
+
+        heap->elements[hole] = heap->elements[grandparent];
+        hole = grandparent;
+    }
+    memcpy(heap->elements + hole, &element, sizeof(MIN_MAX_HEAP_DATA_TYPE));
+}
+
+/// Pops and returns least element from heap.
+/// @param heap Min-max heap data structure.
+/// @return Least element in heap as specified by its compare function.
+static inline MIN_MAX_HEAP_DATA_TYPE pop_min_min_max_heap(min_max_heap_s * heap) {
+    MIN_MAX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    MIN_MAX_HEAP_ASSERT(heap->size && "[ERROR] Can't pop from empty heap.");
+
+    MIN_MAX_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap->size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // save root element and move hole left by it down min levels for last element
+    MIN_MAX_HEAP_DATA_TYPE removed = heap->elements[0];
+    heap->size--;
+    MIN_MAX_HEAP_DATA_TYPE last = heap->elements[heap->size];
+
+    size_t hole = 0;
+    while ((2 * hole) + 1 < heap->size) {
+        // find least among hole's children and grandchildren, grandchildren are continuous in array
+        size_t least = (2 * hole) + 1;
+        const size_t children_end = (least + 2) < heap->size ? (least + 2) : heap->size;
+        for (size_t child = least + 1; child < children_end; ++child) {
+            if (heap->compare(heap->elements[child], heap->elements[least]) < 0) {
+                least = child;
+            }
+        }
+        const size_t grandchild = (4 * hole) + 3;
+        const size_t grandchildren_end = (grandchild + 4) < heap->size ? (grandchild + 4) : heap->size;
+        for (size_t g = grandchild; g < grandchildren_end; ++g) {
+            if (heap->compare(heap->elements[g], heap->elements[least]) < 0) {
+                least = g;
+            }
+        }
+
+        // if least is not less than last element, then hole is properly set and thus break from loop
+        if (heap->compare(heap->elements[least], last) >= 0) {
+            break;
+        }
+
+        heap->elements[hole] = heap->elements[least];
+        hole = least;
+        if (least < grandchild) { // if least is a child then it has no descendants on min levels
+            break;
+        }
+
+        // last element must not be greater than least's parent on max level, else they exchange
+        const size_t parent = (least - 1) / 2;
+        if (heap->compare(last, heap->elements[parent]) > 0) {
+            MIN_MAX_HEAP_DATA_TYPE temporary = heap->elements[parent];
+            heap->elements[parent] = last;
+            last = temporary;
+        }
+    }
+    heap->elements[hole] = last;
+
+    return removed;
+}
+
+/// Pops and returns greatest element from heap.
+/// @param heap Min-max heap data structure.
+/// @return Greatest element in heap as specified by its compare function.
+static inline MIN_MAX_HEAP_DATA_TYPE pop_max_min_max_heap(min_max_heap_s * heap) {
+    MIN_MAX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    MIN_MAX_HEAP_ASSERT(heap->size && "[ERROR] Can't pop from empty heap.");
+
+    MIN_MAX_HEAP_ASSERT(heap->compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap->size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // greatest element is root's greater child, or root itself if it has none
+    size_t hole = 0;
+    if (heap->size > 1) {
+        hole = (heap->size > 2 && heap->compare(heap->elements[2], heap->elements[1]) > 0) ? 2 : 1;
+    }
+
+    // save greatest element and move hole left by it down max levels for last element
+    MIN_MAX_HEAP_DATA_TYPE removed = heap->elements[hole];
+    heap->size--;
+    MIN_MAX_HEAP_DATA_TYPE last = heap->elements[heap->size];
+    if (hole == heap->size) { // if greatest element was the last one then no element has to move
+        return removed;
+    }
+
+    while ((2 * hole) + 1 < heap->size) {
+        // find greatest among hole's children and grandchildren, grandchildren are continuous in array
+        size_t greatest = (2 * hole) + 1;
+        const size_t children_end = (greatest + 2) < heap->size ? (greatest + 2) : heap->size;
+        for (size_t child = greatest + 1; child < children_end; ++child) {
+            if (heap->compare(heap->elements[child], heap->elements[greatest]) > 0) {
+                greatest = child;
+            }
+        }
+        const size_t grandchild = (4 * hole) + 3;
+        const size_t grandchildren_end = (grandchild + 4) < heap->size ? (grandchild + 4) : heap->size;
+        for (size_t g = grandchild; g < grandchildren_end; ++g) {
+            if (heap->compare(heap->elements[g], heap->elements[greatest]) > 0) {
+                greatest = g;
+            }
+        }
+
+        // if greatest is not greater than last element, then hole is properly set and thus break from loop
+        if (heap->compare(heap->elements[greatest], last) <= 0) {
+            break;
+        }
+
+        heap->elements[hole] = heap->elements[greatest];
+        hole = greatest;
+        if (greatest < grandchild) { // if greatest is a child then it has no descendants on max levels
+            break;
+        }
+
+        // last element must not be less than greatest's parent on min level, else they exchange
+        const size_t parent = (greatest - 1) / 2;
+        if (heap->compare(last, heap->elements[parent]) < 0) {
+            MIN_MAX_HEAP_DATA_TYPE temporary = heap->elements[parent];
+            heap->elements[parent] = last;
+            last = temporary;
+        }
+    }
+    heap->elements[hole] = last;
+
+    return removed;
+}
+
+/// Returns least element in heap without removing it.
+/// @param heap Min-max heap data structure.
+/// @return Least element in heap as specified by its compare function.
+static inline MIN_MAX_HEAP_DATA_TYPE peep_min_min_max_heap(const min_max_heap_s heap) {
+    MIN_MAX_HEAP_ASSERT(heap.size && "[ERROR] Can't peep from empty heap.");
+
+    MIN_MAX_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap.size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return heap.elements[0];
+}
+
+/// Returns greatest element in heap without removing it.
+/// @param heap Min-max heap data structure.
+/// @return Greatest element in heap as specified by its compare function.
+static inline MIN_MAX_HEAP_DATA_TYPE peep_max_min_max_heap(const min_max_heap_s heap) {
+    MIN_MAX_HEAP_ASSERT(heap.size && "[ERROR] Can't peep from empty heap.");
+
+    MIN_MAX_HEAP_ASSERT(heap.compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(heap.size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // greatest element is root's greater child, or root itself if it has none
+    if (heap.size == 1) {
+        return heap.elements[0];
+    }
+    if (heap.size == 2 || heap.compare(heap.elements[1], heap.elements[2]) >= 0) {
+        return heap.elements[1];
+    }
+    return heap.elements[2];
+}
+
+/// Melds the source heap into the destination while keeping heap property.
+/// @param destination Destination min-max heap data structure.
+/// @param source Source min-max heap data structure.
+static inline void meld_min_max_heap(min_max_heap_s * restrict destination, min_max_heap_s * restrict source) {
+    MIN_MAX_HEAP_ASSERT(destination && "[ERROR] 'destination' parameter is NULL.");
+    MIN_MAX_HEAP_ASSERT(source && "[ERROR] 'source' parameter is NULL.");
+    MIN_MAX_HEAP_ASSERT(destination != source && "[ERROR] Heaps can't be the same.");
+    MIN_MAX_HEAP_ASSERT(destination->size + source->size <= MIN_MAX_HEAP_SIZE && "[ERROR] Merge will exceed maximum size.");
+    MIN_MAX_HEAP_ASSERT(destination->compare == source->compare && "[ERROR] Compare functions must be the same.");
+
+    MIN_MAX_HEAP_ASSERT(destination->compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(destination->size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(destination->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    MIN_MAX_HEAP_ASSERT(source->compare && "[ERROR] Invalid compare function pointer.");
+    MIN_MAX_HEAP_ASSERT(source->size <= MIN_MAX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    MIN_MAX_HEAP_ASSERT(source->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    for (size_t i = 0; i < source->size; ++i) {
+        push_min_max_heap(destination, source->elements[i]);
+    }
+    source->size = 0;
+}
+
+#endif // MIN_MAX_HEAP_H
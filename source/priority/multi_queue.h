@@ -0,0 +1,305 @@
+#ifndef MULTI_QUEUE_H
+#define MULTI_QUEUE_H
+
+/*
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+    For more information, please refer to <https://unlicense.org>
+*/
+
+#include <stddef.h>  // imports size_t
+#include <stdbool.h> // imports bool
+#include <stdint.h>  // imports uint64_t, uintptr_t
+
+#ifndef MULTI_QUEUE_DATA_TYPE
+// redefine using #define MULTI_QUEUE_DATA_TYPE [type]
+#   define MULTI_QUEUE_DATA_TYPE void*
+#endif
+
+#ifndef MULTI_QUEUE_ASSERT
+#   include <assert.h>  // imports assert for debugging
+// redefine using #define MULTI_QUEUE_DATA_TYPE [assert]
+#   define MULTI_QUEUE_ASSERT assert
+#endif
+
+#if !defined(MULTI_QUEUE_ALLOC) && !defined(MULTI_QUEUE_FREE)
+#   include <stdlib.h>
+#   define MULTI_QUEUE_ALLOC malloc
+#   define MULTI_QUEUE_FREE free
+#elif !defined(MULTI_QUEUE_ALLOC)
+#   error Must also define MULTI_QUEUE_ALLOC.
+#elif !defined(MULTI_QUEUE_FREE)
+#   error Must also define MULTI_QUEUE_FREE.
+#endif
+
+#ifndef MULTI_QUEUE_COUNT
+// redefine using #define MULTI_QUEUE_COUNT [shard count], usually a small multiple of the number of threads
+#   define MULTI_QUEUE_COUNT 8
+#elif MULTI_QUEUE_COUNT < 2
+#   error Count must be at least two.
+#endif
+
+#ifndef MULTI_QUEUE_CACHE_LINE
+// redefine using #define MULTI_QUEUE_CACHE_LINE [line size in bytes], e.g. 128 for targets that prefetch line pairs
+#   define MULTI_QUEUE_CACHE_LINE 64
+#elif MULTI_QUEUE_CACHE_LINE <= 0 || (MULTI_QUEUE_CACHE_LINE & (MULTI_QUEUE_CACHE_LINE - 1))
+#   error Cache line size must be a power of two.
+#endif
+
+#if !defined(MULTI_QUEUE_LOCK_TYPE)
+#   include <pthread.h> // imports pthread_mutex_t
+#   define MULTI_QUEUE_LOCK_TYPE pthread_mutex_t
+#   define MULTI_QUEUE_LOCK_INIT(lock) pthread_mutex_init(lock, NULL)
+#   define MULTI_QUEUE_LOCK_DESTROY(lock) pthread_mutex_destroy(lock)
+#   define MULTI_QUEUE_LOCK(lock) pthread_mutex_lock(lock)
+#   define MULTI_QUEUE_TRY_LOCK(lock) (0 == pthread_mutex_trylock(lock))
+#   define MULTI_QUEUE_UNLOCK(lock) pthread_mutex_unlock(lock)
+#elif !defined(MULTI_QUEUE_LOCK_INIT) || !defined(MULTI_QUEUE_LOCK_DESTROY)
+#   error Must also define MULTI_QUEUE_LOCK_INIT and MULTI_QUEUE_LOCK_DESTROY.
+#elif !defined(MULTI_QUEUE_LOCK) || !defined(MULTI_QUEUE_TRY_LOCK) || !defined(MULTI_QUEUE_UNLOCK)
+#   error Must also define MULTI_QUEUE_LOCK, MULTI_QUEUE_TRY_LOCK and MULTI_QUEUE_UNLOCK.
+#endif
+
+// each shard is a binary heap of at most BINARY_HEAP_SIZE elements, if binary_heap.h was already included its data type must match
+#ifndef BINARY_HEAP_DATA_TYPE
+#   define BINARY_HEAP_DATA_TYPE MULTI_QUEUE_DATA_TYPE
+#endif
+#ifndef BINARY_HEAP_ASSERT
+#   define BINARY_HEAP_ASSERT MULTI_QUEUE_ASSERT
+#endif
+#include "binary_heap.h"
+
+/// Function pointer that destroys a deep element.
+typedef void (*destroy_multi_queue_fn) (MULTI_QUEUE_DATA_TYPE * element);
+/// 'less than', else a positive number if 'more than'.
+typedef int  (*compare_multi_queue_fn) (const MULTI_QUEUE_DATA_TYPE one, const MULTI_QUEUE_DATA_TYPE two);
+
+typedef struct multi_queue_shard {
+    binary_heap_s heap; // heap of shard's elements
+    MULTI_QUEUE_LOCK_TYPE lock; // lock that guards heap
+    // pads shard to a multiple of cache line size, thus threads locking neighbouring shards never share a line
+    char padding[MULTI_QUEUE_CACHE_LINE - (sizeof(struct { binary_heap_s heap; MULTI_QUEUE_LOCK_TYPE lock; }) % MULTI_QUEUE_CACHE_LINE)];
+} multi_queue_shard_s;
+
+/// @brief Relaxed concurrent priority queue, pops return one of the least elements instead of the exact least one.
+typedef struct multi_queue {
+    multi_queue_shard_s * shards; // array of MULTI_QUEUE_COUNT lock protected heaps, aligned to cache line
+    void * allocation; // unaligned memory that holds shards array and is freed on destroy
+    compare_multi_queue_fn compare; // compare function to push and pop shard heaps
+} multi_queue_s;
+
+/// Creates a multi queue data structure, must not be called concurrently with any other function on the same queue.
+/// @param compare Function pointer to compare elements for queue.
+/// @return New multi queue.
+static inline multi_queue_s create_multi_queue(const compare_multi_queue_fn compare) {
+    MULTI_QUEUE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+
+    MULTI_QUEUE_ASSERT(!(sizeof(multi_queue_shard_s) % MULTI_QUEUE_CACHE_LINE) && "[ERROR] Shard isn't padded to cache line.");
+
+    // allocate one extra line, since allocator only guarantees alignment for fundamental types, and round shards up to it
+    multi_queue_s queue = {
+        .allocation = MULTI_QUEUE_ALLOC((MULTI_QUEUE_COUNT * sizeof(multi_queue_shard_s)) + MULTI_QUEUE_CACHE_LINE - 1),
+        .compare = compare,
+    };
+    MULTI_QUEUE_ASSERT(queue.allocation && "[ERROR] Memory allocation failed.");
+
+    const uintptr_t address = (uintptr_t)(queue.allocation);
+    queue.shards = (multi_queue_shard_s*)((char*)(queue.allocation) + ((MULTI_QUEUE_CACHE_LINE - (address % MULTI_QUEUE_CACHE_LINE)) % MULTI_QUEUE_CACHE_LINE));
+
+    for (multi_queue_shard_s * s = queue.shards; s < queue.shards + MULTI_QUEUE_COUNT; s++) {
+        s->heap = create_binary_heap(compare);
+        MULTI_QUEUE_LOCK_INIT(&(s->lock));
+    }
+
+    return queue;
+}
+
+/// Destroys the queue and all its elements, must not be called concurrently with any other function on the same queue.
+/// @param queue Multi queue data structure.
+/// @param destroy Function pointer to destroy each element in queue.
+static inline void destroy_multi_queue(multi_queue_s * queue, const destroy_multi_queue_fn destroy) {
+    MULTI_QUEUE_ASSERT(queue && "[ERROR] 'queue' parameter is NULL.");
+    MULTI_QUEUE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    MULTI_QUEUE_ASSERT(queue->compare && "[ERROR] Invalid compare function pointer.");
+    MULTI_QUEUE_ASSERT(queue->shards && "[ERROR] 'shards' pointer is NULL.");
+
+    for (multi_queue_shard_s * s = queue->shards; s < queue->shards + MULTI_QUEUE_COUNT; s++) {
+        destroy_binary_heap(&(s->heap), destroy);
+        MULTI_QUEUE_LOCK_DESTROY(&(s->lock));
+    }
+
+    queue->compare = NULL;
+    MULTI_QUEUE_FREE(queue->allocation);
+    queue->allocation = NULL;
+    queue->shards = NULL;
+}
+
+/// Clears the queue and all its elements, locking one shard at a time.
+/// @param queue Multi queue data structure.
+/// @param destroy Function pointer to destroy each element in queue.
+static inline void clear_multi_queue(multi_queue_s * queue, const destroy_multi_queue_fn destroy) {
+    MULTI_QUEUE_ASSERT(queue && "[ERROR] 'queue' parameter is NULL.");
+    MULTI_QUEUE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    MULTI_QUEUE_ASSERT(queue->compare && "[ERROR] Invalid compare function pointer.");
+    MULTI_QUEUE_ASSERT(queue->shards && "[ERROR] 'shards' pointer is NULL.");
+
+    for (multi_queue_shard_s * s = queue->shards; s < queue->shards + MULTI_QUEUE_COUNT; s++) {
+        MULTI_QUEUE_LOCK(&(s->lock));
+        clear_binary_heap(&(s->heap), destroy);
+        MULTI_QUEUE_UNLOCK(&(s->lock));
+    }
+}
+
+/// Checks if queue is empty, locking one shard at a time, thus result is only a snapshot under concurrent pushes.
+/// @param queue Multi queue data structure.
+/// @return 'true' if every shard was empty when checked, 'false' otherwise.
+static inline bool is_empty_multi_queue(const multi_queue_s queue) {
+    MULTI_QUEUE_ASSERT(queue.compare && "[ERROR] Invalid compare function pointer.");
+    MULTI_QUEUE_ASSERT(queue.shards && "[ERROR] 'shards' pointer is NULL.");
+
+    for (multi_queue_shard_s * s = queue.shards; s < queue.shards + MULTI_QUEUE_COUNT; s++) {
+        MULTI_QUEUE_LOCK(&(s->lock));
+        const size_t size = s->heap.size;
+        MULTI_QUEUE_UNLOCK(&(s->lock));
+
+        if (size) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Pushes element into a random shard of queue, safe to call concurrently.
+/// @param queue Multi queue data structure.
+/// @param element Element to push into queue.
+/// @param seed Pointer to random generator state owned by the calling thread, any initial value is valid.
+static inline void push_multi_queue(multi_queue_s * queue, const MULTI_QUEUE_DATA_TYPE element, uint64_t * seed) {
+    MULTI_QUEUE_ASSERT(queue && "[ERROR] 'queue' parameter is NULL.");
+    MULTI_QUEUE_ASSERT(seed && "[ERROR] 'seed' parameter is NULL.");
+
+    MULTI_QUEUE_ASSERT(queue->compare && "[ERROR] Invalid compare function pointer.");
+    MULTI_QUEUE_ASSERT(queue->shards && "[ERROR] 'shards' pointer is NULL.");
+
+    // try random shards without waiting, since a contended shard is as good as any other for a push
+    for (size_t attempt = 0; attempt < MULTI_QUEUE_COUNT; ++attempt) {
+        (*seed) = ((*seed) * 6364136223846793005ULL) + 1442695040888963407ULL; // 64-bit LCG, upper bits are the random ones
+        multi_queue_shard_s * s = queue->shards + (size_t)(((*seed) >> 33) % MULTI_QUEUE_COUNT);
+
+        if (!MULTI_QUEUE_TRY_LOCK(&(s->lock))) {
+            continue;
+        }
+        if (s->heap.size != BINARY_HEAP_SIZE) {
+            push_binary_heap(&(s->heap), element);
+            MULTI_QUEUE_UNLOCK(&(s->lock));
+            return;
+        }
+        MULTI_QUEUE_UNLOCK(&(s->lock));
+    }
+
+    // every attempt was contended or full, thus wait on each shard in turn starting from a random one
+    const size_t start = (size_t)(((*seed) >> 33) % MULTI_QUEUE_COUNT);
+    for (size_t i = 0; i < MULTI_QUEUE_COUNT; ++i) {
+        multi_queue_shard_s * s = queue->shards + ((start + i) % MULTI_QUEUE_COUNT);
+
+        MULTI_QUEUE_LOCK(&(s->lock));
+        if (s->heap.size != BINARY_HEAP_SIZE) {
+            push_binary_heap(&(s->heap), element);
+            MULTI_QUEUE_UNLOCK(&(s->lock));
+            return;
+        }
+        MULTI_QUEUE_UNLOCK(&(s->lock));
+    }
+
+    MULTI_QUEUE_ASSERT(false && "[ERROR] Can't push to full queue.");
+}
+
+/// Pops the lesser of the least elements of two random shards, safe to call concurrently.
+/// @param queue Multi queue data structure.
+/// @param element Pointer to store popped element into.
+/// @param seed Pointer to random generator state owned by the calling thread, any initial value is valid.
+/// @return 'true' if an element was popped, 'false' if every shard was empty when checked.
+static inline bool pop_multi_queue(multi_queue_s * queue, MULTI_QUEUE_DATA_TYPE * element, uint64_t * seed) {
+    MULTI_QUEUE_ASSERT(queue && "[ERROR] 'queue' parameter is NULL.");
+    MULTI_QUEUE_ASSERT(element && "[ERROR] 'element' parameter is NULL.");
+    MULTI_QUEUE_ASSERT(seed && "[ERROR] 'seed' parameter is NULL.");
+
+    MULTI_QUEUE_ASSERT(queue->compare && "[ERROR] Invalid compare function pointer.");
+    MULTI_QUEUE_ASSERT(queue->shards && "[ERROR] 'shards' pointer is NULL.");
+
+    // sample two distinct shards without waiting, a contended pair is simply resampled
+    for (size_t attempt = 0; attempt < MULTI_QUEUE_COUNT; ++attempt) {
+        (*seed) = ((*seed) * 6364136223846793005ULL) + 1442695040888963407ULL; // 64-bit LCG, upper bits are the random ones
+        const size_t first = (size_t)(((*seed) >> 33) % MULTI_QUEUE_COUNT);
+        (*seed) = ((*seed) * 6364136223846793005ULL) + 1442695040888963407ULL;
+        const size_t second = (first + 1 + (size_t)(((*seed) >> 33) % (MULTI_QUEUE_COUNT - 1))) % MULTI_QUEUE_COUNT;
+
+        multi_queue_shard_s * one = queue->shards + first;
+        multi_queue_shard_s * two = queue->shards + second;
+        if (!MULTI_QUEUE_TRY_LOCK(&(one->lock))) {
+            continue;
+        }
+        if (!MULTI_QUEUE_TRY_LOCK(&(two->lock))) {
+            MULTI_QUEUE_UNLOCK(&(one->lock));
+            continue;
+        }
+
+        // take from the shard whose root comes first, or from whichever one isn't empty
+        multi_queue_shard_s * best = one->heap.size ? one : two;
+        if (one->heap.size && two->heap.size && queue->compare(two->heap.elements[0], one->heap.elements[0]) < 0) {
+            best = two;
+        }
+
+        const bool found = (best->heap.size != 0);
+        if (found) {
+            (*element) = pop_binary_heap(&(best->heap));
+        }
+        MULTI_QUEUE_UNLOCK(&(two->lock));
+        MULTI_QUEUE_UNLOCK(&(one->lock));
+
+        if (found) {
+            return true;
+        }
+    }
+
+    // sampling failed, thus wait on each shard in turn starting from a random one to not miss a lone element
+    const size_t start = (size_t)(((*seed) >> 33) % MULTI_QUEUE_COUNT);
+    for (size_t i = 0; i < MULTI_QUEUE_COUNT; ++i) {
+        multi_queue_shard_s * s = queue->shards + ((start + i) % MULTI_QUEUE_COUNT);
+
+        MULTI_QUEUE_LOCK(&(s->lock));
+        if (s->heap.size) {
+            (*element) = pop_binary_heap(&(s->heap));
+            MULTI_QUEUE_UNLOCK(&(s->lock));
+            return true;
+        }
+        MULTI_QUEUE_UNLOCK(&(s->lock));
+    }
+
+    return false;
+}
+
+#endif // MULTI_QUEUE_H
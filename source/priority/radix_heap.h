@@ -0,0 +1,378 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+/*
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+    For more information, please refer to <https://unlicense.org>
+*/
+
+#include <stddef.h>  // imports size_t
+#include <stdbool.h> // imports bool
+#include <string.h>  // imports memcpy
+#include <limits.h>  // imports CHAR_BIT
+
+#ifndef RADIX_HEAP_DATA_TYPE
+// redefine using #define RADIX_HEAP_DATA_TYPE [type]
+#   define RADIX_HEAP_DATA_TYPE void*
+#endif
+
+#ifndef RADIX_HEAP_KEY_TYPE
+// redefine using #define RADIX_HEAP_KEY_TYPE [unsigned type], its bit count must be a power of two
+#   define RADIX_HEAP_KEY_TYPE size_t
+#endif
+
+#ifndef RADIX_HEAP_ASSERT
+#   include <assert.h>  // imports assert for debugging
+// redefine using #define RADIX_HEAP_DATA_TYPE [assert]
+#   define RADIX_HEAP_ASSERT assert
+#endif
+
+#if !defined(RADIX_HEAP_ALLOC) && !defined(RADIX_HEAP_FREE)
+#   include <stdlib.h>
+#   define RADIX_HEAP_ALLOC malloc
+#   define RADIX_HEAP_FREE free
+#elif !defined(RADIX_HEAP_ALLOC)
+#   error Must also define RADIX_HEAP_ALLOC.
+#elif !defined(RADIX_HEAP_FREE)
+#   error Must also define RADIX_HEAP_FREE.
+#endif
+
+#ifndef RADIX_HEAP_SIZE
+#   define RADIX_HEAP_SIZE (1 << 10)
+#elif RADIX_HEAP_SIZE <= 0
+#   error Size cannot be zero.
+#endif
+
+// bucket zero holds keys equal to last popped minimum, bucket 'i' keys whose highest bit differing from it is bit 'i - 1'
+#define RADIX_HEAP_BUCKETS ((sizeof(RADIX_HEAP_KEY_TYPE) * CHAR_BIT) + 1)
+
+/// Function pointer that creates a deep element copy.
+typedef RADIX_HEAP_DATA_TYPE (*copy_radix_heap_fn)    (const RADIX_HEAP_DATA_TYPE element);
+/// Function pointer that destroys a deep element.
+typedef void                 (*destroy_radix_heap_fn) (RADIX_HEAP_DATA_TYPE * element);
+/// Function pointer that returns the unsigned integer priority key of an element, least key is popped first.
+typedef RADIX_HEAP_KEY_TYPE  (*key_radix_heap_fn)     (const RADIX_HEAP_DATA_TYPE element);
+/// Function pointer that changes an element pointer using void pointer arguments if needed. Returns true if operation should continue.
+typedef bool                 (*operate_radix_heap_fn) (RADIX_HEAP_DATA_TYPE * element, void * args);
+
+typedef struct radix_heap {
+    RADIX_HEAP_DATA_TYPE * elements; // elements array
+    RADIX_HEAP_KEY_TYPE * keys; // key of each element, saved so that redistributing a bucket doesn't call key function
+    size_t * next; // next element index in the same bucket or free list, 'RADIX_HEAP_SIZE' if there is none
+    size_t * heads; // first element index in each bucket, 'RADIX_HEAP_SIZE' if bucket is empty
+    key_radix_heap_fn key; // key function to push elements into buckets
+    size_t size, empty; // size of heap and first free element index
+    RADIX_HEAP_KEY_TYPE last; // last popped minimum key, pushed keys can't be less than it
+} radix_heap_s;
+
+/// Creates a radix heap data structure.
+/// @param key Function pointer to get unsigned integer key of elements.
+/// @return New radix heap.
+static inline radix_heap_s create_radix_heap(const key_radix_heap_fn key) {
+    RADIX_HEAP_ASSERT(key && "[ERROR] 'key' parameter is NULL.");
+
+    const radix_heap_s heap = {
+        .elements = RADIX_HEAP_ALLOC(RADIX_HEAP_SIZE * sizeof(RADIX_HEAP_DATA_TYPE)),
+        .keys = RADIX_HEAP_ALLOC(RADIX_HEAP_SIZE * sizeof(RADIX_HEAP_KEY_TYPE)),
+        .next = RADIX_HEAP_ALLOC(RADIX_HEAP_SIZE * sizeof(size_t)),
+        .heads = RADIX_HEAP_ALLOC(RADIX_HEAP_BUCKETS * sizeof(size_t)),
+        .key = key, .size = 0, .empty = 0, .last = 0,
+    };
+
+    RADIX_HEAP_ASSERT(heap.elements && "[ERROR] Memory allocation failed.");
+    RADIX_HEAP_ASSERT(heap.keys && "[ERROR] Memory allocation failed.");
+    RADIX_HEAP_ASSERT(heap.next && "[ERROR] Memory allocation failed.");
+    RADIX_HEAP_ASSERT(heap.heads && "[ERROR] Memory allocation failed.");
+
+    // every element index starts in free list and every bucket starts empty
+    for (size_t i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        heap.next[i] = i + 1;
+    }
+    for (size_t i = 0; i < RADIX_HEAP_BUCKETS; ++i) {
+        heap.heads[i] = RADIX_HEAP_SIZE;
+    }
+
+    return heap;
+}
+
+/// Destroys the heap and all its elements.
+/// @param heap Radix heap data structure.
+/// @param destroy Function pointer to destroy each element in heap.
+static inline void destroy_radix_heap(radix_heap_s * heap, const destroy_radix_heap_fn destroy) {
+    RADIX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    RADIX_HEAP_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    RADIX_HEAP_ASSERT(heap->key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap->size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // for each element in each bucket destroy it
+    for (size_t b = 0; b < RADIX_HEAP_BUCKETS; ++b) {
+        for (size_t i = heap->heads[b]; i != RADIX_HEAP_SIZE; i = heap->next[i]) {
+            destroy(heap->elements + i);
+        }
+    }
+
+    RADIX_HEAP_FREE(heap->elements);
+    RADIX_HEAP_FREE(heap->keys);
+    RADIX_HEAP_FREE(heap->next);
+    RADIX_HEAP_FREE(heap->heads);
+
+    heap->size = heap->empty = 0;
+    heap->last = 0;
+    heap->key = NULL;
+}
+
+/// Clears the heap and all its elements.
+/// @param heap Radix heap data structure.
+/// @param destroy Function pointer to destroy each element in heap.
+static inline void clear_radix_heap(radix_heap_s * heap, const destroy_radix_heap_fn destroy) {
+    RADIX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    RADIX_HEAP_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    RADIX_HEAP_ASSERT(heap->key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap->size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // for each element in each bucket destroy it and empty bucket
+    for (size_t b = 0; b < RADIX_HEAP_BUCKETS; ++b) {
+        for (size_t i = heap->heads[b]; i != RADIX_HEAP_SIZE; i = heap->next[i]) {
+            destroy(heap->elements + i);
+        }
+        heap->heads[b] = RADIX_HEAP_SIZE;
+    }
+
+    // put every element index back into free list
+    for (size_t i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        heap->next[i] = i + 1;
+    }
+
+    heap->size = heap->empty = 0;
+    heap->last = 0;
+}
+
+/// Checks if heap is empty.
+/// @param heap Radix heap data structure.
+/// @return 'true' if heap is empty, 'false' otherwise.
+static inline bool is_empty_radix_heap(const radix_heap_s heap) {
+    RADIX_HEAP_ASSERT(heap.key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap.size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return !(heap.size);
+}
+
+/// Checks if heap is full.
+/// @param heap Radix heap data structure.
+/// @return 'true' if heap is full, 'false' otherwise.
+static inline bool is_full_radix_heap(const radix_heap_s heap) {
+    RADIX_HEAP_ASSERT(heap.key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap.size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return (heap.size == RADIX_HEAP_SIZE);
+}
+
+/// Creates a copy of the specified heap.
+/// @param heap Radix heap data structure.
+/// @param copy Function pointer to create a deep or shallow copy of each element in heap.
+/// @return Copy of specified heap.
+static inline radix_heap_s copy_radix_heap(const radix_heap_s heap, const copy_radix_heap_fn copy) {
+    RADIX_HEAP_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+
+    RADIX_HEAP_ASSERT(heap.key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap.size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    const radix_heap_s replica = {
+        .elements = RADIX_HEAP_ALLOC(RADIX_HEAP_SIZE * sizeof(RADIX_HEAP_DATA_TYPE)),
+        .keys = RADIX_HEAP_ALLOC(RADIX_HEAP_SIZE * sizeof(RADIX_HEAP_KEY_TYPE)),
+        .next = RADIX_HEAP_ALLOC(RADIX_HEAP_SIZE * sizeof(size_t)),
+        .heads = RADIX_HEAP_ALLOC(RADIX_HEAP_BUCKETS * sizeof(size_t)),
+        .key = heap.key, .size = heap.size, .empty = heap.empty, .last = heap.last,
+    };
+
+    RADIX_HEAP_ASSERT(replica.elements && "[ERROR] Memory allocation failed.");
+    RADIX_HEAP_ASSERT(replica.keys && "[ERROR] Memory allocation failed.");
+    RADIX_HEAP_ASSERT(replica.next && "[ERROR] Memory allocation failed.");
+    RADIX_HEAP_ASSERT(replica.heads && "[ERROR] Memory allocation failed.");
+
+    // replica keeps the same bucket lists, thus only elements in them must be copied
+    memcpy(replica.keys, heap.keys, RADIX_HEAP_SIZE * sizeof(RADIX_HEAP_KEY_TYPE));
+    memcpy(replica.next, heap.next, RADIX_HEAP_SIZE * sizeof(size_t));
+    memcpy(replica.heads, heap.heads, RADIX_HEAP_BUCKETS * sizeof(size_t));
+    for (size_t b = 0; b < RADIX_HEAP_BUCKETS; ++b) {
+        for (size_t i = heap.heads[b]; i != RADIX_HEAP_SIZE; i = heap.next[i]) {
+            replica.elements[i] = copy(heap.elements[i]);
+        }
+    }
+
+    return replica;
+}
+
+/// Iterates over each element in heap in bucket order.
+/// @param heap Radix heap data structure.
+/// @param operate Function pointer to operate on each element in heap using generic argumenst.
+/// @param args Generic void pointer arguments for operate function pointer.
+/// @note Operate function must not change element's key.
+static inline void foreach_radix_heap(const radix_heap_s heap, const operate_radix_heap_fn operate, void * args) {
+    RADIX_HEAP_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    RADIX_HEAP_ASSERT(heap.key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap.size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // for each element in each bucket call operate function pointer on it until each element was operated successfully
+    for (size_t b = 0; b < RADIX_HEAP_BUCKETS; ++b) {
+        for (size_t i = heap.heads[b]; i != RADIX_HEAP_SIZE; i = heap.next[i]) {
+            if (!operate(heap.elements + i, args)) {
+                return;
+            }
+        }
+    }
+}
+
+// bucket is the bit length of key's difference from last popped minimum, found by halving the searched bit width
+static inline size_t bucket_radix_heap(const RADIX_HEAP_KEY_TYPE key, const RADIX_HEAP_KEY_TYPE last) {
+    RADIX_HEAP_KEY_TYPE difference = key ^ last;
+    size_t bucket = difference ? 1 : 0;
+    for (size_t shift = (sizeof(RADIX_HEAP_KEY_TYPE) * CHAR_BIT) / 2; shift; shift /= 2) {
+        if (difference >> shift) {
+            difference >>= shift;
+            bucket += shift;
+        }
+    }
+
+    return bucket;
+}
+
+/// Pushes element onto heap.
+/// @param heap Radix heap data structure.
+/// @param element Element to push into heap, its key can't be less than last popped minimum.
+static inline void push_radix_heap(radix_heap_s * heap, const RADIX_HEAP_DATA_TYPE element) {
+    RADIX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    RADIX_HEAP_ASSERT(heap->size != RADIX_HEAP_SIZE && "[ERROR] Can't push to full heap.");
+
+    RADIX_HEAP_ASSERT(heap->key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap->size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    const RADIX_HEAP_KEY_TYPE key = heap->key(element);
+    RADIX_HEAP_ASSERT(key >= heap->last && "[ERROR] Key is less than last popped minimum.");
+
+    const size_t bucket = bucket_radix_heap(key, heap->last);
+
+    // take first free index and link it as bucket's head
+    const size_t index = heap->empty;
+    heap->empty = heap->next[index];
+
+    memcpy(heap->elements + index, &element, sizeof(RADIX_HEAP_DATA_TYPE));
+    heap->keys[index] = key;
+    heap->next[index] = heap->heads[bucket];
+    heap->heads[bucket] = index;
+
+    heap->size++;
+}
+
+/// Pops and returns element with least key from heap.
+/// @param heap Radix heap data structure.
+/// @return Element with least key in heap.
+static inline RADIX_HEAP_DATA_TYPE pop_radix_heap(radix_heap_s * heap) {
+    RADIX_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+    RADIX_HEAP_ASSERT(heap->size && "[ERROR] Can't pop from empty heap.");
+
+    RADIX_HEAP_ASSERT(heap->key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap->size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    if (heap->heads[0] == RADIX_HEAP_SIZE) { // if no key equals last minimum then redistribute first non-empty bucket
+        size_t bucket = 1;
+        while (heap->heads[bucket] == RADIX_HEAP_SIZE) {
+            bucket++;
+        }
+
+        // bucket's least key becomes the new last minimum
+        size_t minimum = heap->heads[bucket];
+        for (size_t i = heap->next[minimum]; i != RADIX_HEAP_SIZE; i = heap->next[i]) {
+            if (heap->keys[i] < heap->keys[minimum]) {
+                minimum = i;
+            }
+        }
+        heap->last = heap->keys[minimum];
+
+        // relink every element in bucket into lower buckets, since their highest differing bit is now lower
+        size_t i = heap->heads[bucket];
+        heap->heads[bucket] = RADIX_HEAP_SIZE;
+        while (i != RADIX_HEAP_SIZE) {
+            const size_t next = heap->next[i];
+
+            const size_t lower = bucket_radix_heap(heap->keys[i], heap->last);
+            heap->next[i] = heap->heads[lower];
+            heap->heads[lower] = i;
+            i = next;
+        }
+    }
+
+    // unlink head of bucket zero and put its index into free list
+    const size_t index = heap->heads[0];
+    heap->heads[0] = heap->next[index];
+    heap->next[index] = heap->empty;
+    heap->empty = index;
+
+    heap->size--;
+    return heap->elements[index];
+}
+
+/// Returns element with least key in heap without removing it.
+/// @param heap Radix heap data structure.
+/// @return Element with least key in heap.
+static inline RADIX_HEAP_DATA_TYPE peep_radix_heap(const radix_heap_s heap) {
+    RADIX_HEAP_ASSERT(heap.size && "[ERROR] Can't peep from empty heap.");
+
+    RADIX_HEAP_ASSERT(heap.key && "[ERROR] Invalid key function pointer.");
+    RADIX_HEAP_ASSERT(heap.size <= RADIX_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    RADIX_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    if (heap.heads[0] != RADIX_HEAP_SIZE) { // if a key equals last minimum then it is the least key
+        return heap.elements[heap.heads[0]];
+    }
+
+    // else least key is in first non-empty bucket, since every key in it is less than keys in higher buckets
+    size_t bucket = 1;
+    while (heap.heads[bucket] == RADIX_HEAP_SIZE) {
+        bucket++;
+    }
+
+    size_t minimum = heap.heads[bucket];
+    for (size_t i = heap.next[minimum]; i != RADIX_HEAP_SIZE; i = heap.next[i]) {
+        if (heap.keys[i] < heap.keys[minimum]) {
+            minimum = i;
+        }
+    }
+
+    return heap.elements[minimum];
+}
+
+#endif // RADIX_HEAP_H
@@ -30,7 +30,7 @@
 
 #include <stddef.h>  // imports size_t
 #include <stdbool.h> // imports bool
-#include <string.h>  // imports memcpy
+#include <string.h>  // imports memcpy and memmove
 
 #ifndef SORT_HEAP_DATA_TYPE
 // redefine using #define SORT_HEAP_DATA_TYPE [type]
@@ -59,6 +59,24 @@
 #   error Size cannot be zero.
 #endif
 
+#ifdef SORT_HEAP_RADIX_KEY
+#   include <stdint.h> // imports fixed width unsigned integers for radix keys
+#   ifndef SORT_HEAP_RADIX_KEY_TYPE
+// redefine using #define SORT_HEAP_RADIX_KEY_TYPE [unsigned type], narrower keys need fewer radix sort passes
+#       define SORT_HEAP_RADIX_KEY_TYPE uint64_t
+#   endif
+// radix sort is used in place of 'sort' function pointer calls, thus the pointer is ignored and may be NULL
+#   define SORT_HEAP_SORT(heap) radix_sort_heap(heap)
+#   define SORT_HEAP_SORT_ASSERT(expression)
+#else
+// redefine using #define SORT_HEAP_RADIX_KEY(element) [unsigned key expression] to sort with built-in LSD radix sort
+#   define SORT_HEAP_SORT(heap) (heap)->sort((heap)->elements + (heap)->current, (heap)->size, (heap)->args)
+#   define SORT_HEAP_SORT_ASSERT(expression) SORT_HEAP_ASSERT(expression)
+#endif
+
+// define SORT_HEAP_COMPARE(one, two) as compare expression with same order as sort function to keep pushed elements in a
+// binary heap behind sorted run, thus sort is only called once the run is exhausted instead of after every push
+
 /// Function pointer that creates a deep element copy.
 typedef SORT_HEAP_DATA_TYPE (*copy_sort_heap_fn)    (const SORT_HEAP_DATA_TYPE element);
 /// Function pointer that destroys a deep element.
@@ -75,6 +93,12 @@ typedef struct sort_heap {
     manage_sort_heap_fn sort; // sorts the elements array when needed
     void * args; // compare function pointer parameters for sort, if needed
     size_t size, current; // size and current first element index
+#ifdef SORT_HEAP_RADIX_KEY
+    SORT_HEAP_DATA_TYPE * buffer; // scratch array radix sort scatters elements into, reused by every sort
+#endif
+#ifdef SORT_HEAP_COMPARE
+    size_t sorted; // length of sorted run at current index, remaining elements after it form a binary heap
+#endif
     bool valid;
 } sort_heap_s;
 
@@ -83,13 +107,22 @@ typedef struct sort_heap {
 /// @param args Generic void pointer arguments for sort function.
 /// @return New sort heap.
 static inline sort_heap_s create_sort_heap(const manage_sort_heap_fn sort, void * args) {
-    SORT_HEAP_ASSERT(sort && "[ERROR] 'sort' parameter is NULL.");
+    SORT_HEAP_SORT_ASSERT(sort && "[ERROR] 'sort' parameter is NULL.");
 
     const sort_heap_s heap = {
         .elements = SORT_HEAP_ALLOC(SORT_HEAP_SIZE * sizeof(SORT_HEAP_DATA_TYPE)),
         .sort = sort, .args = args, .size = 0, .current = 0, .valid = true,
+#ifdef SORT_HEAP_RADIX_KEY
+        .buffer = SORT_HEAP_ALLOC(SORT_HEAP_SIZE * sizeof(SORT_HEAP_DATA_TYPE)),
+#endif
+#ifdef SORT_HEAP_COMPARE
+        .sorted = 0,
+#endif
     };
     SORT_HEAP_ASSERT(heap.elements && "[ERROR] Memory allocation failed.");
+#ifdef SORT_HEAP_RADIX_KEY
+    SORT_HEAP_ASSERT(heap.buffer && "[ERROR] Memory allocation failed.");
+#endif
 
     return heap;
 }
@@ -101,7 +134,7 @@ static inline void destroy_sort_heap(sort_heap_s * heap, const destroy_sort_heap
     SORT_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
     SORT_HEAP_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
 
-    SORT_HEAP_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
@@ -113,8 +146,14 @@ static inline void destroy_sort_heap(sort_heap_s * heap, const destroy_sort_heap
     heap->args = NULL;
     heap->sort = NULL;
     heap->current = heap->size = 0;
+#ifdef SORT_HEAP_COMPARE
+    heap->sorted = 0;
+#endif
     heap->valid = true;
     SORT_HEAP_FREE(heap->elements);
+#ifdef SORT_HEAP_RADIX_KEY
+    SORT_HEAP_FREE(heap->buffer);
+#endif
 }
 
 /// Clears the heap and all its elements.
@@ -124,7 +163,7 @@ static inline void clear_sort_heap(sort_heap_s * heap, const destroy_sort_heap_f
     SORT_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
     SORT_HEAP_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
 
-    SORT_HEAP_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
@@ -133,6 +172,9 @@ static inline void clear_sort_heap(sort_heap_s * heap, const destroy_sort_heap_f
         destroy(e);
     }
     heap->current = heap->size = 0;
+#ifdef SORT_HEAP_COMPARE
+    heap->sorted = 0;
+#endif
     heap->valid = true;
 }
 
@@ -140,7 +182,7 @@ static inline void clear_sort_heap(sort_heap_s * heap, const destroy_sort_heap_f
 /// @param heap Sort heap data structure.
 /// @return 'true' if heap is empty, 'false' otherwise.
 static inline bool is_empty_sort_heap(const sort_heap_s heap) {
-    SORT_HEAP_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap.size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
 
@@ -151,7 +193,7 @@ static inline bool is_empty_sort_heap(const sort_heap_s heap) {
 /// @param heap Sort heap data structure.
 /// @return 'true' if heap is full, 'false' otherwise.
 static inline bool is_full_sort_heap(const sort_heap_s heap) {
-    SORT_HEAP_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap.size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
 
@@ -165,15 +207,24 @@ static inline bool is_full_sort_heap(const sort_heap_s heap) {
 static inline sort_heap_s copy_sort_heap(const sort_heap_s heap, const copy_sort_heap_fn copy) {
     SORT_HEAP_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
 
-    SORT_HEAP_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap.size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
 
     sort_heap_s replica = {
         .elements = SORT_HEAP_ALLOC(SORT_HEAP_SIZE * sizeof(SORT_HEAP_DATA_TYPE)),
         .sort = heap.sort, .args = heap.args, .size = 0, .current = 0, .valid = heap.valid,
+#ifdef SORT_HEAP_RADIX_KEY
+        .buffer = SORT_HEAP_ALLOC(SORT_HEAP_SIZE * sizeof(SORT_HEAP_DATA_TYPE)),
+#endif
+#ifdef SORT_HEAP_COMPARE
+        .sorted = heap.sorted,
+#endif
     };
     SORT_HEAP_ASSERT(replica.elements && "[ERROR] Memory allocation failed.");
+#ifdef SORT_HEAP_RADIX_KEY
+    SORT_HEAP_ASSERT(replica.buffer && "[ERROR] Memory allocation failed.");
+#endif
 
     // copy elements from heap into replica, but starting from replica's zeroth element in array
     for (replica.size = 0; replica.size < heap.size; replica.size++) {
@@ -190,7 +241,7 @@ static inline sort_heap_s copy_sort_heap(const sort_heap_s heap, const copy_sort
 static inline void foreach_sort_heap(const sort_heap_s heap, const operate_sort_heap_fn operate, void * args) {
     SORT_HEAP_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    SORT_HEAP_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap.size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
 
@@ -205,13 +256,107 @@ static inline void foreach_sort_heap(const sort_heap_s heap, const operate_sort_
 static inline void map_sort_heap(const sort_heap_s heap, const manage_sort_heap_fn manage, void * args) {
     SORT_HEAP_ASSERT(manage && "[ERROR] 'manage' parameter is NULL.");
 
-    SORT_HEAP_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap.sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap.size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap.elements && "[ERROR] 'elements' pointer is NULL.");
 
     manage(heap.elements + heap.current, heap.size, args);
 }
 
+#ifdef SORT_HEAP_RADIX_KEY
+/// Converts a signed 32 bit integer into an unsigned radix key with the same order.
+/// @param key Signed integer key.
+/// @return Unsigned radix key.
+static inline uint32_t int32_radix_key_sort_heap(const int32_t key) {
+    return (uint32_t)(key) ^ (UINT32_C(1) << 31); // flip sign bit so that negative keys come before positive ones
+}
+
+/// Converts a signed 64 bit integer into an unsigned radix key with the same order.
+/// @param key Signed integer key.
+/// @return Unsigned radix key.
+static inline uint64_t int64_radix_key_sort_heap(const int64_t key) {
+    return (uint64_t)(key) ^ (UINT64_C(1) << 63); // flip sign bit so that negative keys come before positive ones
+}
+
+/// Converts an IEEE 754 single precision float into an unsigned radix key with the same order.
+/// @param key Float key, NaNs are ordered past infinities.
+/// @return Unsigned radix key.
+static inline uint32_t float_radix_key_sort_heap(const float key) {
+    uint32_t bits = 0;
+    memcpy(&bits, &key, sizeof(bits));
+
+    // negative floats have all bits flipped to reverse their magnitude order, positive ones only the sign bit
+    return (bits & (UINT32_C(1) << 31)) ? ~bits : bits | (UINT32_C(1) << 31);
+}
+
+/// Converts an IEEE 754 double precision float into an unsigned radix key with the same order.
+/// @param key Double key, NaNs are ordered past infinities.
+/// @return Unsigned radix key.
+static inline uint64_t double_radix_key_sort_heap(const double key) {
+    uint64_t bits = 0;
+    memcpy(&bits, &key, sizeof(bits));
+
+    // negative doubles have all bits flipped to reverse their magnitude order, positive ones only the sign bit
+    return (bits & (UINT64_C(1) << 63)) ? ~bits : bits | (UINT64_C(1) << 63);
+}
+
+/// Sorts heap elements in ascending SORT_HEAP_RADIX_KEY order using least significant digit radix sort.
+/// @param heap Sort heap data structure.
+/// @note Called in place of 'sort' function pointer, but can also be used to sort heap directly.
+static inline void radix_sort_heap(sort_heap_s * heap) {
+    SORT_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
+
+    SORT_HEAP_ASSERT(heap->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
+    SORT_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
+    SORT_HEAP_ASSERT(heap->buffer && "[ERROR] 'buffer' pointer is NULL.");
+
+    if (heap->size < 2) { // zero or one element is always sorted
+        return;
+    }
+
+    // count each byte digit for every pass in a single read over all elements
+    size_t counts[sizeof(SORT_HEAP_RADIX_KEY_TYPE)][1 << 8] = { 0 };
+    SORT_HEAP_DATA_TYPE * source = heap->elements + heap->current;
+    for (size_t i = 0; i < heap->size; ++i) {
+        const SORT_HEAP_RADIX_KEY_TYPE key = SORT_HEAP_RADIX_KEY(source[i]);
+        for (size_t d = 0; d < sizeof(SORT_HEAP_RADIX_KEY_TYPE); ++d) {
+            counts[d][(key >> (d * 8)) & 0xFF]++;
+        }
+    }
+
+    // scatter elements stably by each digit from least to most significant, swapping source and buffer between passes
+    SORT_HEAP_DATA_TYPE * destination = heap->buffer;
+    for (size_t d = 0; d < sizeof(SORT_HEAP_RADIX_KEY_TYPE); ++d) {
+        // if every key has the same digit then pass won't change order and can be skipped
+        if (heap->size == counts[d][(SORT_HEAP_RADIX_KEY(source[0]) >> (d * 8)) & 0xFF]) {
+            continue;
+        }
+
+        // turn digit counts into starting indexes of each digit in destination
+        size_t offset = 0;
+        for (size_t b = 0; b < (1 << 8); ++b) {
+            const size_t count = counts[d][b];
+            counts[d][b] = offset;
+            offset += count;
+        }
+
+        for (size_t i = 0; i < heap->size; ++i) {
+            const SORT_HEAP_RADIX_KEY_TYPE key = SORT_HEAP_RADIX_KEY(source[i]);
+            destination[counts[d][(key >> (d * 8)) & 0xFF]++] = source[i];
+        }
+
+        SORT_HEAP_DATA_TYPE * temporary = source;
+        source = destination;
+        destination = temporary;
+    }
+
+    // if last pass ended in buffer copy sorted elements back into heap
+    if (source == heap->buffer) {
+        memcpy(heap->elements + heap->current, heap->buffer, heap->size * sizeof(SORT_HEAP_DATA_TYPE));
+    }
+}
+#endif
+
 /// Pushes element onto heap.
 /// @param heap Sort heap data structure.
 /// @param element Element to push into heap.
@@ -219,10 +364,40 @@ static inline void push_sort_heap(sort_heap_s * heap, const SORT_HEAP_DATA_TYPE
     SORT_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
     SORT_HEAP_ASSERT(heap->size != SORT_HEAP_SIZE && "[ERROR] Can't push to full heap.");
 
-    SORT_HEAP_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
+#ifdef SORT_HEAP_COMPARE
+    if (heap->valid) {
+        // element not greater than sorted run's head is prepended to the run
+        if (heap->current && (!heap->sorted || SORT_HEAP_COMPARE(element, heap->elements[heap->current]) <= 0)) {
+            heap->current--;
+            memcpy(heap->elements + heap->current, &element, sizeof(SORT_HEAP_DATA_TYPE));
+            heap->sorted++;
+            heap->size++;
+            return;
+        }
+
+        // if there is no room behind the last element move all elements to array's start
+        if (heap->current + heap->size == SORT_HEAP_SIZE) {
+            memmove(heap->elements, heap->elements + heap->current, heap->size * sizeof(SORT_HEAP_DATA_TYPE));
+            heap->current = 0;
+        }
+
+        // else push element into binary heap waiting behind sorted run by moving a hole up from its end
+        SORT_HEAP_DATA_TYPE * waiting = heap->elements + heap->current + heap->sorted;
+        size_t hole = heap->size - heap->sorted;
+        for (size_t parent = (hole - 1) / 2; hole && SORT_HEAP_COMPARE(element, waiting[parent]) < 0; parent = (hole - 1) / 2) {
+            waiting[hole] = waiting[parent];
+            hole = parent;
+        }
+        memcpy(waiting + hole, &element, sizeof(SORT_HEAP_DATA_TYPE));
+        heap->size++;
+        return;
+    }
+#endif
+
     SORT_HEAP_DATA_TYPE * current_element = heap->current ? heap->elements + (--(heap->current)) : heap->elements + heap->size;
     memcpy(current_element, &element, sizeof(SORT_HEAP_DATA_TYPE));
 
@@ -237,17 +412,57 @@ static inline SORT_HEAP_DATA_TYPE pop_sort_heap(sort_heap_s * heap) {
     SORT_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
     SORT_HEAP_ASSERT(heap->size && "[ERROR] Can't pop from empty heap.");
 
-    SORT_HEAP_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
+#ifdef SORT_HEAP_COMPARE
+    if (!heap->valid || !heap->sorted) { // if heap is invalid or sorted run is exhausted then sort all waiting elements
+        SORT_HEAP_SORT(heap);
+        heap->sorted = heap->size;
+    }
+    heap->valid = true;
+
+    SORT_HEAP_DATA_TYPE * waiting = heap->elements + heap->current + heap->sorted;
+    size_t waiting_size = heap->size - heap->sorted;
+    if (!waiting_size || SORT_HEAP_COMPARE(heap->elements[heap->current], waiting[0]) <= 0) { // if run's head is least then pop it
+        heap->sorted--;
+        heap->size--;
+        return heap->elements[heap->current++];
+    }
+
+    // else pop waiting binary heap's root and move hole left by it down for its last element
+    SORT_HEAP_DATA_TYPE removed = waiting[0];
+    waiting_size--;
+    heap->size--;
+
+    SORT_HEAP_DATA_TYPE last = waiting[waiting_size];
+    size_t hole = 0;
+    for (size_t child = 1; child < waiting_size; child = (2 * hole) + 1) {
+        // if right child is a valid index and it is smaller than left child change left child to right one
+        if ((child + 1) < waiting_size && SORT_HEAP_COMPARE(waiting[child], waiting[child + 1]) > 0) {
+            child++;
+        }
+        // if child is greater, then hole is properly set and thus break from loop
+        if (SORT_HEAP_COMPARE(waiting[child], last) > 0) {
+            break;
+        }
+
+        waiting[hole] = waiting[child];
+        hole = child;
+    }
+    waiting[hole] = last;
+
+    return removed;
+#else
     if (!heap->valid) { // if heap is not sorted then sort it
-        heap->sort(heap->elements + heap->current, heap->size, heap->args);
+        SORT_HEAP_SORT(heap);
     }
 
     heap->valid = true; // validate that the heap is sorted
     heap->size--;
     return heap->elements[heap->current++]; // return removed head element by incrementing current after returning it
+#endif
 }
 
 /// Returns root element in heap without removing it.
@@ -257,16 +472,31 @@ static inline SORT_HEAP_DATA_TYPE peep_sort_heap(sort_heap_s * heap) {
     SORT_HEAP_ASSERT(heap && "[ERROR] 'heap' parameter is NULL.");
     SORT_HEAP_ASSERT(heap->size && "[ERROR] Can't pop from empty heap.");
 
-    SORT_HEAP_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
+#ifdef SORT_HEAP_COMPARE
+    if (!heap->valid || !heap->sorted) { // if heap is invalid or sorted run is exhausted then sort all waiting elements
+        SORT_HEAP_SORT(heap);
+        heap->sorted = heap->size;
+    }
+    heap->valid = true;
+
+    // return lesser of sorted run's head and waiting binary heap's root
+    const size_t waiting = heap->current + heap->sorted;
+    if (heap->size == heap->sorted || SORT_HEAP_COMPARE(heap->elements[heap->current], heap->elements[waiting]) <= 0) {
+        return heap->elements[heap->current];
+    }
+    return heap->elements[waiting];
+#else
     if (!heap->valid) { // if heap is not sorted then sort it
-        heap->sort(heap->elements + heap->current, heap->size, heap->args);
+        SORT_HEAP_SORT(heap);
     }
 
     heap->valid = true; // validate that the heap is sorted and return head element without removing it
     return heap->elements[heap->current];
+#endif
 }
 
 /// Replace the element at elements array index in heap while maintaining sort heap property.
@@ -279,13 +509,20 @@ static inline SORT_HEAP_DATA_TYPE replace_sort_heap(sort_heap_s * heap, const si
     SORT_HEAP_ASSERT(heap->size && "[ERROR] Can't pop from empty heap.");
     SORT_HEAP_ASSERT(index < heap->size && "[ERROR] Index out of heap size bounds.");
 
-    SORT_HEAP_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
+#ifdef SORT_HEAP_COMPARE
+    if (!heap->valid || heap->sorted != heap->size) { // index is in sort order, thus waiting elements must be sorted too
+        SORT_HEAP_SORT(heap);
+        heap->sorted = heap->size;
+    }
+#else
     if (!heap->valid) { // if heap is not sorted then sort it
-        heap->sort(heap->elements + heap->current, heap->size, heap->args);
+        SORT_HEAP_SORT(heap);
     }
+#endif
 
     // temporar save replaced/removed head element to not loose it
     SORT_HEAP_DATA_TYPE removed = heap->elements[heap->current + index];
@@ -308,11 +545,11 @@ static inline void meld_sort_heap(sort_heap_s * restrict destination, sort_heap_
     SORT_HEAP_ASSERT(destination->args == source->args && "[ERROR] Compare functions must be the same.");
     SORT_HEAP_ASSERT(destination->sort == source->sort && "[ERROR] Compare functions must be the same.");
 
-    SORT_HEAP_ASSERT(destination->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(destination->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(destination->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(destination->elements && "[ERROR] 'elements' pointer is NULL.");
 
-    SORT_HEAP_ASSERT(source->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(source->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(source->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(source->elements && "[ERROR] 'elements' pointer is NULL.");
 
@@ -329,6 +566,9 @@ static inline void meld_sort_heap(sort_heap_s * restrict destination, sort_heap_
 
     // clear source
     source->size = source->current = 0;
+#ifdef SORT_HEAP_COMPARE
+    source->sorted = 0;
+#endif
     source->valid = true;
 }
 
@@ -337,11 +577,14 @@ static inline void meld_sort_heap(sort_heap_s * restrict destination, sort_heap_
 /// @note Only call this function in the case of an event that breaks the heap properties by modifying its elements,
 /// like foreach and map.
 static inline void patch_sort_heap(sort_heap_s * heap) {
-    SORT_HEAP_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
+    SORT_HEAP_SORT_ASSERT(heap->sort && "[ERROR] Invalid sort function pointer.");
     SORT_HEAP_ASSERT(heap->size <= SORT_HEAP_SIZE && "[ERROR] Invalid heap size.");
     SORT_HEAP_ASSERT(heap->elements && "[ERROR] 'elements' pointer is NULL.");
 
-    heap->sort(heap->elements + heap->current, heap->size, heap->args);
+    SORT_HEAP_SORT(heap);
+#ifdef SORT_HEAP_COMPARE
+    heap->sorted = heap->size;
+#endif
     heap->valid = true;
 }
 
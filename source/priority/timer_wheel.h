@@ -0,0 +1,486 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+/*
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+    For more information, please refer to <https://unlicense.org>
+*/
+
+#include <stddef.h>  // imports size_t
+#include <stdbool.h> // imports bool
+#include <string.h>  // imports memcpy
+#include <limits.h>  // imports CHAR_BIT
+#include <stdint.h>  // imports SIZE_MAX
+
+#ifndef TIMER_WHEEL_DATA_TYPE
+// redefine using #define TIMER_WHEEL_DATA_TYPE [type]
+#   define TIMER_WHEEL_DATA_TYPE void*
+#endif
+
+#ifndef TIMER_WHEEL_TIME_TYPE
+// redefine using #define TIMER_WHEEL_TIME_TYPE [unsigned type] for ticks
+#   define TIMER_WHEEL_TIME_TYPE size_t
+#endif
+
+#ifndef TIMER_WHEEL_ASSERT
+#   include <assert.h>  // imports assert for debugging
+// redefine using #define TIMER_WHEEL_DATA_TYPE [assert]
+#   define TIMER_WHEEL_ASSERT assert
+#endif
+
+#if !defined(TIMER_WHEEL_ALLOC) && !defined(TIMER_WHEEL_FREE)
+#   include <stdlib.h>
+#   define TIMER_WHEEL_ALLOC malloc
+#   define TIMER_WHEEL_FREE free
+#elif !defined(TIMER_WHEEL_ALLOC)
+#   error Must also define TIMER_WHEEL_ALLOC.
+#elif !defined(TIMER_WHEEL_FREE)
+#   error Must also define TIMER_WHEEL_FREE.
+#endif
+
+#ifndef TIMER_WHEEL_SIZE
+#   define TIMER_WHEEL_SIZE (1 << 10)
+#elif TIMER_WHEEL_SIZE <= 0
+#   error Size cannot be zero.
+#endif
+
+#ifndef TIMER_WHEEL_SLOT_BITS
+// redefine using #define TIMER_WHEEL_SLOT_BITS [bits], each wheel has '1 << TIMER_WHEEL_SLOT_BITS' slots
+#   define TIMER_WHEEL_SLOT_BITS 6
+#elif TIMER_WHEEL_SLOT_BITS <= 0
+#   error Slot bits cannot be zero.
+#endif
+
+#ifndef TIMER_WHEEL_LEVELS
+// redefine using #define TIMER_WHEEL_LEVELS [count], later deadlines wait in an overflow list until wheels wrap around
+#   define TIMER_WHEEL_LEVELS 5
+#elif TIMER_WHEEL_LEVELS <= 0
+#   error Levels cannot be zero.
+#endif
+
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+// slot lists of every level are followed by overflow list and by list of timers that are being expired
+#define TIMER_WHEEL_OVERFLOW (TIMER_WHEEL_SLOTS * TIMER_WHEEL_LEVELS)
+#define TIMER_WHEEL_EXPIRING (TIMER_WHEEL_OVERFLOW + 1)
+#define TIMER_WHEEL_LISTS (TIMER_WHEEL_EXPIRING + 1)
+
+/// Function pointer that creates a deep element copy.
+typedef TIMER_WHEEL_DATA_TYPE (*copy_timer_wheel_fn)    (const TIMER_WHEEL_DATA_TYPE element);
+/// Function pointer that destroys a deep element.
+typedef void                  (*destroy_timer_wheel_fn) (TIMER_WHEEL_DATA_TYPE * element);
+/// Function pointer that handles an expired timer's element using void pointer arguments if needed.
+typedef void                  (*expire_timer_wheel_fn)  (TIMER_WHEEL_DATA_TYPE * element, void * args);
+
+typedef struct timer_wheel {
+    TIMER_WHEEL_DATA_TYPE * elements; // elements array
+    TIMER_WHEEL_TIME_TYPE * deadlines; // deadline tick of each timer
+    // current handle of each timer, its multiple of 'TIMER_WHEEL_SIZE' is a generation that grows whenever timer is freed
+    size_t * handles;
+    // circular lists of timers, indexes from 'TIMER_WHEEL_SIZE' onwards are list heads, free timers point to themselves
+    size_t * next;
+    size_t * prev;
+    size_t size, empty; // size of wheel and first free timer index
+    TIMER_WHEEL_TIME_TYPE current; // next tick to expire, all earlier deadlines have expired
+} timer_wheel_s;
+
+/// Creates a timer wheel data structure.
+/// @param now Tick that the wheel starts at.
+/// @return New timer wheel.
+static inline timer_wheel_s create_timer_wheel(const TIMER_WHEEL_TIME_TYPE now) {
+    // slot bit groups of every level and the overflow group above them must fit into time type, else ticks shift out of range
+    TIMER_WHEEL_ASSERT(TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS < sizeof(TIMER_WHEEL_TIME_TYPE) * CHAR_BIT && "[ERROR] Levels and slot bits exceed time type.");
+
+    const timer_wheel_s wheel = {
+        .elements = TIMER_WHEEL_ALLOC(TIMER_WHEEL_SIZE * sizeof(TIMER_WHEEL_DATA_TYPE)),
+        .deadlines = TIMER_WHEEL_ALLOC(TIMER_WHEEL_SIZE * sizeof(TIMER_WHEEL_TIME_TYPE)),
+        .handles = TIMER_WHEEL_ALLOC(TIMER_WHEEL_SIZE * sizeof(size_t)),
+        .next = TIMER_WHEEL_ALLOC((TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS) * sizeof(size_t)),
+        .prev = TIMER_WHEEL_ALLOC((TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS) * sizeof(size_t)),
+        .size = 0, .empty = 0, .current = now,
+    };
+
+    TIMER_WHEEL_ASSERT(wheel.elements && "[ERROR] Memory allocation failed.");
+    TIMER_WHEEL_ASSERT(wheel.deadlines && "[ERROR] Memory allocation failed.");
+    TIMER_WHEEL_ASSERT(wheel.handles && "[ERROR] Memory allocation failed.");
+    TIMER_WHEEL_ASSERT(wheel.next && "[ERROR] Memory allocation failed.");
+    TIMER_WHEEL_ASSERT(wheel.prev && "[ERROR] Memory allocation failed.");
+
+    // every timer starts in free list, which uses next indexes only, and every list head starts empty
+    for (size_t i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        wheel.next[i] = i + 1;
+        wheel.prev[i] = i;
+        wheel.handles[i] = i;
+    }
+    for (size_t i = TIMER_WHEEL_SIZE; i < TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS; ++i) {
+        wheel.next[i] = wheel.prev[i] = i;
+    }
+
+    return wheel;
+}
+
+/// Destroys the wheel and all its elements.
+/// @param wheel Timer wheel data structure.
+/// @param destroy Function pointer to destroy each element in wheel.
+static inline void destroy_timer_wheel(timer_wheel_s * wheel, const destroy_timer_wheel_fn destroy) {
+    TIMER_WHEEL_ASSERT(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    TIMER_WHEEL_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    TIMER_WHEEL_ASSERT(wheel->size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // for each timer in each list destroy its element
+    for (size_t l = TIMER_WHEEL_SIZE; l < TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS; ++l) {
+        for (size_t i = wheel->next[l]; i != l; i = wheel->next[i]) {
+            destroy(wheel->elements + i);
+        }
+    }
+
+    TIMER_WHEEL_FREE(wheel->elements);
+    TIMER_WHEEL_FREE(wheel->deadlines);
+    TIMER_WHEEL_FREE(wheel->handles);
+    TIMER_WHEEL_FREE(wheel->next);
+    TIMER_WHEEL_FREE(wheel->prev);
+
+    wheel->size = wheel->empty = 0;
+    wheel->current = 0;
+}
+
+// returns timer's handle of next generation, generation wraps around before handle overflows, thus handle always
+// keeps timer index as its remainder
+static inline size_t generation_timer_wheel(const size_t handle, const size_t timer) {
+    return handle <= SIZE_MAX - TIMER_WHEEL_SIZE ? handle + TIMER_WHEEL_SIZE : timer;
+}
+
+// puts timer into free list and moves its handle to next generation, thus handles of freed timer become stale
+static inline void free_timer_wheel(timer_wheel_s * wheel, const size_t timer) {
+    wheel->prev[timer] = timer;
+    wheel->next[timer] = wheel->empty;
+    wheel->empty = timer;
+
+    wheel->handles[timer] = generation_timer_wheel(wheel->handles[timer], timer);
+}
+
+// checks if handle is the current handle of a scheduled timer
+static inline bool valid_timer_wheel(const timer_wheel_s wheel, const size_t handle) {
+    const size_t timer = handle % TIMER_WHEEL_SIZE;
+    return wheel.handles[timer] == handle && wheel.prev[timer] != timer;
+}
+
+/// Clears the wheel and all its elements.
+/// @param wheel Timer wheel data structure.
+/// @param destroy Function pointer to destroy each element in wheel.
+static inline void clear_timer_wheel(timer_wheel_s * wheel, const destroy_timer_wheel_fn destroy) {
+    TIMER_WHEEL_ASSERT(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    TIMER_WHEEL_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    TIMER_WHEEL_ASSERT(wheel->size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // for each timer in each list destroy its element and make its handle stale
+    for (size_t l = TIMER_WHEEL_SIZE; l < TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS; ++l) {
+        for (size_t i = wheel->next[l]; i != l; i = wheel->next[i]) {
+            destroy(wheel->elements + i);
+            wheel->handles[i] = generation_timer_wheel(wheel->handles[i], i);
+        }
+    }
+
+    // put every timer back into free list and empty every list, current tick is kept
+    for (size_t i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        wheel->next[i] = i + 1;
+        wheel->prev[i] = i;
+    }
+    for (size_t i = TIMER_WHEEL_SIZE; i < TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS; ++i) {
+        wheel->next[i] = wheel->prev[i] = i;
+    }
+
+    wheel->size = wheel->empty = 0;
+}
+
+/// Checks if wheel is empty.
+/// @param wheel Timer wheel data structure.
+/// @return 'true' if wheel is empty, 'false' otherwise.
+static inline bool is_empty_timer_wheel(const timer_wheel_s wheel) {
+    TIMER_WHEEL_ASSERT(wheel.size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return !(wheel.size);
+}
+
+/// Checks if wheel is full.
+/// @param wheel Timer wheel data structure.
+/// @return 'true' if wheel is full, 'false' otherwise.
+static inline bool is_full_timer_wheel(const timer_wheel_s wheel) {
+    TIMER_WHEEL_ASSERT(wheel.size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return (wheel.size == TIMER_WHEEL_SIZE);
+}
+
+/// Creates a copy of the specified wheel, timers keep their handles.
+/// @param wheel Timer wheel data structure.
+/// @param copy Function pointer to create a deep or shallow copy of each element in wheel.
+/// @return Copy of specified wheel.
+static inline timer_wheel_s copy_timer_wheel(const timer_wheel_s wheel, const copy_timer_wheel_fn copy) {
+    TIMER_WHEEL_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+
+    TIMER_WHEEL_ASSERT(wheel.size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    const timer_wheel_s replica = {
+        .elements = TIMER_WHEEL_ALLOC(TIMER_WHEEL_SIZE * sizeof(TIMER_WHEEL_DATA_TYPE)),
+        .deadlines = TIMER_WHEEL_ALLOC(TIMER_WHEEL_SIZE * sizeof(TIMER_WHEEL_TIME_TYPE)),
+        .handles = TIMER_WHEEL_ALLOC(TIMER_WHEEL_SIZE * sizeof(size_t)),
+        .next = TIMER_WHEEL_ALLOC((TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS) * sizeof(size_t)),
+        .prev = TIMER_WHEEL_ALLOC((TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS) * sizeof(size_t)),
+        .size = wheel.size, .empty = wheel.empty, .current = wheel.current,
+    };
+
+    TIMER_WHEEL_ASSERT(replica.elements && "[ERROR] Memory allocation failed.");
+    TIMER_WHEEL_ASSERT(replica.deadlines && "[ERROR] Memory allocation failed.");
+    TIMER_WHEEL_ASSERT(replica.handles && "[ERROR] Memory allocation failed.");
+    TIMER_WHEEL_ASSERT(replica.next && "[ERROR] Memory allocation failed.");
+    TIMER_WHEEL_ASSERT(replica.prev && "[ERROR] Memory allocation failed.");
+
+    // replica keeps the same lists, thus only elements in them must be copied
+    memcpy(replica.deadlines, wheel.deadlines, TIMER_WHEEL_SIZE * sizeof(TIMER_WHEEL_TIME_TYPE));
+    memcpy(replica.handles, wheel.handles, TIMER_WHEEL_SIZE * sizeof(size_t));
+    memcpy(replica.next, wheel.next, (TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS) * sizeof(size_t));
+    memcpy(replica.prev, wheel.prev, (TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS) * sizeof(size_t));
+    for (size_t l = TIMER_WHEEL_SIZE; l < TIMER_WHEEL_SIZE + TIMER_WHEEL_LISTS; ++l) {
+        for (size_t i = wheel.next[l]; i != l; i = wheel.next[i]) {
+            replica.elements[i] = copy(wheel.elements[i]);
+        }
+    }
+
+    return replica;
+}
+
+// level is the highest slot bit group where deadline differs from current tick, levels above every wheel use overflow
+static inline size_t level_timer_wheel(const TIMER_WHEEL_TIME_TYPE deadline, const TIMER_WHEEL_TIME_TYPE current) {
+    TIMER_WHEEL_TIME_TYPE difference = deadline ^ current;
+    size_t level = 0;
+    for (difference >>= TIMER_WHEEL_SLOT_BITS; difference; difference >>= TIMER_WHEEL_SLOT_BITS) {
+        level++;
+    }
+
+    return level;
+}
+
+// list head of tick's slot in level, or overflow list head if level is above every wheel
+static inline size_t list_timer_wheel(const size_t level, const TIMER_WHEEL_TIME_TYPE tick) {
+    return TIMER_WHEEL_SIZE + (level < TIMER_WHEEL_LEVELS ?
+        (level * TIMER_WHEEL_SLOTS) + ((tick >> (level * TIMER_WHEEL_SLOT_BITS)) & (TIMER_WHEEL_SLOTS - 1)) :
+        TIMER_WHEEL_OVERFLOW);
+}
+
+/// Schedules element to expire at deadline tick.
+/// @param wheel Timer wheel data structure.
+/// @param deadline Tick to expire element at, passed deadlines expire on next advance.
+/// @param element Element to schedule.
+/// @return Handle of scheduled timer, valid until it expires or is cancelled, after which it never matches a later timer
+/// unless the timer's generation wraps around.
+static inline size_t schedule_timer_wheel(timer_wheel_s * wheel, const TIMER_WHEEL_TIME_TYPE deadline, const TIMER_WHEEL_DATA_TYPE element) {
+    TIMER_WHEEL_ASSERT(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    TIMER_WHEEL_ASSERT(wheel->size != TIMER_WHEEL_SIZE && "[ERROR] Can't schedule in full wheel.");
+
+    TIMER_WHEEL_ASSERT(wheel->size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // take first free timer
+    const size_t timer = wheel->empty;
+    wheel->empty = wheel->next[timer];
+
+    memcpy(wheel->elements + timer, &element, sizeof(TIMER_WHEEL_DATA_TYPE));
+    wheel->deadlines[timer] = deadline < wheel->current ? wheel->current : deadline;
+
+    const size_t list = list_timer_wheel(level_timer_wheel(wheel->deadlines[timer], wheel->current), wheel->deadlines[timer]);
+
+    // link timer as list's last
+    wheel->next[timer] = list;
+    wheel->prev[timer] = wheel->prev[list];
+    wheel->next[wheel->prev[list]] = timer;
+    wheel->prev[list] = timer;
+
+    wheel->size++;
+
+    return wheel->handles[timer];
+}
+
+/// Checks if handle belongs to a scheduled timer that hasn't expired or been cancelled.
+/// @param wheel Timer wheel data structure.
+/// @param handle Handle of timer.
+/// @return 'true' if timer is scheduled, 'false' otherwise.
+static inline bool is_scheduled_timer_wheel(const timer_wheel_s wheel, const size_t handle) {
+    TIMER_WHEEL_ASSERT(wheel.size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return valid_timer_wheel(wheel, handle);
+}
+
+/// Cancels scheduled timer and returns its element.
+/// @param wheel Timer wheel data structure.
+/// @param handle Handle of scheduled timer.
+/// @return Element of cancelled timer.
+static inline TIMER_WHEEL_DATA_TYPE cancel_timer_wheel(timer_wheel_s * wheel, const size_t handle) {
+    TIMER_WHEEL_ASSERT(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    TIMER_WHEEL_ASSERT(valid_timer_wheel(*wheel, handle) && "[ERROR] Timer isn't scheduled.");
+
+    TIMER_WHEEL_ASSERT(wheel->size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    // unlink timer from its list, list heads make this independent of the list
+    const size_t timer = handle % TIMER_WHEEL_SIZE;
+    wheel->next[wheel->prev[timer]] = wheel->next[timer];
+    wheel->prev[wheel->next[timer]] = wheel->prev[timer];
+
+    free_timer_wheel(wheel, timer);
+    wheel->size--;
+
+    return wheel->elements[timer];
+}
+
+/// Returns deadline tick of scheduled timer.
+/// @param wheel Timer wheel data structure.
+/// @param handle Handle of scheduled timer.
+/// @return Deadline of timer.
+static inline TIMER_WHEEL_TIME_TYPE get_deadline_timer_wheel(const timer_wheel_s wheel, const size_t handle) {
+    TIMER_WHEEL_ASSERT(valid_timer_wheel(wheel, handle) && "[ERROR] Timer isn't scheduled.");
+
+    TIMER_WHEEL_ASSERT(wheel.size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel.elements && "[ERROR] 'elements' pointer is NULL.");
+
+    return wheel.deadlines[handle % TIMER_WHEEL_SIZE];
+}
+
+/// Advances wheel up to and including tick now, expiring every timer with a passed deadline.
+/// @param wheel Timer wheel data structure.
+/// @param now Tick to advance to, must be before the last tick that time type can hold.
+/// @param expire Function pointer called with each expired timer's element, it may schedule or cancel timers.
+/// @param args Generic void pointer arguments for expire function pointer.
+/// @note Timers expire in deadline order, those with the same deadline together as one batch.
+static inline void advance_timer_wheel(timer_wheel_s * wheel, const TIMER_WHEEL_TIME_TYPE now, const expire_timer_wheel_fn expire, void * args) {
+    TIMER_WHEEL_ASSERT(wheel && "[ERROR] 'wheel' parameter is NULL.");
+    TIMER_WHEEL_ASSERT(expire && "[ERROR] 'expire' parameter is NULL.");
+    // current tick is set one past now, thus the last representable tick can't be advanced to
+    TIMER_WHEEL_ASSERT(now != (TIMER_WHEEL_TIME_TYPE)(-1) && "[ERROR] Can't advance to last tick.");
+
+    TIMER_WHEEL_ASSERT(wheel->size <= TIMER_WHEEL_SIZE && "[ERROR] Invalid wheel size.");
+    TIMER_WHEEL_ASSERT(wheel->elements && "[ERROR] 'elements' pointer is NULL.");
+
+    while (wheel->current <= now) {
+        if (!wheel->size) { // if there are no timers then nothing can expire up to now
+            wheel->current = now + 1;
+            break;
+        }
+
+        // skip to next tick that expires a level zero slot or cascades a higher level slot, each level's next event
+        // comes before next wrap around of the level above it, thus levels are searched from lowest, but a wrapped
+        // around tick may have to cascade slots and is always processed
+        bool found = !(wheel->current & (TIMER_WHEEL_SLOTS - 1));
+        for (size_t l = 0; l < TIMER_WHEEL_LEVELS && !found; ++l) {
+            const TIMER_WHEEL_TIME_TYPE groups = wheel->current >> (l * TIMER_WHEEL_SLOT_BITS);
+            size_t slot = groups & (TIMER_WHEEL_SLOTS - 1);
+            if (wheel->current != (groups << (l * TIMER_WHEEL_SLOT_BITS))) { // if lower groups aren't zero then slot was cascaded
+                slot++;
+            }
+
+            for (; slot < TIMER_WHEEL_SLOTS; ++slot) {
+                const size_t list = TIMER_WHEEL_SIZE + (l * TIMER_WHEEL_SLOTS) + slot;
+                if (wheel->next[list] != list) {
+                    wheel->current = (((groups >> TIMER_WHEEL_SLOT_BITS) << TIMER_WHEEL_SLOT_BITS) + slot) << (l * TIMER_WHEEL_SLOT_BITS);
+                    found = true;
+                    break;
+                }
+            }
+        }
+
+        if (!found) { // else only overflow list has timers, thus skip to next wrap around of every level
+            const TIMER_WHEEL_TIME_TYPE groups = (wheel->current >> ((TIMER_WHEEL_LEVELS - 1) * TIMER_WHEEL_SLOT_BITS)) >> TIMER_WHEEL_SLOT_BITS;
+            const TIMER_WHEEL_TIME_TYPE wrap = (groups << TIMER_WHEEL_SLOT_BITS) << ((TIMER_WHEEL_LEVELS - 1) * TIMER_WHEEL_SLOT_BITS);
+            if (wheel->current != wrap) {
+                wheel->current = ((groups + 1) << TIMER_WHEEL_SLOT_BITS) << ((TIMER_WHEEL_LEVELS - 1) * TIMER_WHEEL_SLOT_BITS);
+            }
+        }
+
+        if (wheel->current > now) { // if next event is after now then nothing expires up to now
+            wheel->current = now + 1;
+            break;
+        }
+
+        // find highest level whose lower slot bit groups all wrapped around to zero, overflow is above every level
+        size_t level = 0;
+        for (TIMER_WHEEL_TIME_TYPE lower = wheel->current; level < TIMER_WHEEL_LEVELS && !(lower & (TIMER_WHEEL_SLOTS - 1)); lower >>= TIMER_WHEEL_SLOT_BITS) {
+            level++;
+        }
+
+        // cascade current slot of each wrapped level from highest to lowest, rescheduled timers only fall into lower levels
+        for (; level; --level) {
+            const size_t list = list_timer_wheel(level, wheel->current);
+
+            // detach whole list, then relink each of its timers until detached last one that still points to list head
+            size_t timer = wheel->next[list];
+            wheel->next[list] = wheel->prev[list] = list;
+            while (timer != list) {
+                const size_t next = wheel->next[timer];
+
+                const size_t destination = list_timer_wheel(level_timer_wheel(wheel->deadlines[timer], wheel->current), wheel->deadlines[timer]);
+
+                wheel->next[timer] = destination;
+                wheel->prev[timer] = wheel->prev[destination];
+                wheel->next[wheel->prev[destination]] = timer;
+                wheel->prev[destination] = timer;
+
+                timer = next;
+            }
+        }
+
+        // splice current tick's level zero slot into expiring list as a batch, and move current tick past it, thus expire
+        // can schedule timers without them landing in the batch and can cancel timers that are still in it
+        const size_t list = list_timer_wheel(0, wheel->current);
+        const size_t expiring = TIMER_WHEEL_SIZE + TIMER_WHEEL_EXPIRING;
+        if (wheel->next[list] != list) {
+            wheel->next[expiring] = wheel->next[list];
+            wheel->prev[expiring] = wheel->prev[list];
+            wheel->prev[wheel->next[expiring]] = wheel->next[wheel->prev[expiring]] = expiring;
+            wheel->next[list] = wheel->prev[list] = list;
+        }
+        wheel->current++;
+
+        while (wheel->next[expiring] != expiring) {
+            // unlink first timer and free it before calling expire, thus expire can reuse it while its element is a copy
+            const size_t timer = wheel->next[expiring];
+            TIMER_WHEEL_DATA_TYPE element = wheel->elements[timer];
+            wheel->next[expiring] = wheel->next[timer];
+            wheel->prev[wheel->next[timer]] = expiring;
+
+            free_timer_wheel(wheel, timer);
+            wheel->size--;
+
+            expire(&element, args);
+        }
+    }
+}
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,734 @@
+#ifndef AVL_MAP_H
+#define AVL_MAP_H
+
+/*
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+    For more information, please refer to <https://unlicense.org>
+*/
+
+#include <stddef.h>  // imports size_t
+#include <stdbool.h> // imports bool
+#include <string.h>  // imports memcpy
+
+#ifndef AVL_MAP_KEY_TYPE
+// redefine using #define AVL_MAP_KEY_TYPE [type]
+#   define AVL_MAP_KEY_TYPE void*
+#endif
+
+#ifndef AVL_MAP_VALUE_TYPE
+// redefine using #define AVL_MAP_VALUE_TYPE [type]
+#   define AVL_MAP_VALUE_TYPE void*
+#endif
+
+#ifndef AVL_MAP_ASSERT
+#   include <assert.h>  // imports assert for debugging
+// redefine using #define AVL_MAP_KEY_TYPE [assert]
+#   define AVL_MAP_ASSERT assert
+#endif
+
+#if !defined(AVL_MAP_ALLOC) && !defined(AVL_MAP_FREE)
+#   include <stdlib.h>
+#   define AVL_MAP_ALLOC malloc
+#   define AVL_MAP_FREE free
+#elif !defined(AVL_MAP_ALLOC)
+#   error Must also define AVL_MAP_ALLOC.
+#elif !defined(AVL_MAP_FREE)
+#   error Must also define AVL_MAP_FREE.
+#endif
+
+#ifndef AVL_MAP_SIZE
+#   define AVL_MAP_SIZE (1 << 10)
+#elif AVL_MAP_SIZE <= 0
+#   error Size cannot be zero.
+#endif
+
+#ifndef AVL_MAP_INDEX_TYPE
+// redefine using #define AVL_MAP_INDEX_TYPE [unsigned type], e.g. uint32_t to halve node size if size allows it
+#   define AVL_MAP_INDEX_TYPE size_t
+#endif
+
+/// Function pointer that creates a deep key copy.
+typedef AVL_MAP_KEY_TYPE   (*copy_key_avl_map_fn)      (const AVL_MAP_KEY_TYPE key);
+/// Function pointer that creates a deep value copy.
+typedef AVL_MAP_VALUE_TYPE (*copy_value_avl_map_fn)    (const AVL_MAP_VALUE_TYPE value);
+/// Function pointer that destroys a deep key.
+typedef void               (*destroy_key_avl_map_fn)   (AVL_MAP_KEY_TYPE * key);
+/// Function pointer that destroys a deep value.
+typedef void               (*destroy_value_avl_map_fn) (AVL_MAP_VALUE_TYPE * value);
+/// Function pointer that compares two keys and returns zero if equal, a negative number if 'less than', else a positive number if 'more than'.
+typedef int                (*compare_avl_map_fn)       (const AVL_MAP_KEY_TYPE one, const AVL_MAP_KEY_TYPE two);
+/// Function pointer that changes a value of a read-only key using void pointer arguments if needed. Returns 'false' if foreach loop should break.
+typedef bool               (*operate_avl_map_fn)       (AVL_MAP_KEY_TYPE const * key, AVL_MAP_VALUE_TYPE * value, void * args);
+
+#define AVL_MAP_CHILD_COUNT 2
+#define AVL_MAP_LEFT  0
+#define AVL_MAP_RIGHT 1
+typedef struct avl_map_node {
+    AVL_MAP_INDEX_TYPE child[AVL_MAP_CHILD_COUNT], parent;
+} avl_map_node_s;
+
+typedef struct avl_map {
+    compare_avl_map_fn compare;
+    AVL_MAP_KEY_TYPE * keys;
+    AVL_MAP_VALUE_TYPE * values;
+    avl_map_node_s * nodes;
+    unsigned char * heights;
+    size_t size;
+    AVL_MAP_INDEX_TYPE root;
+} avl_map_s;
+
+/// Key and value pair returned on removal, so that the caller can destroy both.
+typedef struct avl_map_pair {
+    AVL_MAP_KEY_TYPE key;
+    AVL_MAP_VALUE_TYPE value;
+} avl_map_pair_s;
+
+static inline avl_map_s create_avl_map(const compare_avl_map_fn compare) {
+    AVL_MAP_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+    AVL_MAP_ASSERT((AVL_MAP_INDEX_TYPE)(AVL_MAP_SIZE) == AVL_MAP_SIZE && "[ERROR] 'AVL_MAP_INDEX_TYPE' can't hold map size.");
+
+    // initialize and allocate memory for map
+    const avl_map_s map = {
+        .keys = AVL_MAP_ALLOC(AVL_MAP_SIZE * sizeof(AVL_MAP_KEY_TYPE)),
+        .values = AVL_MAP_ALLOC(AVL_MAP_SIZE * sizeof(AVL_MAP_VALUE_TYPE)),
+        .nodes = AVL_MAP_ALLOC(AVL_MAP_SIZE * sizeof(avl_map_node_s)),
+        .heights = AVL_MAP_ALLOC(AVL_MAP_SIZE * sizeof(unsigned char)),
+        .size = 0, .compare = compare, .root = AVL_MAP_SIZE,
+    };
+
+    // check if memory allocation succeeded
+    AVL_MAP_ASSERT(map.keys && "[ERROR] Memory allocation failed.");
+    AVL_MAP_ASSERT(map.values && "[ERROR] Memory allocation failed.");
+    AVL_MAP_ASSERT(map.nodes && "[ERROR] Memory allocation failed.");
+    AVL_MAP_ASSERT(map.heights && "[ERROR] Memory allocation failed.");
+
+    return map;
+}
+
+static inline void destroy_avl_map(avl_map_s * map, const destroy_key_avl_map_fn destroy_key, const destroy_value_avl_map_fn destroy_value) {
+    AVL_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+    AVL_MAP_ASSERT(destroy_key && "[ERROR] 'destroy_key' parameter is NULL.");
+    AVL_MAP_ASSERT(destroy_value && "[ERROR] 'destroy_value' parameter is NULL.");
+
+    AVL_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map->size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // for each key and value in map arrays call destroy functions
+    for (size_t i = 0; i < map->size; ++i) {
+        destroy_key(map->keys + i);
+        destroy_value(map->values + i);
+    }
+
+    // free allocated memory
+    AVL_MAP_FREE(map->keys);
+    AVL_MAP_FREE(map->values);
+    AVL_MAP_FREE(map->nodes);
+    AVL_MAP_FREE(map->heights);
+
+    // set pointers to NULL
+    map->keys = NULL;
+    map->values = NULL;
+    map->nodes = NULL;
+    map->heights = NULL;
+
+    // other cleanup stuff
+    map->root = AVL_MAP_SIZE;
+    map->compare = NULL;
+    map->size = 0;
+}
+
+static inline void clear_avl_map(avl_map_s * map, const destroy_key_avl_map_fn destroy_key, const destroy_value_avl_map_fn destroy_value) {
+    AVL_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+    AVL_MAP_ASSERT(destroy_key && "[ERROR] 'destroy_key' parameter is NULL.");
+    AVL_MAP_ASSERT(destroy_value && "[ERROR] 'destroy_value' parameter is NULL.");
+
+    AVL_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map->size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // since the keys and values are continuosly in arrays just iterate through each and call destroy on them
+    for (size_t i = 0; i < map->size; ++i) {
+        destroy_key(map->keys + i);
+        destroy_value(map->values + i);
+    }
+
+    // clearing cleanup
+    map->root = AVL_MAP_SIZE;
+    map->size = 0;
+}
+
+static inline avl_map_s copy_avl_map(const avl_map_s map, const copy_key_avl_map_fn copy_key, const copy_value_avl_map_fn copy_value) {
+    AVL_MAP_ASSERT(copy_key && "[ERROR] 'copy_key' parameter is NULL.");
+    AVL_MAP_ASSERT(copy_value && "[ERROR] 'copy_value' parameter is NULL.");
+
+    AVL_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map.size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // create replica/copy to return
+    const avl_map_s replica = {
+        .compare = map.compare, .root = map.root, .size = map.size,
+        .keys = AVL_MAP_ALLOC(AVL_MAP_SIZE * sizeof(AVL_MAP_KEY_TYPE)),
+        .values = AVL_MAP_ALLOC(AVL_MAP_SIZE * sizeof(AVL_MAP_VALUE_TYPE)),
+        .nodes = AVL_MAP_ALLOC(AVL_MAP_SIZE * sizeof(avl_map_node_s)),
+        .heights = AVL_MAP_ALLOC(AVL_MAP_SIZE * sizeof(unsigned char)),
+    };
+
+    AVL_MAP_ASSERT(replica.keys && "[ERROR] Memory allocation failed.");
+    AVL_MAP_ASSERT(replica.values && "[ERROR] Memory allocation failed.");
+    AVL_MAP_ASSERT(replica.nodes && "[ERROR] Memory allocation failed.");
+    AVL_MAP_ASSERT(replica.heights && "[ERROR] Memory allocation failed.");
+
+    // copy each key and value either as a deep or shallow copy based on function pointers
+    for (size_t i = 0; i < map.size; ++i) {
+        replica.keys[i] = copy_key(map.keys[i]);
+        replica.values[i] = copy_value(map.values[i]);
+    }
+
+    // copy node records since everything is continuous in memory
+    memcpy(replica.nodes, map.nodes, map.size * sizeof(avl_map_node_s));
+    memcpy(replica.heights, map.heights, map.size * sizeof(unsigned char));
+
+    return replica;
+}
+
+static inline bool is_empty_avl_map(const avl_map_s map) {
+    AVL_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map.size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    return !(map.size);
+}
+
+static inline bool is_full_avl_map(const avl_map_s map) {
+    AVL_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map.size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    return (AVL_MAP_SIZE == map.size);
+}
+
+static inline bool contains_avl_map(const avl_map_s map, const AVL_MAP_KEY_TYPE key) {
+    AVL_MAP_ASSERT(map.size && "[ERROR] Can't check empty map.");
+    AVL_MAP_ASSERT(AVL_MAP_SIZE != map.root && "[ERROR] Invalid root node index.");
+
+    AVL_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map.size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    for (AVL_MAP_INDEX_TYPE node = map.root; AVL_MAP_SIZE != node;) {
+        // calculate and determine next child node, i.e. if left or right child
+        const int comparison = map.compare(key, map.keys[node]);
+        if (!comparison) {
+            return true;
+        }
+
+        const AVL_MAP_INDEX_TYPE node_index = comparison <= 0 ? AVL_MAP_LEFT : AVL_MAP_RIGHT;
+        node = map.nodes[node].child[node_index]; // go to next child node
+    }
+
+    return false;
+}
+
+static inline AVL_MAP_VALUE_TYPE * upsert_avl_map(avl_map_s * map, const AVL_MAP_KEY_TYPE key, const AVL_MAP_VALUE_TYPE value) {
+    AVL_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+
+    AVL_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map->size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    AVL_MAP_INDEX_TYPE previous = AVL_MAP_SIZE; // initially invalid for the head case when map is empty
+    AVL_MAP_INDEX_TYPE * node = &(map->root); // pointer to later change actual index of the empty child
+    while (AVL_MAP_SIZE != (*node)) {
+        // calculate and determine next child node, i.e. if left or right child
+        const int comparison = map->compare(key, map->keys[(*node)]);
+        if (!comparison) { // if key is already in map then return its value's slot without changing anything
+            return map->values + (*node);
+        }
+
+        const AVL_MAP_INDEX_TYPE node_index = comparison <= 0 ? AVL_MAP_LEFT : AVL_MAP_RIGHT;
+
+        previous = (*node); // change parent to child
+        node = &(map->nodes[(*node)].child[node_index]); // change child to proper gradnchild
+    }
+
+    AVL_MAP_ASSERT(map->size != AVL_MAP_SIZE && "[ERROR] Can't insert into full map.");
+
+    const AVL_MAP_INDEX_TYPE slot = (AVL_MAP_INDEX_TYPE)map->size; // new key and value are pushed at the end of their arrays
+    (*node) = slot; // change child index from invalid value to next empty index in array
+    map->nodes[(*node)].parent = previous; // make child's parent into parent
+    map->nodes[(*node)].child[AVL_MAP_LEFT] = map->nodes[(*node)].child[AVL_MAP_RIGHT] = AVL_MAP_SIZE; // make child's left and right indexes invalid
+
+    memcpy(map->keys + (*node), &key, sizeof(AVL_MAP_KEY_TYPE));
+    memcpy(map->values + (*node), &value, sizeof(AVL_MAP_VALUE_TYPE));
+    map->size++;
+
+    // go up the map from the inserted node, update heights and rotate unbalanced nodes
+    for (AVL_MAP_INDEX_TYPE n = (*node); AVL_MAP_SIZE != n; n = map->nodes[n].parent) {
+        // calculate left child's height
+        const AVL_MAP_INDEX_TYPE left_child = map->nodes[n].child[AVL_MAP_LEFT];
+        const unsigned char left_child_height = (AVL_MAP_SIZE == left_child) ? 0 : map->heights[left_child];
+
+        // calculate right child's height
+        const AVL_MAP_INDEX_TYPE right_child = map->nodes[n].child[AVL_MAP_RIGHT];
+        const unsigned char right_child_height = (AVL_MAP_SIZE == right_child) ? 0 : map->heights[right_child];
+
+        // set new height for each node on the path to root
+        map->heights[n] = (unsigned char)(1 + (left_child_height > right_child_height ? left_child_height : right_child_height));
+
+        // calculate absolute difference of left and right child's heights
+        const int abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
+
+        if (abs_balance < 2) { // if map is balanced continue, else perform rotation/s
+            continue;
+        }
+
+        if (left_child_height < right_child_height) {
+            const unsigned char left_grand_height = (AVL_MAP_SIZE == map->nodes[right_child].child[AVL_MAP_LEFT]) ? 0 : map->heights[map->nodes[right_child].child[AVL_MAP_LEFT]];
+            const unsigned char right_grand_height = (AVL_MAP_SIZE == map->nodes[right_child].child[AVL_MAP_RIGHT]) ? 0 : map->heights[map->nodes[right_child].child[AVL_MAP_RIGHT]];
+
+            if (left_grand_height > right_grand_height) {
+                { // RIGHT ROTATE RIGHT CHILD
+                    const AVL_MAP_INDEX_TYPE x = right_child, y = map->nodes[x].child[AVL_MAP_LEFT], z = map->nodes[y].child[AVL_MAP_RIGHT];
+
+                    map->nodes[x].child[AVL_MAP_LEFT] = z;
+                    if (AVL_MAP_SIZE != z) map->nodes[z].parent = x;
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (AVL_MAP_SIZE == map->nodes[x].parent) map->root = y;
+                    else if (x == map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT] = y;
+                    else map->nodes[map->nodes[x].parent].child[AVL_MAP_RIGHT] = y;
+
+                    map->nodes[y].child[AVL_MAP_RIGHT] = x;
+                    map->nodes[x].parent = y;
+
+                    const unsigned char x_left_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_LEFT] ? map->heights[map->nodes[x].child[AVL_MAP_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[x].child[AVL_MAP_RIGHT]] : 0;
+                    map->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                    const unsigned char y_left_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_LEFT] ? map->heights[map->nodes[y].child[AVL_MAP_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[y].child[AVL_MAP_RIGHT]] : 0;
+                    map->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+                }
+            }
+            { // LEFT ROTATE CURRENT NODE
+                const AVL_MAP_INDEX_TYPE x = n, y = map->nodes[x].child[AVL_MAP_RIGHT], z = map->nodes[y].child[AVL_MAP_LEFT];
+
+                map->nodes[x].child[AVL_MAP_RIGHT] = z;
+                if (AVL_MAP_SIZE != z) map->nodes[z].parent = x;
+                map->nodes[y].parent = map->nodes[x].parent;
+
+                if (AVL_MAP_SIZE == map->nodes[x].parent) map->root = y;
+                else if (x == map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT] = y;
+                else map->nodes[map->nodes[x].parent].child[AVL_MAP_RIGHT] = y;
+
+                map->nodes[y].child[AVL_MAP_LEFT] = x;
+                map->nodes[x].parent = y;
+
+                const unsigned char x_left_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_LEFT] ? map->heights[map->nodes[x].child[AVL_MAP_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[x].child[AVL_MAP_RIGHT]] : 0;
+                map->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                const unsigned char y_left_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_LEFT] ? map->heights[map->nodes[y].child[AVL_MAP_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[y].child[AVL_MAP_RIGHT]] : 0;
+                map->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        } else {
+            const unsigned char left_grand_height = (AVL_MAP_SIZE == map->nodes[left_child].child[AVL_MAP_LEFT]) ? 0 : map->heights[map->nodes[left_child].child[AVL_MAP_LEFT]];
+            const unsigned char right_grand_height = (AVL_MAP_SIZE == map->nodes[left_child].child[AVL_MAP_RIGHT]) ? 0 : map->heights[map->nodes[left_child].child[AVL_MAP_RIGHT]];
+
+            if (left_grand_height < right_grand_height) {
+                { // LEFT ROTATE LEFT CHILD
+                    const AVL_MAP_INDEX_TYPE x = left_child, y = map->nodes[x].child[AVL_MAP_RIGHT], z = map->nodes[y].child[AVL_MAP_LEFT];
+
+                    map->nodes[x].child[AVL_MAP_RIGHT] = z;
+                    if (AVL_MAP_SIZE != z) map->nodes[z].parent = x;
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (AVL_MAP_SIZE == map->nodes[x].parent) map->root = y;
+                    else if (x == map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT] = y;
+                    else map->nodes[map->nodes[x].parent].child[AVL_MAP_RIGHT] = y;
+
+                    map->nodes[y].child[AVL_MAP_LEFT] = x;
+                    map->nodes[x].parent = y;
+
+                    const unsigned char x_left_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_LEFT] ? map->heights[map->nodes[x].child[AVL_MAP_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[x].child[AVL_MAP_RIGHT]] : 0;
+                    map->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                    const unsigned char y_left_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_LEFT] ? map->heights[map->nodes[y].child[AVL_MAP_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[y].child[AVL_MAP_RIGHT]] : 0;
+                    map->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+                }
+            }
+            { // RIGHT ROTATE CURRENT NODE
+                const AVL_MAP_INDEX_TYPE x = n, y = map->nodes[x].child[AVL_MAP_LEFT], z = map->nodes[y].child[AVL_MAP_RIGHT];
+
+                map->nodes[x].child[AVL_MAP_LEFT] = z;
+                if (AVL_MAP_SIZE != z) map->nodes[z].parent = x;
+                map->nodes[y].parent = map->nodes[x].parent;
+
+                if (AVL_MAP_SIZE == map->nodes[x].parent) map->root = y;
+                else if (x == map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT] = y;
+                else map->nodes[map->nodes[x].parent].child[AVL_MAP_RIGHT] = y;
+
+                map->nodes[y].child[AVL_MAP_RIGHT] = x;
+                map->nodes[x].parent = y;
+
+                const unsigned char x_left_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_LEFT] ? map->heights[map->nodes[x].child[AVL_MAP_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[x].child[AVL_MAP_RIGHT]] : 0;
+                map->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                const unsigned char y_left_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_LEFT] ? map->heights[map->nodes[y].child[AVL_MAP_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[y].child[AVL_MAP_RIGHT]] : 0;
+                map->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        }
+    }
+
+    return map->values + slot;
+}
+
+static inline AVL_MAP_VALUE_TYPE * insert_or_assign_avl_map(avl_map_s * map, const AVL_MAP_KEY_TYPE key, const AVL_MAP_VALUE_TYPE value) {
+    AVL_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+
+    AVL_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map->size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // old value is overwritten without destroying it, since it might still be referenced by the caller
+    AVL_MAP_VALUE_TYPE * slot = upsert_avl_map(map, key, value);
+    memcpy(slot, &value, sizeof(AVL_MAP_VALUE_TYPE));
+
+    return slot;
+}
+
+static inline AVL_MAP_VALUE_TYPE * get_ptr_avl_map(const avl_map_s map, const AVL_MAP_KEY_TYPE key) {
+    AVL_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map.size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // only keys are touched while descending, values are reached once the key is found
+    for (AVL_MAP_INDEX_TYPE node = map.root; AVL_MAP_SIZE != node;) {
+        const int comparison = map.compare(key, map.keys[node]);
+        if (!comparison) {
+            return map.values + node;
+        }
+
+        const AVL_MAP_INDEX_TYPE node_index = comparison <= 0 ? AVL_MAP_LEFT : AVL_MAP_RIGHT;
+        node = map.nodes[node].child[node_index]; // go to next child node
+    }
+
+    return NULL;
+}
+
+static inline avl_map_pair_s remove_avl_map(avl_map_s * map, const AVL_MAP_KEY_TYPE key) {
+    AVL_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+    AVL_MAP_ASSERT(map->size && "[ERROR] Can't remove from empty map.");
+    AVL_MAP_ASSERT(AVL_MAP_SIZE != map->root && "[ERROR] Invalid root node index.");
+
+    AVL_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map->size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+    AVL_MAP_ASSERT(map->root != AVL_MAP_SIZE && "[ERROR] Invalid map root index.");
+    AVL_MAP_ASSERT(map->root < map->size && "[ERROR] Invalid map root index.");
+    AVL_MAP_ASSERT(map->nodes[map->root].parent == AVL_MAP_SIZE && "[ERROR] Invalid map root parent.");
+
+    AVL_MAP_INDEX_TYPE node = map->root;
+    while (AVL_MAP_SIZE != node) {
+        // calculate and determine next child node, i.e. if left or right child
+        const int comparison = map->compare(key, map->keys[node]);
+        if (!comparison) {
+            break;
+        }
+
+        const AVL_MAP_INDEX_TYPE node_index = comparison <= 0 ? AVL_MAP_LEFT : AVL_MAP_RIGHT;
+        node = map->nodes[node].child[node_index]; // go to next child node
+    }
+
+    if (AVL_MAP_SIZE == node) {
+        // key was NOT found, thus return an error
+        AVL_MAP_ASSERT(false && "[ERROR] Key not found in map.");
+        exit(EXIT_FAILURE);
+    }
+
+    const avl_map_pair_s removed = { .key = map->keys[node], .value = map->values[node], };
+
+    // if node has two children replace its key with the in-order neighbour from the higher subtree and cut that one instead
+    if (AVL_MAP_SIZE != map->nodes[node].child[AVL_MAP_LEFT] && AVL_MAP_SIZE != map->nodes[node].child[AVL_MAP_RIGHT]) {
+        AVL_MAP_INDEX_TYPE replace = AVL_MAP_SIZE;
+        if (map->heights[map->nodes[node].child[AVL_MAP_LEFT]] > map->heights[map->nodes[node].child[AVL_MAP_RIGHT]]) {
+            for (AVL_MAP_INDEX_TYPE i = map->nodes[node].child[AVL_MAP_LEFT]; AVL_MAP_SIZE != i; i = map->nodes[i].child[AVL_MAP_RIGHT]) {
+                replace = i;
+            }
+        } else {
+            for (AVL_MAP_INDEX_TYPE i = map->nodes[node].child[AVL_MAP_RIGHT]; AVL_MAP_SIZE != i; i = map->nodes[i].child[AVL_MAP_LEFT]) {
+                replace = i;
+            }
+        }
+
+        map->keys[node] = map->keys[replace];
+        map->values[node] = map->values[replace];
+        node = replace;
+    }
+
+    { // cut node with at most one child out of the map by linking its child to its parent
+        const AVL_MAP_INDEX_TYPE child = AVL_MAP_SIZE != map->nodes[node].child[AVL_MAP_LEFT] ? map->nodes[node].child[AVL_MAP_LEFT] : map->nodes[node].child[AVL_MAP_RIGHT];
+        const AVL_MAP_INDEX_TYPE parent = map->nodes[node].parent;
+
+        if (AVL_MAP_SIZE != child) map->nodes[child].parent = parent;
+
+        if (AVL_MAP_SIZE == parent) map->root = child;
+        else if (node == map->nodes[parent].child[AVL_MAP_LEFT]) map->nodes[parent].child[AVL_MAP_LEFT] = child;
+        else map->nodes[parent].child[AVL_MAP_RIGHT] = child;
+    }
+
+    // go up the map from the cut node's parent, update heights and rotate unbalanced nodes
+    for (AVL_MAP_INDEX_TYPE n = map->nodes[node].parent; AVL_MAP_SIZE != n; n = map->nodes[n].parent) {
+        // calculate left child's height
+        const AVL_MAP_INDEX_TYPE left_child = map->nodes[n].child[AVL_MAP_LEFT];
+        const unsigned char left_child_height = (AVL_MAP_SIZE == left_child) ? 0 : map->heights[left_child];
+
+        // calculate right child's height
+        const AVL_MAP_INDEX_TYPE right_child = map->nodes[n].child[AVL_MAP_RIGHT];
+        const unsigned char right_child_height = (AVL_MAP_SIZE == right_child) ? 0 : map->heights[right_child];
+
+        // set new height for each node on the path to root
+        map->heights[n] = (unsigned char)(1 + (left_child_height > right_child_height ? left_child_height : right_child_height));
+
+        // calculate absolute difference of left and right child's heights
+        const int abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
+
+        if (abs_balance < 2) { // if map is balanced continue, else perform rotation/s
+            continue;
+        }
+
+        if (left_child_height < right_child_height) {
+            const unsigned char left_grand_height = (AVL_MAP_SIZE == map->nodes[right_child].child[AVL_MAP_LEFT]) ? 0 : map->heights[map->nodes[right_child].child[AVL_MAP_LEFT]];
+            const unsigned char right_grand_height = (AVL_MAP_SIZE == map->nodes[right_child].child[AVL_MAP_RIGHT]) ? 0 : map->heights[map->nodes[right_child].child[AVL_MAP_RIGHT]];
+
+            if (left_grand_height > right_grand_height) {
+                { // RIGHT ROTATE RIGHT CHILD
+                    const AVL_MAP_INDEX_TYPE x = right_child, y = map->nodes[x].child[AVL_MAP_LEFT], z = map->nodes[y].child[AVL_MAP_RIGHT];
+
+                    map->nodes[x].child[AVL_MAP_LEFT] = z;
+                    if (AVL_MAP_SIZE != z) map->nodes[z].parent = x;
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (AVL_MAP_SIZE == map->nodes[x].parent) map->root = y;
+                    else if (x == map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT] = y;
+                    else map->nodes[map->nodes[x].parent].child[AVL_MAP_RIGHT] = y;
+
+                    map->nodes[y].child[AVL_MAP_RIGHT] = x;
+                    map->nodes[x].parent = y;
+
+                    const unsigned char x_left_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_LEFT] ? map->heights[map->nodes[x].child[AVL_MAP_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[x].child[AVL_MAP_RIGHT]] : 0;
+                    map->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                    const unsigned char y_left_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_LEFT] ? map->heights[map->nodes[y].child[AVL_MAP_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[y].child[AVL_MAP_RIGHT]] : 0;
+                    map->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+                }
+            }
+            { // LEFT ROTATE CURRENT NODE
+                const AVL_MAP_INDEX_TYPE x = n, y = map->nodes[x].child[AVL_MAP_RIGHT], z = map->nodes[y].child[AVL_MAP_LEFT];
+
+                map->nodes[x].child[AVL_MAP_RIGHT] = z;
+                if (AVL_MAP_SIZE != z) map->nodes[z].parent = x;
+                map->nodes[y].parent = map->nodes[x].parent;
+
+                if (AVL_MAP_SIZE == map->nodes[x].parent) map->root = y;
+                else if (x == map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT] = y;
+                else map->nodes[map->nodes[x].parent].child[AVL_MAP_RIGHT] = y;
+
+                map->nodes[y].child[AVL_MAP_LEFT] = x;
+                map->nodes[x].parent = y;
+
+                const unsigned char x_left_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_LEFT] ? map->heights[map->nodes[x].child[AVL_MAP_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[x].child[AVL_MAP_RIGHT]] : 0;
+                map->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                const unsigned char y_left_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_LEFT] ? map->heights[map->nodes[y].child[AVL_MAP_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[y].child[AVL_MAP_RIGHT]] : 0;
+                map->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        } else {
+            const unsigned char left_grand_height = (AVL_MAP_SIZE == map->nodes[left_child].child[AVL_MAP_LEFT]) ? 0 : map->heights[map->nodes[left_child].child[AVL_MAP_LEFT]];
+            const unsigned char right_grand_height = (AVL_MAP_SIZE == map->nodes[left_child].child[AVL_MAP_RIGHT]) ? 0 : map->heights[map->nodes[left_child].child[AVL_MAP_RIGHT]];
+
+            if (left_grand_height < right_grand_height) {
+                { // LEFT ROTATE LEFT CHILD
+                    const AVL_MAP_INDEX_TYPE x = left_child, y = map->nodes[x].child[AVL_MAP_RIGHT], z = map->nodes[y].child[AVL_MAP_LEFT];
+
+                    map->nodes[x].child[AVL_MAP_RIGHT] = z;
+                    if (AVL_MAP_SIZE != z) map->nodes[z].parent = x;
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (AVL_MAP_SIZE == map->nodes[x].parent) map->root = y;
+                    else if (x == map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT] = y;
+                    else map->nodes[map->nodes[x].parent].child[AVL_MAP_RIGHT] = y;
+
+                    map->nodes[y].child[AVL_MAP_LEFT] = x;
+                    map->nodes[x].parent = y;
+
+                    const unsigned char x_left_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_LEFT] ? map->heights[map->nodes[x].child[AVL_MAP_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[x].child[AVL_MAP_RIGHT]] : 0;
+                    map->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                    const unsigned char y_left_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_LEFT] ? map->heights[map->nodes[y].child[AVL_MAP_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[y].child[AVL_MAP_RIGHT]] : 0;
+                    map->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+                }
+            }
+            { // RIGHT ROTATE CURRENT NODE
+                const AVL_MAP_INDEX_TYPE x = n, y = map->nodes[x].child[AVL_MAP_LEFT], z = map->nodes[y].child[AVL_MAP_RIGHT];
+
+                map->nodes[x].child[AVL_MAP_LEFT] = z;
+                if (AVL_MAP_SIZE != z) map->nodes[z].parent = x;
+                map->nodes[y].parent = map->nodes[x].parent;
+
+                if (AVL_MAP_SIZE == map->nodes[x].parent) map->root = y;
+                else if (x == map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[x].parent].child[AVL_MAP_LEFT] = y;
+                else map->nodes[map->nodes[x].parent].child[AVL_MAP_RIGHT] = y;
+
+                map->nodes[y].child[AVL_MAP_RIGHT] = x;
+                map->nodes[x].parent = y;
+
+                const unsigned char x_left_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_LEFT] ? map->heights[map->nodes[x].child[AVL_MAP_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_MAP_SIZE != map->nodes[x].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[x].child[AVL_MAP_RIGHT]] : 0;
+                map->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                const unsigned char y_left_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_LEFT] ? map->heights[map->nodes[y].child[AVL_MAP_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_MAP_SIZE != map->nodes[y].child[AVL_MAP_RIGHT] ? map->heights[map->nodes[y].child[AVL_MAP_RIGHT]] : 0;
+                map->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        }
+    }
+
+    map->size--;
+    if (node != map->size) { // if the cut node isn't the last array node then fill its hole with the last one
+        const AVL_MAP_INDEX_TYPE last = (AVL_MAP_INDEX_TYPE)map->size;
+
+        map->keys[node] = map->keys[last];
+        map->values[node] = map->values[last];
+        map->nodes[node].child[AVL_MAP_LEFT] = map->nodes[last].child[AVL_MAP_LEFT];
+        map->nodes[node].child[AVL_MAP_RIGHT] = map->nodes[last].child[AVL_MAP_RIGHT];
+        map->nodes[node].parent = map->nodes[last].parent;
+        map->heights[node] = map->heights[last];
+
+        // redirect children and parent of last array node to the filled hole
+        if (AVL_MAP_SIZE != map->nodes[last].child[AVL_MAP_LEFT]) map->nodes[map->nodes[last].child[AVL_MAP_LEFT]].parent = node;
+        if (AVL_MAP_SIZE != map->nodes[last].child[AVL_MAP_RIGHT]) map->nodes[map->nodes[last].child[AVL_MAP_RIGHT]].parent = node;
+
+        if (AVL_MAP_SIZE == map->nodes[last].parent) map->root = node;
+        else if (last == map->nodes[map->nodes[last].parent].child[AVL_MAP_LEFT]) map->nodes[map->nodes[last].parent].child[AVL_MAP_LEFT] = node;
+        else map->nodes[map->nodes[last].parent].child[AVL_MAP_RIGHT] = node;
+    }
+
+    return removed;
+}
+
+static inline void inorder_avl_map(const avl_map_s map, const operate_avl_map_fn operate, void * args) {
+    AVL_MAP_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    AVL_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    AVL_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    AVL_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_MAP_ASSERT(map.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_MAP_ASSERT(map.size <= AVL_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    bool left_done = false;
+    AVL_MAP_INDEX_TYPE node = map.root;
+    while (AVL_MAP_SIZE != node) {
+        while (!left_done && AVL_MAP_SIZE != map.nodes[node].child[AVL_MAP_LEFT]) {
+            node = map.nodes[node].child[AVL_MAP_LEFT];
+        }
+
+        if (!operate(map.keys + node, map.values + node, args)) {
+            break;
+        }
+
+        left_done = true;
+        if (AVL_MAP_SIZE != map.nodes[node].child[AVL_MAP_RIGHT]) {
+            left_done = false;
+            node = map.nodes[node].child[AVL_MAP_RIGHT];
+        } else if (AVL_MAP_SIZE != map.nodes[node].parent) {
+            while (AVL_MAP_SIZE != map.nodes[node].parent && node == map.nodes[map.nodes[node].parent].child[AVL_MAP_RIGHT]) {
+                node = map.nodes[node].parent;
+            }
+
+            if (AVL_MAP_SIZE == map.nodes[node].parent) {
+                break;
+            }
+
+            node = map.nodes[node].parent;
+        } else {
+            break;
+        }
+    }
+}
+
+#endif // AVL_MAP_H
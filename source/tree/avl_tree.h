@@ -59,6 +59,25 @@
 #   error Size cannot be zero.
 #endif
 
+#ifndef AVL_TREE_INDEX_TYPE
+// redefine using #define AVL_TREE_INDEX_TYPE [unsigned type], e.g. uint32_t to halve node size if size allows it
+#   define AVL_TREE_INDEX_TYPE size_t
+#endif
+
+#ifdef AVL_TREE_COMPARE
+// compare macro is expanded in place of 'compare' function pointer calls, thus the pointer is removed from tree structure
+#   define AVL_TREE_COMPARE_WITH(function, one, two) AVL_TREE_COMPARE(one, two)
+#   define AVL_TREE_COMPARE_FUNCTION(function) NULL
+#   define AVL_TREE_COMPARE_ASSERT(expression)
+#else
+// redefine using #define AVL_TREE_COMPARE(one, two) [expression], e.g. (((one) > (two)) - ((one) < (two))) for scalar types
+#   define AVL_TREE_COMPARE_WITH(function, one, two) (function)(one, two)
+#   define AVL_TREE_COMPARE_FUNCTION(function) (function)
+#   define AVL_TREE_COMPARE_ASSERT(expression) AVL_TREE_ASSERT(expression)
+#endif
+
+// define AVL_TREE_ORDER_STATISTICS to keep subtree element counts in each node for 'select_avl_tree' and 'rank_avl_tree'
+
 /// Function pointer that creates a deep element copy.
 typedef AVL_TREE_DATA_TYPE (*copy_avl_tree_fn)    (const AVL_TREE_DATA_TYPE element);
 /// Function pointer that destroys a deep element.
@@ -73,34 +92,119 @@ typedef void               (*manage_avl_tree_fn)  (AVL_TREE_DATA_TYPE * array, c
 #define AVL_TREE_CHILD_COUNT 2
 #define AVL_TREE_LEFT  0
 #define AVL_TREE_RIGHT 1
+typedef struct avl_tree_node {
+    AVL_TREE_INDEX_TYPE child[AVL_TREE_CHILD_COUNT], parent;
+#ifdef AVL_TREE_ORDER_STATISTICS
+    AVL_TREE_INDEX_TYPE count; // number of elements in node's subtree
+#endif
+} avl_tree_node_s;
+
 typedef struct avl_tree {
+#ifndef AVL_TREE_COMPARE
     compare_avl_tree_fn compare;
+#endif
     AVL_TREE_DATA_TYPE * elements;
-    size_t * node[AVL_TREE_CHILD_COUNT];
-    size_t * parent;
-    size_t * height;
-    size_t size, root;
+    avl_tree_node_s * nodes;
+    unsigned char * heights; // avl tree height is below 1.45 * log2(size), thus a byte holds it for any index type
+    size_t size;
+    AVL_TREE_INDEX_TYPE root;
+    AVL_TREE_INDEX_TYPE maximum; // cached rightmost node, thus appending monotonic keys needs a single comparison
 } avl_tree_s;
 
+typedef struct avl_tree_cursor {
+    AVL_TREE_DATA_TYPE * element;
+    AVL_TREE_INDEX_TYPE node;
+} avl_tree_cursor_s;
+
 static inline avl_tree_s create_avl_tree(const compare_avl_tree_fn compare) {
-    AVL_TREE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+    AVL_TREE_COMPARE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+#ifdef AVL_TREE_COMPARE
+    (void)(compare); // compare macro is used instead, thus parameter is ignored and may be NULL
+#endif
+    AVL_TREE_ASSERT((AVL_TREE_INDEX_TYPE)(AVL_TREE_SIZE) == AVL_TREE_SIZE && "[ERROR] 'AVL_TREE_INDEX_TYPE' can't hold tree size.");
 
     // initialize and allocate memory for tree
     const avl_tree_s tree = {
         .elements = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(AVL_TREE_DATA_TYPE)),
-        .node[AVL_TREE_LEFT]  = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(size_t)),
-        .node[AVL_TREE_RIGHT] = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(size_t)),
-        .parent = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(size_t)),
-        .height = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(size_t)),
-        .size = 0, .compare = compare, .root = AVL_TREE_SIZE,
+        .nodes = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(avl_tree_node_s)),
+        .heights = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(unsigned char)),
+        .size = 0, .root = AVL_TREE_SIZE, .maximum = AVL_TREE_SIZE,
+#ifndef AVL_TREE_COMPARE
+        .compare = compare,
+#endif
     };
 
     // check if memory allocation succeeded
     AVL_TREE_ASSERT(tree.elements && "[ERROR] Memory allocation failed.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] Memory allocation failed.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] Memory allocation failed.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] Memory allocation failed.");
-    AVL_TREE_ASSERT(tree.height && "[ERROR] Memory allocation failed.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] Memory allocation failed.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] Memory allocation failed.");
+
+    return tree;
+}
+
+// links tree's elements, which must already be sorted, into a balanced tree with each array index as in-order position
+static inline void link_sorted_avl_tree(avl_tree_s * tree) {
+    AVL_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    if (!tree->size) {
+        tree->root = tree->maximum = AVL_TREE_SIZE;
+        return;
+    }
+
+    // pending subtree ranges never exceed tree height, which is less than the bit count of AVL_TREE_INDEX_TYPE
+    struct build_range { AVL_TREE_INDEX_TYPE low, high, parent; } stack[sizeof(AVL_TREE_INDEX_TYPE) << 3];
+    size_t stack_size = 0;
+    stack[stack_size++] = (struct build_range) { .low = 0, .high = (AVL_TREE_INDEX_TYPE)tree->size, .parent = AVL_TREE_SIZE, };
+
+    while (stack_size) {
+        // pop range and make its middle element the subtree's root, so that both subtree sizes differ at most by one
+        const struct build_range range = stack[--stack_size];
+        const AVL_TREE_INDEX_TYPE middle = (AVL_TREE_INDEX_TYPE)(range.low + (range.high - range.low) / 2);
+
+        tree->nodes[middle].parent = range.parent;
+        tree->nodes[middle].child[AVL_TREE_LEFT] = (AVL_TREE_INDEX_TYPE)(range.low < middle ? range.low + (middle - range.low) / 2 : AVL_TREE_SIZE);
+        tree->nodes[middle].child[AVL_TREE_RIGHT] = (AVL_TREE_INDEX_TYPE)(middle + 1 < range.high ? (middle + 1) + (range.high - middle - 1) / 2 : AVL_TREE_SIZE);
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[middle].count = range.high - range.low;
+#endif
+        tree->heights[middle] = 0;
+        for (size_t s = (size_t)(range.high - range.low); s; s >>= 1) {
+            tree->heights[middle]++;
+        }
+
+        if (AVL_TREE_SIZE != tree->nodes[middle].child[AVL_TREE_LEFT]) {
+            stack[stack_size++] = (struct build_range) { .low = range.low, .high = middle, .parent = middle, };
+        }
+
+        if (AVL_TREE_SIZE != tree->nodes[middle].child[AVL_TREE_RIGHT]) {
+            stack[stack_size++] = (struct build_range) { .low = middle + 1, .high = range.high, .parent = middle, };
+        }
+    }
+
+    tree->root = (AVL_TREE_INDEX_TYPE)(tree->size / 2);
+    tree->maximum = (AVL_TREE_INDEX_TYPE)(tree->size - 1);
+}
+
+static inline avl_tree_s create_avl_tree_from_sorted(const compare_avl_tree_fn compare, const AVL_TREE_DATA_TYPE * sorted, const size_t size) {
+    AVL_TREE_COMPARE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+    AVL_TREE_ASSERT((sorted || !size) && "[ERROR] 'sorted' parameter is NULL.");
+    AVL_TREE_ASSERT(size <= AVL_TREE_SIZE && "[ERROR] 'size' parameter exceeds maximum tree size.");
+
+    for (size_t i = 1; i < size; ++i) {
+        AVL_TREE_ASSERT(AVL_TREE_COMPARE_WITH(compare, sorted[i - 1], sorted[i]) <= 0 && "[ERROR] 'sorted' array isn't sorted.");
+    }
+
+    avl_tree_s tree = create_avl_tree(compare);
+    if (!size) {
+        return tree;
+    }
+
+    // elements stay in sorted order, thus each array index is also the node's in-order position
+    memcpy(tree.elements, sorted, size * sizeof(AVL_TREE_DATA_TYPE));
+    tree.size = size;
+    link_sorted_avl_tree(&tree);
 
     return tree;
 }
@@ -109,12 +213,10 @@ static inline void destroy_avl_tree(avl_tree_s * tree, const destroy_avl_tree_fn
     AVL_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     AVL_TREE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
 
-    AVL_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->height && "[ERROR] 'height' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     // for each element in tree elements array call destroy function
@@ -124,21 +226,20 @@ static inline void destroy_avl_tree(avl_tree_s * tree, const destroy_avl_tree_fn
 
     // free allocated memory
     AVL_TREE_FREE(tree->elements);
-    AVL_TREE_FREE(tree->node[AVL_TREE_LEFT]);
-    AVL_TREE_FREE(tree->node[AVL_TREE_RIGHT]);
-    AVL_TREE_FREE(tree->parent);
-    AVL_TREE_FREE(tree->height);
+    AVL_TREE_FREE(tree->nodes);
+    AVL_TREE_FREE(tree->heights);
 
     // set pointers to NULL
     tree->elements = NULL;
-    tree->node[AVL_TREE_LEFT] = NULL;
-    tree->node[AVL_TREE_RIGHT] = NULL;
-    tree->parent = NULL;
-    tree->height = NULL;
+    tree->nodes = NULL;
+    tree->heights = NULL;
 
     // other cleanup stuff
     tree->root = AVL_TREE_SIZE;
+    tree->maximum = AVL_TREE_SIZE;
+#ifndef AVL_TREE_COMPARE
     tree->compare = NULL;
+#endif
     tree->size = 0;
 }
 
@@ -146,12 +247,10 @@ static inline void clear_avl_tree(avl_tree_s * tree, const destroy_avl_tree_fn d
     AVL_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     AVL_TREE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
 
-    AVL_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->height && "[ERROR] 'height' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     // since the elements are continuosly in an array just iterate through each and call destroy on it
@@ -161,228 +260,521 @@ static inline void clear_avl_tree(avl_tree_s * tree, const destroy_avl_tree_fn d
 
     // clearing cleanup
     tree->root = AVL_TREE_SIZE;
+    tree->maximum = AVL_TREE_SIZE;
     tree->size = 0;
 }
 
 static inline avl_tree_s copy_avl_tree(const avl_tree_s tree, const copy_avl_tree_fn copy) {
     AVL_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.height && "[ERROR] 'height' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     // create replica/copy to return
     const avl_tree_s replica = {
-        .compare = tree.compare, .root = tree.root, .size = tree.size,
+        .root = tree.root, .maximum = tree.maximum, .size = tree.size,
+#ifndef AVL_TREE_COMPARE
+        .compare = tree.compare,
+#endif
         .elements = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(AVL_TREE_DATA_TYPE)),
-        .height = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(size_t)),
-        .parent = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(size_t)),
-        .node[AVL_TREE_LEFT] = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(size_t)),
-        .node[AVL_TREE_RIGHT] = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(size_t)),
+        .nodes = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(avl_tree_node_s)),
+        .heights = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(unsigned char)),
     };
 
-    AVL_TREE_ASSERT(tree.elements && "[ERROR] Memory allocation failed.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] Memory allocation failed.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] Memory allocation failed.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] Memory allocation failed.");
-    AVL_TREE_ASSERT(tree.height && "[ERROR] Memory allocation failed.");
+    AVL_TREE_ASSERT(replica.elements && "[ERROR] Memory allocation failed.");
+    AVL_TREE_ASSERT(replica.nodes && "[ERROR] Memory allocation failed.");
+    AVL_TREE_ASSERT(replica.heights && "[ERROR] Memory allocation failed.");
 
     // copy each element either as a deep or shallow copy based on function pointer
     for (size_t i = 0; i < tree.size; ++i) {
         replica.elements[i] = copy(tree.elements[i]);
     }
 
-    // copy node and parent indexes, and heights since everything is continuous in memory
-    const size_t copy_size = tree.size * sizeof(size_t);
-    memcpy(replica.node[AVL_TREE_LEFT], tree.node[AVL_TREE_LEFT], copy_size);
-    memcpy(replica.node[AVL_TREE_RIGHT], tree.node[AVL_TREE_RIGHT], copy_size);
-    memcpy(replica.parent, tree.parent, copy_size);
-    memcpy(replica.height, tree.height, copy_size);
+    // copy node records since everything is continuous in memory
+    memcpy(replica.nodes, tree.nodes, tree.size * sizeof(avl_tree_node_s));
+    memcpy(replica.heights, tree.heights, tree.size * sizeof(unsigned char));
 
     return replica;
 }
 
 static inline bool is_empty_avl_tree(const avl_tree_s tree) {
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.height && "[ERROR] 'height' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     return !(tree.size);
 }
 
 static inline bool is_full_avl_tree(const avl_tree_s tree) {
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.height && "[ERROR] 'height' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     return (AVL_TREE_SIZE == tree.size);
 }
 
+// caches tree's rightmost node, called after changes that may remove or move the maximum
+static inline void update_maximum_avl_tree(avl_tree_s * tree) {
+    tree->maximum = tree->root;
+    if (AVL_TREE_SIZE == tree->maximum) {
+        return;
+    }
+
+    while (AVL_TREE_SIZE != tree->nodes[tree->maximum].child[AVL_TREE_RIGHT]) {
+        tree->maximum = tree->nodes[tree->maximum].child[AVL_TREE_RIGHT];
+    }
+}
+
 static inline void insert_avl_tree(avl_tree_s * tree, const AVL_TREE_DATA_TYPE element) {
     AVL_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     AVL_TREE_ASSERT(tree->size != AVL_TREE_SIZE && "[ERROR] Can't insert into full tree.");
 
-    AVL_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->height && "[ERROR] 'height' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    size_t previous = AVL_TREE_SIZE; // initially invalid for the head case when tree is empty
-    size_t * node = &(tree->root); // pointer to later change actual index of the empty child
+    AVL_TREE_INDEX_TYPE previous = AVL_TREE_SIZE; // initially invalid for the head case when tree is empty
+    AVL_TREE_INDEX_TYPE * node = &(tree->root); // pointer to later change actual index of the empty child
+    if (AVL_TREE_SIZE != tree->maximum && AVL_TREE_COMPARE_WITH(tree->compare, element, tree->elements[tree->maximum]) > 0) { // monotonic keys append after the cached maximum, thus check it with a single comparison before descending from root
+        previous = tree->maximum;
+        node = &(tree->nodes[tree->maximum].child[AVL_TREE_RIGHT]);
+    }
+
     while (AVL_TREE_SIZE != (*node)) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree->compare(element, tree->elements[(*node)]);
-        const size_t node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
+        const int comparison = AVL_TREE_COMPARE_WITH(tree->compare, element, tree->elements[(*node)]);
+        const AVL_TREE_INDEX_TYPE node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
 
         previous = (*node); // change parent to child
-        node = tree->node[node_index] + (*node); // change child to proper gradnchild
+        node = &(tree->nodes[(*node)].child[node_index]); // change child to proper gradnchild
     }
 
-    (*node) = tree->size; // change child index from invalid value to next empty index in array
-    tree->parent[(*node)] = previous; // make child's parent into parent
-    tree->node[AVL_TREE_LEFT][(*node)] = tree->node[AVL_TREE_RIGHT][(*node)] = AVL_TREE_SIZE; // make child's left and right indexes invalid
+    // new node becomes the maximum if tree was empty or if it hangs right of the old maximum
+    if (AVL_TREE_SIZE == tree->maximum || &(tree->nodes[tree->maximum].child[AVL_TREE_RIGHT]) == node) {
+        tree->maximum = (AVL_TREE_INDEX_TYPE)tree->size;
+    }
+
+    (*node) = (AVL_TREE_INDEX_TYPE)tree->size; // change child index from invalid value to next empty index in array
+    tree->nodes[(*node)].parent = previous; // make child's parent into parent
+    tree->nodes[(*node)].child[AVL_TREE_LEFT] = tree->nodes[(*node)].child[AVL_TREE_RIGHT] = AVL_TREE_SIZE; // make child's left and right indexes invalid
 
     memcpy(tree->elements + (*node), &element, sizeof(AVL_TREE_DATA_TYPE));
     tree->size++;
 
-    for (size_t n = (*node), p = tree->parent[n]; AVL_TREE_SIZE != n; n = p, p = tree->parent[n]) {
+    // go up the tree from the inserted node, update heights and counts, and rotate unbalanced nodes
+    for (AVL_TREE_INDEX_TYPE n = (*node); AVL_TREE_SIZE != n; n = tree->nodes[n].parent) {
         // calculate left child's height
-        const size_t left_child = tree->node[AVL_TREE_LEFT][n];
-        const size_t left_child_height = (AVL_TREE_SIZE == left_child) ? 0 : tree->height[left_child];
+        const AVL_TREE_INDEX_TYPE left_child = tree->nodes[n].child[AVL_TREE_LEFT];
+        const unsigned char left_child_height = (AVL_TREE_SIZE == left_child) ? 0 : tree->heights[left_child];
 
         // calculate right child's height
-        const size_t right_child = tree->node[AVL_TREE_RIGHT][n];
-        const size_t right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->height[right_child];
+        const AVL_TREE_INDEX_TYPE right_child = tree->nodes[n].child[AVL_TREE_RIGHT];
+        const unsigned char right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->heights[right_child];
 
-        // set new height for each element popped from stack
-        tree->height[n] = 1 + (left_child_height > right_child_height ? left_child_height : right_child_height);
+        // set new height and subtree element count for each node on the path to root
+        tree->heights[n] = (unsigned char)(1 + (left_child_height > right_child_height ? left_child_height : right_child_height));
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[n].count = (AVL_TREE_INDEX_TYPE)(1 + ((AVL_TREE_SIZE == left_child) ? 0 : tree->nodes[left_child].count) + ((AVL_TREE_SIZE == right_child) ? 0 : tree->nodes[right_child].count));
+#endif
 
         // calculate absolute difference of left and right child's heights
-        const size_t abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
+        const int abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
 
         if (abs_balance < 2) { // if tree is balanced continue, else perform rotation/s
             continue;
         }
 
         if (left_child_height < right_child_height) {
-            const size_t left_grand_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][right_child]) ? 0 : tree->height[tree->node[AVL_TREE_LEFT][right_child]];
-            const size_t right_grand_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_RIGHT][right_child]) ? 0 : tree->height[tree->node[AVL_TREE_RIGHT][right_child]];
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_RIGHT]];
 
             if (left_grand_height > right_grand_height) {
                 { // RIGHT ROTATE RIGHT CHILD
-                    const size_t x = right_child, y = tree->node[AVL_TREE_LEFT][x], z = tree->node[AVL_TREE_RIGHT][y];
+                    const AVL_TREE_INDEX_TYPE x = right_child, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
+
+                    tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
 
-                    tree->node[AVL_TREE_LEFT][x] = z;
-                    if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                    tree->parent[y] = tree->parent[x];
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                    if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                    else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                    else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                    tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                    tree->nodes[x].parent = y;
 
-                    tree->node[AVL_TREE_RIGHT][y] = x;
-                    tree->parent[x] = y;
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                    const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                    const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                    tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-                    const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                    const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                    tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
                 }
             }
             { // LEFT ROTATE CURRENT NODE
-                const size_t x = n, y = tree->node[AVL_TREE_RIGHT][x], z = tree->node[AVL_TREE_LEFT][y];
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
+
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
+
+                tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                tree->nodes[x].parent = y;
+
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        } else {
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_RIGHT]];
+
+            if (left_grand_height < right_grand_height) {
+                { // LEFT ROTATE LEFT CHILD
+                    const AVL_TREE_INDEX_TYPE x = left_child, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                    tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
+
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
+
+                    tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                    tree->nodes[x].parent = y;
+
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
+            }
+            { // RIGHT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
+
+                tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
 
-                tree->node[AVL_TREE_RIGHT][x] = z;
-                if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                tree->parent[y] = tree->parent[x];
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                tree->nodes[x].parent = y;
 
-                tree->node[AVL_TREE_LEFT][y] = x;
-                tree->parent[x] = y;
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-                const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        }
+    }
+}
+
+static inline avl_tree_cursor_s insert_hint_avl_tree(avl_tree_s * tree, const avl_tree_cursor_s hint, const AVL_TREE_DATA_TYPE element) {
+    AVL_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    AVL_TREE_ASSERT(tree->size != AVL_TREE_SIZE && "[ERROR] Can't insert into full tree.");
+
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+    AVL_TREE_ASSERT((AVL_TREE_SIZE == hint.node || hint.node < tree->size) && "[ERROR] Invalid hint node index.");
+
+    // climb from hint until element falls between the nearest lesser and greater ancestors of the start node's subtree
+    AVL_TREE_INDEX_TYPE start = AVL_TREE_SIZE == hint.node ? tree->root : hint.node;
+    if (AVL_TREE_SIZE != start) {
+        bool has_low = false, has_high = false; // farther ancestors don't need checks once both nearest bounds hold
+        for (AVL_TREE_INDEX_TYPE child = start; AVL_TREE_SIZE != tree->nodes[child].parent && !(has_low && has_high); child = tree->nodes[child].parent) {
+            const AVL_TREE_INDEX_TYPE parent = tree->nodes[child].parent;
+            const bool is_left = (child == tree->nodes[parent].child[AVL_TREE_LEFT]);
+            if (is_left ? has_high : has_low) { // only the nearest ancestor on each side bounds the subtree
+                continue;
+            }
+
+            const int comparison = AVL_TREE_COMPARE_WITH(tree->compare, element, tree->elements[parent]);
+            if (is_left ? comparison > 0 : comparison <= 0) { // if element is outside subtree then restart from ancestor with a wider range
+                start = parent;
+                has_low = has_high = false;
+            } else if (is_left) {
+                has_high = true;
+            } else {
+                has_low = true;
             }
         }
+    }
+
+    // descend from start node as usual
+    AVL_TREE_INDEX_TYPE previous = AVL_TREE_SIZE == start ? AVL_TREE_SIZE : tree->nodes[start].parent;
+    AVL_TREE_INDEX_TYPE * node = &(tree->root); // pointer to later change actual index of the empty child
+    if (AVL_TREE_SIZE != previous) {
+        node = &(tree->nodes[previous].child[start == tree->nodes[previous].child[AVL_TREE_LEFT] ? AVL_TREE_LEFT : AVL_TREE_RIGHT]);
+    }
+
+    while (AVL_TREE_SIZE != (*node)) {
+        // calculate and determine next child node, i.e. if left or right child
+        const int comparison = AVL_TREE_COMPARE_WITH(tree->compare, element, tree->elements[(*node)]);
+        const AVL_TREE_INDEX_TYPE node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
+
+        previous = (*node); // change parent to child
+        node = &(tree->nodes[(*node)].child[node_index]); // change child to proper gradnchild
+    }
+
+    // new node becomes the maximum if tree was empty or if it hangs right of the old maximum
+    if (AVL_TREE_SIZE == tree->maximum || &(tree->nodes[tree->maximum].child[AVL_TREE_RIGHT]) == node) {
+        tree->maximum = (AVL_TREE_INDEX_TYPE)tree->size;
+    }
+
+    const AVL_TREE_INDEX_TYPE inserted = (AVL_TREE_INDEX_TYPE)tree->size; // new node is pushed at the end of the arrays
+    (*node) = inserted; // change child index from invalid value to next empty index in array
+    tree->nodes[(*node)].parent = previous; // make child's parent into parent
+    tree->nodes[(*node)].child[AVL_TREE_LEFT] = tree->nodes[(*node)].child[AVL_TREE_RIGHT] = AVL_TREE_SIZE; // make child's left and right indexes invalid
+
+    memcpy(tree->elements + (*node), &element, sizeof(AVL_TREE_DATA_TYPE));
+    tree->size++;
+
+    // go up the tree from the inserted node, update heights and counts, and rotate unbalanced nodes
+    for (AVL_TREE_INDEX_TYPE n = (*node); AVL_TREE_SIZE != n; n = tree->nodes[n].parent) {
+        // calculate left child's height
+        const AVL_TREE_INDEX_TYPE left_child = tree->nodes[n].child[AVL_TREE_LEFT];
+        const unsigned char left_child_height = (AVL_TREE_SIZE == left_child) ? 0 : tree->heights[left_child];
+
+        // calculate right child's height
+        const AVL_TREE_INDEX_TYPE right_child = tree->nodes[n].child[AVL_TREE_RIGHT];
+        const unsigned char right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->heights[right_child];
+
+        // set new height and subtree element count for each node on the path to root
+        tree->heights[n] = (unsigned char)(1 + (left_child_height > right_child_height ? left_child_height : right_child_height));
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[n].count = (AVL_TREE_INDEX_TYPE)(1 + ((AVL_TREE_SIZE == left_child) ? 0 : tree->nodes[left_child].count) + ((AVL_TREE_SIZE == right_child) ? 0 : tree->nodes[right_child].count));
+#endif
+
+        // calculate absolute difference of left and right child's heights
+        const int abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
+
+        if (abs_balance < 2) { // if tree is balanced continue, else perform rotation/s
+            continue;
+        }
+
+        if (left_child_height < right_child_height) {
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_RIGHT]];
+
+            if (left_grand_height > right_grand_height) {
+                { // RIGHT ROTATE RIGHT CHILD
+                    const AVL_TREE_INDEX_TYPE x = right_child, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
 
-        if (left_child_height > right_child_height) {
-            const size_t left_grand_height = AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][left_child] ? 0 : tree->height[tree->node[AVL_TREE_LEFT][left_child]];
-            const size_t right_grand_height = AVL_TREE_SIZE == tree->node[AVL_TREE_RIGHT][left_child] ? 0 : tree->height[tree->node[AVL_TREE_RIGHT][left_child]];
+                    tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
+
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
+
+                    tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                    tree->nodes[x].parent = y;
+
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
+            }
+            { // LEFT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
+
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
+
+                tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                tree->nodes[x].parent = y;
+
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        } else {
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_RIGHT]];
 
             if (left_grand_height < right_grand_height) {
                 { // LEFT ROTATE LEFT CHILD
-                    const size_t x = left_child, y = tree->node[AVL_TREE_RIGHT][x], z = tree->node[AVL_TREE_LEFT][y];
+                    const AVL_TREE_INDEX_TYPE x = left_child, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                    tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
 
-                    tree->node[AVL_TREE_RIGHT][x] = z;
-                    if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                    tree->parent[y] = tree->parent[x];
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                    if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                    else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                    else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                    tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                    tree->nodes[x].parent = y;
 
-                    tree->node[AVL_TREE_LEFT][y] = x;
-                    tree->parent[x] = y;
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                    const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                    const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                    tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-                    const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                    const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                    tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
                 }
             }
             { // RIGHT ROTATE CURRENT NODE
-                const size_t x = n, y = tree->node[AVL_TREE_LEFT][x], z = tree->node[AVL_TREE_RIGHT][y];
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
 
-                tree->node[AVL_TREE_LEFT][x] = z;
-                if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                tree->parent[y] = tree->parent[x];
+                tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
 
-                if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                tree->node[AVL_TREE_RIGHT][y] = x;
-                tree->parent[x] = y;
+                tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                tree->nodes[x].parent = y;
 
-                const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+
+                n = y; // continue upwards from the new root of the rotated subtree
             }
         }
     }
+
+    return (avl_tree_cursor_s) { .element = tree->elements + inserted, .node = inserted, };
 }
 
 static inline AVL_TREE_DATA_TYPE remove_avl_tree(avl_tree_s * tree, const AVL_TREE_DATA_TYPE element) {
@@ -390,216 +782,257 @@ static inline AVL_TREE_DATA_TYPE remove_avl_tree(avl_tree_s * tree, const AVL_TR
     AVL_TREE_ASSERT(tree->size && "[ERROR] Can't remove from empty tree.");
     AVL_TREE_ASSERT(AVL_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
 
-    AVL_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
     AVL_TREE_ASSERT(tree->root != AVL_TREE_SIZE && "[ERROR] Invalid tree root index.");
     AVL_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    AVL_TREE_ASSERT(tree->parent[tree->root] == AVL_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    AVL_TREE_ASSERT(tree->nodes[tree->root].parent == AVL_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t * node = &(tree->root); // pointer to later change actual index of the empty child
-    while (AVL_TREE_SIZE != (*node)) {
+    AVL_TREE_INDEX_TYPE node = tree->root;
+    while (AVL_TREE_SIZE != node) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree->compare(element, tree->elements[(*node)]);
+        const int comparison = AVL_TREE_COMPARE_WITH(tree->compare, element, tree->elements[node]);
         if (!comparison) {
             break;
         }
 
-        const size_t node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
-
-        // change parent to child and go to next child node
-        node = tree->node[node_index] + (*node);
+        const AVL_TREE_INDEX_TYPE node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
+        node = tree->nodes[node].child[node_index]; // go to next child node
     }
 
-    if (AVL_TREE_SIZE == (*node)) {
+    if (AVL_TREE_SIZE == node) {
         // element was NOT found, thus return an error
         AVL_TREE_ASSERT(false && "[ERROR] Element not found in tree.");
         exit(EXIT_FAILURE);
     }
 
-    AVL_TREE_DATA_TYPE removed = tree->elements[(*node)];
-    tree->size--;
-
-    // calculate the rightmost depth of the left child
-    size_t left_depth = 0, * left_node = node;
-    for (size_t * l = tree->node[AVL_TREE_LEFT] + (*left_node); AVL_TREE_SIZE != (*l); l = tree->node[AVL_TREE_RIGHT] + (*l)) {
-        left_depth++;
-        left_node = l;
-    }
-
-    // calculate the leftmost depth of the right child
-    size_t right_depth = 0, * right_node = node;
-    for (size_t * r = tree->node[AVL_TREE_RIGHT] + (*right_node); AVL_TREE_SIZE != (*r); r = tree->node[AVL_TREE_LEFT] + (*r)) {
-        right_depth++;
-        right_node = r;
-    }
+    AVL_TREE_DATA_TYPE removed = tree->elements[node];
 
-    const size_t hole_index = left_depth > right_depth ? (*left_node) : (*right_node);
-    tree->elements[(*node)] = tree->elements[hole_index];
-    if (left_depth > right_depth) {
-        if (AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][(*left_node)]) { // if right child exists cut off parent
-            tree->parent[tree->node[AVL_TREE_LEFT][(*left_node)]] = tree->parent[(*left_node)];
-        }
-        (*left_node) = tree->node[AVL_TREE_LEFT][(*left_node)]; // cut off new hole index
-    } else {
-        if (AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][(*right_node)]) { // if left child exists cut off parent
-            tree->parent[tree->node[AVL_TREE_RIGHT][(*right_node)]] = tree->parent[(*right_node)];
+    // if node has two children replace its element with the in-order neighbour from the higher subtree and cut that one instead
+    if (AVL_TREE_SIZE != tree->nodes[node].child[AVL_TREE_LEFT] && AVL_TREE_SIZE != tree->nodes[node].child[AVL_TREE_RIGHT]) {
+        AVL_TREE_INDEX_TYPE replace = AVL_TREE_SIZE;
+        if (tree->heights[tree->nodes[node].child[AVL_TREE_LEFT]] > tree->heights[tree->nodes[node].child[AVL_TREE_RIGHT]]) {
+            for (AVL_TREE_INDEX_TYPE i = tree->nodes[node].child[AVL_TREE_LEFT]; AVL_TREE_SIZE != i; i = tree->nodes[i].child[AVL_TREE_RIGHT]) {
+                replace = i;
+            }
+        } else {
+            for (AVL_TREE_INDEX_TYPE i = tree->nodes[node].child[AVL_TREE_RIGHT]; AVL_TREE_SIZE != i; i = tree->nodes[i].child[AVL_TREE_LEFT]) {
+                replace = i;
+            }
         }
-        (*right_node) = tree->node[AVL_TREE_RIGHT][(*right_node)]; // cut off new hole index
-    }
 
-    if (tree->size && tree->root == tree->size) { // if head node is last array element then change index to removed one
-        tree->root = hole_index;
+        tree->elements[node] = tree->elements[replace];
+        node = replace;
     }
 
-    // cut hole node from the rest of the tree
-    tree->node[AVL_TREE_LEFT][hole_index] = tree->node[AVL_TREE_RIGHT][hole_index] = tree->parent[hole_index] = hole_index;
-
-    // replace removed element with rightmost array one (or fill hole with valid element)
-    tree->elements[hole_index] = tree->elements[tree->size];
-    tree->node[AVL_TREE_LEFT][hole_index] = tree->node[AVL_TREE_LEFT][tree->size];
-    tree->node[AVL_TREE_RIGHT][hole_index] = tree->node[AVL_TREE_RIGHT][tree->size];
-    tree->parent[hole_index] = tree->parent[tree->size];
-
-    // redirect parent and children of rightmost array node if they dont overlap with removed index
-    const size_t left_last = tree->node[AVL_TREE_LEFT][tree->size];
-    if (AVL_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole_index;
-    }
+    { // cut node with at most one child out of the tree by linking its child to its parent
+        const AVL_TREE_INDEX_TYPE child = AVL_TREE_SIZE != tree->nodes[node].child[AVL_TREE_LEFT] ? tree->nodes[node].child[AVL_TREE_LEFT] : tree->nodes[node].child[AVL_TREE_RIGHT];
+        const AVL_TREE_INDEX_TYPE parent = tree->nodes[node].parent;
 
-    const size_t right_last = tree->node[AVL_TREE_RIGHT][tree->size];
-    if (AVL_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole_index;
-    }
+        if (AVL_TREE_SIZE != child) tree->nodes[child].parent = parent;
 
-    const size_t parent_last = tree->parent[tree->size];
-    if (AVL_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole_index;
+        if (AVL_TREE_SIZE == parent) tree->root = child;
+        else if (node == tree->nodes[parent].child[AVL_TREE_LEFT]) tree->nodes[parent].child[AVL_TREE_LEFT] = child;
+        else tree->nodes[parent].child[AVL_TREE_RIGHT] = child;
     }
 
-    for (size_t n = (*node), p = tree->parent[n]; AVL_TREE_SIZE != n; n = p, p = tree->parent[n]) {
+    // go up the tree from the cut node's parent, update heights and counts, and rotate unbalanced nodes
+    for (AVL_TREE_INDEX_TYPE n = tree->nodes[node].parent; AVL_TREE_SIZE != n; n = tree->nodes[n].parent) {
         // calculate left child's height
-        const size_t left_child = tree->node[AVL_TREE_LEFT][n];
-        const size_t left_child_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][n]) ? 0 : tree->height[tree->node[AVL_TREE_LEFT][n]];
+        const AVL_TREE_INDEX_TYPE left_child = tree->nodes[n].child[AVL_TREE_LEFT];
+        const unsigned char left_child_height = (AVL_TREE_SIZE == left_child) ? 0 : tree->heights[left_child];
 
         // calculate right child's height
-        const size_t right_child = tree->node[AVL_TREE_RIGHT][n];
-        const size_t right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->height[right_child];
+        const AVL_TREE_INDEX_TYPE right_child = tree->nodes[n].child[AVL_TREE_RIGHT];
+        const unsigned char right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->heights[right_child];
 
-        // set new height for each element popped from stack
-        tree->height[n] = 1 + (left_child_height > right_child_height ? left_child_height : right_child_height);
+        // set new height and subtree element count for each node on the path to root
+        tree->heights[n] = (unsigned char)(1 + (left_child_height > right_child_height ? left_child_height : right_child_height));
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[n].count = (AVL_TREE_INDEX_TYPE)(1 + ((AVL_TREE_SIZE == left_child) ? 0 : tree->nodes[left_child].count) + ((AVL_TREE_SIZE == right_child) ? 0 : tree->nodes[right_child].count));
+#endif
 
         // calculate absolute difference of left and right child's heights
-        const size_t abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
+        const int abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
 
         if (abs_balance < 2) { // if tree is balanced continue, else perform rotation/s
             continue;
         }
 
         if (left_child_height < right_child_height) {
-            const size_t left_grand_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][right_child]) ? 0 : tree->height[tree->node[AVL_TREE_LEFT][right_child]];
-            const size_t right_grand_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_RIGHT][right_child]) ? 0 : tree->height[tree->node[AVL_TREE_RIGHT][right_child]];
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_RIGHT]];
 
             if (left_grand_height > right_grand_height) {
-                const size_t x = right_child, y = tree->node[AVL_TREE_LEFT][x], z = tree->node[AVL_TREE_RIGHT][y];
+                { // RIGHT ROTATE RIGHT CHILD
+                    const AVL_TREE_INDEX_TYPE x = right_child, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
 
-                tree->node[AVL_TREE_LEFT][x] = z;
-                if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                tree->parent[y] = tree->parent[x];
+                    tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
 
-                if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                tree->node[AVL_TREE_RIGHT][y] = x;
-                tree->parent[x] = y;
+                    tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                    tree->nodes[x].parent = y;
 
-                const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
             }
+            { // LEFT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
 
-            const size_t x = n, y = tree->node[AVL_TREE_RIGHT][x], z = tree->node[AVL_TREE_LEFT][y];
+                tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
 
-            tree->node[AVL_TREE_RIGHT][x] = z;
-            if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-            tree->parent[y] = tree->parent[x];
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-            if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-            else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-            else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                tree->nodes[x].parent = y;
 
-            tree->node[AVL_TREE_LEFT][y] = x;
-            tree->parent[x] = y;
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-            const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-            const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-            tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-            const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-            const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-            tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
-        }
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
 
-        if (left_child_height > right_child_height) {
-            const size_t left_grand_height = AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][left_child] ? 0 : tree->height[tree->node[AVL_TREE_LEFT][left_child]];
-            const size_t right_grand_height = AVL_TREE_SIZE == tree->node[AVL_TREE_RIGHT][left_child] ? 0 : tree->height[tree->node[AVL_TREE_RIGHT][left_child]];
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
 
-            if (left_grand_height > right_grand_height) {
-                const size_t x = left_child, y = tree->node[AVL_TREE_RIGHT][x], z = tree->node[AVL_TREE_LEFT][y];
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        } else {
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_RIGHT]];
+
+            if (left_grand_height < right_grand_height) {
+                { // LEFT ROTATE LEFT CHILD
+                    const AVL_TREE_INDEX_TYPE x = left_child, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                    tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
 
-                tree->node[AVL_TREE_RIGHT][x] = z;
-                if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                tree->parent[y] = tree->parent[x];
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                    tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                    tree->nodes[x].parent = y;
 
-                tree->node[AVL_TREE_LEFT][y] = x;
-                tree->parent[x] = y;
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-                const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
             }
+            { // RIGHT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
+
+                tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
+
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-            const size_t x = n, y = tree->node[AVL_TREE_LEFT][x], z = tree->node[AVL_TREE_RIGHT][y];
+                tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                tree->nodes[x].parent = y;
 
-            tree->node[AVL_TREE_LEFT][x] = z;
-            if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-            tree->parent[y] = tree->parent[x];
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-            if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-            else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-            else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-            tree->node[AVL_TREE_RIGHT][y] = x;
-            tree->parent[x] = y;
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
 
-            const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-            const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-            tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
 
-            const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-            const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-            tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
         }
     }
 
+    tree->size--;
+    if (node != tree->size) { // if the cut node isn't the last array node then fill its hole with the last one
+        const AVL_TREE_INDEX_TYPE last = (AVL_TREE_INDEX_TYPE)tree->size;
+
+        tree->elements[node] = tree->elements[last];
+        tree->nodes[node].child[AVL_TREE_LEFT] = tree->nodes[last].child[AVL_TREE_LEFT];
+        tree->nodes[node].child[AVL_TREE_RIGHT] = tree->nodes[last].child[AVL_TREE_RIGHT];
+        tree->nodes[node].parent = tree->nodes[last].parent;
+        tree->heights[node] = tree->heights[last];
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[node].count = tree->nodes[last].count;
+#endif
+
+        // redirect children and parent of last array node to the filled hole
+        if (AVL_TREE_SIZE != tree->nodes[last].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[last].child[AVL_TREE_LEFT]].parent = node;
+        if (AVL_TREE_SIZE != tree->nodes[last].child[AVL_TREE_RIGHT]) tree->nodes[tree->nodes[last].child[AVL_TREE_RIGHT]].parent = node;
+
+        if (AVL_TREE_SIZE == tree->nodes[last].parent) tree->root = node;
+        else if (last == tree->nodes[tree->nodes[last].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[last].parent].child[AVL_TREE_LEFT] = node;
+        else tree->nodes[tree->nodes[last].parent].child[AVL_TREE_RIGHT] = node;
+    }
+
+    update_maximum_avl_tree(tree);
+
     return removed;
 }
 
@@ -607,22 +1040,21 @@ static inline bool contains_avl_tree(const avl_tree_s tree, const AVL_TREE_DATA_
     AVL_TREE_ASSERT(tree.size && "[ERROR] Can't check empty tree.");
     AVL_TREE_ASSERT(AVL_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    for (size_t node = tree.root; AVL_TREE_SIZE != node;) {
+    for (AVL_TREE_INDEX_TYPE node = tree.root; AVL_TREE_SIZE != node;) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree.compare(tree.elements[node], element);
+        const int comparison = AVL_TREE_COMPARE_WITH(tree.compare, element, tree.elements[node]);
         if (!comparison) {
             return true;
         }
 
-        const size_t node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
-        node = tree.node[node_index][node]; // go to next child node
+        const AVL_TREE_INDEX_TYPE node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
+        node = tree.nodes[node].child[node_index]; // go to next child node
     }
 
     return false;
@@ -632,15 +1064,14 @@ static inline AVL_TREE_DATA_TYPE get_min_avl_tree(const avl_tree_s tree) {
     AVL_TREE_ASSERT(tree.size && "[ERROR] Can't get from empty tree.");
     AVL_TREE_ASSERT(AVL_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    size_t minimum_node = tree.root;
-    for (size_t i = tree.node[AVL_TREE_LEFT][minimum_node]; AVL_TREE_SIZE != i; i = tree.node[AVL_TREE_LEFT][i]) {
+    AVL_TREE_INDEX_TYPE minimum_node = tree.root;
+    for (AVL_TREE_INDEX_TYPE i = tree.nodes[minimum_node].child[AVL_TREE_LEFT]; AVL_TREE_SIZE != i; i = tree.nodes[i].child[AVL_TREE_LEFT]) {
         minimum_node = i;
     }
 
@@ -651,194 +1082,293 @@ static inline AVL_TREE_DATA_TYPE get_max_avl_tree(const avl_tree_s tree) {
     AVL_TREE_ASSERT(tree.size && "[ERROR] Can't get from empty tree.");
     AVL_TREE_ASSERT(AVL_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    size_t maximum_node = tree.root;
-    for (size_t i = tree.node[AVL_TREE_RIGHT][maximum_node]; AVL_TREE_SIZE != i; i = tree.node[AVL_TREE_RIGHT][i]) {
-        maximum_node = i;
+    return tree.elements[tree.maximum];
+}
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+static inline AVL_TREE_DATA_TYPE select_avl_tree(const avl_tree_s tree, const size_t index) {
+    AVL_TREE_ASSERT(index < tree.size && "[ERROR] Index out of tree bounds.");
+    AVL_TREE_ASSERT(AVL_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
+
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    AVL_TREE_INDEX_TYPE node = tree.root;
+    size_t remaining = index; // remaining is the index of the searched element in node's subtree
+    while (true) {
+        const AVL_TREE_INDEX_TYPE left_child = tree.nodes[node].child[AVL_TREE_LEFT];
+        const AVL_TREE_INDEX_TYPE left_count = AVL_TREE_SIZE == left_child ? 0 : tree.nodes[left_child].count;
+
+        if (remaining == left_count) { // node has exactly 'remaining' smaller elements, so it is the searched one
+            break;
+        }
+
+        if (remaining < left_count) { // searched element is in left subtree
+            node = left_child;
+        } else { // else skip left subtree and node, and search in right subtree
+            remaining -= left_count + 1;
+            node = tree.nodes[node].child[AVL_TREE_RIGHT];
+        }
+    }
+
+    return tree.elements[node];
+}
+
+static inline size_t rank_avl_tree(const avl_tree_s tree, const AVL_TREE_DATA_TYPE element) {
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    size_t rank = 0; // number of elements less than element
+    for (AVL_TREE_INDEX_TYPE node = tree.root; AVL_TREE_SIZE != node;) {
+        if (AVL_TREE_COMPARE_WITH(tree.compare, element, tree.elements[node]) <= 0) { // node and its right subtree aren't less than element
+            node = tree.nodes[node].child[AVL_TREE_LEFT];
+        } else { // else node and its left subtree are less than element
+            const AVL_TREE_INDEX_TYPE left_child = tree.nodes[node].child[AVL_TREE_LEFT];
+            rank += 1 + (size_t)(AVL_TREE_SIZE == left_child ? 0 : tree.nodes[left_child].count);
+            node = tree.nodes[node].child[AVL_TREE_RIGHT];
+        }
     }
 
-    return tree.elements[maximum_node];
+    return rank;
 }
+#endif
 
 static inline AVL_TREE_DATA_TYPE remove_min_avl_tree(avl_tree_s * tree) {
     AVL_TREE_ASSERT(tree->size && "[ERROR] Can't get from empty tree.");
     AVL_TREE_ASSERT(AVL_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
 
-    AVL_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
     AVL_TREE_ASSERT(tree->root != AVL_TREE_SIZE && "[ERROR] Invalid tree root index.");
     AVL_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    AVL_TREE_ASSERT(tree->parent[tree->root] == AVL_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    AVL_TREE_ASSERT(tree->nodes[tree->root].parent == AVL_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t * minimum_node = &(tree->root);
-    for (size_t * i = tree->node[AVL_TREE_LEFT] + (*minimum_node); AVL_TREE_SIZE != (*i); i = tree->node[AVL_TREE_LEFT] + (*i)) {
+    AVL_TREE_INDEX_TYPE minimum_node = tree->root;
+    for (AVL_TREE_INDEX_TYPE i = tree->nodes[minimum_node].child[AVL_TREE_LEFT]; AVL_TREE_SIZE != i; i = tree->nodes[i].child[AVL_TREE_LEFT]) {
         minimum_node = i;
     }
 
-    AVL_TREE_DATA_TYPE removed = tree->elements[(*minimum_node)];
-    tree->size--;
-
-    const size_t hole_index = (*minimum_node);
-    const size_t right_node = tree->node[AVL_TREE_RIGHT][(*minimum_node)];
-    if (AVL_TREE_SIZE != right_node) {
-        tree->parent[right_node] = tree->parent[(*minimum_node)];
-    }
-    (*minimum_node) = right_node;
-
-    // cut hole node from the rest of the tree
-    tree->node[AVL_TREE_LEFT][hole_index] = tree->node[AVL_TREE_RIGHT][hole_index] = tree->parent[hole_index] = hole_index;
-
-    // replace removed element with rightmost array one (or fill hole with valid element)
-    tree->elements[hole_index] = tree->elements[tree->size];
-    tree->node[AVL_TREE_LEFT][hole_index] = tree->node[AVL_TREE_LEFT][tree->size];
-    tree->node[AVL_TREE_RIGHT][hole_index] = tree->node[AVL_TREE_RIGHT][tree->size];
-    tree->parent[hole_index] = tree->parent[tree->size];
+    AVL_TREE_DATA_TYPE removed = tree->elements[minimum_node];
 
-    // redirect parent and children of rightmost last array node if they dont overlap with removed index
-    const size_t left_last = tree->node[AVL_TREE_LEFT][tree->size];
-    if (AVL_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole_index;
-    }
+    { // cut node with at most one child out of the tree by linking its child to its parent
+        const AVL_TREE_INDEX_TYPE child = AVL_TREE_SIZE != tree->nodes[minimum_node].child[AVL_TREE_LEFT] ? tree->nodes[minimum_node].child[AVL_TREE_LEFT] : tree->nodes[minimum_node].child[AVL_TREE_RIGHT];
+        const AVL_TREE_INDEX_TYPE parent = tree->nodes[minimum_node].parent;
 
-    const size_t right_last = tree->node[AVL_TREE_RIGHT][tree->size];
-    if (AVL_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole_index;
-    }
+        if (AVL_TREE_SIZE != child) tree->nodes[child].parent = parent;
 
-    const size_t parent_last = tree->parent[tree->size];
-    if (AVL_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole_index;
+        if (AVL_TREE_SIZE == parent) tree->root = child;
+        else if (minimum_node == tree->nodes[parent].child[AVL_TREE_LEFT]) tree->nodes[parent].child[AVL_TREE_LEFT] = child;
+        else tree->nodes[parent].child[AVL_TREE_RIGHT] = child;
     }
 
-    for (size_t n = (*minimum_node), p = tree->parent[n]; AVL_TREE_SIZE != n; n = p, p = tree->parent[n]) {
+    // go up the tree from the cut node's parent, update heights and counts, and rotate unbalanced nodes
+    for (AVL_TREE_INDEX_TYPE n = tree->nodes[minimum_node].parent; AVL_TREE_SIZE != n; n = tree->nodes[n].parent) {
         // calculate left child's height
-        const size_t left_child = tree->node[AVL_TREE_LEFT][n];
-        const size_t left_child_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][n]) ? 0 : tree->height[tree->node[AVL_TREE_LEFT][n]];
+        const AVL_TREE_INDEX_TYPE left_child = tree->nodes[n].child[AVL_TREE_LEFT];
+        const unsigned char left_child_height = (AVL_TREE_SIZE == left_child) ? 0 : tree->heights[left_child];
 
         // calculate right child's height
-        const size_t right_child = tree->node[AVL_TREE_RIGHT][n];
-        const size_t right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->height[right_child];
+        const AVL_TREE_INDEX_TYPE right_child = tree->nodes[n].child[AVL_TREE_RIGHT];
+        const unsigned char right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->heights[right_child];
 
-        // set new height for each element popped from stack
-        tree->height[n] = 1 + (left_child_height > right_child_height ? left_child_height : right_child_height);
+        // set new height and subtree element count for each node on the path to root
+        tree->heights[n] = (unsigned char)(1 + (left_child_height > right_child_height ? left_child_height : right_child_height));
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[n].count = (AVL_TREE_INDEX_TYPE)(1 + ((AVL_TREE_SIZE == left_child) ? 0 : tree->nodes[left_child].count) + ((AVL_TREE_SIZE == right_child) ? 0 : tree->nodes[right_child].count));
+#endif
 
         // calculate absolute difference of left and right child's heights
-        const size_t abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
+        const int abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
 
         if (abs_balance < 2) { // if tree is balanced continue, else perform rotation/s
             continue;
         }
 
         if (left_child_height < right_child_height) {
-            const size_t left_grand_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][right_child]) ? 0 : tree->height[tree->node[AVL_TREE_LEFT][right_child]];
-            const size_t right_grand_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_RIGHT][right_child]) ? 0 : tree->height[tree->node[AVL_TREE_RIGHT][right_child]];
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_RIGHT]];
 
             if (left_grand_height > right_grand_height) {
-                const size_t x = right_child, y = tree->node[AVL_TREE_LEFT][x], z = tree->node[AVL_TREE_RIGHT][y];
+                { // RIGHT ROTATE RIGHT CHILD
+                    const AVL_TREE_INDEX_TYPE x = right_child, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
 
-                tree->node[AVL_TREE_LEFT][x] = z;
-                if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                tree->parent[y] = tree->parent[x];
+                    tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
 
-                if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                tree->node[AVL_TREE_RIGHT][y] = x;
-                tree->parent[x] = y;
+                    tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                    tree->nodes[x].parent = y;
 
-                const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
             }
+            { // LEFT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
 
-            const size_t x = n, y = tree->node[AVL_TREE_RIGHT][x], z = tree->node[AVL_TREE_LEFT][y];
+                tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
 
-            tree->node[AVL_TREE_RIGHT][x] = z;
-            if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-            tree->parent[y] = tree->parent[x];
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-            if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-            else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-            else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                tree->nodes[x].parent = y;
 
-            tree->node[AVL_TREE_LEFT][y] = x;
-            tree->parent[x] = y;
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-            const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-            const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-            tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-            const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-            const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-            tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
-        }
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
 
-        if (left_child_height > right_child_height) {
-            const size_t left_grand_height = AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][left_child] ? 0 : tree->height[tree->node[AVL_TREE_LEFT][left_child]];
-            const size_t right_grand_height = AVL_TREE_SIZE == tree->node[AVL_TREE_RIGHT][left_child] ? 0 : tree->height[tree->node[AVL_TREE_RIGHT][left_child]];
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
 
-            if (left_grand_height > right_grand_height) {
-                const size_t x = left_child, y = tree->node[AVL_TREE_RIGHT][x], z = tree->node[AVL_TREE_LEFT][y];
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        } else {
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_RIGHT]];
+
+            if (left_grand_height < right_grand_height) {
+                { // LEFT ROTATE LEFT CHILD
+                    const AVL_TREE_INDEX_TYPE x = left_child, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                    tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
 
-                tree->node[AVL_TREE_RIGHT][x] = z;
-                if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                tree->parent[y] = tree->parent[x];
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                    tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                    tree->nodes[x].parent = y;
 
-                tree->node[AVL_TREE_LEFT][y] = x;
-                tree->parent[x] = y;
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-                const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
             }
+            { // RIGHT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
 
-            const size_t x = n, y = tree->node[AVL_TREE_LEFT][x], z = tree->node[AVL_TREE_RIGHT][y];
+                tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
 
-            tree->node[AVL_TREE_LEFT][x] = z;
-            if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-            tree->parent[y] = tree->parent[x];
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-            if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-            else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-            else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                tree->nodes[x].parent = y;
 
-            tree->node[AVL_TREE_RIGHT][y] = x;
-            tree->parent[x] = y;
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-            const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-            const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-            tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-            const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-            const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-            tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
-        }
-    }
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        }
+    }
+
+    tree->size--;
+    if (minimum_node != tree->size) { // if the cut node isn't the last array node then fill its hole with the last one
+        const AVL_TREE_INDEX_TYPE last = (AVL_TREE_INDEX_TYPE)tree->size;
+
+        tree->elements[minimum_node] = tree->elements[last];
+        tree->nodes[minimum_node].child[AVL_TREE_LEFT] = tree->nodes[last].child[AVL_TREE_LEFT];
+        tree->nodes[minimum_node].child[AVL_TREE_RIGHT] = tree->nodes[last].child[AVL_TREE_RIGHT];
+        tree->nodes[minimum_node].parent = tree->nodes[last].parent;
+        tree->heights[minimum_node] = tree->heights[last];
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[minimum_node].count = tree->nodes[last].count;
+#endif
+
+        // redirect children and parent of last array node to the filled hole
+        if (AVL_TREE_SIZE != tree->nodes[last].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[last].child[AVL_TREE_LEFT]].parent = minimum_node;
+        if (AVL_TREE_SIZE != tree->nodes[last].child[AVL_TREE_RIGHT]) tree->nodes[tree->nodes[last].child[AVL_TREE_RIGHT]].parent = minimum_node;
+
+        if (AVL_TREE_SIZE == tree->nodes[last].parent) tree->root = minimum_node;
+        else if (last == tree->nodes[tree->nodes[last].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[last].parent].child[AVL_TREE_LEFT] = minimum_node;
+        else tree->nodes[tree->nodes[last].parent].child[AVL_TREE_RIGHT] = minimum_node;
+    }
+
+    update_maximum_avl_tree(tree);
 
     return removed;
 }
@@ -847,193 +1377,999 @@ static inline AVL_TREE_DATA_TYPE remove_max_avl_tree(avl_tree_s * tree) {
     AVL_TREE_ASSERT(tree->size && "[ERROR] Can't get from empty tree.");
     AVL_TREE_ASSERT(AVL_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
 
-    AVL_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
     AVL_TREE_ASSERT(tree->root != AVL_TREE_SIZE && "[ERROR] Invalid tree root index.");
     AVL_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    AVL_TREE_ASSERT(tree->parent[tree->root] == AVL_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    AVL_TREE_ASSERT(tree->nodes[tree->root].parent == AVL_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t * maximum_node = &(tree->root);
-    for (size_t * i = tree->node[AVL_TREE_RIGHT] + (*maximum_node); AVL_TREE_SIZE != (*i); i = tree->node[AVL_TREE_RIGHT] + (*i)) {
+    AVL_TREE_INDEX_TYPE maximum_node = tree->root;
+    for (AVL_TREE_INDEX_TYPE i = tree->nodes[maximum_node].child[AVL_TREE_RIGHT]; AVL_TREE_SIZE != i; i = tree->nodes[i].child[AVL_TREE_RIGHT]) {
         maximum_node = i;
     }
 
-    AVL_TREE_DATA_TYPE removed = tree->elements[(*maximum_node)];
-    tree->size--;
+    AVL_TREE_DATA_TYPE removed = tree->elements[maximum_node];
+
+    { // cut node with at most one child out of the tree by linking its child to its parent
+        const AVL_TREE_INDEX_TYPE child = AVL_TREE_SIZE != tree->nodes[maximum_node].child[AVL_TREE_LEFT] ? tree->nodes[maximum_node].child[AVL_TREE_LEFT] : tree->nodes[maximum_node].child[AVL_TREE_RIGHT];
+        const AVL_TREE_INDEX_TYPE parent = tree->nodes[maximum_node].parent;
 
-    const size_t hole_index = (*maximum_node);
-    const size_t left_node = tree->node[AVL_TREE_LEFT][(*maximum_node)];
-    if (AVL_TREE_SIZE != left_node) {
-        tree->parent[left_node] = tree->parent[(*maximum_node)];
+        if (AVL_TREE_SIZE != child) tree->nodes[child].parent = parent;
+
+        if (AVL_TREE_SIZE == parent) tree->root = child;
+        else if (maximum_node == tree->nodes[parent].child[AVL_TREE_LEFT]) tree->nodes[parent].child[AVL_TREE_LEFT] = child;
+        else tree->nodes[parent].child[AVL_TREE_RIGHT] = child;
     }
-    (*maximum_node) = left_node;
 
-    // cut hole node from the rest of the tree
-    tree->node[AVL_TREE_LEFT][hole_index] = tree->node[AVL_TREE_RIGHT][hole_index] = tree->parent[hole_index] = hole_index;
+    // go up the tree from the cut node's parent, update heights and counts, and rotate unbalanced nodes
+    for (AVL_TREE_INDEX_TYPE n = tree->nodes[maximum_node].parent; AVL_TREE_SIZE != n; n = tree->nodes[n].parent) {
+        // calculate left child's height
+        const AVL_TREE_INDEX_TYPE left_child = tree->nodes[n].child[AVL_TREE_LEFT];
+        const unsigned char left_child_height = (AVL_TREE_SIZE == left_child) ? 0 : tree->heights[left_child];
 
-    // replace removed element with rightmost array one (or fill hole with valid element)
-    tree->elements[hole_index] = tree->elements[tree->size];
-    tree->node[AVL_TREE_LEFT][hole_index] = tree->node[AVL_TREE_LEFT][tree->size];
-    tree->node[AVL_TREE_RIGHT][hole_index] = tree->node[AVL_TREE_RIGHT][tree->size];
-    tree->parent[hole_index] = tree->parent[tree->size];
+        // calculate right child's height
+        const AVL_TREE_INDEX_TYPE right_child = tree->nodes[n].child[AVL_TREE_RIGHT];
+        const unsigned char right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->heights[right_child];
+
+        // set new height and subtree element count for each node on the path to root
+        tree->heights[n] = (unsigned char)(1 + (left_child_height > right_child_height ? left_child_height : right_child_height));
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[n].count = (AVL_TREE_INDEX_TYPE)(1 + ((AVL_TREE_SIZE == left_child) ? 0 : tree->nodes[left_child].count) + ((AVL_TREE_SIZE == right_child) ? 0 : tree->nodes[right_child].count));
+#endif
 
-    // redirect parent and children of rightmost last array node if they dont overlap with removed index
-    const size_t left_last = tree->node[AVL_TREE_LEFT][tree->size];
-    if (AVL_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole_index;
+        // calculate absolute difference of left and right child's heights
+        const int abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
+
+        if (abs_balance < 2) { // if tree is balanced continue, else perform rotation/s
+            continue;
+        }
+
+        if (left_child_height < right_child_height) {
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_RIGHT]];
+
+            if (left_grand_height > right_grand_height) {
+                { // RIGHT ROTATE RIGHT CHILD
+                    const AVL_TREE_INDEX_TYPE x = right_child, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
+
+                    tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
+
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
+
+                    tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                    tree->nodes[x].parent = y;
+
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
+            }
+            { // LEFT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
+
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
+
+                tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                tree->nodes[x].parent = y;
+
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        } else {
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_RIGHT]];
+
+            if (left_grand_height < right_grand_height) {
+                { // LEFT ROTATE LEFT CHILD
+                    const AVL_TREE_INDEX_TYPE x = left_child, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                    tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
+
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
+
+                    tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                    tree->nodes[x].parent = y;
+
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
+            }
+            { // RIGHT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
+
+                tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
+
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
+
+                tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                tree->nodes[x].parent = y;
+
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
+
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
+
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        }
     }
 
-    const size_t right_last = tree->node[AVL_TREE_RIGHT][tree->size];
-    if (AVL_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole_index;
+    tree->size--;
+    if (maximum_node != tree->size) { // if the cut node isn't the last array node then fill its hole with the last one
+        const AVL_TREE_INDEX_TYPE last = (AVL_TREE_INDEX_TYPE)tree->size;
+
+        tree->elements[maximum_node] = tree->elements[last];
+        tree->nodes[maximum_node].child[AVL_TREE_LEFT] = tree->nodes[last].child[AVL_TREE_LEFT];
+        tree->nodes[maximum_node].child[AVL_TREE_RIGHT] = tree->nodes[last].child[AVL_TREE_RIGHT];
+        tree->nodes[maximum_node].parent = tree->nodes[last].parent;
+        tree->heights[maximum_node] = tree->heights[last];
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[maximum_node].count = tree->nodes[last].count;
+#endif
+
+        // redirect children and parent of last array node to the filled hole
+        if (AVL_TREE_SIZE != tree->nodes[last].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[last].child[AVL_TREE_LEFT]].parent = maximum_node;
+        if (AVL_TREE_SIZE != tree->nodes[last].child[AVL_TREE_RIGHT]) tree->nodes[tree->nodes[last].child[AVL_TREE_RIGHT]].parent = maximum_node;
+
+        if (AVL_TREE_SIZE == tree->nodes[last].parent) tree->root = maximum_node;
+        else if (last == tree->nodes[tree->nodes[last].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[last].parent].child[AVL_TREE_LEFT] = maximum_node;
+        else tree->nodes[tree->nodes[last].parent].child[AVL_TREE_RIGHT] = maximum_node;
     }
 
-    const size_t parent_last = tree->parent[tree->size];
-    if (AVL_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? AVL_TREE_LEFT : AVL_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole_index;
+    update_maximum_avl_tree(tree);
+
+    return removed;
+}
+
+// joins left and right subtrees, whose nodes are already in tree's arrays, with pivot node between them into tree's root
+static inline void join_pivot_avl_tree(avl_tree_s * tree, const AVL_TREE_INDEX_TYPE left, const AVL_TREE_INDEX_TYPE pivot, const AVL_TREE_INDEX_TYPE right) {
+    AVL_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    AVL_TREE_ASSERT(pivot < AVL_TREE_SIZE && "[ERROR] Invalid pivot node.");
+
+    if (AVL_TREE_SIZE != left) tree->nodes[left].parent = AVL_TREE_SIZE;
+    if (AVL_TREE_SIZE != right) tree->nodes[right].parent = AVL_TREE_SIZE;
+
+    const unsigned char left_height = AVL_TREE_SIZE == left ? 0 : tree->heights[left];
+    const unsigned char right_height = AVL_TREE_SIZE == right ? 0 : tree->heights[right];
+
+    if (left_height <= right_height + 1 && right_height <= left_height + 1) { // if heights are close enough then pivot becomes root of both trees
+        tree->nodes[pivot].child[AVL_TREE_LEFT] = left;
+        tree->nodes[pivot].child[AVL_TREE_RIGHT] = right;
+        tree->nodes[pivot].parent = AVL_TREE_SIZE;
+
+        if (AVL_TREE_SIZE != left) tree->nodes[left].parent = pivot;
+        if (AVL_TREE_SIZE != right) tree->nodes[right].parent = pivot;
+        tree->root = pivot;
+    } else if (left_height > right_height) { // else if left tree is higher then pivot replaces first node on left's right spine that is at most one higher than right tree
+        AVL_TREE_INDEX_TYPE parent = AVL_TREE_SIZE, node = left;
+        while (AVL_TREE_SIZE != node && tree->heights[node] > right_height + 1) {
+            parent = node;
+            node = tree->nodes[node].child[AVL_TREE_RIGHT];
+        }
+
+        tree->nodes[pivot].child[AVL_TREE_LEFT] = node;
+        tree->nodes[pivot].child[AVL_TREE_RIGHT] = right;
+        tree->nodes[pivot].parent = parent;
+        tree->nodes[parent].child[AVL_TREE_RIGHT] = pivot;
+
+        if (AVL_TREE_SIZE != node) tree->nodes[node].parent = pivot;
+        if (AVL_TREE_SIZE != right) tree->nodes[right].parent = pivot;
+        tree->root = left;
+    } else { // else right tree is higher and pivot replaces first node on right's left spine that is at most one higher than left tree
+        AVL_TREE_INDEX_TYPE parent = AVL_TREE_SIZE, node = right;
+        while (AVL_TREE_SIZE != node && tree->heights[node] > left_height + 1) {
+            parent = node;
+            node = tree->nodes[node].child[AVL_TREE_LEFT];
+        }
+
+        tree->nodes[pivot].child[AVL_TREE_LEFT] = left;
+        tree->nodes[pivot].child[AVL_TREE_RIGHT] = node;
+        tree->nodes[pivot].parent = parent;
+        tree->nodes[parent].child[AVL_TREE_LEFT] = pivot;
+
+        if (AVL_TREE_SIZE != left) tree->nodes[left].parent = pivot;
+        if (AVL_TREE_SIZE != node) tree->nodes[node].parent = pivot;
+        tree->root = right;
     }
 
-    for (size_t n = (*maximum_node), p = tree->parent[n]; AVL_TREE_SIZE != n; n = p, p = tree->parent[n]) {
+    // go up the tree from pivot, update heights and counts, and rotate unbalanced nodes
+    for (AVL_TREE_INDEX_TYPE n = pivot; AVL_TREE_SIZE != n; n = tree->nodes[n].parent) {
         // calculate left child's height
-        const size_t left_child = tree->node[AVL_TREE_LEFT][n];
-        const size_t left_child_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][n]) ? 0 : tree->height[tree->node[AVL_TREE_LEFT][n]];
+        const AVL_TREE_INDEX_TYPE left_child = tree->nodes[n].child[AVL_TREE_LEFT];
+        const unsigned char left_child_height = (AVL_TREE_SIZE == left_child) ? 0 : tree->heights[left_child];
 
         // calculate right child's height
-        const size_t right_child = tree->node[AVL_TREE_RIGHT][n];
-        const size_t right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->height[right_child];
+        const AVL_TREE_INDEX_TYPE right_child = tree->nodes[n].child[AVL_TREE_RIGHT];
+        const unsigned char right_child_height = (AVL_TREE_SIZE == right_child) ? 0 : tree->heights[right_child];
 
-        // set new height for each element popped from stack
-        tree->height[n] = 1 + (left_child_height > right_child_height ? left_child_height : right_child_height);
+        // set new height and subtree element count for each node on the path to root
+        tree->heights[n] = (unsigned char)(1 + (left_child_height > right_child_height ? left_child_height : right_child_height));
+#ifdef AVL_TREE_ORDER_STATISTICS
+        tree->nodes[n].count = (AVL_TREE_INDEX_TYPE)(1 + ((AVL_TREE_SIZE == left_child) ? 0 : tree->nodes[left_child].count) + ((AVL_TREE_SIZE == right_child) ? 0 : tree->nodes[right_child].count));
+#endif
 
         // calculate absolute difference of left and right child's heights
-        const size_t abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
+        const int abs_balance = left_child_height > right_child_height ? left_child_height - right_child_height : right_child_height - left_child_height;
 
         if (abs_balance < 2) { // if tree is balanced continue, else perform rotation/s
             continue;
         }
 
         if (left_child_height < right_child_height) {
-            const size_t left_grand_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][right_child]) ? 0 : tree->height[tree->node[AVL_TREE_LEFT][right_child]];
-            const size_t right_grand_height = (AVL_TREE_SIZE == tree->node[AVL_TREE_RIGHT][right_child]) ? 0 : tree->height[tree->node[AVL_TREE_RIGHT][right_child]];
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[right_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[right_child].child[AVL_TREE_RIGHT]];
 
             if (left_grand_height > right_grand_height) {
-                const size_t x = right_child, y = tree->node[AVL_TREE_LEFT][x], z = tree->node[AVL_TREE_RIGHT][y];
+                { // RIGHT ROTATE RIGHT CHILD
+                    const AVL_TREE_INDEX_TYPE x = right_child, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
+
+                    tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
+
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                tree->node[AVL_TREE_LEFT][x] = z;
-                if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                tree->parent[y] = tree->parent[x];
+                    tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                    tree->nodes[x].parent = y;
 
-                if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                tree->node[AVL_TREE_RIGHT][y] = x;
-                tree->parent[x] = y;
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-                const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
 
-                const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
             }
+            { // LEFT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
 
-            const size_t x = n, y = tree->node[AVL_TREE_RIGHT][x], z = tree->node[AVL_TREE_LEFT][y];
+                tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
 
-            tree->node[AVL_TREE_RIGHT][x] = z;
-            if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-            tree->parent[y] = tree->parent[x];
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-            if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-            else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-            else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                tree->nodes[x].parent = y;
 
-            tree->node[AVL_TREE_LEFT][y] = x;
-            tree->parent[x] = y;
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-            const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-            const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-            tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-            const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-            const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-            tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
-        }
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
 
-        if (left_child_height > right_child_height) {
-            const size_t left_grand_height = AVL_TREE_SIZE == tree->node[AVL_TREE_LEFT][left_child] ? 0 : tree->height[tree->node[AVL_TREE_LEFT][left_child]];
-            const size_t right_grand_height = AVL_TREE_SIZE == tree->node[AVL_TREE_RIGHT][left_child] ? 0 : tree->height[tree->node[AVL_TREE_RIGHT][left_child]];
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
 
-            if (left_grand_height > right_grand_height) {
-                const size_t x = left_child, y = tree->node[AVL_TREE_RIGHT][x], z = tree->node[AVL_TREE_LEFT][y];
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
+        } else {
+            const unsigned char left_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_LEFT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_LEFT]];
+            const unsigned char right_grand_height = (AVL_TREE_SIZE == tree->nodes[left_child].child[AVL_TREE_RIGHT]) ? 0 : tree->heights[tree->nodes[left_child].child[AVL_TREE_RIGHT]];
+
+            if (left_grand_height < right_grand_height) {
+                { // LEFT ROTATE LEFT CHILD
+                    const AVL_TREE_INDEX_TYPE x = left_child, y = tree->nodes[x].child[AVL_TREE_RIGHT], z = tree->nodes[y].child[AVL_TREE_LEFT];
+
+                    tree->nodes[x].child[AVL_TREE_RIGHT] = z;
+                    if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                    tree->nodes[y].parent = tree->nodes[x].parent;
 
-                tree->node[AVL_TREE_RIGHT][x] = z;
-                if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-                tree->parent[y] = tree->parent[x];
+                    if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                    else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                    else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-                if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-                else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-                else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                    tree->nodes[y].child[AVL_TREE_LEFT] = x;
+                    tree->nodes[x].parent = y;
 
-                tree->node[AVL_TREE_LEFT][y] = x;
-                tree->parent[x] = y;
+                    const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-                const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-                const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-                tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+                    const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                    const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                    tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-                const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-                const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-                tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+#ifdef AVL_TREE_ORDER_STATISTICS
+                    const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
+
+                    const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                    const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                    tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+                }
             }
+            { // RIGHT ROTATE CURRENT NODE
+                const AVL_TREE_INDEX_TYPE x = n, y = tree->nodes[x].child[AVL_TREE_LEFT], z = tree->nodes[y].child[AVL_TREE_RIGHT];
+
+                tree->nodes[x].child[AVL_TREE_LEFT] = z;
+                if (AVL_TREE_SIZE != z) tree->nodes[z].parent = x;
+                tree->nodes[y].parent = tree->nodes[x].parent;
 
-            const size_t x = n, y = tree->node[AVL_TREE_LEFT][x], z = tree->node[AVL_TREE_RIGHT][y];
+                if (AVL_TREE_SIZE == tree->nodes[x].parent) tree->root = y;
+                else if (x == tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[x].parent].child[AVL_TREE_LEFT] = y;
+                else tree->nodes[tree->nodes[x].parent].child[AVL_TREE_RIGHT] = y;
 
-            tree->node[AVL_TREE_LEFT][x] = z;
-            if (AVL_TREE_SIZE != z) tree->parent[z] = x;
-            tree->parent[y] = tree->parent[x];
+                tree->nodes[y].child[AVL_TREE_RIGHT] = x;
+                tree->nodes[x].parent = y;
 
-            if (AVL_TREE_SIZE == tree->parent[x]) tree->root = y;
-            else if (x == tree->node[AVL_TREE_LEFT][tree->parent[x]]) tree->node[AVL_TREE_LEFT][tree->parent[x]] = y;
-            else tree->node[AVL_TREE_RIGHT][tree->parent[x]] = y;
+                const unsigned char x_left_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[x].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char x_right_height = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[x].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[x] = (unsigned char)(1 + (x_right_height > x_left_height ? x_right_height : x_left_height));
 
-            tree->node[AVL_TREE_RIGHT][y] = x;
-            tree->parent[x] = y;
+                const unsigned char y_left_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->heights[tree->nodes[y].child[AVL_TREE_LEFT]] : 0;
+                const unsigned char y_right_height = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->heights[tree->nodes[y].child[AVL_TREE_RIGHT]] : 0;
+                tree->heights[y] = (unsigned char)(1 + (y_right_height > y_left_height ? y_right_height : y_left_height));
 
-            const size_t x_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][x] ? tree->height[tree->node[AVL_TREE_LEFT][x]] : 0;
-            const size_t x_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][x] ? tree->height[tree->node[AVL_TREE_RIGHT][x]] : 0;
-            tree->height[x] = 1 + (x_right_height > x_left_height ? x_right_height : x_left_height);
+#ifdef AVL_TREE_ORDER_STATISTICS
+                const AVL_TREE_INDEX_TYPE x_left_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE x_right_count = AVL_TREE_SIZE != tree->nodes[x].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[x].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[x].count = (AVL_TREE_INDEX_TYPE)(1 + x_left_count + x_right_count);
 
-            const size_t y_left_height = AVL_TREE_SIZE != tree->node[AVL_TREE_LEFT][y] ? tree->height[tree->node[AVL_TREE_LEFT][y]] : 0;
-            const size_t y_right_height = AVL_TREE_SIZE != tree->node[AVL_TREE_RIGHT][y] ? tree->height[tree->node[AVL_TREE_RIGHT][y]] : 0;
-            tree->height[y] = 1 + (y_right_height > y_left_height ? y_right_height : y_left_height);
+                const AVL_TREE_INDEX_TYPE y_left_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_LEFT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_LEFT]].count : 0;
+                const AVL_TREE_INDEX_TYPE y_right_count = AVL_TREE_SIZE != tree->nodes[y].child[AVL_TREE_RIGHT] ? tree->nodes[tree->nodes[y].child[AVL_TREE_RIGHT]].count : 0;
+                tree->nodes[y].count = (AVL_TREE_INDEX_TYPE)(1 + y_left_count + y_right_count);
+#endif
+
+                n = y; // continue upwards from the new root of the rotated subtree
+            }
         }
     }
-    return removed;
+}
+
+// returns node's in-order neighbour, successor if direction is right and predecessor if left, or NIL node if there is none
+static inline AVL_TREE_INDEX_TYPE step_avl_tree(const avl_tree_s tree, AVL_TREE_INDEX_TYPE node, const AVL_TREE_INDEX_TYPE direction) {
+    const AVL_TREE_INDEX_TYPE opposite = (AVL_TREE_INDEX_TYPE)(!direction);
+    if (AVL_TREE_SIZE != tree.nodes[node].child[direction]) { // neighbour is the outermost opposite node of direction's subtree
+        node = tree.nodes[node].child[direction];
+        while (AVL_TREE_SIZE != tree.nodes[node].child[opposite]) {
+            node = tree.nodes[node].child[opposite];
+        }
+
+        return node;
+    }
+
+    // else neighbour is the first ancestor whose opposite subtree contains node
+    AVL_TREE_INDEX_TYPE parent = tree.nodes[node].parent;
+    while (AVL_TREE_SIZE != parent && node == tree.nodes[parent].child[direction]) {
+        node = parent;
+        parent = tree.nodes[parent].parent;
+    }
+
+    return parent;
+}
+
+static inline void join_avl_tree(avl_tree_s * restrict destination, avl_tree_s * restrict source) {
+    AVL_TREE_ASSERT(destination && "[ERROR] 'destination' parameter is NULL.");
+    AVL_TREE_ASSERT(source && "[ERROR] 'source' parameter is NULL.");
+    AVL_TREE_ASSERT(destination != source && "[ERROR] Trees can't be the same.");
+    AVL_TREE_ASSERT(destination->size + source->size <= AVL_TREE_SIZE && "[ERROR] Join will exceed maximum size.");
+    AVL_TREE_COMPARE_ASSERT(destination->compare == source->compare && "[ERROR] Compare functions must be the same.");
+
+    AVL_TREE_COMPARE_ASSERT(destination->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(destination->elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(destination->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(destination->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(destination->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    AVL_TREE_COMPARE_ASSERT(source->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(source->elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(source->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(source->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(source->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // smaller tree is appended into larger one's arrays, thus both trees swap if source is larger
+    if (source->size > destination->size) {
+        const avl_tree_s temp = (*destination);
+        (*destination) = (*source);
+        (*source) = temp;
+    }
+
+    if (!source->size) {
+        return;
+    }
+
+    // source's elements must either all be not less or all be not greater than destination's
+    bool is_greater = true;
+    if (destination->size) {
+        is_greater = AVL_TREE_COMPARE_WITH(destination->compare, get_max_avl_tree(*destination), get_min_avl_tree(*source)) <= 0;
+        AVL_TREE_ASSERT((is_greater || AVL_TREE_COMPARE_WITH(destination->compare, get_max_avl_tree(*source), get_min_avl_tree(*destination)) <= 0) && "[ERROR] Trees' element ranges overlap.");
+    }
+
+    // source's element bordering destination is taken out to become the pivot node joining both trees
+    const AVL_TREE_DATA_TYPE element = is_greater ? remove_min_avl_tree(source) : remove_max_avl_tree(source);
+
+    // append source's nodes behind destination's by shifting all their valid indexes
+    const AVL_TREE_INDEX_TYPE offset = (AVL_TREE_INDEX_TYPE)destination->size;
+    memcpy(destination->elements + offset, source->elements, source->size * sizeof(AVL_TREE_DATA_TYPE));
+    memcpy(destination->heights + offset, source->heights, source->size * sizeof(unsigned char));
+    for (size_t i = 0; i < source->size; ++i) {
+        avl_tree_node_s record = source->nodes[i];
+        if (AVL_TREE_SIZE != record.child[AVL_TREE_LEFT]) record.child[AVL_TREE_LEFT] += offset;
+        if (AVL_TREE_SIZE != record.child[AVL_TREE_RIGHT]) record.child[AVL_TREE_RIGHT] += offset;
+        if (AVL_TREE_SIZE != record.parent) record.parent += offset;
+        destination->nodes[offset + i] = record;
+    }
+
+    const AVL_TREE_INDEX_TYPE appended = source->size ? (AVL_TREE_INDEX_TYPE)(source->root + offset) : AVL_TREE_SIZE;
+    const AVL_TREE_INDEX_TYPE pivot = (AVL_TREE_INDEX_TYPE)(destination->size + source->size);
+    memcpy(destination->elements + pivot, &element, sizeof(AVL_TREE_DATA_TYPE));
+
+    destination->size += source->size + 1;
+    source->size = 0;
+    source->root = source->maximum = AVL_TREE_SIZE;
+
+    const AVL_TREE_INDEX_TYPE left = is_greater ? destination->root : appended;
+    const AVL_TREE_INDEX_TYPE right = is_greater ? appended : destination->root;
+    join_pivot_avl_tree(destination, left, pivot, right);
+    update_maximum_avl_tree(destination);
+}
+
+static inline avl_tree_s split_avl_tree(avl_tree_s * tree, const AVL_TREE_DATA_TYPE element) {
+    AVL_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // highest node less than element ends lesser side and lowest node not less than element starts greater side
+    AVL_TREE_INDEX_TYPE highest = AVL_TREE_SIZE, lowest = AVL_TREE_SIZE;
+    for (AVL_TREE_INDEX_TYPE n = tree->root; AVL_TREE_SIZE != n;) {
+        if (AVL_TREE_COMPARE_WITH(tree->compare, element, tree->elements[n]) <= 0) {
+            lowest = n;
+            n = tree->nodes[n].child[AVL_TREE_LEFT];
+        } else {
+            highest = n;
+            n = tree->nodes[n].child[AVL_TREE_RIGHT];
+        }
+    }
+
+    // both sides are walked outwards in lockstep until one ends, thus only the smaller side is moved out of tree's arrays
+    AVL_TREE_INDEX_TYPE lesser_node = highest, greater_node = lowest;
+    while (AVL_TREE_SIZE != lesser_node && AVL_TREE_SIZE != greater_node) {
+        lesser_node = step_avl_tree(*tree, lesser_node, AVL_TREE_LEFT);
+        greater_node = step_avl_tree(*tree, greater_node, AVL_TREE_RIGHT);
+    }
+    const bool is_greater_moved = (AVL_TREE_SIZE == greater_node);
+
+    // moved side is collected in order, lesser side starts at tree's leftmost node and ends right before greater side
+    avl_tree_s moved = create_avl_tree(AVL_TREE_COMPARE_FUNCTION(tree->compare));
+    AVL_TREE_INDEX_TYPE node = lowest, end = AVL_TREE_SIZE;
+    if (!is_greater_moved) {
+        for (node = tree->root; AVL_TREE_SIZE != tree->nodes[node].child[AVL_TREE_LEFT];) {
+            node = tree->nodes[node].child[AVL_TREE_LEFT];
+        }
+        end = lowest;
+    }
+
+    for (; end != node; node = step_avl_tree(*tree, node, AVL_TREE_RIGHT)) {
+        // moved tree's node records are built at the end, thus they temporarily store the moved node's index
+        moved.elements[moved.size] = tree->elements[node];
+        moved.nodes[moved.size++].parent = node;
+    }
+
+    // nodes on the search path that stay are the only ones that lose a subtree, tree height is below twice the bit count
+    AVL_TREE_INDEX_TYPE path[sizeof(AVL_TREE_INDEX_TYPE) << 4];
+    size_t path_size = 0;
+    for (AVL_TREE_INDEX_TYPE n = tree->root; AVL_TREE_SIZE != n;) {
+        const bool is_greater = AVL_TREE_COMPARE_WITH(tree->compare, element, tree->elements[n]) <= 0;
+        if (is_greater != is_greater_moved) {
+            path[path_size++] = n;
+        }
+        n = tree->nodes[n].child[is_greater ? AVL_TREE_LEFT : AVL_TREE_RIGHT];
+    }
+
+    // join path nodes bottom up with their kept subtrees, since everything joined below a path node is on its moved side
+    tree->root = AVL_TREE_SIZE;
+    while (path_size) {
+        const AVL_TREE_INDEX_TYPE pivot = path[--path_size];
+        if (is_greater_moved) {
+            join_pivot_avl_tree(tree, tree->nodes[pivot].child[AVL_TREE_LEFT], pivot, tree->root);
+        } else {
+            join_pivot_avl_tree(tree, tree->root, pivot, tree->nodes[pivot].child[AVL_TREE_RIGHT]);
+        }
+    }
+
+    // mark moved nodes as holes by making them their own parent
+    for (size_t i = 0; i < moved.size; ++i) {
+        const AVL_TREE_INDEX_TYPE hole = moved.nodes[i].parent;
+        tree->nodes[hole].parent = hole;
+    }
+
+    // fill holes below remaining size with remaining nodes above it
+    const size_t size = tree->size - moved.size;
+    AVL_TREE_INDEX_TYPE hole = 0;
+    for (AVL_TREE_INDEX_TYPE last = (AVL_TREE_INDEX_TYPE)size; last < tree->size; ++last) {
+        if (last == tree->nodes[last].parent) {
+            continue;
+        }
+
+        while (hole != tree->nodes[hole].parent) {
+            hole++;
+        }
+
+        tree->elements[hole] = tree->elements[last];
+        tree->nodes[hole] = tree->nodes[last];
+        tree->heights[hole] = tree->heights[last];
+
+        if (AVL_TREE_SIZE != tree->nodes[last].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[last].child[AVL_TREE_LEFT]].parent = hole;
+        if (AVL_TREE_SIZE != tree->nodes[last].child[AVL_TREE_RIGHT]) tree->nodes[tree->nodes[last].child[AVL_TREE_RIGHT]].parent = hole;
+
+        if (AVL_TREE_SIZE == tree->nodes[last].parent) tree->root = hole;
+        else if (last == tree->nodes[tree->nodes[last].parent].child[AVL_TREE_LEFT]) tree->nodes[tree->nodes[last].parent].child[AVL_TREE_LEFT] = hole;
+        else tree->nodes[tree->nodes[last].parent].child[AVL_TREE_RIGHT] = hole;
+
+        hole++;
+    }
+    tree->size = size;
+    update_maximum_avl_tree(tree);
+
+    // build moved tree from its sorted elements
+    link_sorted_avl_tree(&moved);
+
+    if (is_greater_moved) {
+        return moved;
+    }
+
+    // tree keeps lesser elements, thus it swaps with moved lesser tree and returns its own greater one
+    const avl_tree_s greater = (*tree);
+    (*tree) = moved;
+
+    return greater;
+}
+
+static inline avl_tree_cursor_s begin_avl_tree(const avl_tree_s tree) {
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    avl_tree_cursor_s cursor = { .element = NULL, .node = tree.root, };
+    if (AVL_TREE_SIZE == cursor.node) { // if tree is empty then cursor is past the end
+        return cursor;
+    }
+
+    // first element is the leftmost node
+    while (AVL_TREE_SIZE != tree.nodes[cursor.node].child[AVL_TREE_LEFT]) {
+        cursor.node = tree.nodes[cursor.node].child[AVL_TREE_LEFT];
+    }
+    cursor.element = tree.elements + cursor.node;
+
+    return cursor;
+}
+
+static inline avl_tree_cursor_s rbegin_avl_tree(const avl_tree_s tree) {
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // last element is the cached rightmost node, if tree is empty then cursor is past the end
+    const avl_tree_cursor_s cursor = { .element = AVL_TREE_SIZE == tree.maximum ? NULL : tree.elements + tree.maximum, .node = tree.maximum, };
+
+    return cursor;
+}
+
+static inline avl_tree_cursor_s next_avl_tree(const avl_tree_s tree, const avl_tree_cursor_s cursor) {
+    AVL_TREE_ASSERT(cursor.element && "[ERROR] Can't move cursor that is past the end.");
+    AVL_TREE_ASSERT(cursor.node < tree.size && "[ERROR] Invalid cursor node index.");
+
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    avl_tree_cursor_s next = { .element = NULL, .node = tree.nodes[cursor.node].child[AVL_TREE_RIGHT], };
+    if (AVL_TREE_SIZE != next.node) { // successor is the leftmost node of right subtree
+        while (AVL_TREE_SIZE != tree.nodes[next.node].child[AVL_TREE_LEFT]) {
+            next.node = tree.nodes[next.node].child[AVL_TREE_LEFT];
+        }
+    } else { // else successor is the first ancestor whose left subtree contains node
+        AVL_TREE_INDEX_TYPE child = cursor.node;
+        next.node = tree.nodes[child].parent;
+        while (AVL_TREE_SIZE != next.node && child == tree.nodes[next.node].child[AVL_TREE_RIGHT]) {
+            child = next.node;
+            next.node = tree.nodes[next.node].parent;
+        }
+    }
+
+    if (AVL_TREE_SIZE != next.node) {
+        next.element = tree.elements + next.node;
+    }
+
+    return next;
+}
+
+static inline avl_tree_cursor_s prev_avl_tree(const avl_tree_s tree, const avl_tree_cursor_s cursor) {
+    AVL_TREE_ASSERT(cursor.element && "[ERROR] Can't move cursor that is past the end.");
+    AVL_TREE_ASSERT(cursor.node < tree.size && "[ERROR] Invalid cursor node index.");
+
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    avl_tree_cursor_s prev = { .element = NULL, .node = tree.nodes[cursor.node].child[AVL_TREE_LEFT], };
+    if (AVL_TREE_SIZE != prev.node) { // predecessor is the rightmost node of left subtree
+        while (AVL_TREE_SIZE != tree.nodes[prev.node].child[AVL_TREE_RIGHT]) {
+            prev.node = tree.nodes[prev.node].child[AVL_TREE_RIGHT];
+        }
+    } else { // else predecessor is the first ancestor whose right subtree contains node
+        AVL_TREE_INDEX_TYPE child = cursor.node;
+        prev.node = tree.nodes[child].parent;
+        while (AVL_TREE_SIZE != prev.node && child == tree.nodes[prev.node].child[AVL_TREE_LEFT]) {
+            child = prev.node;
+            prev.node = tree.nodes[prev.node].parent;
+        }
+    }
+
+    if (AVL_TREE_SIZE != prev.node) {
+        prev.element = tree.elements + prev.node;
+    }
+
+    return prev;
+}
+
+static inline avl_tree_cursor_s seek_avl_tree(const avl_tree_s tree, const AVL_TREE_DATA_TYPE element) {
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // find the leftmost node that is not less than element, without stopping at equal ones since duplicates may be left
+    avl_tree_cursor_s cursor = { .element = NULL, .node = AVL_TREE_SIZE, };
+    for (AVL_TREE_INDEX_TYPE node = tree.root; AVL_TREE_SIZE != node;) {
+        if (AVL_TREE_COMPARE_WITH(tree.compare, element, tree.elements[node]) <= 0) {
+            cursor.node = node;
+            node = tree.nodes[node].child[AVL_TREE_LEFT];
+        } else {
+            node = tree.nodes[node].child[AVL_TREE_RIGHT];
+        }
+    }
+
+    if (AVL_TREE_SIZE != cursor.node) {
+        cursor.element = tree.elements + cursor.node;
+    }
+
+    return cursor;
+}
+
+static inline avl_tree_s union_avl_tree(const avl_tree_s tree_one, const avl_tree_s tree_two, const copy_avl_tree_fn copy) {
+    AVL_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    AVL_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    AVL_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    avl_tree_s tree_union = create_avl_tree(AVL_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    avl_tree_cursor_s one = begin_avl_tree(tree_one), two = begin_avl_tree(tree_two);
+    while (one.element || two.element) {
+        const int comparison = !one.element ? 1 : !two.element ? -1 : AVL_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        AVL_TREE_ASSERT(tree_union.size < AVL_TREE_SIZE && "[ERROR] Union exceeds maximum tree size.");
+        tree_union.elements[tree_union.size++] = copy(comparison <= 0 ? (*one.element) : (*two.element));
+
+        if (comparison <= 0) one = next_avl_tree(tree_one, one);
+        if (comparison >= 0) two = next_avl_tree(tree_two, two);
+    }
+    link_sorted_avl_tree(&tree_union);
+
+    return tree_union;
+}
+
+static inline avl_tree_s intersect_avl_tree(const avl_tree_s tree_one, const avl_tree_s tree_two, const copy_avl_tree_fn copy) {
+    AVL_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    AVL_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    AVL_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    avl_tree_s tree_intersect = create_avl_tree(AVL_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    avl_tree_cursor_s one = begin_avl_tree(tree_one), two = begin_avl_tree(tree_two);
+    while (one.element && two.element) {
+        const int comparison = AVL_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (!comparison) {
+            tree_intersect.elements[tree_intersect.size++] = copy((*one.element));
+        }
+
+        if (comparison <= 0) one = next_avl_tree(tree_one, one);
+        if (comparison >= 0) two = next_avl_tree(tree_two, two);
+    }
+    link_sorted_avl_tree(&tree_intersect);
+
+    return tree_intersect;
+}
+
+static inline avl_tree_s subtract_avl_tree(const avl_tree_s tree_one, const avl_tree_s tree_two, const copy_avl_tree_fn copy) {
+    AVL_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    AVL_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    AVL_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    avl_tree_s tree_subtract = create_avl_tree(AVL_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    avl_tree_cursor_s one = begin_avl_tree(tree_one), two = begin_avl_tree(tree_two);
+    while (one.element) {
+        const int comparison = !two.element ? -1 : AVL_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (comparison < 0) {
+            tree_subtract.elements[tree_subtract.size++] = copy((*one.element));
+        }
+
+        if (comparison <= 0) one = next_avl_tree(tree_one, one);
+        if (comparison >= 0) two = next_avl_tree(tree_two, two);
+    }
+    link_sorted_avl_tree(&tree_subtract);
+
+    return tree_subtract;
+}
+
+static inline avl_tree_s exclude_avl_tree(const avl_tree_s tree_one, const avl_tree_s tree_two, const copy_avl_tree_fn copy) {
+    AVL_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    AVL_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_one.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    AVL_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree_two.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    avl_tree_s tree_exclude = create_avl_tree(AVL_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    avl_tree_cursor_s one = begin_avl_tree(tree_one), two = begin_avl_tree(tree_two);
+    while (one.element || two.element) {
+        const int comparison = !one.element ? 1 : !two.element ? -1 : AVL_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (comparison) {
+            AVL_TREE_ASSERT(tree_exclude.size < AVL_TREE_SIZE && "[ERROR] Exclude exceeds maximum tree size.");
+            tree_exclude.elements[tree_exclude.size++] = copy(comparison < 0 ? (*one.element) : (*two.element));
+        }
+
+        if (comparison <= 0) one = next_avl_tree(tree_one, one);
+        if (comparison >= 0) two = next_avl_tree(tree_two, two);
+    }
+    link_sorted_avl_tree(&tree_exclude);
+
+    return tree_exclude;
+}
+
+static inline void compact_avl_tree(avl_tree_s * tree) {
+    AVL_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+
+    AVL_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->heights && "[ERROR] 'heights' pointer is NULL.");
+    AVL_TREE_ASSERT(tree->size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    if (!tree->size) {
+        return;
+    }
+
+    // each node's in-order position becomes its new array index, thus in-order scans walk memory sequentially
+    AVL_TREE_INDEX_TYPE * position = AVL_TREE_ALLOC(tree->size * sizeof(AVL_TREE_INDEX_TYPE));
+    AVL_TREE_ASSERT(position && "[ERROR] Memory allocation failed.");
+
+    AVL_TREE_INDEX_TYPE node = tree->root;
+    while (AVL_TREE_SIZE != tree->nodes[node].child[AVL_TREE_LEFT]) {
+        node = tree->nodes[node].child[AVL_TREE_LEFT];
+    }
+
+    for (AVL_TREE_INDEX_TYPE rank = 0; AVL_TREE_SIZE != node; ++rank) {
+        position[node] = rank;
+
+        if (AVL_TREE_SIZE != tree->nodes[node].child[AVL_TREE_RIGHT]) { // successor is leftmost node of right subtree
+            node = tree->nodes[node].child[AVL_TREE_RIGHT];
+            while (AVL_TREE_SIZE != tree->nodes[node].child[AVL_TREE_LEFT]) {
+                node = tree->nodes[node].child[AVL_TREE_LEFT];
+            }
+        } else { // else successor is first ancestor whose left subtree contains node
+            AVL_TREE_INDEX_TYPE parent = tree->nodes[node].parent;
+            while (AVL_TREE_SIZE != parent && node == tree->nodes[parent].child[AVL_TREE_RIGHT]) {
+                node = parent;
+                parent = tree->nodes[parent].parent;
+            }
+            node = parent;
+        }
+    }
+
+    // scatter elements and node records into new arrays while renaming every valid link, tree shape stays the same
+    AVL_TREE_DATA_TYPE * elements = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(AVL_TREE_DATA_TYPE));
+    avl_tree_node_s * nodes = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(avl_tree_node_s));
+    unsigned char * heights = AVL_TREE_ALLOC(AVL_TREE_SIZE * sizeof(unsigned char));
+
+    AVL_TREE_ASSERT(elements && "[ERROR] Memory allocation failed.");
+    AVL_TREE_ASSERT(nodes && "[ERROR] Memory allocation failed.");
+    AVL_TREE_ASSERT(heights && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < tree->size; ++i) {
+        avl_tree_node_s record = tree->nodes[i];
+        if (AVL_TREE_SIZE != record.child[AVL_TREE_LEFT]) record.child[AVL_TREE_LEFT] = position[record.child[AVL_TREE_LEFT]];
+        if (AVL_TREE_SIZE != record.child[AVL_TREE_RIGHT]) record.child[AVL_TREE_RIGHT] = position[record.child[AVL_TREE_RIGHT]];
+        if (AVL_TREE_SIZE != record.parent) record.parent = position[record.parent];
+
+        nodes[position[i]] = record;
+        elements[position[i]] = tree->elements[i];
+        heights[position[i]] = tree->heights[i];
+    }
+
+    tree->root = position[tree->root];
+
+    AVL_TREE_FREE(position);
+    AVL_TREE_FREE(tree->elements);
+    AVL_TREE_FREE(tree->nodes);
+    AVL_TREE_FREE(tree->heights);
+
+    tree->elements = elements;
+    tree->nodes = nodes;
+    tree->heights = heights;
+    update_maximum_avl_tree(tree);
 }
 
 static inline void inorder_avl_tree(const avl_tree_s tree, const operate_avl_tree_fn operate, void * args) {
     AVL_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     bool left_done = false;
-    size_t node = tree.root;
+    AVL_TREE_INDEX_TYPE node = tree.root;
     while (AVL_TREE_SIZE != node) {
-        while (!left_done && AVL_TREE_SIZE != tree.node[AVL_TREE_LEFT][node]) {
-            node = tree.node[AVL_TREE_LEFT][node];
+        while (!left_done && AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_LEFT]) {
+            node = tree.nodes[node].child[AVL_TREE_LEFT];
         }
 
         if (!operate(tree.elements + node, args)) {
@@ -1041,19 +2377,19 @@ static inline void inorder_avl_tree(const avl_tree_s tree, const operate_avl_tre
         }
 
         left_done = true;
-        if (AVL_TREE_SIZE != tree.node[AVL_TREE_RIGHT][node]) {
+        if (AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_RIGHT]) {
             left_done = false;
-            node = tree.node[AVL_TREE_RIGHT][node];
-        } else if (AVL_TREE_SIZE != tree.parent[node]) {
-            while (AVL_TREE_SIZE != tree.parent[node] && node == tree.node[AVL_TREE_RIGHT][tree.parent[node]]) {
-                node = tree.parent[node];
+            node = tree.nodes[node].child[AVL_TREE_RIGHT];
+        } else if (AVL_TREE_SIZE != tree.nodes[node].parent) {
+            while (AVL_TREE_SIZE != tree.nodes[node].parent && node == tree.nodes[tree.nodes[node].parent].child[AVL_TREE_RIGHT]) {
+                node = tree.nodes[node].parent;
             }
 
-            if (AVL_TREE_SIZE == tree.parent[node]) {
+            if (AVL_TREE_SIZE == tree.nodes[node].parent) {
                 break;
             }
 
-            node = tree.parent[node];
+            node = tree.nodes[node].parent;
         } else {
             break;
         }
@@ -1063,132 +2399,123 @@ static inline void inorder_avl_tree(const avl_tree_s tree, const operate_avl_tre
 static inline void preorder_avl_tree(const avl_tree_s tree, const operate_avl_tree_fn operate, void * args) {
     AVL_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    // create simple stack to manage depth first in-order traversal of node indexes
-    struct pre_stack { size_t size; size_t * elements; } stack = {
-        .size = 0, .elements = AVL_TREE_ALLOC(tree.size * sizeof(size_t)),
-    };
-    AVL_TREE_ASSERT(stack.elements && "[ERROR] Memory allocation failed.");
-
-    if (tree.size) {
-        stack.elements[stack.size++] = tree.root;
-    }
-
-    while (stack.size && operate(tree.elements + stack.elements[stack.size - 1], args)) {
-        const size_t node = stack.elements[--stack.size];
-
-        const size_t right_child = tree.node[AVL_TREE_RIGHT][node];
-        if (AVL_TREE_SIZE != right_child) {
-            stack.elements[stack.size++] = right_child;
-        }
+    AVL_TREE_INDEX_TYPE node = tree.root;
+    while (AVL_TREE_SIZE != node && operate(tree.elements + node, args)) {
+        if (AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_LEFT]) { // go to left child first
+            node = tree.nodes[node].child[AVL_TREE_LEFT];
+        } else if (AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_RIGHT]) { // else go to right child
+            node = tree.nodes[node].child[AVL_TREE_RIGHT];
+        } else { // else go up until an ancestor with a not yet visited right child is found
+            AVL_TREE_INDEX_TYPE parent = tree.nodes[node].parent;
+            while (AVL_TREE_SIZE != parent && (node == tree.nodes[parent].child[AVL_TREE_RIGHT] || AVL_TREE_SIZE == tree.nodes[parent].child[AVL_TREE_RIGHT])) {
+                node = parent;
+                parent = tree.nodes[parent].parent;
+            }
 
-        const size_t left_child = tree.node[AVL_TREE_LEFT][node];
-        if (AVL_TREE_SIZE != left_child) {
-            stack.elements[stack.size++] = left_child;
+            node = (AVL_TREE_SIZE == parent) ? AVL_TREE_SIZE : tree.nodes[parent].child[AVL_TREE_RIGHT];
         }
     }
-
-    AVL_TREE_FREE(stack.elements);
 }
 
 static inline void postorder_avl_tree(const avl_tree_s tree, const operate_avl_tree_fn operate, void * args) {
     AVL_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    // create simple stack to manage depth first in-order traversal of node indexes
-    struct post_stack { size_t size; size_t * elements; } stack = {
-        .size = 0, .elements = AVL_TREE_ALLOC(tree.size * sizeof(size_t)),
-    };
-    AVL_TREE_ASSERT(stack.elements && "[ERROR] Memory allocation failed.");
-
-    // push root node onto stack and initially save it into variable
-    size_t node = tree.root;
-    size_t last = AVL_TREE_SIZE;
-    while (stack.size || AVL_TREE_SIZE != node) { // while stack is not empty OR node is valid
-        if (AVL_TREE_SIZE != node) { // if node is valid push it onto the stack and go to node's left child
-            stack.elements[stack.size++] = node;
-            node = tree.node[AVL_TREE_LEFT][node];
-        } else { // else node is invalid, thus pop a new node from the stack, operate on element, and go to node's right child
-            const size_t peek = stack.elements[stack.size - 1];
-
-            const size_t peek_right_child = tree.node[AVL_TREE_RIGHT][peek];
-            if (AVL_TREE_SIZE != peek_right_child && peek_right_child != last) {
-                node = peek_right_child;
+    AVL_TREE_INDEX_TYPE node = tree.root;
+    if (AVL_TREE_SIZE != node) {
+        while (true) { // descend to the first node in post-order, preferring left children over right ones
+            if (AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_LEFT]) {
+                node = tree.nodes[node].child[AVL_TREE_LEFT];
+            } else if (AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_RIGHT]) {
+                node = tree.nodes[node].child[AVL_TREE_RIGHT];
             } else {
-                if (!operate(tree.elements + node, args)) {
+                break;
+            }
+        }
+    }
+
+    while (AVL_TREE_SIZE != node && operate(tree.elements + node, args)) {
+        const AVL_TREE_INDEX_TYPE parent = tree.nodes[node].parent;
+        if (AVL_TREE_SIZE == parent || node == tree.nodes[parent].child[AVL_TREE_RIGHT] || AVL_TREE_SIZE == tree.nodes[parent].child[AVL_TREE_RIGHT]) {
+            node = parent; // parent comes right after its last child
+        } else { // else continue with first node of parent's right subtree
+            node = tree.nodes[parent].child[AVL_TREE_RIGHT];
+            while (true) { // descend to the first node in post-order, preferring left children over right ones
+                if (AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_LEFT]) {
+                    node = tree.nodes[node].child[AVL_TREE_LEFT];
+                } else if (AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_RIGHT]) {
+                    node = tree.nodes[node].child[AVL_TREE_RIGHT];
+                } else {
                     break;
                 }
-
-                last = stack.elements[--stack.size];
             }
         }
     }
-
-    AVL_TREE_FREE(stack.elements);
 }
 
 static inline void level_order_avl_tree(const avl_tree_s tree, const operate_avl_tree_fn operate, void * args) {
     AVL_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    // create simple queue to manage breath first level order traversal of node indexes
-    struct level_queue { size_t size, current; size_t * elements; } queue = {
-        .size = 0, .current = 0, .elements = AVL_TREE_ALLOC(tree.size * sizeof(size_t)),
-    };
-    AVL_TREE_ASSERT(queue.elements && "[ERROR] Memory allocation failed.");
-
-    if (tree.size) { // if tree isn't empty push root node
-        queue.elements[queue.current + queue.size++] = tree.root;
-    }
-
-    // while queue isn't empty operate on element, pop parent and push valid children
-    while (queue.size && operate(tree.elements + queue.elements[queue.current], args)) {
-        // pop index
-        const size_t popped_index = queue.elements[queue.current++];
-        queue.size--;
+    // walk the tree in pre-order once per level without going deeper than it, since balanced trees are only
+    // logarithmically high this avoids allocating a queue at the cost of revisiting the upper levels
+    bool found = true;
+    for (size_t level = 0; found; ++level) {
+        found = false;
+
+        size_t depth = 0;
+        AVL_TREE_INDEX_TYPE node = tree.root;
+        while (AVL_TREE_SIZE != node) {
+            if (depth == level) {
+                found = true;
+                if (!operate(tree.elements + node, args)) {
+                    return;
+                }
+            }
 
-        // push left child of popped parent to the top of the queue
-        const size_t left_child = tree.node[AVL_TREE_LEFT][popped_index];
-        if (AVL_TREE_SIZE != left_child) {
-            queue.elements[queue.current + queue.size++] = left_child;
-        }
+            if (depth < level && AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_LEFT]) {
+                node = tree.nodes[node].child[AVL_TREE_LEFT];
+                depth++;
+            } else if (depth < level && AVL_TREE_SIZE != tree.nodes[node].child[AVL_TREE_RIGHT]) {
+                node = tree.nodes[node].child[AVL_TREE_RIGHT];
+                depth++;
+            } else { // go up until an ancestor with a not yet visited right child is found, right child is on node's depth
+                AVL_TREE_INDEX_TYPE parent = tree.nodes[node].parent;
+                while (AVL_TREE_SIZE != parent && (node == tree.nodes[parent].child[AVL_TREE_RIGHT] || AVL_TREE_SIZE == tree.nodes[parent].child[AVL_TREE_RIGHT])) {
+                    node = parent;
+                    parent = tree.nodes[parent].parent;
+                    depth--;
+                }
 
-        // push right child of popped parent to the top of the queue
-        const size_t right_child = tree.node[AVL_TREE_RIGHT][popped_index];
-        if (AVL_TREE_SIZE != right_child) {
-            queue.elements[queue.current + queue.size++] = right_child;
+                node = (AVL_TREE_SIZE == parent) ? AVL_TREE_SIZE : tree.nodes[parent].child[AVL_TREE_RIGHT];
+            }
         }
     }
-
-    AVL_TREE_FREE(queue.elements);
 }
 
 static inline void map_avl_tree(const avl_tree_s tree, const manage_avl_tree_fn manage, void * args) {
     AVL_TREE_ASSERT(manage && "[ERROR] 'manage' parameter is NULL.");
 
-    AVL_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    AVL_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     AVL_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_LEFT] && "[ERROR] 'node[AVL_TREE_LEFT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.node[AVL_TREE_RIGHT] && "[ERROR] 'node[AVL_TREE_RIGHT]' pointer is NULL.");
-    AVL_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    AVL_TREE_ASSERT(tree.heights && "[ERROR] 'heights' pointer is NULL.");
     AVL_TREE_ASSERT(tree.size <= AVL_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     manage(tree.elements, tree.size, args);
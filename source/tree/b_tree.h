@@ -0,0 +1,829 @@
+#ifndef B_TREE_H
+#define B_TREE_H
+
+/*
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+    For more information, please refer to <https://unlicense.org>
+*/
+
+#include <stddef.h>  // imports size_t
+#include <stdbool.h> // imports bool
+#include <string.h>  // imports memcpy, memmove
+
+#ifndef B_TREE_DATA_TYPE
+// redefine using #define B_TREE_DATA_TYPE [type]
+#   define B_TREE_DATA_TYPE void*
+#endif
+
+#ifndef B_TREE_ASSERT
+#   include <assert.h>  // imports assert for debugging
+// redefine using #define B_TREE_DATA_TYPE [assert]
+#   define B_TREE_ASSERT assert
+#endif
+
+#if !defined(B_TREE_ALLOC) && !defined(B_TREE_FREE)
+#   include <stdlib.h>
+#   define B_TREE_ALLOC malloc
+#   define B_TREE_FREE free
+#elif !defined(B_TREE_ALLOC)
+#   error Must also define B_TREE_ALLOC.
+#elif !defined(B_TREE_FREE)
+#   error Must also define B_TREE_FREE.
+#endif
+
+#ifndef B_TREE_SIZE
+#   define B_TREE_SIZE (1 << 10)
+#elif B_TREE_SIZE <= 0
+#   error Size cannot be zero.
+#endif
+
+#ifndef B_TREE_NODE_SIZE
+// redefine using #define B_TREE_NODE_SIZE [size], maximum element count per node, default spans four cache lines of pointers
+#   define B_TREE_NODE_SIZE 32
+#elif B_TREE_NODE_SIZE < 3
+#   error Node size must be at least three.
+#endif
+
+#ifndef B_TREE_INDEX_TYPE
+// redefine using #define B_TREE_INDEX_TYPE [unsigned type], e.g. uint32_t to shrink nodes if size allows it
+#   define B_TREE_INDEX_TYPE size_t
+#endif
+
+// every node except root is at least half full, thus there are never more leaves or branches than this
+#define B_TREE_NODE_COUNT ((B_TREE_SIZE) / ((B_TREE_NODE_SIZE) / 2) + 1)
+
+/// Function pointer that creates a deep element copy.
+typedef B_TREE_DATA_TYPE (*copy_b_tree_fn)    (const B_TREE_DATA_TYPE element);
+/// Function pointer that destroys a deep element.
+typedef void             (*destroy_b_tree_fn) (B_TREE_DATA_TYPE * element);
+/// 'less than', else a positive number if 'more than'.
+typedef int              (*compare_b_tree_fn) (const B_TREE_DATA_TYPE one, const B_TREE_DATA_TYPE two);
+/// Function pointer that changes an element pointer using void pointer arguments if needed. Returns 'false' if foreach loop should break.
+typedef bool             (*operate_b_tree_fn) (B_TREE_DATA_TYPE * element, void * args);
+/// @brief Function pointer to manage an array of graph elements based on generic arguments.
+typedef void             (*manage_b_tree_fn)  (B_TREE_DATA_TYPE * array, const size_t size, void * args);
+
+typedef struct b_tree_leaf {
+    B_TREE_DATA_TYPE elements[B_TREE_NODE_SIZE];
+    B_TREE_INDEX_TYPE count, next;
+} b_tree_leaf_s;
+
+typedef struct b_tree_branch {
+    B_TREE_DATA_TYPE keys[B_TREE_NODE_SIZE]; // each key is the smallest element in the subtree to its right
+    B_TREE_INDEX_TYPE child[B_TREE_NODE_SIZE + 1], count;
+} b_tree_branch_s;
+
+typedef struct b_tree {
+    compare_b_tree_fn compare;
+    b_tree_leaf_s * leaves;
+    b_tree_branch_s * branches;
+    size_t size;
+    B_TREE_INDEX_TYPE root, head, height; // height is the number of branch levels above the leaves
+    B_TREE_INDEX_TYPE free_leaf, free_branch;
+} b_tree_s;
+
+static inline b_tree_s create_b_tree(const compare_b_tree_fn compare) {
+    B_TREE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+    B_TREE_ASSERT((B_TREE_INDEX_TYPE)(B_TREE_NODE_COUNT) == B_TREE_NODE_COUNT && "[ERROR] 'B_TREE_INDEX_TYPE' can't hold node count.");
+    B_TREE_ASSERT((B_TREE_INDEX_TYPE)(B_TREE_NODE_SIZE + 1) == B_TREE_NODE_SIZE + 1 && "[ERROR] 'B_TREE_INDEX_TYPE' can't hold node size.");
+
+    // initialize and allocate memory for tree
+    const b_tree_s tree = {
+        .leaves = B_TREE_ALLOC(B_TREE_NODE_COUNT * sizeof(b_tree_leaf_s)),
+        .branches = B_TREE_ALLOC(B_TREE_NODE_COUNT * sizeof(b_tree_branch_s)),
+        .size = 0, .compare = compare, .root = B_TREE_NODE_COUNT, .head = B_TREE_NODE_COUNT, .height = 0,
+        .free_leaf = 0, .free_branch = 0,
+    };
+
+    // check if memory allocation succeeded
+    B_TREE_ASSERT(tree.leaves && "[ERROR] Memory allocation failed.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] Memory allocation failed.");
+
+    // chain all nodes into free lists, leaves through their next index and branches through their first child
+    for (B_TREE_INDEX_TYPE i = 0; i < B_TREE_NODE_COUNT; ++i) {
+        tree.leaves[i].next = (B_TREE_INDEX_TYPE)(i + 1);
+        tree.branches[i].child[0] = (B_TREE_INDEX_TYPE)(i + 1);
+    }
+
+    return tree;
+}
+
+static inline void destroy_b_tree(b_tree_s * tree, const destroy_b_tree_fn destroy) {
+    B_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    B_TREE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    B_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree->leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree->branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree->size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // for each element in linked leaves call destroy function
+    for (B_TREE_INDEX_TYPE leaf = tree->head; B_TREE_NODE_COUNT != leaf; leaf = tree->leaves[leaf].next) {
+        for (B_TREE_INDEX_TYPE i = 0; i < tree->leaves[leaf].count; ++i) {
+            destroy(tree->leaves[leaf].elements + i);
+        }
+    }
+
+    // free allocated memory
+    B_TREE_FREE(tree->leaves);
+    B_TREE_FREE(tree->branches);
+
+    // set pointers to NULL
+    tree->leaves = NULL;
+    tree->branches = NULL;
+
+    // other cleanup stuff
+    tree->root = tree->head = B_TREE_NODE_COUNT;
+    tree->height = 0;
+    tree->compare = NULL;
+    tree->size = 0;
+}
+
+static inline void clear_b_tree(b_tree_s * tree, const destroy_b_tree_fn destroy) {
+    B_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    B_TREE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
+
+    B_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree->leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree->branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree->size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // for each element in linked leaves call destroy function
+    for (B_TREE_INDEX_TYPE leaf = tree->head; B_TREE_NODE_COUNT != leaf; leaf = tree->leaves[leaf].next) {
+        for (B_TREE_INDEX_TYPE i = 0; i < tree->leaves[leaf].count; ++i) {
+            destroy(tree->leaves[leaf].elements + i);
+        }
+    }
+
+    // chain all nodes back into free lists
+    for (B_TREE_INDEX_TYPE i = 0; i < B_TREE_NODE_COUNT; ++i) {
+        tree->leaves[i].next = (B_TREE_INDEX_TYPE)(i + 1);
+        tree->branches[i].child[0] = (B_TREE_INDEX_TYPE)(i + 1);
+    }
+
+    // clearing cleanup
+    tree->free_leaf = tree->free_branch = 0;
+    tree->root = tree->head = B_TREE_NODE_COUNT;
+    tree->height = 0;
+    tree->size = 0;
+}
+
+static inline b_tree_s copy_b_tree(const b_tree_s tree, const copy_b_tree_fn copy) {
+    B_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // create replica/copy to return
+    const b_tree_s replica = {
+        .compare = tree.compare, .root = tree.root, .head = tree.head, .height = tree.height, .size = tree.size,
+        .free_leaf = tree.free_leaf, .free_branch = tree.free_branch,
+        .leaves = B_TREE_ALLOC(B_TREE_NODE_COUNT * sizeof(b_tree_leaf_s)),
+        .branches = B_TREE_ALLOC(B_TREE_NODE_COUNT * sizeof(b_tree_branch_s)),
+    };
+
+    B_TREE_ASSERT(replica.leaves && "[ERROR] Memory allocation failed.");
+    B_TREE_ASSERT(replica.branches && "[ERROR] Memory allocation failed.");
+
+    // copy node records since indexes and free lists stay the same
+    memcpy(replica.leaves, tree.leaves, B_TREE_NODE_COUNT * sizeof(b_tree_leaf_s));
+    memcpy(replica.branches, tree.branches, B_TREE_NODE_COUNT * sizeof(b_tree_branch_s));
+
+    if (!tree.size) {
+        return replica;
+    }
+
+    // each branch is at least binary, thus the tree height is less than the bit count of B_TREE_INDEX_TYPE
+    struct path_level { B_TREE_INDEX_TYPE branch, child; } path[sizeof(B_TREE_INDEX_TYPE) << 3];
+    B_TREE_INDEX_TYPE leaf = tree.root;
+    for (B_TREE_INDEX_TYPE level = 0; level < tree.height; ++level) {
+        path[level] = (struct path_level) { .branch = leaf, .child = 0, };
+        leaf = tree.branches[leaf].child[0];
+    }
+
+    // walk leaves in order with a path, since keys must reference replica's copy of each leaf's first element
+    while (true) {
+        for (B_TREE_INDEX_TYPE i = 0; i < tree.leaves[leaf].count; ++i) {
+            replica.leaves[leaf].elements[i] = copy(tree.leaves[leaf].elements[i]);
+        }
+
+        // key that references leaf's first element is left of the deepest branch child that isn't a first child
+        B_TREE_INDEX_TYPE level = tree.height;
+        while (level && !path[level - 1].child) {
+            level--;
+        }
+
+        if (level) {
+            replica.branches[path[level - 1].branch].keys[path[level - 1].child - 1] = replica.leaves[leaf].elements[0];
+        }
+
+        // go up until a branch with an unvisited child is found
+        level = tree.height;
+        while (level && path[level - 1].child == tree.branches[path[level - 1].branch].count) {
+            level--;
+        }
+
+        if (!level) {
+            break;
+        }
+
+        // go down to the leftmost leaf of next child
+        leaf = tree.branches[path[level - 1].branch].child[++path[level - 1].child];
+        for (; level < tree.height; ++level) {
+            path[level] = (struct path_level) { .branch = leaf, .child = 0, };
+            leaf = tree.branches[leaf].child[0];
+        }
+    }
+
+    return replica;
+}
+
+static inline bool is_empty_b_tree(const b_tree_s tree) {
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    return !(tree.size);
+}
+
+static inline bool is_full_b_tree(const b_tree_s tree) {
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    return (tree.size == B_TREE_SIZE);
+}
+
+static inline void insert_b_tree(b_tree_s * tree, const B_TREE_DATA_TYPE element) {
+    B_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    B_TREE_ASSERT(tree->size != B_TREE_SIZE && "[ERROR] Can't insert into full tree.");
+
+    B_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree->leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree->branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree->size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    if (B_TREE_NODE_COUNT == tree->root) { // if tree is empty then pop first leaf from free list and make it root
+        tree->root = tree->head = tree->free_leaf;
+        tree->free_leaf = tree->leaves[tree->free_leaf].next;
+
+        tree->leaves[tree->root].count = 0;
+        tree->leaves[tree->root].next = B_TREE_NODE_COUNT;
+    }
+
+    // descend to leaf while saving path, going right on equal keys keeps the first element of every leaf except head unchanged
+    struct path_level { B_TREE_INDEX_TYPE branch, child; } path[sizeof(B_TREE_INDEX_TYPE) << 3];
+    B_TREE_INDEX_TYPE node = tree->root;
+    for (B_TREE_INDEX_TYPE level = 0; level < tree->height; ++level) {
+        const b_tree_branch_s * branch = tree->branches + node;
+
+        // binary search for the first key greater than element
+        B_TREE_INDEX_TYPE low = 0, high = branch->count;
+        while (low < high) {
+            const B_TREE_INDEX_TYPE middle = low + (high - low) / 2;
+            if (tree->compare(element, branch->keys[middle]) < 0) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+
+        path[level] = (struct path_level) { .branch = node, .child = low, };
+        node = branch->child[low];
+    }
+
+    // binary search for the first leaf element greater than element
+    b_tree_leaf_s * leaf = tree->leaves + node;
+    B_TREE_INDEX_TYPE position = 0, high = leaf->count;
+    while (position < high) {
+        const B_TREE_INDEX_TYPE middle = position + (high - position) / 2;
+        if (tree->compare(element, leaf->elements[middle]) < 0) {
+            high = middle;
+        } else {
+            position = middle + 1;
+        }
+    }
+
+    B_TREE_DATA_TYPE separator;
+    memcpy(&separator, &element, sizeof(B_TREE_DATA_TYPE));
+    B_TREE_INDEX_TYPE right = B_TREE_NODE_COUNT;
+    if (B_TREE_NODE_SIZE == leaf->count) { // if leaf is full then split its upper half into a new leaf and insert into proper half
+        right = tree->free_leaf;
+        tree->free_leaf = tree->leaves[right].next;
+
+        b_tree_leaf_s * split = tree->leaves + right;
+        const B_TREE_INDEX_TYPE half = B_TREE_NODE_SIZE / 2;
+        memcpy(split->elements, leaf->elements + half, (B_TREE_NODE_SIZE - half) * sizeof(B_TREE_DATA_TYPE));
+        split->count = B_TREE_NODE_SIZE - half;
+        leaf->count = half;
+
+        split->next = leaf->next;
+        leaf->next = right;
+
+        if (position > half) {
+            position -= half;
+            leaf = split;
+        }
+    }
+
+    memmove(leaf->elements + position + 1, leaf->elements + position, (leaf->count - position) * sizeof(B_TREE_DATA_TYPE));
+    memcpy(leaf->elements + position, &element, sizeof(B_TREE_DATA_TYPE));
+    leaf->count++;
+    tree->size++;
+
+    if (B_TREE_NODE_COUNT != right) {
+        separator = tree->leaves[right].elements[0];
+    }
+
+    // insert key and right node of each split into parent branch until one doesn't split
+    for (B_TREE_INDEX_TYPE level = tree->height; B_TREE_NODE_COUNT != right && level; --level) {
+        b_tree_branch_s * branch = tree->branches + path[level - 1].branch;
+        const B_TREE_INDEX_TYPE child = path[level - 1].child;
+
+        if (B_TREE_NODE_SIZE != branch->count) { // if branch isn't full then shift greater keys and children to make space
+            memmove(branch->keys + child + 1, branch->keys + child, (branch->count - child) * sizeof(B_TREE_DATA_TYPE));
+            memmove(branch->child + child + 2, branch->child + child + 1, (branch->count - child) * sizeof(B_TREE_INDEX_TYPE));
+            branch->keys[child] = separator;
+            branch->child[child + 1] = right;
+            branch->count++;
+
+            right = B_TREE_NODE_COUNT;
+            continue;
+        }
+
+        // else split branch as if key was already inserted at child, key in the middle goes up and keys after it go right
+        const B_TREE_INDEX_TYPE split_index = tree->free_branch;
+        tree->free_branch = tree->branches[split_index].child[0];
+
+        b_tree_branch_s * split = tree->branches + split_index;
+        const B_TREE_INDEX_TYPE half = B_TREE_NODE_SIZE / 2;
+        B_TREE_DATA_TYPE promoted = child == half ? separator : branch->keys[child < half ? half - 1 : half];
+
+        for (B_TREE_INDEX_TYPE i = half + 1; i <= B_TREE_NODE_SIZE; ++i) {
+            split->keys[i - half - 1] = i < child ? branch->keys[i] : (i == child ? separator : branch->keys[i - 1]);
+        }
+        for (B_TREE_INDEX_TYPE i = half + 1; i <= B_TREE_NODE_SIZE + 1; ++i) {
+            split->child[i - half - 1] = i <= child ? branch->child[i] : (i == child + 1 ? right : branch->child[i - 1]);
+        }
+        split->count = B_TREE_NODE_SIZE - half;
+
+        if (child < half) { // if key was in lower half then shift it into remaining branch
+            memmove(branch->keys + child + 1, branch->keys + child, (size_t)(half - 1 - child) * sizeof(B_TREE_DATA_TYPE));
+            memmove(branch->child + child + 2, branch->child + child + 1, (size_t)(half - 1 - child) * sizeof(B_TREE_INDEX_TYPE));
+            branch->keys[child] = separator;
+            branch->child[child + 1] = right;
+        }
+        branch->count = half;
+
+        separator = promoted;
+        right = split_index;
+    }
+
+    if (B_TREE_NODE_COUNT != right) { // if root was split then grow tree by one level
+        const B_TREE_INDEX_TYPE root = tree->free_branch;
+        tree->free_branch = tree->branches[root].child[0];
+
+        tree->branches[root].keys[0] = separator;
+        tree->branches[root].child[0] = tree->root;
+        tree->branches[root].child[1] = right;
+        tree->branches[root].count = 1;
+
+        tree->root = root;
+        tree->height++;
+    }
+}
+
+static inline B_TREE_DATA_TYPE remove_b_tree(b_tree_s * tree, const B_TREE_DATA_TYPE element) {
+    B_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    B_TREE_ASSERT(tree->size && "[ERROR] Can't remove from empty tree.");
+    B_TREE_ASSERT(B_TREE_NODE_COUNT != tree->root && "[ERROR] Invalid root node index.");
+
+    B_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree->leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree->branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree->size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // descend to leaf while saving path, element equal to a key is the first element of the leaf to its right
+    struct path_level { B_TREE_INDEX_TYPE branch, child; } path[sizeof(B_TREE_INDEX_TYPE) << 3];
+    B_TREE_INDEX_TYPE node = tree->root;
+    for (B_TREE_INDEX_TYPE level = 0; level < tree->height; ++level) {
+        const b_tree_branch_s * branch = tree->branches + node;
+
+        // binary search for the first key greater than element
+        B_TREE_INDEX_TYPE low = 0, high = branch->count;
+        while (low < high) {
+            const B_TREE_INDEX_TYPE middle = low + (high - low) / 2;
+            if (tree->compare(element, branch->keys[middle]) < 0) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+
+        path[level] = (struct path_level) { .branch = node, .child = low, };
+        node = branch->child[low];
+    }
+
+    // binary search for the first leaf element not less than element
+    b_tree_leaf_s * leaf = tree->leaves + node;
+    B_TREE_INDEX_TYPE position = 0, high = leaf->count;
+    while (position < high) {
+        const B_TREE_INDEX_TYPE middle = position + (high - position) / 2;
+        if (tree->compare(element, leaf->elements[middle]) <= 0) {
+            high = middle;
+        } else {
+            position = middle + 1;
+        }
+    }
+
+    if (position == leaf->count || tree->compare(element, leaf->elements[position])) {
+        // element was NOT found, thus return an error
+        B_TREE_ASSERT(false && "[ERROR] Element not found in tree.");
+        exit(EXIT_FAILURE);
+    }
+
+    B_TREE_DATA_TYPE removed = leaf->elements[position];
+    leaf->count--;
+    memmove(leaf->elements + position, leaf->elements + position + 1, (leaf->count - position) * sizeof(B_TREE_DATA_TYPE));
+    tree->size--;
+
+    if (!tree->height) { // if leaf is root then it can hold any element count, but must be freed when empty
+        if (!leaf->count) {
+            leaf->next = tree->free_leaf;
+            tree->free_leaf = tree->root;
+            tree->root = tree->head = B_TREE_NODE_COUNT;
+        }
+
+        return removed;
+    }
+
+    if (!position) { // if leaf's first element was removed then key referencing it must be replaced with its successor
+        B_TREE_INDEX_TYPE level = tree->height;
+        while (level && !path[level - 1].child) {
+            level--;
+        }
+
+        // an empty leaf gets its successor from next leaf when borrowing or merging, or its key is removed when it has none
+        if (level && leaf->count) {
+            tree->branches[path[level - 1].branch].keys[path[level - 1].child - 1] = leaf->elements[0];
+        } else if (level && B_TREE_NODE_COUNT != leaf->next) {
+            tree->branches[path[level - 1].branch].keys[path[level - 1].child - 1] = tree->leaves[leaf->next].elements[0];
+        }
+    }
+
+    const B_TREE_INDEX_TYPE half = B_TREE_NODE_SIZE / 2;
+    if (leaf->count >= half) {
+        return removed;
+    }
+
+    { // REBALANCE LEAF
+        b_tree_branch_s * parent = tree->branches + path[tree->height - 1].branch;
+        const B_TREE_INDEX_TYPE child = path[tree->height - 1].child;
+
+        if (child && tree->leaves[parent->child[child - 1]].count > half) { // if left sibling has spare elements borrow its last
+            b_tree_leaf_s * left = tree->leaves + parent->child[child - 1];
+
+            memmove(leaf->elements + 1, leaf->elements, leaf->count * sizeof(B_TREE_DATA_TYPE));
+            leaf->elements[0] = left->elements[--left->count];
+            leaf->count++;
+
+            parent->keys[child - 1] = leaf->elements[0];
+            return removed;
+        }
+
+        if (child < parent->count && tree->leaves[parent->child[child + 1]].count > half) { // else if right sibling has spare elements borrow its first
+            b_tree_leaf_s * right = tree->leaves + parent->child[child + 1];
+
+            leaf->elements[leaf->count++] = right->elements[0];
+            right->count--;
+            memmove(right->elements, right->elements + 1, right->count * sizeof(B_TREE_DATA_TYPE));
+
+            parent->keys[child] = right->elements[0];
+            return removed;
+        }
+
+        // else merge leaf with a sibling, always moving right leaf into left one
+        const B_TREE_INDEX_TYPE merge = child ? child - 1 : child;
+        const B_TREE_INDEX_TYPE right_index = parent->child[merge + 1];
+        b_tree_leaf_s * left = tree->leaves + parent->child[merge];
+        b_tree_leaf_s * right = tree->leaves + right_index;
+
+        memcpy(left->elements + left->count, right->elements, right->count * sizeof(B_TREE_DATA_TYPE));
+        left->count += right->count;
+        left->next = right->next;
+
+        right->next = tree->free_leaf;
+        tree->free_leaf = right_index;
+
+        parent->count--;
+        memmove(parent->keys + merge, parent->keys + merge + 1, (parent->count - merge) * sizeof(B_TREE_DATA_TYPE));
+        memmove(parent->child + merge + 1, parent->child + merge + 2, (parent->count - merge) * sizeof(B_TREE_INDEX_TYPE));
+    }
+
+    for (B_TREE_INDEX_TYPE level = tree->height - 1; level; --level) { // REBALANCE BRANCHES
+        b_tree_branch_s * branch = tree->branches + path[level].branch;
+        if (branch->count >= half) {
+            return removed;
+        }
+
+        b_tree_branch_s * parent = tree->branches + path[level - 1].branch;
+        const B_TREE_INDEX_TYPE child = path[level - 1].child;
+
+        if (child && tree->branches[parent->child[child - 1]].count > half) { // if left sibling has spare keys rotate its last child over parent
+            b_tree_branch_s * left = tree->branches + parent->child[child - 1];
+
+            memmove(branch->keys + 1, branch->keys, branch->count * sizeof(B_TREE_DATA_TYPE));
+            memmove(branch->child + 1, branch->child, (branch->count + 1) * sizeof(B_TREE_INDEX_TYPE));
+            branch->keys[0] = parent->keys[child - 1];
+            branch->child[0] = left->child[left->count];
+            branch->count++;
+
+            parent->keys[child - 1] = left->keys[--left->count];
+            return removed;
+        }
+
+        if (child < parent->count && tree->branches[parent->child[child + 1]].count > half) { // else if right sibling has spare keys rotate its first child over parent
+            b_tree_branch_s * right = tree->branches + parent->child[child + 1];
+
+            branch->keys[branch->count] = parent->keys[child];
+            branch->child[branch->count + 1] = right->child[0];
+            branch->count++;
+
+            parent->keys[child] = right->keys[0];
+            right->count--;
+            memmove(right->keys, right->keys + 1, right->count * sizeof(B_TREE_DATA_TYPE));
+            memmove(right->child, right->child + 1, (right->count + 1) * sizeof(B_TREE_INDEX_TYPE));
+            return removed;
+        }
+
+        // else merge branch with a sibling and the parent key between them, always moving right branch into left one
+        const B_TREE_INDEX_TYPE merge = child ? child - 1 : child;
+        const B_TREE_INDEX_TYPE right_index = parent->child[merge + 1];
+        b_tree_branch_s * left = tree->branches + parent->child[merge];
+        b_tree_branch_s * right = tree->branches + right_index;
+
+        left->keys[left->count] = parent->keys[merge];
+        memcpy(left->keys + left->count + 1, right->keys, right->count * sizeof(B_TREE_DATA_TYPE));
+        memcpy(left->child + left->count + 1, right->child, (right->count + 1) * sizeof(B_TREE_INDEX_TYPE));
+        left->count += right->count + 1;
+
+        right->child[0] = tree->free_branch;
+        tree->free_branch = right_index;
+
+        parent->count--;
+        memmove(parent->keys + merge, parent->keys + merge + 1, (parent->count - merge) * sizeof(B_TREE_DATA_TYPE));
+        memmove(parent->child + merge + 1, parent->child + merge + 2, (parent->count - merge) * sizeof(B_TREE_INDEX_TYPE));
+    }
+
+    if (!tree->branches[tree->root].count) { // if root branch lost its last key then its only child becomes root
+        const B_TREE_INDEX_TYPE root = tree->root;
+        tree->root = tree->branches[root].child[0];
+        tree->height--;
+
+        tree->branches[root].child[0] = tree->free_branch;
+        tree->free_branch = root;
+    }
+
+    return removed;
+}
+
+static inline bool contains_b_tree(const b_tree_s tree, const B_TREE_DATA_TYPE element) {
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    if (!tree.size) {
+        return false;
+    }
+
+    // descend to the only leaf that can contain element
+    B_TREE_INDEX_TYPE node = tree.root;
+    for (B_TREE_INDEX_TYPE level = 0; level < tree.height; ++level) {
+        const b_tree_branch_s * branch = tree.branches + node;
+
+        B_TREE_INDEX_TYPE low = 0, high = branch->count;
+        while (low < high) {
+            const B_TREE_INDEX_TYPE middle = low + (high - low) / 2;
+            if (tree.compare(element, branch->keys[middle]) < 0) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+
+        node = branch->child[low];
+    }
+
+    const b_tree_leaf_s * leaf = tree.leaves + node;
+    B_TREE_INDEX_TYPE position = 0, high = leaf->count;
+    while (position < high) {
+        const B_TREE_INDEX_TYPE middle = position + (high - position) / 2;
+        if (tree.compare(element, leaf->elements[middle]) <= 0) {
+            high = middle;
+        } else {
+            position = middle + 1;
+        }
+    }
+
+    return position != leaf->count && !tree.compare(element, leaf->elements[position]);
+}
+
+static inline B_TREE_DATA_TYPE get_min_b_tree(const b_tree_s tree) {
+    B_TREE_ASSERT(tree.size && "[ERROR] Can't get element from empty tree.");
+    B_TREE_ASSERT(B_TREE_NODE_COUNT != tree.head && "[ERROR] Invalid head leaf index.");
+
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    return tree.leaves[tree.head].elements[0];
+}
+
+static inline B_TREE_DATA_TYPE get_max_b_tree(const b_tree_s tree) {
+    B_TREE_ASSERT(tree.size && "[ERROR] Can't get element from empty tree.");
+    B_TREE_ASSERT(B_TREE_NODE_COUNT != tree.root && "[ERROR] Invalid root node index.");
+
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // descend through last children to rightmost leaf
+    B_TREE_INDEX_TYPE node = tree.root;
+    for (B_TREE_INDEX_TYPE level = 0; level < tree.height; ++level) {
+        node = tree.branches[node].child[tree.branches[node].count];
+    }
+
+    return tree.leaves[node].elements[tree.leaves[node].count - 1];
+}
+
+static inline void foreach_range_b_tree(const b_tree_s tree, const B_TREE_DATA_TYPE low, const B_TREE_DATA_TYPE high, const operate_b_tree_fn operate, void * args) {
+    B_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+    B_TREE_ASSERT(tree.compare(low, high) <= 0 && "[ERROR] 'low' can't be greater than 'high'.");
+
+    if (!tree.size) {
+        return;
+    }
+
+    // descend through first keys not less than low, since equal elements may also end the leaf to the left
+    B_TREE_INDEX_TYPE node = tree.root;
+    for (B_TREE_INDEX_TYPE level = 0; level < tree.height; ++level) {
+        const b_tree_branch_s * branch = tree.branches + node;
+
+        B_TREE_INDEX_TYPE first = 0, last = branch->count;
+        while (first < last) {
+            const B_TREE_INDEX_TYPE middle = first + (last - first) / 2;
+            if (tree.compare(low, branch->keys[middle]) <= 0) {
+                last = middle;
+            } else {
+                first = middle + 1;
+            }
+        }
+
+        node = branch->child[first];
+    }
+
+    B_TREE_INDEX_TYPE position = 0, last = tree.leaves[node].count;
+    while (position < last) {
+        const B_TREE_INDEX_TYPE middle = position + (last - position) / 2;
+        if (tree.compare(low, tree.leaves[node].elements[middle]) <= 0) {
+            last = middle;
+        } else {
+            position = middle + 1;
+        }
+    }
+
+    // operate on elements through linked leaves until an element greater than high is reached
+    for (; B_TREE_NODE_COUNT != node; node = tree.leaves[node].next, position = 0) {
+        for (; position < tree.leaves[node].count; ++position) {
+            B_TREE_DATA_TYPE * element = tree.leaves[node].elements + position;
+            if (tree.compare(*element, high) > 0 || !operate(element, args)) {
+                return;
+            }
+        }
+    }
+}
+
+static inline void inorder_b_tree(const b_tree_s tree, const operate_b_tree_fn operate, void * args) {
+    B_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // leaves are linked in order, thus no branch has to be visited
+    for (B_TREE_INDEX_TYPE leaf = tree.head; B_TREE_NODE_COUNT != leaf; leaf = tree.leaves[leaf].next) {
+        for (B_TREE_INDEX_TYPE i = 0; i < tree.leaves[leaf].count; ++i) {
+            if (!operate(tree.leaves[leaf].elements + i, args)) {
+                return;
+            }
+        }
+    }
+}
+
+static inline void map_b_tree(const b_tree_s tree, const manage_b_tree_fn manage, void * args) {
+    B_TREE_ASSERT(manage && "[ERROR] 'manage' parameter is NULL.");
+
+    B_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    B_TREE_ASSERT(tree.leaves && "[ERROR] 'leaves' pointer is NULL.");
+    B_TREE_ASSERT(tree.branches && "[ERROR] 'branches' pointer is NULL.");
+    B_TREE_ASSERT(tree.size <= B_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // elements are spread across leaves, thus gather them into a continuous array and scatter them back after managing
+    B_TREE_DATA_TYPE * elements = B_TREE_ALLOC(tree.size * sizeof(B_TREE_DATA_TYPE));
+    B_TREE_ASSERT((elements || !tree.size) && "[ERROR] Memory allocation failed.");
+
+    size_t index = 0;
+    for (B_TREE_INDEX_TYPE leaf = tree.head; B_TREE_NODE_COUNT != leaf; leaf = tree.leaves[leaf].next) {
+        memcpy(elements + index, tree.leaves[leaf].elements, tree.leaves[leaf].count * sizeof(B_TREE_DATA_TYPE));
+        index += tree.leaves[leaf].count;
+    }
+
+    manage(elements, tree.size, args);
+
+    index = 0;
+    for (B_TREE_INDEX_TYPE leaf = tree.head; B_TREE_NODE_COUNT != leaf; leaf = tree.leaves[leaf].next) {
+        memcpy(tree.leaves[leaf].elements, elements + index, tree.leaves[leaf].count * sizeof(B_TREE_DATA_TYPE));
+        index += tree.leaves[leaf].count;
+    }
+
+    B_TREE_FREE(elements);
+
+    if (!tree.size) {
+        return;
+    }
+
+    // each branch is at least binary, thus the tree height is less than the bit count of B_TREE_INDEX_TYPE
+    struct path_level { B_TREE_INDEX_TYPE branch, child; } path[sizeof(B_TREE_INDEX_TYPE) << 3];
+    B_TREE_INDEX_TYPE leaf = tree.root;
+    for (B_TREE_INDEX_TYPE level = 0; level < tree.height; ++level) {
+        path[level] = (struct path_level) { .branch = leaf, .child = 0, };
+        leaf = tree.branches[leaf].child[0];
+    }
+
+    // walk leaves in order with a path, since keys must reference each leaf's managed first element
+    while (true) {
+        // key that references leaf's first element is left of the deepest branch child that isn't a first child
+        B_TREE_INDEX_TYPE level = tree.height;
+        while (level && !path[level - 1].child) {
+            level--;
+        }
+
+        if (level) {
+            tree.branches[path[level - 1].branch].keys[path[level - 1].child - 1] = tree.leaves[leaf].elements[0];
+        }
+
+        // go up until a branch with an unvisited child is found
+        level = tree.height;
+        while (level && path[level - 1].child == tree.branches[path[level - 1].branch].count) {
+            level--;
+        }
+
+        if (!level) {
+            break;
+        }
+
+        // go down to the leftmost leaf of next child
+        leaf = tree.branches[path[level - 1].branch].child[++path[level - 1].child];
+        for (; level < tree.height; ++level) {
+            path[level] = (struct path_level) { .branch = leaf, .child = 0, };
+            leaf = tree.branches[leaf].child[0];
+        }
+    }
+}
+
+#endif // B_TREE_H
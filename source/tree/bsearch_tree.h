@@ -59,6 +59,25 @@
 #   error Size cannot be zero.
 #endif
 
+#ifndef BSEARCH_TREE_INDEX_TYPE
+// redefine using #define BSEARCH_TREE_INDEX_TYPE [unsigned type], e.g. uint32_t to halve node size if size allows it
+#   define BSEARCH_TREE_INDEX_TYPE size_t
+#endif
+
+#ifdef BSEARCH_TREE_COMPARE
+// compare macro is expanded in place of 'compare' function pointer calls, thus the pointer is removed from tree structure
+#   define BSEARCH_TREE_COMPARE_WITH(function, one, two) BSEARCH_TREE_COMPARE(one, two)
+#   define BSEARCH_TREE_COMPARE_FUNCTION(function) NULL
+#   define BSEARCH_TREE_COMPARE_ASSERT(expression)
+#else
+// redefine using #define BSEARCH_TREE_COMPARE(one, two) [expression], e.g. (((one) > (two)) - ((one) < (two))) for scalar types
+#   define BSEARCH_TREE_COMPARE_WITH(function, one, two) (function)(one, two)
+#   define BSEARCH_TREE_COMPARE_FUNCTION(function) (function)
+#   define BSEARCH_TREE_COMPARE_ASSERT(expression) BSEARCH_TREE_ASSERT(expression)
+#endif
+
+// define BSEARCH_TREE_SCAPEGOAT to keep tree height logarithmic by rebuilding unbalanced subtrees, without any per-node data
+
 /// Function pointer that creates a deep element copy.
 typedef BSEARCH_TREE_DATA_TYPE (*copy_bsearch_tree_fn)    (const BSEARCH_TREE_DATA_TYPE element);
 /// Function pointer that destroys a deep element.
@@ -73,29 +92,46 @@ typedef void                   (*manage_bsearch_tree_fn)  (BSEARCH_TREE_DATA_TYP
 #define BSEARCH_TREE_CHILD_COUNT 2
 #define BSEARCH_TREE_LEFT  0
 #define BSEARCH_TREE_RIGHT 1
+typedef struct bsearch_tree_node {
+    BSEARCH_TREE_INDEX_TYPE child[BSEARCH_TREE_CHILD_COUNT], parent;
+} bsearch_tree_node_s;
+
 typedef struct bsearch_tree {
+#ifndef BSEARCH_TREE_COMPARE
     compare_bsearch_tree_fn compare;
+#endif
     BSEARCH_TREE_DATA_TYPE * elements;
-    size_t * node[BSEARCH_TREE_CHILD_COUNT];
-    size_t * parent;
-    size_t size, root;
+    bsearch_tree_node_s * nodes;
+    size_t size;
+    BSEARCH_TREE_INDEX_TYPE root;
+#ifdef BSEARCH_TREE_SCAPEGOAT
+    size_t max_size; // largest size since the last whole tree rebuild
+#endif
 } bsearch_tree_s;
 
+typedef struct bsearch_tree_cursor {
+    BSEARCH_TREE_DATA_TYPE * element;
+    BSEARCH_TREE_INDEX_TYPE node;
+} bsearch_tree_cursor_s;
+
 static inline bsearch_tree_s create_bsearch_tree(const compare_bsearch_tree_fn compare) {
-    BSEARCH_TREE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+#ifdef BSEARCH_TREE_COMPARE
+    (void)(compare); // compare macro is used instead, thus parameter is ignored and may be NULL
+#endif
+    BSEARCH_TREE_ASSERT((BSEARCH_TREE_INDEX_TYPE)(BSEARCH_TREE_SIZE) == BSEARCH_TREE_SIZE && "[ERROR] 'BSEARCH_TREE_INDEX_TYPE' can't hold tree size.");
 
     const bsearch_tree_s tree = {
         .elements = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(BSEARCH_TREE_DATA_TYPE)),
-        .node[BSEARCH_TREE_LEFT]  = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(size_t)),
-        .node[BSEARCH_TREE_RIGHT] = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(size_t)),
-        .parent = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(size_t)),
-        .size = 0, .compare = compare, .root = BSEARCH_TREE_SIZE,
+        .nodes = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(bsearch_tree_node_s)),
+        .size = 0, .root = BSEARCH_TREE_SIZE,
+#ifndef BSEARCH_TREE_COMPARE
+        .compare = compare,
+#endif
     };
 
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] Memory allocation failed.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] Memory allocation failed.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] Memory allocation failed.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] Memory allocation failed.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] Memory allocation failed.");
 
     return tree;
 }
@@ -104,11 +140,9 @@ static inline void destroy_bsearch_tree(bsearch_tree_s * tree, const destroy_bse
     BSEARCH_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     BSEARCH_TREE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
 
-    BSEARCH_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree->size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     for (BSEARCH_TREE_DATA_TYPE * e = tree->elements; e < tree->elements + tree->size; e++) {
@@ -116,17 +150,15 @@ static inline void destroy_bsearch_tree(bsearch_tree_s * tree, const destroy_bse
     }
 
     BSEARCH_TREE_FREE(tree->elements);
-    BSEARCH_TREE_FREE(tree->node[BSEARCH_TREE_LEFT]);
-    BSEARCH_TREE_FREE(tree->node[BSEARCH_TREE_RIGHT]);
-    BSEARCH_TREE_FREE(tree->parent);
+    BSEARCH_TREE_FREE(tree->nodes);
 
     tree->elements = NULL;
-    tree->node[BSEARCH_TREE_LEFT] = NULL;
-    tree->node[BSEARCH_TREE_RIGHT] = NULL;
-    tree->parent = NULL;
+    tree->nodes = NULL;
 
     tree->root = BSEARCH_TREE_SIZE;
+#ifndef BSEARCH_TREE_COMPARE
     tree->compare = NULL;
+#endif
     tree->size = 0;
 }
 
@@ -134,11 +166,9 @@ static inline void clear_bsearch_tree(bsearch_tree_s * tree, const destroy_bsear
     BSEARCH_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     BSEARCH_TREE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
 
-    BSEARCH_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree->size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     for (BSEARCH_TREE_DATA_TYPE * e = tree->elements; e < tree->elements + tree->size; e++) {
@@ -147,59 +177,56 @@ static inline void clear_bsearch_tree(bsearch_tree_s * tree, const destroy_bsear
 
     tree->root = BSEARCH_TREE_SIZE;
     tree->size = 0;
+#ifdef BSEARCH_TREE_SCAPEGOAT
+    tree->max_size = 0;
+#endif
 }
 
 static inline bsearch_tree_s copy_bsearch_tree(const bsearch_tree_s tree, const copy_bsearch_tree_fn copy) {
     BSEARCH_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     const bsearch_tree_s replica = {
         .elements = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(BSEARCH_TREE_DATA_TYPE)),
-        .node[BSEARCH_TREE_LEFT]  = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(size_t)),
-        .node[BSEARCH_TREE_RIGHT] = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(size_t)),
-        .parent = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(size_t)),
-        .size = tree.size, .compare = tree.compare, .root = tree.root,
+        .nodes = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(bsearch_tree_node_s)),
+        .size = tree.size, .root = tree.root,
+#ifndef BSEARCH_TREE_COMPARE
+        .compare = tree.compare,
+#endif
+#ifdef BSEARCH_TREE_SCAPEGOAT
+        .max_size = tree.max_size,
+#endif
     };
 
     BSEARCH_TREE_ASSERT(replica.elements && "[ERROR] Memory allocation failed.");
-    BSEARCH_TREE_ASSERT(replica.node[BSEARCH_TREE_LEFT] && "[ERROR] Memory allocation failed.");
-    BSEARCH_TREE_ASSERT(replica.node[BSEARCH_TREE_RIGHT] && "[ERROR] Memory allocation failed.");
-    BSEARCH_TREE_ASSERT(replica.parent && "[ERROR] Memory allocation failed.");
+    BSEARCH_TREE_ASSERT(replica.nodes && "[ERROR] Memory allocation failed.");
 
     for (size_t i = 0; i < tree.size; ++i) {
         replica.elements[i] = copy(tree.elements[i]);
     }
 
-    memcpy(replica.node[BSEARCH_TREE_LEFT], tree.node[BSEARCH_TREE_LEFT], tree.size * sizeof(size_t));
-    memcpy(replica.node[BSEARCH_TREE_RIGHT], tree.node[BSEARCH_TREE_RIGHT], tree.size * sizeof(size_t));
-    memcpy(replica.parent, tree.parent, tree.size * sizeof(size_t));
+    memcpy(replica.nodes, tree.nodes, tree.size * sizeof(bsearch_tree_node_s));
 
     return replica;
 }
 
 static inline bool is_empty_bsearch_tree(const bsearch_tree_s tree) {
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     return !(tree.size);
 }
 
 static inline bool is_full_bsearch_tree(const bsearch_tree_s tree) {
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     return (BSEARCH_TREE_SIZE == tree.size);
@@ -209,30 +236,141 @@ static inline void insert_bsearch_tree(bsearch_tree_s * tree, const BSEARCH_TREE
     BSEARCH_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     BSEARCH_TREE_ASSERT(tree->size != BSEARCH_TREE_SIZE && "[ERROR] Can't insert into full tree.");
 
-    BSEARCH_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree->size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    size_t previous = BSEARCH_TREE_SIZE; // initially invalid for the head case when tree is empty
-    size_t * node = &(tree->root); // pointer to later change actual index of the empty child
+    BSEARCH_TREE_INDEX_TYPE previous = BSEARCH_TREE_SIZE; // initially invalid for the head case when tree is empty
+    BSEARCH_TREE_INDEX_TYPE * node = &(tree->root); // pointer to later change actual index of the empty child
     while (BSEARCH_TREE_SIZE != (*node)) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree->compare(element, tree->elements[(*node)]);
-        const size_t node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
+        const int comparison = BSEARCH_TREE_COMPARE_WITH(tree->compare, element, tree->elements[(*node)]);
+        const BSEARCH_TREE_INDEX_TYPE node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
 
         previous = (*node); // change parent to child
-        node = tree->node[node_index] + (*node); // change child to proper gradnchild
+        node = &(tree->nodes[(*node)].child[node_index]); // change child to proper gradnchild
     }
 
-    (*node) = tree->size; // change child index from invalid value to next empty index in array
-    tree->parent[(*node)] = previous; // make child's parent into parent
-    tree->node[BSEARCH_TREE_LEFT][(*node)] = tree->node[BSEARCH_TREE_RIGHT][(*node)] = BSEARCH_TREE_SIZE; // make child's left and right indexes invalid
+    (*node) = (BSEARCH_TREE_INDEX_TYPE)tree->size; // change child index from invalid value to next empty index in array
+    tree->nodes[(*node)].parent = previous; // make child's parent into parent
+    tree->nodes[(*node)].child[BSEARCH_TREE_LEFT] = tree->nodes[(*node)].child[BSEARCH_TREE_RIGHT] = BSEARCH_TREE_SIZE; // make child's left and right indexes invalid
 
     memcpy(tree->elements + (*node), &element, sizeof(BSEARCH_TREE_DATA_TYPE));
     tree->size++;
+
+#ifdef BSEARCH_TREE_SCAPEGOAT
+    if (tree->max_size < tree->size) {
+        tree->max_size = tree->size;
+    }
+
+    // height limit is about log base 3/2 of size, i.e. no child subtree may hold more than two thirds of its parent's nodes
+    const BSEARCH_TREE_INDEX_TYPE inserted = (BSEARCH_TREE_INDEX_TYPE)(tree->size - 1);
+    size_t limit = 0, depth = 0;
+    for (size_t s = tree->size; s > 1; s = (s * 2) / 3) {
+        limit++;
+    }
+    for (BSEARCH_TREE_INDEX_TYPE n = inserted; BSEARCH_TREE_SIZE != tree->nodes[n].parent; n = tree->nodes[n].parent) {
+        depth++;
+    }
+
+    if (depth > limit) {
+        // go up from inserted node until a child subtree holds more than two thirds of its parent's nodes, that parent is the scapegoat
+        BSEARCH_TREE_INDEX_TYPE child = inserted, scapegoat = tree->nodes[inserted].parent;
+        size_t child_count = 1, count = 0;
+        while (BSEARCH_TREE_SIZE != scapegoat) {
+            const BSEARCH_TREE_INDEX_TYPE sibling = child == tree->nodes[scapegoat].child[BSEARCH_TREE_LEFT] ? tree->nodes[scapegoat].child[BSEARCH_TREE_RIGHT] : tree->nodes[scapegoat].child[BSEARCH_TREE_LEFT];
+
+            // count sibling subtree's nodes with a stackless preorder walk that never leaves the subtree
+            size_t sibling_count = 0;
+            for (BSEARCH_TREE_INDEX_TYPE n = sibling; BSEARCH_TREE_SIZE != n;) {
+                sibling_count++;
+                if (BSEARCH_TREE_SIZE != tree->nodes[n].child[BSEARCH_TREE_LEFT]) {
+                    n = tree->nodes[n].child[BSEARCH_TREE_LEFT];
+                } else if (BSEARCH_TREE_SIZE != tree->nodes[n].child[BSEARCH_TREE_RIGHT]) {
+                    n = tree->nodes[n].child[BSEARCH_TREE_RIGHT];
+                } else {
+                    while (n != sibling && (n == tree->nodes[tree->nodes[n].parent].child[BSEARCH_TREE_RIGHT] || BSEARCH_TREE_SIZE == tree->nodes[tree->nodes[n].parent].child[BSEARCH_TREE_RIGHT])) {
+                        n = tree->nodes[n].parent;
+                    }
+                    n = (n == sibling) ? BSEARCH_TREE_SIZE : tree->nodes[tree->nodes[n].parent].child[BSEARCH_TREE_RIGHT];
+                }
+            }
+
+            count = child_count + 1 + sibling_count;
+            if (3 * child_count > 2 * count) {
+                break;
+            }
+
+            child = scapegoat;
+            child_count = count;
+            scapegoat = tree->nodes[scapegoat].parent;
+        }
+
+        if (BSEARCH_TREE_SIZE != scapegoat) {
+            { // REBUILD SCAPEGOAT'S SUBTREE INTO A PERFECTLY BALANCED ONE
+                // collect subtree's nodes in order, elements stay in place and only their links are rewritten
+                BSEARCH_TREE_INDEX_TYPE * order = BSEARCH_TREE_ALLOC(count * sizeof(BSEARCH_TREE_INDEX_TYPE));
+                BSEARCH_TREE_ASSERT(order && "[ERROR] Memory allocation failed.");
+
+                const BSEARCH_TREE_INDEX_TYPE above = tree->nodes[scapegoat].parent;
+                BSEARCH_TREE_INDEX_TYPE node = scapegoat;
+                while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                    node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+                }
+
+                for (size_t i = 0; i < count; ++i) {
+                    order[i] = node;
+
+                    if (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_RIGHT]) { // successor is leftmost node of right subtree
+                        node = tree->nodes[node].child[BSEARCH_TREE_RIGHT];
+                        while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                            node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+                        }
+                    } else { // else successor is first ancestor whose left subtree contains node
+                        BSEARCH_TREE_INDEX_TYPE parent = tree->nodes[node].parent;
+                        while (BSEARCH_TREE_SIZE != parent && node == tree->nodes[parent].child[BSEARCH_TREE_RIGHT]) {
+                            node = parent;
+                            parent = tree->nodes[parent].parent;
+                        }
+                        node = parent;
+                    }
+                }
+
+                // pending subtree ranges never exceed subtree height, which is less than the bit count of BSEARCH_TREE_INDEX_TYPE
+                struct build_range { BSEARCH_TREE_INDEX_TYPE low, high, parent; } stack[sizeof(BSEARCH_TREE_INDEX_TYPE) << 3];
+                size_t stack_size = 0;
+                stack[stack_size++] = (struct build_range) { .low = 0, .high = (BSEARCH_TREE_INDEX_TYPE)count, .parent = above, };
+
+                while (stack_size) {
+                    // pop range and make its middle node the subtree's root, so that both subtree sizes differ at most by one
+                    const struct build_range range = stack[--stack_size];
+                    const BSEARCH_TREE_INDEX_TYPE middle = (BSEARCH_TREE_INDEX_TYPE)(range.low + (range.high - range.low) / 2);
+
+                    tree->nodes[order[middle]].parent = range.parent;
+                    tree->nodes[order[middle]].child[BSEARCH_TREE_LEFT] = range.low < middle ? order[range.low + (middle - range.low) / 2] : BSEARCH_TREE_SIZE;
+                    tree->nodes[order[middle]].child[BSEARCH_TREE_RIGHT] = middle + 1 < range.high ? order[(middle + 1) + (range.high - middle - 1) / 2] : BSEARCH_TREE_SIZE;
+
+                    if (range.low < middle) {
+                        stack[stack_size++] = (struct build_range) { .low = range.low, .high = middle, .parent = order[middle], };
+                    }
+
+                    if (middle + 1 < range.high) {
+                        stack[stack_size++] = (struct build_range) { .low = middle + 1, .high = range.high, .parent = order[middle], };
+                    }
+                }
+
+                // hang rebuilt subtree where scapegoat was
+                const BSEARCH_TREE_INDEX_TYPE top = order[count / 2];
+                if (BSEARCH_TREE_SIZE == above) tree->root = top;
+                else if (scapegoat == tree->nodes[above].child[BSEARCH_TREE_LEFT]) tree->nodes[above].child[BSEARCH_TREE_LEFT] = top;
+                else tree->nodes[above].child[BSEARCH_TREE_RIGHT] = top;
+
+                BSEARCH_TREE_FREE(order);
+            }
+        }
+    }
+#endif
 }
 
 static inline BSEARCH_TREE_DATA_TYPE remove_bsearch_tree(bsearch_tree_s * tree, const BSEARCH_TREE_DATA_TYPE element) {
@@ -240,28 +378,26 @@ static inline BSEARCH_TREE_DATA_TYPE remove_bsearch_tree(bsearch_tree_s * tree,
     BSEARCH_TREE_ASSERT(tree->size && "[ERROR] Can't remove from empty tree.");
     BSEARCH_TREE_ASSERT(BSEARCH_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
 
-    BSEARCH_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree->size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
     BSEARCH_TREE_ASSERT(tree->root != BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root index.");
     BSEARCH_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    BSEARCH_TREE_ASSERT(tree->parent[tree->root] == BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    BSEARCH_TREE_ASSERT(tree->nodes[tree->root].parent == BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t * node = &(tree->root); // pointer to later change actual index of the empty child
+    BSEARCH_TREE_INDEX_TYPE * node = &(tree->root); // pointer to later change actual index of the empty child
     while (BSEARCH_TREE_SIZE != (*node)) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree->compare(element, tree->elements[(*node)]);
+        const int comparison = BSEARCH_TREE_COMPARE_WITH(tree->compare, element, tree->elements[(*node)]);
         if (!comparison) {
             break;
         }
 
-        const size_t node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
+        const BSEARCH_TREE_INDEX_TYPE node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
 
         // change parent to child and go to next child node
-        node = tree->node[node_index] + (*node);
+        node = &(tree->nodes[(*node)].child[node_index]);
     }
 
     if (BSEARCH_TREE_SIZE == (*node)) {
@@ -274,31 +410,33 @@ static inline BSEARCH_TREE_DATA_TYPE remove_bsearch_tree(bsearch_tree_s * tree,
     tree->size--;
 
     // calculate the rightmost depth of the left child
-    size_t left_depth = 0, * left_node = node;
-    for (size_t * l = tree->node[BSEARCH_TREE_LEFT] + (*left_node); BSEARCH_TREE_SIZE != (*l); l = tree->node[BSEARCH_TREE_RIGHT] + (*l)) {
+    size_t left_depth = 0;
+    BSEARCH_TREE_INDEX_TYPE * left_node = node;
+    for (BSEARCH_TREE_INDEX_TYPE * l = &(tree->nodes[(*left_node)].child[BSEARCH_TREE_LEFT]); BSEARCH_TREE_SIZE != (*l); l = &(tree->nodes[(*l)].child[BSEARCH_TREE_RIGHT])) {
         left_depth++;
         left_node = l;
     }
 
     // calculate the leftmost depth of the right child
-    size_t right_depth = 0, * right_node = node;
-    for (size_t * r = tree->node[BSEARCH_TREE_RIGHT] + (*right_node); BSEARCH_TREE_SIZE != (*r); r = tree->node[BSEARCH_TREE_LEFT] + (*r)) {
+    size_t right_depth = 0;
+    BSEARCH_TREE_INDEX_TYPE * right_node = node;
+    for (BSEARCH_TREE_INDEX_TYPE * r = &(tree->nodes[(*right_node)].child[BSEARCH_TREE_RIGHT]); BSEARCH_TREE_SIZE != (*r); r = &(tree->nodes[(*r)].child[BSEARCH_TREE_LEFT])) {
         right_depth++;
         right_node = r;
     }
 
-    const size_t hole_index = left_depth > right_depth ? (*left_node) : (*right_node);
+    const BSEARCH_TREE_INDEX_TYPE hole_index = left_depth > right_depth ? (*left_node) : (*right_node);
     tree->elements[(*node)] = tree->elements[hole_index];
     if (left_depth > right_depth) {
-        if (BSEARCH_TREE_SIZE != tree->node[BSEARCH_TREE_LEFT][(*left_node)]) { // if right child exists cut off parent
-            tree->parent[tree->node[BSEARCH_TREE_LEFT][(*left_node)]] = tree->parent[(*left_node)];
+        if (BSEARCH_TREE_SIZE != tree->nodes[(*left_node)].child[BSEARCH_TREE_LEFT]) { // if right child exists cut off parent
+            tree->nodes[tree->nodes[(*left_node)].child[BSEARCH_TREE_LEFT]].parent = tree->nodes[(*left_node)].parent;
         }
-        (*left_node) = tree->node[BSEARCH_TREE_LEFT][(*left_node)]; // cut off new hole index
+        (*left_node) = tree->nodes[(*left_node)].child[BSEARCH_TREE_LEFT]; // cut off new hole index
     } else {
-        if (BSEARCH_TREE_SIZE != tree->node[BSEARCH_TREE_RIGHT][(*right_node)]) { // if left child exists cut off parent
-            tree->parent[tree->node[BSEARCH_TREE_RIGHT][(*right_node)]] = tree->parent[(*right_node)];
+        if (BSEARCH_TREE_SIZE != tree->nodes[(*right_node)].child[BSEARCH_TREE_RIGHT]) { // if left child exists cut off parent
+            tree->nodes[tree->nodes[(*right_node)].child[BSEARCH_TREE_RIGHT]].parent = tree->nodes[(*right_node)].parent;
         }
-        (*right_node) = tree->node[BSEARCH_TREE_RIGHT][(*right_node)]; // cut off new hole index
+        (*right_node) = tree->nodes[(*right_node)].child[BSEARCH_TREE_RIGHT]; // cut off new hole index
     }
 
     if (tree->size && tree->root == tree->size) { // if head node is last array element then change index to removed one
@@ -306,32 +444,101 @@ static inline BSEARCH_TREE_DATA_TYPE remove_bsearch_tree(bsearch_tree_s * tree,
     }
 
     // cut hole node from the rest of the tree
-    tree->node[BSEARCH_TREE_LEFT][hole_index] = tree->node[BSEARCH_TREE_RIGHT][hole_index] = tree->parent[hole_index] = hole_index;
+    tree->nodes[hole_index].child[BSEARCH_TREE_LEFT] = tree->nodes[hole_index].child[BSEARCH_TREE_RIGHT] = tree->nodes[hole_index].parent = hole_index;
 
     // replace removed element with rightmost array one (or fill hole with valid element)
     tree->elements[hole_index] = tree->elements[tree->size];
-    tree->node[BSEARCH_TREE_LEFT][hole_index] = tree->node[BSEARCH_TREE_LEFT][tree->size];
-    tree->node[BSEARCH_TREE_RIGHT][hole_index] = tree->node[BSEARCH_TREE_RIGHT][tree->size];
-    tree->parent[hole_index] = tree->parent[tree->size];
+    tree->nodes[hole_index].child[BSEARCH_TREE_LEFT] = tree->nodes[tree->size].child[BSEARCH_TREE_LEFT];
+    tree->nodes[hole_index].child[BSEARCH_TREE_RIGHT] = tree->nodes[tree->size].child[BSEARCH_TREE_RIGHT];
+    tree->nodes[hole_index].parent = tree->nodes[tree->size].parent;
 
     // redirect parent and children of rightmost array node if they dont overlap with removed index
-    const size_t left_last = tree->node[BSEARCH_TREE_LEFT][tree->size];
+    const BSEARCH_TREE_INDEX_TYPE left_last = tree->nodes[tree->size].child[BSEARCH_TREE_LEFT];
     if (BSEARCH_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole_index;
+        tree->nodes[left_last].parent = hole_index;
     }
 
-    const size_t right_last = tree->node[BSEARCH_TREE_RIGHT][tree->size];
+    const BSEARCH_TREE_INDEX_TYPE right_last = tree->nodes[tree->size].child[BSEARCH_TREE_RIGHT];
     if (BSEARCH_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole_index;
+        tree->nodes[right_last].parent = hole_index;
     }
 
-    const size_t parent_last = tree->parent[tree->size];
+    const BSEARCH_TREE_INDEX_TYPE parent_last = tree->nodes[tree->size].parent;
     if (BSEARCH_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole_index;
+        const BSEARCH_TREE_INDEX_TYPE node_index = tree->size == tree->nodes[parent_last].child[BSEARCH_TREE_LEFT] ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
+        tree->nodes[parent_last].child[node_index] = hole_index;
     }
 
+
+#ifdef BSEARCH_TREE_SCAPEGOAT
+    if (3 * tree->size < 2 * tree->max_size) { // if tree shrank below two thirds of its largest size then rebuild it whole
+        if (tree->size) {
+            const BSEARCH_TREE_INDEX_TYPE scapegoat = tree->root;
+            const size_t count = tree->size;
+            { // REBUILD SCAPEGOAT'S SUBTREE INTO A PERFECTLY BALANCED ONE
+                // collect subtree's nodes in order, elements stay in place and only their links are rewritten
+                BSEARCH_TREE_INDEX_TYPE * order = BSEARCH_TREE_ALLOC(count * sizeof(BSEARCH_TREE_INDEX_TYPE));
+                BSEARCH_TREE_ASSERT(order && "[ERROR] Memory allocation failed.");
+
+                const BSEARCH_TREE_INDEX_TYPE above = tree->nodes[scapegoat].parent;
+                BSEARCH_TREE_INDEX_TYPE node = scapegoat;
+                while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                    node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+                }
+
+                for (size_t i = 0; i < count; ++i) {
+                    order[i] = node;
+
+                    if (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_RIGHT]) { // successor is leftmost node of right subtree
+                        node = tree->nodes[node].child[BSEARCH_TREE_RIGHT];
+                        while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                            node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+                        }
+                    } else { // else successor is first ancestor whose left subtree contains node
+                        BSEARCH_TREE_INDEX_TYPE parent = tree->nodes[node].parent;
+                        while (BSEARCH_TREE_SIZE != parent && node == tree->nodes[parent].child[BSEARCH_TREE_RIGHT]) {
+                            node = parent;
+                            parent = tree->nodes[parent].parent;
+                        }
+                        node = parent;
+                    }
+                }
+
+                // pending subtree ranges never exceed subtree height, which is less than the bit count of BSEARCH_TREE_INDEX_TYPE
+                struct build_range { BSEARCH_TREE_INDEX_TYPE low, high, parent; } stack[sizeof(BSEARCH_TREE_INDEX_TYPE) << 3];
+                size_t stack_size = 0;
+                stack[stack_size++] = (struct build_range) { .low = 0, .high = (BSEARCH_TREE_INDEX_TYPE)count, .parent = above, };
+
+                while (stack_size) {
+                    // pop range and make its middle node the subtree's root, so that both subtree sizes differ at most by one
+                    const struct build_range range = stack[--stack_size];
+                    const BSEARCH_TREE_INDEX_TYPE middle = (BSEARCH_TREE_INDEX_TYPE)(range.low + (range.high - range.low) / 2);
+
+                    tree->nodes[order[middle]].parent = range.parent;
+                    tree->nodes[order[middle]].child[BSEARCH_TREE_LEFT] = range.low < middle ? order[range.low + (middle - range.low) / 2] : BSEARCH_TREE_SIZE;
+                    tree->nodes[order[middle]].child[BSEARCH_TREE_RIGHT] = middle + 1 < range.high ? order[(middle + 1) + (range.high - middle - 1) / 2] : BSEARCH_TREE_SIZE;
+
+                    if (range.low < middle) {
+                        stack[stack_size++] = (struct build_range) { .low = range.low, .high = middle, .parent = order[middle], };
+                    }
+
+                    if (middle + 1 < range.high) {
+                        stack[stack_size++] = (struct build_range) { .low = middle + 1, .high = range.high, .parent = order[middle], };
+                    }
+                }
+
+                // hang rebuilt subtree where scapegoat was
+                const BSEARCH_TREE_INDEX_TYPE top = order[count / 2];
+                if (BSEARCH_TREE_SIZE == above) tree->root = top;
+                else if (scapegoat == tree->nodes[above].child[BSEARCH_TREE_LEFT]) tree->nodes[above].child[BSEARCH_TREE_LEFT] = top;
+                else tree->nodes[above].child[BSEARCH_TREE_RIGHT] = top;
+
+                BSEARCH_TREE_FREE(order);
+            }
+        }
+        tree->max_size = tree->size;
+    }
+#endif
     return removed;
 }
 
@@ -339,22 +546,20 @@ static inline bool contains_bsearch_tree(const bsearch_tree_s tree, const BSEARC
     BSEARCH_TREE_ASSERT(tree.size && "[ERROR] Can't check empty tree.");
     BSEARCH_TREE_ASSERT(BSEARCH_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    for (size_t node = tree.root; BSEARCH_TREE_SIZE != node;) {
+    for (BSEARCH_TREE_INDEX_TYPE node = tree.root; BSEARCH_TREE_SIZE != node;) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree.compare(tree.elements[node], element);
+        const int comparison = BSEARCH_TREE_COMPARE_WITH(tree.compare, element, tree.elements[node]);
         if (!comparison) {
             return true;
         }
 
-        const size_t node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
-        node = tree.node[node_index][node]; // go to next child node
+        const BSEARCH_TREE_INDEX_TYPE node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
+        node = tree.nodes[node].child[node_index]; // go to next child node
     }
 
     return false;
@@ -364,15 +569,13 @@ static inline BSEARCH_TREE_DATA_TYPE get_min_bsearch_tree(const bsearch_tree_s t
     BSEARCH_TREE_ASSERT(tree.size && "[ERROR] Can't get from empty tree.");
     BSEARCH_TREE_ASSERT(BSEARCH_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    size_t minimum_node = tree.root;
-    for (size_t i = tree.node[BSEARCH_TREE_LEFT][minimum_node]; BSEARCH_TREE_SIZE != i; i = tree.node[BSEARCH_TREE_LEFT][i]) {
+    BSEARCH_TREE_INDEX_TYPE minimum_node = tree.root;
+    for (BSEARCH_TREE_INDEX_TYPE i = tree.nodes[minimum_node].child[BSEARCH_TREE_LEFT]; BSEARCH_TREE_SIZE != i; i = tree.nodes[i].child[BSEARCH_TREE_LEFT]) {
         minimum_node = i;
     }
 
@@ -383,15 +586,13 @@ static inline BSEARCH_TREE_DATA_TYPE get_max_bsearch_tree(const bsearch_tree_s t
     BSEARCH_TREE_ASSERT(tree.size && "[ERROR] Can't get from empty tree.");
     BSEARCH_TREE_ASSERT(BSEARCH_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    size_t maximum_node = tree.root;
-    for (size_t i = tree.node[BSEARCH_TREE_RIGHT][maximum_node]; BSEARCH_TREE_SIZE != i; i = tree.node[BSEARCH_TREE_RIGHT][i]) {
+    BSEARCH_TREE_INDEX_TYPE maximum_node = tree.root;
+    for (BSEARCH_TREE_INDEX_TYPE i = tree.nodes[maximum_node].child[BSEARCH_TREE_RIGHT]; BSEARCH_TREE_SIZE != i; i = tree.nodes[i].child[BSEARCH_TREE_RIGHT]) {
         maximum_node = i;
     }
 
@@ -402,58 +603,129 @@ static inline BSEARCH_TREE_DATA_TYPE remove_min_bsearch_tree(bsearch_tree_s * tr
     BSEARCH_TREE_ASSERT(tree->size && "[ERROR] Can't get from empty tree.");
     BSEARCH_TREE_ASSERT(BSEARCH_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
 
-    BSEARCH_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree->size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
     BSEARCH_TREE_ASSERT(tree->root != BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root index.");
     BSEARCH_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    BSEARCH_TREE_ASSERT(tree->parent[tree->root] == BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    BSEARCH_TREE_ASSERT(tree->nodes[tree->root].parent == BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t * minimum_node = &(tree->root);
-    for (size_t * i = tree->node[BSEARCH_TREE_LEFT] + (*minimum_node); BSEARCH_TREE_SIZE != (*i); i = tree->node[BSEARCH_TREE_LEFT] + (*i)) {
+    BSEARCH_TREE_INDEX_TYPE * minimum_node = &(tree->root);
+    for (BSEARCH_TREE_INDEX_TYPE * i = &(tree->nodes[(*minimum_node)].child[BSEARCH_TREE_LEFT]); BSEARCH_TREE_SIZE != (*i); i = &(tree->nodes[(*i)].child[BSEARCH_TREE_LEFT])) {
         minimum_node = i;
     }
 
     BSEARCH_TREE_DATA_TYPE removed = tree->elements[(*minimum_node)];
     tree->size--;
 
-    const size_t hole_index = (*minimum_node);
-    const size_t right_node = tree->node[BSEARCH_TREE_RIGHT][(*minimum_node)];
+    const BSEARCH_TREE_INDEX_TYPE hole_index = (*minimum_node);
+    const BSEARCH_TREE_INDEX_TYPE right_node = tree->nodes[(*minimum_node)].child[BSEARCH_TREE_RIGHT];
     if (BSEARCH_TREE_SIZE != right_node) {
-        tree->parent[right_node] = tree->parent[(*minimum_node)];
+        tree->nodes[right_node].parent = tree->nodes[(*minimum_node)].parent;
     }
     (*minimum_node) = right_node;
 
+    if (tree->size && tree->root == tree->size) { // if head node is last array element then change index to removed one
+        tree->root = hole_index;
+    }
+
     // cut hole node from the rest of the tree
-    tree->node[BSEARCH_TREE_LEFT][hole_index] = tree->node[BSEARCH_TREE_RIGHT][hole_index] = tree->parent[hole_index] = hole_index;
+    tree->nodes[hole_index].child[BSEARCH_TREE_LEFT] = tree->nodes[hole_index].child[BSEARCH_TREE_RIGHT] = tree->nodes[hole_index].parent = hole_index;
 
     // replace removed element with rightmost array one (or fill hole with valid element)
     tree->elements[hole_index] = tree->elements[tree->size];
-    tree->node[BSEARCH_TREE_LEFT][hole_index] = tree->node[BSEARCH_TREE_LEFT][tree->size];
-    tree->node[BSEARCH_TREE_RIGHT][hole_index] = tree->node[BSEARCH_TREE_RIGHT][tree->size];
-    tree->parent[hole_index] = tree->parent[tree->size];
+    tree->nodes[hole_index].child[BSEARCH_TREE_LEFT] = tree->nodes[tree->size].child[BSEARCH_TREE_LEFT];
+    tree->nodes[hole_index].child[BSEARCH_TREE_RIGHT] = tree->nodes[tree->size].child[BSEARCH_TREE_RIGHT];
+    tree->nodes[hole_index].parent = tree->nodes[tree->size].parent;
 
     // redirect parent and children of rightmost last array node if they dont overlap with removed index
-    const size_t left_last = tree->node[BSEARCH_TREE_LEFT][tree->size];
+    const BSEARCH_TREE_INDEX_TYPE left_last = tree->nodes[tree->size].child[BSEARCH_TREE_LEFT];
     if (BSEARCH_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole_index;
+        tree->nodes[left_last].parent = hole_index;
     }
 
-    const size_t right_last = tree->node[BSEARCH_TREE_RIGHT][tree->size];
+    const BSEARCH_TREE_INDEX_TYPE right_last = tree->nodes[tree->size].child[BSEARCH_TREE_RIGHT];
     if (BSEARCH_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole_index;
+        tree->nodes[right_last].parent = hole_index;
     }
 
-    const size_t parent_last = tree->parent[tree->size];
+    const BSEARCH_TREE_INDEX_TYPE parent_last = tree->nodes[tree->size].parent;
     if (BSEARCH_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole_index;
+        const BSEARCH_TREE_INDEX_TYPE node_index = tree->size == tree->nodes[parent_last].child[BSEARCH_TREE_LEFT] ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
+        tree->nodes[parent_last].child[node_index] = hole_index;
     }
 
+
+#ifdef BSEARCH_TREE_SCAPEGOAT
+    if (3 * tree->size < 2 * tree->max_size) { // if tree shrank below two thirds of its largest size then rebuild it whole
+        if (tree->size) {
+            const BSEARCH_TREE_INDEX_TYPE scapegoat = tree->root;
+            const size_t count = tree->size;
+            { // REBUILD SCAPEGOAT'S SUBTREE INTO A PERFECTLY BALANCED ONE
+                // collect subtree's nodes in order, elements stay in place and only their links are rewritten
+                BSEARCH_TREE_INDEX_TYPE * order = BSEARCH_TREE_ALLOC(count * sizeof(BSEARCH_TREE_INDEX_TYPE));
+                BSEARCH_TREE_ASSERT(order && "[ERROR] Memory allocation failed.");
+
+                const BSEARCH_TREE_INDEX_TYPE above = tree->nodes[scapegoat].parent;
+                BSEARCH_TREE_INDEX_TYPE node = scapegoat;
+                while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                    node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+                }
+
+                for (size_t i = 0; i < count; ++i) {
+                    order[i] = node;
+
+                    if (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_RIGHT]) { // successor is leftmost node of right subtree
+                        node = tree->nodes[node].child[BSEARCH_TREE_RIGHT];
+                        while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                            node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+                        }
+                    } else { // else successor is first ancestor whose left subtree contains node
+                        BSEARCH_TREE_INDEX_TYPE parent = tree->nodes[node].parent;
+                        while (BSEARCH_TREE_SIZE != parent && node == tree->nodes[parent].child[BSEARCH_TREE_RIGHT]) {
+                            node = parent;
+                            parent = tree->nodes[parent].parent;
+                        }
+                        node = parent;
+                    }
+                }
+
+                // pending subtree ranges never exceed subtree height, which is less than the bit count of BSEARCH_TREE_INDEX_TYPE
+                struct build_range { BSEARCH_TREE_INDEX_TYPE low, high, parent; } stack[sizeof(BSEARCH_TREE_INDEX_TYPE) << 3];
+                size_t stack_size = 0;
+                stack[stack_size++] = (struct build_range) { .low = 0, .high = (BSEARCH_TREE_INDEX_TYPE)count, .parent = above, };
+
+                while (stack_size) {
+                    // pop range and make its middle node the subtree's root, so that both subtree sizes differ at most by one
+                    const struct build_range range = stack[--stack_size];
+                    const BSEARCH_TREE_INDEX_TYPE middle = (BSEARCH_TREE_INDEX_TYPE)(range.low + (range.high - range.low) / 2);
+
+                    tree->nodes[order[middle]].parent = range.parent;
+                    tree->nodes[order[middle]].child[BSEARCH_TREE_LEFT] = range.low < middle ? order[range.low + (middle - range.low) / 2] : BSEARCH_TREE_SIZE;
+                    tree->nodes[order[middle]].child[BSEARCH_TREE_RIGHT] = middle + 1 < range.high ? order[(middle + 1) + (range.high - middle - 1) / 2] : BSEARCH_TREE_SIZE;
+
+                    if (range.low < middle) {
+                        stack[stack_size++] = (struct build_range) { .low = range.low, .high = middle, .parent = order[middle], };
+                    }
+
+                    if (middle + 1 < range.high) {
+                        stack[stack_size++] = (struct build_range) { .low = middle + 1, .high = range.high, .parent = order[middle], };
+                    }
+                }
+
+                // hang rebuilt subtree where scapegoat was
+                const BSEARCH_TREE_INDEX_TYPE top = order[count / 2];
+                if (BSEARCH_TREE_SIZE == above) tree->root = top;
+                else if (scapegoat == tree->nodes[above].child[BSEARCH_TREE_LEFT]) tree->nodes[above].child[BSEARCH_TREE_LEFT] = top;
+                else tree->nodes[above].child[BSEARCH_TREE_RIGHT] = top;
+
+                BSEARCH_TREE_FREE(order);
+            }
+        }
+        tree->max_size = tree->size;
+    }
+#endif
     return removed;
 }
 
@@ -461,76 +733,502 @@ static inline BSEARCH_TREE_DATA_TYPE remove_max_bsearch_tree(bsearch_tree_s * tr
     BSEARCH_TREE_ASSERT(tree->size && "[ERROR] Can't get from empty tree.");
     BSEARCH_TREE_ASSERT(BSEARCH_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
 
-    BSEARCH_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree->size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
     BSEARCH_TREE_ASSERT(tree->root != BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root index.");
     BSEARCH_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    BSEARCH_TREE_ASSERT(tree->parent[tree->root] == BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    BSEARCH_TREE_ASSERT(tree->nodes[tree->root].parent == BSEARCH_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t * maximum_node = &(tree->root);
-    for (size_t * i = tree->node[BSEARCH_TREE_RIGHT] + (*maximum_node); BSEARCH_TREE_SIZE != (*i); i = tree->node[BSEARCH_TREE_RIGHT] + (*i)) {
+    BSEARCH_TREE_INDEX_TYPE * maximum_node = &(tree->root);
+    for (BSEARCH_TREE_INDEX_TYPE * i = &(tree->nodes[(*maximum_node)].child[BSEARCH_TREE_RIGHT]); BSEARCH_TREE_SIZE != (*i); i = &(tree->nodes[(*i)].child[BSEARCH_TREE_RIGHT])) {
         maximum_node = i;
     }
 
     BSEARCH_TREE_DATA_TYPE removed = tree->elements[(*maximum_node)];
     tree->size--;
 
-    const size_t hole_index = (*maximum_node);
-    const size_t left_node = tree->node[BSEARCH_TREE_LEFT][(*maximum_node)];
+    const BSEARCH_TREE_INDEX_TYPE hole_index = (*maximum_node);
+    const BSEARCH_TREE_INDEX_TYPE left_node = tree->nodes[(*maximum_node)].child[BSEARCH_TREE_LEFT];
     if (BSEARCH_TREE_SIZE != left_node) {
-        tree->parent[left_node] = tree->parent[(*maximum_node)];
+        tree->nodes[left_node].parent = tree->nodes[(*maximum_node)].parent;
     }
     (*maximum_node) = left_node;
 
+    if (tree->size && tree->root == tree->size) { // if head node is last array element then change index to removed one
+        tree->root = hole_index;
+    }
+
     // cut hole node from the rest of the tree
-    tree->node[BSEARCH_TREE_LEFT][hole_index] = tree->node[BSEARCH_TREE_RIGHT][hole_index] = tree->parent[hole_index] = hole_index;
+    tree->nodes[hole_index].child[BSEARCH_TREE_LEFT] = tree->nodes[hole_index].child[BSEARCH_TREE_RIGHT] = tree->nodes[hole_index].parent = hole_index;
 
     // replace removed element with rightmost array one (or fill hole with valid element)
     tree->elements[hole_index] = tree->elements[tree->size];
-    tree->node[BSEARCH_TREE_LEFT][hole_index] = tree->node[BSEARCH_TREE_LEFT][tree->size];
-    tree->node[BSEARCH_TREE_RIGHT][hole_index] = tree->node[BSEARCH_TREE_RIGHT][tree->size];
-    tree->parent[hole_index] = tree->parent[tree->size];
+    tree->nodes[hole_index].child[BSEARCH_TREE_LEFT] = tree->nodes[tree->size].child[BSEARCH_TREE_LEFT];
+    tree->nodes[hole_index].child[BSEARCH_TREE_RIGHT] = tree->nodes[tree->size].child[BSEARCH_TREE_RIGHT];
+    tree->nodes[hole_index].parent = tree->nodes[tree->size].parent;
 
     // redirect parent and children of rightmost last array node if they dont overlap with removed index
-    const size_t left_last = tree->node[BSEARCH_TREE_LEFT][tree->size];
+    const BSEARCH_TREE_INDEX_TYPE left_last = tree->nodes[tree->size].child[BSEARCH_TREE_LEFT];
     if (BSEARCH_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole_index;
+        tree->nodes[left_last].parent = hole_index;
     }
 
-    const size_t right_last = tree->node[BSEARCH_TREE_RIGHT][tree->size];
+    const BSEARCH_TREE_INDEX_TYPE right_last = tree->nodes[tree->size].child[BSEARCH_TREE_RIGHT];
     if (BSEARCH_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole_index;
+        tree->nodes[right_last].parent = hole_index;
     }
 
-    const size_t parent_last = tree->parent[tree->size];
+    const BSEARCH_TREE_INDEX_TYPE parent_last = tree->nodes[tree->size].parent;
     if (BSEARCH_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole_index;
+        const BSEARCH_TREE_INDEX_TYPE node_index = tree->size == tree->nodes[parent_last].child[BSEARCH_TREE_LEFT] ? BSEARCH_TREE_LEFT : BSEARCH_TREE_RIGHT;
+        tree->nodes[parent_last].child[node_index] = hole_index;
     }
 
+
+#ifdef BSEARCH_TREE_SCAPEGOAT
+    if (3 * tree->size < 2 * tree->max_size) { // if tree shrank below two thirds of its largest size then rebuild it whole
+        if (tree->size) {
+            const BSEARCH_TREE_INDEX_TYPE scapegoat = tree->root;
+            const size_t count = tree->size;
+            { // REBUILD SCAPEGOAT'S SUBTREE INTO A PERFECTLY BALANCED ONE
+                // collect subtree's nodes in order, elements stay in place and only their links are rewritten
+                BSEARCH_TREE_INDEX_TYPE * order = BSEARCH_TREE_ALLOC(count * sizeof(BSEARCH_TREE_INDEX_TYPE));
+                BSEARCH_TREE_ASSERT(order && "[ERROR] Memory allocation failed.");
+
+                const BSEARCH_TREE_INDEX_TYPE above = tree->nodes[scapegoat].parent;
+                BSEARCH_TREE_INDEX_TYPE node = scapegoat;
+                while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                    node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+                }
+
+                for (size_t i = 0; i < count; ++i) {
+                    order[i] = node;
+
+                    if (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_RIGHT]) { // successor is leftmost node of right subtree
+                        node = tree->nodes[node].child[BSEARCH_TREE_RIGHT];
+                        while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                            node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+                        }
+                    } else { // else successor is first ancestor whose left subtree contains node
+                        BSEARCH_TREE_INDEX_TYPE parent = tree->nodes[node].parent;
+                        while (BSEARCH_TREE_SIZE != parent && node == tree->nodes[parent].child[BSEARCH_TREE_RIGHT]) {
+                            node = parent;
+                            parent = tree->nodes[parent].parent;
+                        }
+                        node = parent;
+                    }
+                }
+
+                // pending subtree ranges never exceed subtree height, which is less than the bit count of BSEARCH_TREE_INDEX_TYPE
+                struct build_range { BSEARCH_TREE_INDEX_TYPE low, high, parent; } stack[sizeof(BSEARCH_TREE_INDEX_TYPE) << 3];
+                size_t stack_size = 0;
+                stack[stack_size++] = (struct build_range) { .low = 0, .high = (BSEARCH_TREE_INDEX_TYPE)count, .parent = above, };
+
+                while (stack_size) {
+                    // pop range and make its middle node the subtree's root, so that both subtree sizes differ at most by one
+                    const struct build_range range = stack[--stack_size];
+                    const BSEARCH_TREE_INDEX_TYPE middle = (BSEARCH_TREE_INDEX_TYPE)(range.low + (range.high - range.low) / 2);
+
+                    tree->nodes[order[middle]].parent = range.parent;
+                    tree->nodes[order[middle]].child[BSEARCH_TREE_LEFT] = range.low < middle ? order[range.low + (middle - range.low) / 2] : BSEARCH_TREE_SIZE;
+                    tree->nodes[order[middle]].child[BSEARCH_TREE_RIGHT] = middle + 1 < range.high ? order[(middle + 1) + (range.high - middle - 1) / 2] : BSEARCH_TREE_SIZE;
+
+                    if (range.low < middle) {
+                        stack[stack_size++] = (struct build_range) { .low = range.low, .high = middle, .parent = order[middle], };
+                    }
+
+                    if (middle + 1 < range.high) {
+                        stack[stack_size++] = (struct build_range) { .low = middle + 1, .high = range.high, .parent = order[middle], };
+                    }
+                }
+
+                // hang rebuilt subtree where scapegoat was
+                const BSEARCH_TREE_INDEX_TYPE top = order[count / 2];
+                if (BSEARCH_TREE_SIZE == above) tree->root = top;
+                else if (scapegoat == tree->nodes[above].child[BSEARCH_TREE_LEFT]) tree->nodes[above].child[BSEARCH_TREE_LEFT] = top;
+                else tree->nodes[above].child[BSEARCH_TREE_RIGHT] = top;
+
+                BSEARCH_TREE_FREE(order);
+            }
+        }
+        tree->max_size = tree->size;
+    }
+#endif
     return removed;
 }
 
+static inline bsearch_tree_cursor_s begin_bsearch_tree(const bsearch_tree_s tree) {
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    bsearch_tree_cursor_s cursor = { .element = NULL, .node = tree.root, };
+    if (BSEARCH_TREE_SIZE == cursor.node) { // if tree is empty then cursor is past the end
+        return cursor;
+    }
+
+    // first element is the leftmost node
+    while (BSEARCH_TREE_SIZE != tree.nodes[cursor.node].child[BSEARCH_TREE_LEFT]) {
+        cursor.node = tree.nodes[cursor.node].child[BSEARCH_TREE_LEFT];
+    }
+    cursor.element = tree.elements + cursor.node;
+
+    return cursor;
+}
+
+static inline bsearch_tree_cursor_s rbegin_bsearch_tree(const bsearch_tree_s tree) {
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    bsearch_tree_cursor_s cursor = { .element = NULL, .node = tree.root, };
+    if (BSEARCH_TREE_SIZE == cursor.node) { // if tree is empty then cursor is past the end
+        return cursor;
+    }
+
+    // last element is the rightmost node
+    while (BSEARCH_TREE_SIZE != tree.nodes[cursor.node].child[BSEARCH_TREE_RIGHT]) {
+        cursor.node = tree.nodes[cursor.node].child[BSEARCH_TREE_RIGHT];
+    }
+    cursor.element = tree.elements + cursor.node;
+
+    return cursor;
+}
+
+static inline bsearch_tree_cursor_s next_bsearch_tree(const bsearch_tree_s tree, const bsearch_tree_cursor_s cursor) {
+    BSEARCH_TREE_ASSERT(cursor.element && "[ERROR] Can't move cursor that is past the end.");
+    BSEARCH_TREE_ASSERT(cursor.node < tree.size && "[ERROR] Invalid cursor node index.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    bsearch_tree_cursor_s next = { .element = NULL, .node = tree.nodes[cursor.node].child[BSEARCH_TREE_RIGHT], };
+    if (BSEARCH_TREE_SIZE != next.node) { // successor is the leftmost node of right subtree
+        while (BSEARCH_TREE_SIZE != tree.nodes[next.node].child[BSEARCH_TREE_LEFT]) {
+            next.node = tree.nodes[next.node].child[BSEARCH_TREE_LEFT];
+        }
+    } else { // else successor is the first ancestor whose left subtree contains node
+        BSEARCH_TREE_INDEX_TYPE child = cursor.node;
+        next.node = tree.nodes[child].parent;
+        while (BSEARCH_TREE_SIZE != next.node && child == tree.nodes[next.node].child[BSEARCH_TREE_RIGHT]) {
+            child = next.node;
+            next.node = tree.nodes[next.node].parent;
+        }
+    }
+
+    if (BSEARCH_TREE_SIZE != next.node) {
+        next.element = tree.elements + next.node;
+    }
+
+    return next;
+}
+
+static inline bsearch_tree_cursor_s prev_bsearch_tree(const bsearch_tree_s tree, const bsearch_tree_cursor_s cursor) {
+    BSEARCH_TREE_ASSERT(cursor.element && "[ERROR] Can't move cursor that is past the end.");
+    BSEARCH_TREE_ASSERT(cursor.node < tree.size && "[ERROR] Invalid cursor node index.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    bsearch_tree_cursor_s prev = { .element = NULL, .node = tree.nodes[cursor.node].child[BSEARCH_TREE_LEFT], };
+    if (BSEARCH_TREE_SIZE != prev.node) { // predecessor is the rightmost node of left subtree
+        while (BSEARCH_TREE_SIZE != tree.nodes[prev.node].child[BSEARCH_TREE_RIGHT]) {
+            prev.node = tree.nodes[prev.node].child[BSEARCH_TREE_RIGHT];
+        }
+    } else { // else predecessor is the first ancestor whose right subtree contains node
+        BSEARCH_TREE_INDEX_TYPE child = cursor.node;
+        prev.node = tree.nodes[child].parent;
+        while (BSEARCH_TREE_SIZE != prev.node && child == tree.nodes[prev.node].child[BSEARCH_TREE_LEFT]) {
+            child = prev.node;
+            prev.node = tree.nodes[prev.node].parent;
+        }
+    }
+
+    if (BSEARCH_TREE_SIZE != prev.node) {
+        prev.element = tree.elements + prev.node;
+    }
+
+    return prev;
+}
+
+static inline bsearch_tree_cursor_s seek_bsearch_tree(const bsearch_tree_s tree, const BSEARCH_TREE_DATA_TYPE element) {
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // find the leftmost node that is not less than element, without stopping at equal ones since duplicates may be left
+    bsearch_tree_cursor_s cursor = { .element = NULL, .node = BSEARCH_TREE_SIZE, };
+    for (BSEARCH_TREE_INDEX_TYPE node = tree.root; BSEARCH_TREE_SIZE != node;) {
+        if (BSEARCH_TREE_COMPARE_WITH(tree.compare, element, tree.elements[node]) <= 0) {
+            cursor.node = node;
+            node = tree.nodes[node].child[BSEARCH_TREE_LEFT];
+        } else {
+            node = tree.nodes[node].child[BSEARCH_TREE_RIGHT];
+        }
+    }
+
+    if (BSEARCH_TREE_SIZE != cursor.node) {
+        cursor.element = tree.elements + cursor.node;
+    }
+
+    return cursor;
+}
+
+// links tree's elements, which must already be sorted, into a balanced tree with each array index as in-order position
+static inline void link_sorted_bsearch_tree(bsearch_tree_s * tree) {
+    BSEARCH_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    BSEARCH_TREE_ASSERT(tree->size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    if (!tree->size) {
+        tree->root = BSEARCH_TREE_SIZE;
+        return;
+    }
+
+    // pending subtree ranges never exceed tree height, which is less than the bit count of BSEARCH_TREE_INDEX_TYPE
+    struct build_range { BSEARCH_TREE_INDEX_TYPE low, high, parent; } stack[sizeof(BSEARCH_TREE_INDEX_TYPE) << 3];
+    size_t stack_size = 0;
+    stack[stack_size++] = (struct build_range) { .low = 0, .high = (BSEARCH_TREE_INDEX_TYPE)tree->size, .parent = BSEARCH_TREE_SIZE, };
+
+    while (stack_size) {
+        // pop range and make its middle element the subtree's root, so that both subtree sizes differ at most by one
+        const struct build_range range = stack[--stack_size];
+        const BSEARCH_TREE_INDEX_TYPE middle = (BSEARCH_TREE_INDEX_TYPE)(range.low + (range.high - range.low) / 2);
+
+        tree->nodes[middle].parent = range.parent;
+        tree->nodes[middle].child[BSEARCH_TREE_LEFT] = (BSEARCH_TREE_INDEX_TYPE)(range.low < middle ? range.low + (middle - range.low) / 2 : BSEARCH_TREE_SIZE);
+        tree->nodes[middle].child[BSEARCH_TREE_RIGHT] = (BSEARCH_TREE_INDEX_TYPE)(middle + 1 < range.high ? (middle + 1) + (range.high - middle - 1) / 2 : BSEARCH_TREE_SIZE);
+
+        if (BSEARCH_TREE_SIZE != tree->nodes[middle].child[BSEARCH_TREE_LEFT]) {
+            stack[stack_size++] = (struct build_range) { .low = range.low, .high = middle, .parent = middle, };
+        }
+
+        if (BSEARCH_TREE_SIZE != tree->nodes[middle].child[BSEARCH_TREE_RIGHT]) {
+            stack[stack_size++] = (struct build_range) { .low = middle + 1, .high = range.high, .parent = middle, };
+        }
+    }
+
+    tree->root = (BSEARCH_TREE_INDEX_TYPE)(tree->size / 2);
+#ifdef BSEARCH_TREE_SCAPEGOAT
+    tree->max_size = tree->size; // linking is a whole tree rebuild
+#endif
+}
+
+static inline bsearch_tree_s union_bsearch_tree(const bsearch_tree_s tree_one, const bsearch_tree_s tree_two, const copy_bsearch_tree_fn copy) {
+    BSEARCH_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    bsearch_tree_s tree_union = create_bsearch_tree(BSEARCH_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    bsearch_tree_cursor_s one = begin_bsearch_tree(tree_one), two = begin_bsearch_tree(tree_two);
+    while (one.element || two.element) {
+        const int comparison = !one.element ? 1 : !two.element ? -1 : BSEARCH_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        BSEARCH_TREE_ASSERT(tree_union.size < BSEARCH_TREE_SIZE && "[ERROR] Union exceeds maximum tree size.");
+        tree_union.elements[tree_union.size++] = copy(comparison <= 0 ? (*one.element) : (*two.element));
+
+        if (comparison <= 0) one = next_bsearch_tree(tree_one, one);
+        if (comparison >= 0) two = next_bsearch_tree(tree_two, two);
+    }
+    link_sorted_bsearch_tree(&tree_union);
+
+    return tree_union;
+}
+
+static inline bsearch_tree_s intersect_bsearch_tree(const bsearch_tree_s tree_one, const bsearch_tree_s tree_two, const copy_bsearch_tree_fn copy) {
+    BSEARCH_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    bsearch_tree_s tree_intersect = create_bsearch_tree(BSEARCH_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    bsearch_tree_cursor_s one = begin_bsearch_tree(tree_one), two = begin_bsearch_tree(tree_two);
+    while (one.element && two.element) {
+        const int comparison = BSEARCH_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (!comparison) {
+            tree_intersect.elements[tree_intersect.size++] = copy((*one.element));
+        }
+
+        if (comparison <= 0) one = next_bsearch_tree(tree_one, one);
+        if (comparison >= 0) two = next_bsearch_tree(tree_two, two);
+    }
+    link_sorted_bsearch_tree(&tree_intersect);
+
+    return tree_intersect;
+}
+
+static inline bsearch_tree_s subtract_bsearch_tree(const bsearch_tree_s tree_one, const bsearch_tree_s tree_two, const copy_bsearch_tree_fn copy) {
+    BSEARCH_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    bsearch_tree_s tree_subtract = create_bsearch_tree(BSEARCH_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    bsearch_tree_cursor_s one = begin_bsearch_tree(tree_one), two = begin_bsearch_tree(tree_two);
+    while (one.element) {
+        const int comparison = !two.element ? -1 : BSEARCH_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (comparison < 0) {
+            tree_subtract.elements[tree_subtract.size++] = copy((*one.element));
+        }
+
+        if (comparison <= 0) one = next_bsearch_tree(tree_one, one);
+        if (comparison >= 0) two = next_bsearch_tree(tree_two, two);
+    }
+    link_sorted_bsearch_tree(&tree_subtract);
+
+    return tree_subtract;
+}
+
+static inline bsearch_tree_s exclude_bsearch_tree(const bsearch_tree_s tree_one, const bsearch_tree_s tree_two, const copy_bsearch_tree_fn copy) {
+    BSEARCH_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_one.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree_two.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    bsearch_tree_s tree_exclude = create_bsearch_tree(BSEARCH_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    bsearch_tree_cursor_s one = begin_bsearch_tree(tree_one), two = begin_bsearch_tree(tree_two);
+    while (one.element || two.element) {
+        const int comparison = !one.element ? 1 : !two.element ? -1 : BSEARCH_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (comparison) {
+            BSEARCH_TREE_ASSERT(tree_exclude.size < BSEARCH_TREE_SIZE && "[ERROR] Exclude exceeds maximum tree size.");
+            tree_exclude.elements[tree_exclude.size++] = copy(comparison < 0 ? (*one.element) : (*two.element));
+        }
+
+        if (comparison <= 0) one = next_bsearch_tree(tree_one, one);
+        if (comparison >= 0) two = next_bsearch_tree(tree_two, two);
+    }
+    link_sorted_bsearch_tree(&tree_exclude);
+
+    return tree_exclude;
+}
+
+static inline void compact_bsearch_tree(bsearch_tree_s * tree) {
+    BSEARCH_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+
+    BSEARCH_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree->size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    if (!tree->size) {
+        return;
+    }
+
+    // each node's in-order position becomes its new array index, thus in-order scans walk memory sequentially
+    BSEARCH_TREE_INDEX_TYPE * position = BSEARCH_TREE_ALLOC(tree->size * sizeof(BSEARCH_TREE_INDEX_TYPE));
+    BSEARCH_TREE_ASSERT(position && "[ERROR] Memory allocation failed.");
+
+    BSEARCH_TREE_INDEX_TYPE node = tree->root;
+    while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+        node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+    }
+
+    for (BSEARCH_TREE_INDEX_TYPE rank = 0; BSEARCH_TREE_SIZE != node; ++rank) {
+        position[node] = rank;
+
+        if (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_RIGHT]) { // successor is leftmost node of right subtree
+            node = tree->nodes[node].child[BSEARCH_TREE_RIGHT];
+            while (BSEARCH_TREE_SIZE != tree->nodes[node].child[BSEARCH_TREE_LEFT]) {
+                node = tree->nodes[node].child[BSEARCH_TREE_LEFT];
+            }
+        } else { // else successor is first ancestor whose left subtree contains node
+            BSEARCH_TREE_INDEX_TYPE parent = tree->nodes[node].parent;
+            while (BSEARCH_TREE_SIZE != parent && node == tree->nodes[parent].child[BSEARCH_TREE_RIGHT]) {
+                node = parent;
+                parent = tree->nodes[parent].parent;
+            }
+            node = parent;
+        }
+    }
+
+    // scatter elements and node records into new arrays while renaming every valid link, tree shape stays the same
+    BSEARCH_TREE_DATA_TYPE * elements = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(BSEARCH_TREE_DATA_TYPE));
+    bsearch_tree_node_s * nodes = BSEARCH_TREE_ALLOC(BSEARCH_TREE_SIZE * sizeof(bsearch_tree_node_s));
+
+    BSEARCH_TREE_ASSERT(elements && "[ERROR] Memory allocation failed.");
+    BSEARCH_TREE_ASSERT(nodes && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < tree->size; ++i) {
+        bsearch_tree_node_s record = tree->nodes[i];
+        if (BSEARCH_TREE_SIZE != record.child[BSEARCH_TREE_LEFT]) record.child[BSEARCH_TREE_LEFT] = position[record.child[BSEARCH_TREE_LEFT]];
+        if (BSEARCH_TREE_SIZE != record.child[BSEARCH_TREE_RIGHT]) record.child[BSEARCH_TREE_RIGHT] = position[record.child[BSEARCH_TREE_RIGHT]];
+        if (BSEARCH_TREE_SIZE != record.parent) record.parent = position[record.parent];
+
+        nodes[position[i]] = record;
+        elements[position[i]] = tree->elements[i];
+    }
+
+    tree->root = position[tree->root];
+
+    BSEARCH_TREE_FREE(position);
+    BSEARCH_TREE_FREE(tree->elements);
+    BSEARCH_TREE_FREE(tree->nodes);
+
+    tree->elements = elements;
+    tree->nodes = nodes;
+}
+
 static inline void inorder_bsearch_tree(const bsearch_tree_s tree, const operate_bsearch_tree_fn operate, void * args) {
     BSEARCH_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     bool left_done = false;
-    size_t node = tree.root;
+    BSEARCH_TREE_INDEX_TYPE node = tree.root;
     while (BSEARCH_TREE_SIZE != node) {
-        while (!left_done && BSEARCH_TREE_SIZE != tree.node[BSEARCH_TREE_LEFT][node]) {
-            node = tree.node[BSEARCH_TREE_LEFT][node];
+        while (!left_done && BSEARCH_TREE_SIZE != tree.nodes[node].child[BSEARCH_TREE_LEFT]) {
+            node = tree.nodes[node].child[BSEARCH_TREE_LEFT];
         }
 
         if (!operate(tree.elements + node, args)) {
@@ -538,19 +1236,19 @@ static inline void inorder_bsearch_tree(const bsearch_tree_s tree, const operate
         }
 
         left_done = true;
-        if (BSEARCH_TREE_SIZE != tree.node[BSEARCH_TREE_RIGHT][node]) {
+        if (BSEARCH_TREE_SIZE != tree.nodes[node].child[BSEARCH_TREE_RIGHT]) {
             left_done = false;
-            node = tree.node[BSEARCH_TREE_RIGHT][node];
-        } else if (BSEARCH_TREE_SIZE != tree.parent[node]) {
-            while (BSEARCH_TREE_SIZE != tree.parent[node] && node == tree.node[BSEARCH_TREE_RIGHT][tree.parent[node]]) {
-                node = tree.parent[node];
+            node = tree.nodes[node].child[BSEARCH_TREE_RIGHT];
+        } else if (BSEARCH_TREE_SIZE != tree.nodes[node].parent) {
+            while (BSEARCH_TREE_SIZE != tree.nodes[node].parent && node == tree.nodes[tree.nodes[node].parent].child[BSEARCH_TREE_RIGHT]) {
+                node = tree.nodes[node].parent;
             }
 
-            if (BSEARCH_TREE_SIZE == tree.parent[node]) {
+            if (BSEARCH_TREE_SIZE == tree.nodes[node].parent) {
                 break;
             }
 
-            node = tree.parent[node];
+            node = tree.nodes[node].parent;
         } else {
             break;
         }
@@ -560,95 +1258,80 @@ static inline void inorder_bsearch_tree(const bsearch_tree_s tree, const operate
 static inline void preorder_bsearch_tree(const bsearch_tree_s tree, const operate_bsearch_tree_fn operate, void * args) {
     BSEARCH_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    // create simple stack to manage depth first in-order traversal of node indexes
-    struct pre_stack { size_t size; size_t * elements; } stack = {
-        .size = 0, .elements = BSEARCH_TREE_ALLOC(tree.size * sizeof(size_t)),
-    };
-    BSEARCH_TREE_ASSERT(stack.elements && "[ERROR] Memory allocation failed.");
-
-    if (tree.size) {
-        stack.elements[stack.size++] = tree.root;
-    }
-
-    while (stack.size && operate(tree.elements + stack.elements[stack.size - 1], args)) {
-        const size_t node = stack.elements[--stack.size];
-
-        const size_t right_child = tree.node[BSEARCH_TREE_RIGHT][node];
-        if (BSEARCH_TREE_SIZE != right_child) {
-            stack.elements[stack.size++] = right_child;
-        }
+    BSEARCH_TREE_INDEX_TYPE node = tree.root;
+    while (BSEARCH_TREE_SIZE != node && operate(tree.elements + node, args)) {
+        if (BSEARCH_TREE_SIZE != tree.nodes[node].child[BSEARCH_TREE_LEFT]) { // go to left child first
+            node = tree.nodes[node].child[BSEARCH_TREE_LEFT];
+        } else if (BSEARCH_TREE_SIZE != tree.nodes[node].child[BSEARCH_TREE_RIGHT]) { // else go to right child
+            node = tree.nodes[node].child[BSEARCH_TREE_RIGHT];
+        } else { // else go up until an ancestor with a not yet visited right child is found
+            BSEARCH_TREE_INDEX_TYPE parent = tree.nodes[node].parent;
+            while (BSEARCH_TREE_SIZE != parent && (node == tree.nodes[parent].child[BSEARCH_TREE_RIGHT] || BSEARCH_TREE_SIZE == tree.nodes[parent].child[BSEARCH_TREE_RIGHT])) {
+                node = parent;
+                parent = tree.nodes[parent].parent;
+            }
 
-        const size_t left_child = tree.node[BSEARCH_TREE_LEFT][node];
-        if (BSEARCH_TREE_SIZE != left_child) {
-            stack.elements[stack.size++] = left_child;
+            node = (BSEARCH_TREE_SIZE == parent) ? BSEARCH_TREE_SIZE : tree.nodes[parent].child[BSEARCH_TREE_RIGHT];
         }
     }
-
-    BSEARCH_TREE_FREE(stack.elements);
 }
 
 static inline void postorder_bsearch_tree(const bsearch_tree_s tree, const operate_bsearch_tree_fn operate, void * args) {
     BSEARCH_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    // create simple stack to manage depth first in-order traversal of node indexes
-    struct post_stack { size_t size; size_t * elements; } stack = {
-        .size = 0, .elements = BSEARCH_TREE_ALLOC(tree.size * sizeof(size_t)),
-    };
-    BSEARCH_TREE_ASSERT(stack.elements && "[ERROR] Memory allocation failed.");
-
-    // push root node onto stack and initially save it into variable
-    size_t node = tree.root;
-    size_t last = BSEARCH_TREE_SIZE;
-    while (stack.size || BSEARCH_TREE_SIZE != node) { // while stack is not empty OR node is valid
-        if (BSEARCH_TREE_SIZE != node) { // if node is valid push it onto the stack and go to node's left child
-            stack.elements[stack.size++] = node;
-            node = tree.node[BSEARCH_TREE_LEFT][node];
-        } else { // else node is invalid, thus pop a new node from the stack, operate on element, and go to node's right child
-            const size_t peek = stack.elements[stack.size - 1];
-
-            const size_t peek_right_child = tree.node[BSEARCH_TREE_RIGHT][peek];
-            if (BSEARCH_TREE_SIZE != peek_right_child && peek_right_child != last) {
-                node = peek_right_child;
+    BSEARCH_TREE_INDEX_TYPE node = tree.root;
+    if (BSEARCH_TREE_SIZE != node) {
+        while (true) { // descend to the first node in post-order, preferring left children over right ones
+            if (BSEARCH_TREE_SIZE != tree.nodes[node].child[BSEARCH_TREE_LEFT]) {
+                node = tree.nodes[node].child[BSEARCH_TREE_LEFT];
+            } else if (BSEARCH_TREE_SIZE != tree.nodes[node].child[BSEARCH_TREE_RIGHT]) {
+                node = tree.nodes[node].child[BSEARCH_TREE_RIGHT];
             } else {
-                if (!operate(tree.elements + node, args)) {
+                break;
+            }
+        }
+    }
+
+    while (BSEARCH_TREE_SIZE != node && operate(tree.elements + node, args)) {
+        const BSEARCH_TREE_INDEX_TYPE parent = tree.nodes[node].parent;
+        if (BSEARCH_TREE_SIZE == parent || node == tree.nodes[parent].child[BSEARCH_TREE_RIGHT] || BSEARCH_TREE_SIZE == tree.nodes[parent].child[BSEARCH_TREE_RIGHT]) {
+            node = parent; // parent comes right after its last child
+        } else { // else continue with first node of parent's right subtree
+            node = tree.nodes[parent].child[BSEARCH_TREE_RIGHT];
+            while (true) { // descend to the first node in post-order, preferring left children over right ones
+                if (BSEARCH_TREE_SIZE != tree.nodes[node].child[BSEARCH_TREE_LEFT]) {
+                    node = tree.nodes[node].child[BSEARCH_TREE_LEFT];
+                } else if (BSEARCH_TREE_SIZE != tree.nodes[node].child[BSEARCH_TREE_RIGHT]) {
+                    node = tree.nodes[node].child[BSEARCH_TREE_RIGHT];
+                } else {
                     break;
                 }
-
-                last = stack.elements[--stack.size];
             }
         }
     }
-
-    BSEARCH_TREE_FREE(stack.elements);
 }
 
 static inline void level_order_bsearch_tree(const bsearch_tree_s tree, const operate_bsearch_tree_fn operate, void * args) {
     BSEARCH_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     // create simple queue to manage breath first level order traversal of node indexes
-    struct level_queue { size_t size, current; size_t * elements; } queue = {
-        .size = 0, .current = 0, .elements = BSEARCH_TREE_ALLOC(tree.size * sizeof(size_t)),
+    struct level_queue { BSEARCH_TREE_INDEX_TYPE size, current; BSEARCH_TREE_INDEX_TYPE * elements; } queue = {
+        .size = 0, .current = 0, .elements = BSEARCH_TREE_ALLOC(tree.size * sizeof(BSEARCH_TREE_INDEX_TYPE)),
     };
     BSEARCH_TREE_ASSERT(queue.elements && "[ERROR] Memory allocation failed.");
 
@@ -659,17 +1342,17 @@ static inline void level_order_bsearch_tree(const bsearch_tree_s tree, const ope
     // while queue isn't empty operate on element, pop parent and push valid children
     while (queue.size && operate(tree.elements + queue.elements[queue.current], args)) {
         // pop index
-        const size_t popped_index = queue.elements[queue.current++];
+        const BSEARCH_TREE_INDEX_TYPE popped_index = queue.elements[queue.current++];
         queue.size--;
 
         // push left child of popped parent to the top of the queue
-        const size_t left_child = tree.node[BSEARCH_TREE_LEFT][popped_index];
+        const BSEARCH_TREE_INDEX_TYPE left_child = tree.nodes[popped_index].child[BSEARCH_TREE_LEFT];
         if (BSEARCH_TREE_SIZE != left_child) {
             queue.elements[queue.current + queue.size++] = left_child;
         }
 
         // push right child of popped parent to the top of the queue
-        const size_t right_child = tree.node[BSEARCH_TREE_RIGHT][popped_index];
+        const BSEARCH_TREE_INDEX_TYPE right_child = tree.nodes[popped_index].child[BSEARCH_TREE_RIGHT];
         if (BSEARCH_TREE_SIZE != right_child) {
             queue.elements[queue.current + queue.size++] = right_child;
         }
@@ -681,11 +1364,9 @@ static inline void level_order_bsearch_tree(const bsearch_tree_s tree, const ope
 static inline void map_bsearch_tree(const bsearch_tree_s tree, const manage_bsearch_tree_fn manage, void * args) {
     BSEARCH_TREE_ASSERT(manage && "[ERROR] 'manage' parameter is NULL.");
 
-    BSEARCH_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    BSEARCH_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     BSEARCH_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_LEFT] && "[ERROR] 'node[BSEARCH_TREE_LEFT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.node[BSEARCH_TREE_RIGHT] && "[ERROR] 'node[BSEARCH_TREE_RIGHT]' pointer is NULL.");
-    BSEARCH_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    BSEARCH_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     BSEARCH_TREE_ASSERT(tree.size <= BSEARCH_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     manage(tree.elements, tree.size, args);
@@ -0,0 +1,837 @@
+#ifndef RED_BLACK_MAP_H
+#define RED_BLACK_MAP_H
+
+/*
+    This is free and unencumbered software released into the public domain.
+
+    Anyone is free to copy, modify, publish, use, compile, sell, or
+    distribute this software, either in source code form or as a compiled
+    binary, for any purpose, commercial or non-commercial, and by any
+    means.
+
+    In jurisdictions that recognize copyright laws, the author or authors
+    of this software dedicate any and all copyright interest in the
+    software to the public domain. We make this dedication for the benefit
+    of the public at large and to the detriment of our heirs and
+    successors. We intend this dedication to be an overt act of
+    relinquishment in perpetuity of all present and future rights to this
+    software under copyright law.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+    OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+    ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+    OTHER DEALINGS IN THE SOFTWARE.
+
+    For more information, please refer to <https://unlicense.org>
+*/
+
+#include <stddef.h>  // imports size_t
+#include <stdbool.h> // imports bool
+#include <string.h>  // imports memcpy
+
+#ifndef RED_BLACK_MAP_KEY_TYPE
+// redefine using #define RED_BLACK_MAP_KEY_TYPE [type]
+#   define RED_BLACK_MAP_KEY_TYPE void*
+#endif
+
+#ifndef RED_BLACK_MAP_VALUE_TYPE
+// redefine using #define RED_BLACK_MAP_VALUE_TYPE [type]
+#   define RED_BLACK_MAP_VALUE_TYPE void*
+#endif
+
+#ifndef RED_BLACK_MAP_ASSERT
+#   include <assert.h>  // imports assert for debugging
+// redefine using #define RED_BLACK_MAP_KEY_TYPE [assert]
+#   define RED_BLACK_MAP_ASSERT assert
+#endif
+
+#if !defined(RED_BLACK_MAP_ALLOC) && !defined(RED_BLACK_MAP_FREE)
+#   include <stdlib.h>
+#   define RED_BLACK_MAP_ALLOC malloc
+#   define RED_BLACK_MAP_FREE free
+#elif !defined(RED_BLACK_MAP_ALLOC)
+#   error Must also define RED_BLACK_MAP_ALLOC.
+#elif !defined(RED_BLACK_MAP_FREE)
+#   error Must also define RED_BLACK_MAP_FREE.
+#endif
+
+#ifndef RED_BLACK_MAP_SIZE
+#   define RED_BLACK_MAP_SIZE (1 << 10)
+#elif RED_BLACK_MAP_SIZE <= 0
+#   error Size cannot be zero.
+#endif
+
+#ifndef RED_BLACK_MAP_INDEX_TYPE
+// redefine using #define RED_BLACK_MAP_INDEX_TYPE [unsigned type], e.g. uint32_t to halve node size if size allows it
+#   define RED_BLACK_MAP_INDEX_TYPE size_t
+#endif
+
+/// Function pointer that creates a deep key copy.
+typedef RED_BLACK_MAP_KEY_TYPE   (*copy_key_red_black_map_fn)      (const RED_BLACK_MAP_KEY_TYPE key);
+/// Function pointer that creates a deep value copy.
+typedef RED_BLACK_MAP_VALUE_TYPE (*copy_value_red_black_map_fn)    (const RED_BLACK_MAP_VALUE_TYPE value);
+/// Function pointer that destroys a deep key.
+typedef void                     (*destroy_key_red_black_map_fn)   (RED_BLACK_MAP_KEY_TYPE * key);
+/// Function pointer that destroys a deep value.
+typedef void                     (*destroy_value_red_black_map_fn) (RED_BLACK_MAP_VALUE_TYPE * value);
+/// Function pointer that compares two keys and returns zero if equal, a negative number if 'less than', else a positive number if 'more than'.
+typedef int                      (*compare_red_black_map_fn)       (const RED_BLACK_MAP_KEY_TYPE one, const RED_BLACK_MAP_KEY_TYPE two);
+/// Function pointer that changes a value of a read-only key using void pointer arguments if needed. Returns 'false' if foreach loop should break.
+typedef bool                     (*operate_red_black_map_fn)       (RED_BLACK_MAP_KEY_TYPE const * key, RED_BLACK_MAP_VALUE_TYPE * value, void * args);
+
+#define RED_BLACK_MAP_CHILD_COUNT 2
+#define RED_BLACK_MAP_LEFT  0
+#define RED_BLACK_MAP_RIGHT 1
+#define RED_MAP_COLOR   true
+#define BLACK_MAP_COLOR false
+typedef struct red_black_map_node {
+    RED_BLACK_MAP_INDEX_TYPE child[RED_BLACK_MAP_CHILD_COUNT], parent;
+    bool color;
+} red_black_map_node_s;
+
+typedef struct red_black_map {
+    compare_red_black_map_fn compare;
+    RED_BLACK_MAP_KEY_TYPE * keys;
+    RED_BLACK_MAP_VALUE_TYPE * values;
+    red_black_map_node_s * nodes;
+    size_t size;
+    RED_BLACK_MAP_INDEX_TYPE root;
+} red_black_map_s;
+
+/// Key and value pair returned on removal, so that the caller can destroy both.
+typedef struct red_black_map_pair {
+    RED_BLACK_MAP_KEY_TYPE key;
+    RED_BLACK_MAP_VALUE_TYPE value;
+} red_black_map_pair_s;
+
+static inline red_black_map_s create_red_black_map(const compare_red_black_map_fn compare) {
+    RED_BLACK_MAP_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+    RED_BLACK_MAP_ASSERT((RED_BLACK_MAP_INDEX_TYPE)(RED_BLACK_MAP_SIZE) == RED_BLACK_MAP_SIZE && "[ERROR] 'RED_BLACK_MAP_INDEX_TYPE' can't hold map size.");
+
+    // initialize and allocate memory for map plus its NIL node (RED_BLACK_MAP_SIZE + 1)
+    const red_black_map_s map = {
+        .keys = RED_BLACK_MAP_ALLOC((RED_BLACK_MAP_SIZE + 1) * sizeof(RED_BLACK_MAP_KEY_TYPE)),
+        .values = RED_BLACK_MAP_ALLOC((RED_BLACK_MAP_SIZE + 1) * sizeof(RED_BLACK_MAP_VALUE_TYPE)),
+        .nodes = RED_BLACK_MAP_ALLOC((RED_BLACK_MAP_SIZE + 1) * sizeof(red_black_map_node_s)),
+        .size = 0, .compare = compare, .root = RED_BLACK_MAP_SIZE,
+    };
+
+    // check if memory allocation succeeded
+    RED_BLACK_MAP_ASSERT(map.keys && "[ERROR] Memory allocation failed.");
+    RED_BLACK_MAP_ASSERT(map.values && "[ERROR] Memory allocation failed.");
+    RED_BLACK_MAP_ASSERT(map.nodes && "[ERROR] Memory allocation failed.");
+
+    // initialize NIL node
+    map.nodes[RED_BLACK_MAP_SIZE].color = BLACK_MAP_COLOR;
+    map.nodes[RED_BLACK_MAP_SIZE].parent = RED_BLACK_MAP_SIZE;
+    map.nodes[RED_BLACK_MAP_SIZE].child[RED_BLACK_MAP_LEFT] = RED_BLACK_MAP_SIZE;
+    map.nodes[RED_BLACK_MAP_SIZE].child[RED_BLACK_MAP_RIGHT] = RED_BLACK_MAP_SIZE;
+
+    return map;
+}
+
+static inline void destroy_red_black_map(red_black_map_s * map, const destroy_key_red_black_map_fn destroy_key, const destroy_value_red_black_map_fn destroy_value) {
+    RED_BLACK_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+    RED_BLACK_MAP_ASSERT(destroy_key && "[ERROR] 'destroy_key' parameter is NULL.");
+    RED_BLACK_MAP_ASSERT(destroy_value && "[ERROR] 'destroy_value' parameter is NULL.");
+
+    RED_BLACK_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // for each key and value in map arrays call destroy functions
+    for (size_t i = 0; i < map->size; ++i) {
+        destroy_key(map->keys + i);
+        destroy_value(map->values + i);
+    }
+
+    // free allocated memory
+    RED_BLACK_MAP_FREE(map->keys);
+    RED_BLACK_MAP_FREE(map->values);
+    RED_BLACK_MAP_FREE(map->nodes);
+
+    // set pointers to NULL
+    map->keys = NULL;
+    map->values = NULL;
+    map->nodes = NULL;
+
+    // other cleanup stuff
+    map->root = RED_BLACK_MAP_SIZE;
+    map->compare = NULL;
+    map->size = 0;
+}
+
+static inline void clear_red_black_map(red_black_map_s * map, const destroy_key_red_black_map_fn destroy_key, const destroy_value_red_black_map_fn destroy_value) {
+    RED_BLACK_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+    RED_BLACK_MAP_ASSERT(destroy_key && "[ERROR] 'destroy_key' parameter is NULL.");
+    RED_BLACK_MAP_ASSERT(destroy_value && "[ERROR] 'destroy_value' parameter is NULL.");
+
+    RED_BLACK_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // since the keys and values are continuosly in arrays just iterate through each and call destroy on them
+    for (size_t i = 0; i < map->size; ++i) {
+        destroy_key(map->keys + i);
+        destroy_value(map->values + i);
+    }
+
+    // clearing cleanup
+    map->root = RED_BLACK_MAP_SIZE;
+    map->size = 0;
+}
+
+static inline red_black_map_s copy_red_black_map(const red_black_map_s map, const copy_key_red_black_map_fn copy_key, const copy_value_red_black_map_fn copy_value) {
+    RED_BLACK_MAP_ASSERT(copy_key && "[ERROR] 'copy_key' parameter is NULL.");
+    RED_BLACK_MAP_ASSERT(copy_value && "[ERROR] 'copy_value' parameter is NULL.");
+
+    RED_BLACK_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // create replica/copy to return
+    const red_black_map_s replica = {
+        .compare = map.compare, .root = map.root, .size = map.size,
+        .keys = RED_BLACK_MAP_ALLOC((RED_BLACK_MAP_SIZE + 1) * sizeof(RED_BLACK_MAP_KEY_TYPE)),
+        .values = RED_BLACK_MAP_ALLOC((RED_BLACK_MAP_SIZE + 1) * sizeof(RED_BLACK_MAP_VALUE_TYPE)),
+        .nodes = RED_BLACK_MAP_ALLOC((RED_BLACK_MAP_SIZE + 1) * sizeof(red_black_map_node_s)),
+    };
+
+    RED_BLACK_MAP_ASSERT(replica.keys && "[ERROR] Memory allocation failed.");
+    RED_BLACK_MAP_ASSERT(replica.values && "[ERROR] Memory allocation failed.");
+    RED_BLACK_MAP_ASSERT(replica.nodes && "[ERROR] Memory allocation failed.");
+
+    // initialize NIL node
+    replica.nodes[RED_BLACK_MAP_SIZE].color = BLACK_MAP_COLOR;
+    replica.nodes[RED_BLACK_MAP_SIZE].parent = RED_BLACK_MAP_SIZE;
+    replica.nodes[RED_BLACK_MAP_SIZE].child[RED_BLACK_MAP_LEFT] = RED_BLACK_MAP_SIZE;
+    replica.nodes[RED_BLACK_MAP_SIZE].child[RED_BLACK_MAP_RIGHT] = RED_BLACK_MAP_SIZE;
+
+    // copy each key and value either as a deep or shallow copy based on function pointers
+    for (size_t i = 0; i < map.size; ++i) {
+        replica.keys[i] = copy_key(map.keys[i]);
+        replica.values[i] = copy_value(map.values[i]);
+    }
+
+    // copy node records since everything is continuous in memory
+    memcpy(replica.nodes, map.nodes, map.size * sizeof(red_black_map_node_s));
+
+    return replica;
+}
+
+static inline bool is_empty_red_black_map(const red_black_map_s map) {
+    RED_BLACK_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    return !(map.size);
+}
+
+static inline bool is_full_red_black_map(const red_black_map_s map) {
+    RED_BLACK_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    return (RED_BLACK_MAP_SIZE == map.size);
+}
+
+static inline bool contains_red_black_map(const red_black_map_s map, const RED_BLACK_MAP_KEY_TYPE key) {
+    RED_BLACK_MAP_ASSERT(map.size && "[ERROR] Can't check empty map.");
+    RED_BLACK_MAP_ASSERT(RED_BLACK_MAP_SIZE != map.root && "[ERROR] Invalid root node index.");
+
+    RED_BLACK_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+    RED_BLACK_MAP_ASSERT(map.root != RED_BLACK_MAP_SIZE && "[ERROR] Invalid map root index.");
+    RED_BLACK_MAP_ASSERT(map.root < map.size && "[ERROR] Invalid map root index.");
+    RED_BLACK_MAP_ASSERT(map.nodes[map.root].parent == RED_BLACK_MAP_SIZE && "[ERROR] Invalid map root parent.");
+
+    for (RED_BLACK_MAP_INDEX_TYPE node = map.root; RED_BLACK_MAP_SIZE != node;) {
+        // calculate and determine next child node, i.e. if left or right child
+        const int comparison = map.compare(key, map.keys[node]);
+        if (!comparison) {
+            return true;
+        }
+
+        const RED_BLACK_MAP_INDEX_TYPE node_index = comparison <= 0 ? RED_BLACK_MAP_LEFT : RED_BLACK_MAP_RIGHT;
+        node = map.nodes[node].child[node_index]; // go to next child node
+    }
+
+    return false;
+}
+
+static inline RED_BLACK_MAP_VALUE_TYPE * upsert_red_black_map(red_black_map_s * map, const RED_BLACK_MAP_KEY_TYPE key, const RED_BLACK_MAP_VALUE_TYPE value) {
+    RED_BLACK_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+
+    RED_BLACK_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    RED_BLACK_MAP_INDEX_TYPE previous = RED_BLACK_MAP_SIZE; // initially invalid for the head case when map is empty
+    RED_BLACK_MAP_INDEX_TYPE * node = &(map->root); // pointer to later change actual index of the empty child
+    while (RED_BLACK_MAP_SIZE != (*node)) {
+        // calculate and determine next child node, i.e. if left or right child
+        const int comparison = map->compare(key, map->keys[(*node)]);
+        if (!comparison) { // if key is already in map then return its value's slot without changing anything
+            return map->values + (*node);
+        }
+
+        const RED_BLACK_MAP_INDEX_TYPE node_index = comparison <= 0 ? RED_BLACK_MAP_LEFT : RED_BLACK_MAP_RIGHT;
+
+        previous = (*node); // change parent to child
+        node = &(map->nodes[(*node)].child[node_index]); // change child to proper gradnchild
+    }
+
+    RED_BLACK_MAP_ASSERT(map->size != RED_BLACK_MAP_SIZE && "[ERROR] Can't insert into full map.");
+
+    const RED_BLACK_MAP_INDEX_TYPE slot = (RED_BLACK_MAP_INDEX_TYPE)map->size; // new key and value are pushed at the end of their arrays
+    (*node) = slot; // change child index from invalid value to next empty index in array
+    map->nodes[(*node)].parent = previous; // make child's parent into parent
+    map->nodes[(*node)].child[RED_BLACK_MAP_LEFT] = map->nodes[(*node)].child[RED_BLACK_MAP_RIGHT] = RED_BLACK_MAP_SIZE; // make child's left and right indexes invalid
+    map->nodes[(*node)].color = RED_MAP_COLOR;
+
+    memcpy(map->keys + (*node), &key, sizeof(RED_BLACK_MAP_KEY_TYPE));
+    memcpy(map->values + (*node), &value, sizeof(RED_BLACK_MAP_VALUE_TYPE));
+    map->size++;
+
+    for (RED_BLACK_MAP_INDEX_TYPE child = (*node); child != map->root && RED_MAP_COLOR == map->nodes[map->nodes[child].parent].color;) {
+        if (map->nodes[child].parent == map->nodes[map->nodes[map->nodes[child].parent].parent].child[RED_BLACK_MAP_LEFT]) {
+            const RED_BLACK_MAP_INDEX_TYPE uncle = map->nodes[map->nodes[map->nodes[child].parent].parent].child[RED_BLACK_MAP_RIGHT];
+
+            if (RED_BLACK_MAP_SIZE != uncle && RED_MAP_COLOR == map->nodes[uncle].color) {
+                map->nodes[map->nodes[child].parent].color = map->nodes[uncle].color = BLACK_MAP_COLOR;
+                map->nodes[map->nodes[map->nodes[child].parent].parent].color = RED_MAP_COLOR;
+                child = map->nodes[map->nodes[child].parent].parent;
+            } else {
+                if (child == map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_RIGHT]) {
+                    child = map->nodes[child].parent;
+                    { // LEFT ROTATE
+                        const RED_BLACK_MAP_INDEX_TYPE x = child, y = map->nodes[x].child[RED_BLACK_MAP_RIGHT], z = map->nodes[y].child[RED_BLACK_MAP_LEFT];
+                        map->nodes[x].child[RED_BLACK_MAP_RIGHT] = z;
+
+                        if (RED_BLACK_MAP_SIZE != z) {
+                            map->nodes[z].parent = x;
+                        }
+
+                        map->nodes[y].parent = map->nodes[x].parent;
+
+                        if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                            map->root = y;
+                        } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                            map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                        } else {
+                            map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                        }
+
+                        map->nodes[y].child[RED_BLACK_MAP_LEFT] = x;
+                        map->nodes[x].parent = y;
+                    }
+                }
+
+                map->nodes[map->nodes[child].parent].color = BLACK_MAP_COLOR;
+                map->nodes[map->nodes[map->nodes[child].parent].parent].color = RED_MAP_COLOR;
+                { // RIGHT ROTATE
+                    const RED_BLACK_MAP_INDEX_TYPE x = map->nodes[map->nodes[child].parent].parent, y = map->nodes[x].child[RED_BLACK_MAP_LEFT], z = map->nodes[y].child[RED_BLACK_MAP_RIGHT];
+                    map->nodes[x].child[RED_BLACK_MAP_LEFT] = z;
+
+                    if (RED_BLACK_MAP_SIZE != z) {
+                        map->nodes[z].parent = x;
+                    }
+
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                        map->root = y;
+                    } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                    } else {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                    }
+
+                    map->nodes[y].child[RED_BLACK_MAP_RIGHT] = x;
+                    map->nodes[x].parent = y;
+                }
+            }
+        } else {
+            const RED_BLACK_MAP_INDEX_TYPE uncle = map->nodes[map->nodes[map->nodes[child].parent].parent].child[RED_BLACK_MAP_LEFT];
+
+            if (RED_BLACK_MAP_SIZE != uncle && RED_MAP_COLOR == map->nodes[uncle].color) {
+                map->nodes[map->nodes[child].parent].color = map->nodes[uncle].color = BLACK_MAP_COLOR;
+                map->nodes[map->nodes[map->nodes[child].parent].parent].color = RED_MAP_COLOR;
+                child = map->nodes[map->nodes[child].parent].parent;
+            } else {
+                if (child == map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_LEFT]) {
+                    child = map->nodes[child].parent;
+                    { // RIGHT ROTATE
+                        const RED_BLACK_MAP_INDEX_TYPE x = child, y = map->nodes[x].child[RED_BLACK_MAP_LEFT], z = map->nodes[y].child[RED_BLACK_MAP_RIGHT];
+                        map->nodes[x].child[RED_BLACK_MAP_LEFT] = z;
+
+                        if (RED_BLACK_MAP_SIZE != z) {
+                            map->nodes[z].parent = x;
+                        }
+
+                        map->nodes[y].parent = map->nodes[x].parent;
+
+                        if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                            map->root = y;
+                        } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                            map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                        } else {
+                            map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                        }
+
+                        map->nodes[y].child[RED_BLACK_MAP_RIGHT] = x;
+                        map->nodes[x].parent = y;
+                    }
+                }
+
+                map->nodes[map->nodes[child].parent].color = BLACK_MAP_COLOR;
+                map->nodes[map->nodes[map->nodes[child].parent].parent].color = RED_MAP_COLOR;
+                { // LEFT ROTATE
+                    const RED_BLACK_MAP_INDEX_TYPE x = map->nodes[map->nodes[child].parent].parent, y = map->nodes[x].child[RED_BLACK_MAP_RIGHT], z = map->nodes[y].child[RED_BLACK_MAP_LEFT];
+                    map->nodes[x].child[RED_BLACK_MAP_RIGHT] = z;
+
+                    if (RED_BLACK_MAP_SIZE != z) {
+                        map->nodes[z].parent = x;
+                    }
+
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                        map->root = y;
+                    } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                    } else {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                    }
+
+                    map->nodes[y].child[RED_BLACK_MAP_LEFT] = x;
+                    map->nodes[x].parent = y;
+                }
+            }
+        }
+    }
+
+    map->nodes[map->root].color = BLACK_MAP_COLOR;
+
+    return map->values + slot;
+}
+
+static inline RED_BLACK_MAP_VALUE_TYPE * insert_or_assign_red_black_map(red_black_map_s * map, const RED_BLACK_MAP_KEY_TYPE key, const RED_BLACK_MAP_VALUE_TYPE value) {
+    RED_BLACK_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+
+    RED_BLACK_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // old value is overwritten without destroying it, since it might still be referenced by the caller
+    RED_BLACK_MAP_VALUE_TYPE * slot = upsert_red_black_map(map, key, value);
+    memcpy(slot, &value, sizeof(RED_BLACK_MAP_VALUE_TYPE));
+
+    return slot;
+}
+
+static inline RED_BLACK_MAP_VALUE_TYPE * get_ptr_red_black_map(const red_black_map_s map, const RED_BLACK_MAP_KEY_TYPE key) {
+    RED_BLACK_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    // only keys are touched while descending, values are reached once the key is found
+    for (RED_BLACK_MAP_INDEX_TYPE node = map.root; RED_BLACK_MAP_SIZE != node;) {
+        const int comparison = map.compare(key, map.keys[node]);
+        if (!comparison) {
+            return map.values + node;
+        }
+
+        const RED_BLACK_MAP_INDEX_TYPE node_index = comparison <= 0 ? RED_BLACK_MAP_LEFT : RED_BLACK_MAP_RIGHT;
+        node = map.nodes[node].child[node_index]; // go to next child node
+    }
+
+    return NULL;
+}
+
+static inline red_black_map_pair_s remove_red_black_map(red_black_map_s * map, const RED_BLACK_MAP_KEY_TYPE key) {
+    RED_BLACK_MAP_ASSERT(map && "[ERROR] 'map' parameter is NULL.");
+    RED_BLACK_MAP_ASSERT(map->size && "[ERROR] Can't remove from empty map.");
+    RED_BLACK_MAP_ASSERT(RED_BLACK_MAP_SIZE != map->root && "[ERROR] Invalid root node index.");
+
+    RED_BLACK_MAP_ASSERT(map->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map->keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map->size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+    RED_BLACK_MAP_ASSERT(map->root != RED_BLACK_MAP_SIZE && "[ERROR] Invalid map root index.");
+    RED_BLACK_MAP_ASSERT(map->root < map->size && "[ERROR] Invalid map root index.");
+    RED_BLACK_MAP_ASSERT(map->nodes[map->root].parent == RED_BLACK_MAP_SIZE && "[ERROR] Invalid map root parent.");
+
+    RED_BLACK_MAP_INDEX_TYPE node = map->root; // pointer to later change actual index of the empty child
+    while (RED_BLACK_MAP_SIZE != node) {
+        // calculate and determine next child node, i.e. if left or right child
+        const int comparison = map->compare(key, map->keys[node]);
+        if (!comparison) {
+            break;
+        }
+
+        const RED_BLACK_MAP_INDEX_TYPE node_index = comparison <= 0 ? RED_BLACK_MAP_LEFT : RED_BLACK_MAP_RIGHT;
+
+        // change parent to child and go to next child node
+        node = map->nodes[node].child[node_index];
+    }
+
+    if (RED_BLACK_MAP_SIZE == node) {
+        // key was NOT found, thus return an error
+        RED_BLACK_MAP_ASSERT(false && "[ERROR] Key not found in map.");
+        exit(EXIT_FAILURE);
+    }
+
+    RED_BLACK_MAP_INDEX_TYPE current = node, child = RED_BLACK_MAP_SIZE;
+    bool original_color = map->nodes[current].color;
+
+    if (RED_BLACK_MAP_SIZE == map->nodes[node].child[RED_BLACK_MAP_LEFT]) {
+        child = map->nodes[node].child[RED_BLACK_MAP_RIGHT];
+
+        { // TRANSPLANT
+            const RED_BLACK_MAP_INDEX_TYPE u = node, v = map->nodes[node].child[RED_BLACK_MAP_RIGHT];
+            if (RED_BLACK_MAP_SIZE == map->nodes[u].parent) map->root = v;
+            else if (u == map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_LEFT]) map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_LEFT] = v;
+            else map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_RIGHT] = v;
+
+            map->nodes[v].parent = map->nodes[u].parent;
+        }
+    } else if (RED_BLACK_MAP_SIZE == map->nodes[node].child[RED_BLACK_MAP_RIGHT]) {
+        child = map->nodes[node].child[RED_BLACK_MAP_LEFT];
+
+        { // TRANSPLANT
+            const RED_BLACK_MAP_INDEX_TYPE u = node, v = map->nodes[node].child[RED_BLACK_MAP_LEFT];
+            if (RED_BLACK_MAP_SIZE == map->nodes[u].parent) map->root = v;
+            else if (u == map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_LEFT]) map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_LEFT] = v;
+            else map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_RIGHT] = v;
+
+            map->nodes[v].parent = map->nodes[u].parent;
+        }
+    } else {
+        current = map->nodes[node].child[RED_BLACK_MAP_RIGHT];
+        while (RED_BLACK_MAP_SIZE != map->nodes[current].child[RED_BLACK_MAP_LEFT]) { // TREE MINIMUM
+            current = map->nodes[current].child[RED_BLACK_MAP_LEFT];
+        }
+
+        original_color = map->nodes[current].color;
+        child = map->nodes[current].child[RED_BLACK_MAP_RIGHT];
+
+        if (map->nodes[current].parent == node) {
+            map->nodes[child].parent = current;
+        } else {
+            { // TRANSPLANT
+                const RED_BLACK_MAP_INDEX_TYPE u = current, v = map->nodes[current].child[RED_BLACK_MAP_RIGHT];
+                if (RED_BLACK_MAP_SIZE == map->nodes[u].parent) map->root = v;
+                else if (u == map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_LEFT]) map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_LEFT] = v;
+                else map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_RIGHT] = v;
+
+                map->nodes[v].parent = map->nodes[u].parent;
+            }
+
+            map->nodes[current].child[RED_BLACK_MAP_RIGHT] = map->nodes[node].child[RED_BLACK_MAP_RIGHT];
+            map->nodes[map->nodes[current].child[RED_BLACK_MAP_RIGHT]].parent = current;
+        }
+        { // TRANSPLANT
+            const RED_BLACK_MAP_INDEX_TYPE u = node, v = current;
+            if (RED_BLACK_MAP_SIZE == map->nodes[u].parent) map->root = v;
+            else if (u == map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_LEFT]) map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_LEFT] = v;
+            else map->nodes[map->nodes[u].parent].child[RED_BLACK_MAP_RIGHT] = v;
+
+            map->nodes[v].parent = map->nodes[u].parent;
+        }
+
+        map->nodes[current].child[RED_BLACK_MAP_LEFT] = map->nodes[node].child[RED_BLACK_MAP_LEFT];
+        map->nodes[map->nodes[current].child[RED_BLACK_MAP_LEFT]].parent = current;
+        map->nodes[current].color = map->nodes[node].color;
+    }
+
+    while (BLACK_MAP_COLOR == original_color && child != map->root && BLACK_MAP_COLOR == map->nodes[child].color) {
+        if (child == map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_LEFT]) {
+            RED_BLACK_MAP_INDEX_TYPE sibling = map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_RIGHT];
+            if (RED_MAP_COLOR == map->nodes[sibling].color) {
+                map->nodes[sibling].color = BLACK_MAP_COLOR;
+                map->nodes[map->nodes[child].parent].color = RED_MAP_COLOR;
+                { // LEFT ROTATE
+                    const RED_BLACK_MAP_INDEX_TYPE x = map->nodes[child].parent, y = map->nodes[x].child[RED_BLACK_MAP_RIGHT], z = map->nodes[y].child[RED_BLACK_MAP_LEFT];
+                    map->nodes[x].child[RED_BLACK_MAP_RIGHT] = z;
+
+                    if (RED_BLACK_MAP_SIZE != z) {
+                        map->nodes[z].parent = x;
+                    }
+
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                        map->root = y;
+                    } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                    } else {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                    }
+
+                    map->nodes[y].child[RED_BLACK_MAP_LEFT] = x;
+                    map->nodes[x].parent = y;
+                }
+                sibling = map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_RIGHT];
+            }
+
+            const RED_BLACK_MAP_INDEX_TYPE left_nibling = map->nodes[sibling].child[RED_BLACK_MAP_LEFT];
+            const RED_BLACK_MAP_INDEX_TYPE right_nibling = map->nodes[sibling].child[RED_BLACK_MAP_RIGHT];
+
+            if (BLACK_MAP_COLOR == map->nodes[left_nibling].color && BLACK_MAP_COLOR == map->nodes[right_nibling].color) {
+                map->nodes[sibling].color = RED_MAP_COLOR;
+                child = map->nodes[child].parent;
+            } else {
+                if (BLACK_MAP_COLOR == map->nodes[map->nodes[sibling].child[RED_BLACK_MAP_RIGHT]].color) {
+                    map->nodes[map->nodes[sibling].child[RED_BLACK_MAP_LEFT]].color = BLACK_MAP_COLOR;
+                    map->nodes[sibling].color = RED_MAP_COLOR;
+                    { // RIGHT ROTATE
+                        const RED_BLACK_MAP_INDEX_TYPE x = sibling, y = map->nodes[x].child[RED_BLACK_MAP_LEFT], z = map->nodes[y].child[RED_BLACK_MAP_RIGHT];
+                        map->nodes[x].child[RED_BLACK_MAP_LEFT] = z;
+
+                        if (RED_BLACK_MAP_SIZE != z) {
+                            map->nodes[z].parent = x;
+                        }
+
+                        map->nodes[y].parent = map->nodes[x].parent;
+
+                        if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                            map->root = y;
+                        } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                            map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                        } else {
+                            map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                        }
+
+                        map->nodes[y].child[RED_BLACK_MAP_RIGHT] = x;
+                        map->nodes[x].parent = y;
+                    }
+                    sibling = map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_RIGHT];
+                }
+
+                map->nodes[sibling].color = map->nodes[map->nodes[child].parent].color;
+                map->nodes[map->nodes[child].parent].color = BLACK_MAP_COLOR;
+                map->nodes[map->nodes[sibling].child[RED_BLACK_MAP_RIGHT]].color = BLACK_MAP_COLOR;
+                { // LEFT ROTATE
+                    const RED_BLACK_MAP_INDEX_TYPE x = map->nodes[child].parent, y = map->nodes[x].child[RED_BLACK_MAP_RIGHT], z = map->nodes[y].child[RED_BLACK_MAP_LEFT];
+                    map->nodes[x].child[RED_BLACK_MAP_RIGHT] = z;
+
+                    if (RED_BLACK_MAP_SIZE != z) {
+                        map->nodes[z].parent = x;
+                    }
+
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                        map->root = y;
+                    } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                    } else {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                    }
+
+                    map->nodes[y].child[RED_BLACK_MAP_LEFT] = x;
+                    map->nodes[x].parent = y;
+                }
+                child = map->root;
+            }
+        } else {
+            RED_BLACK_MAP_INDEX_TYPE sibling = map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_LEFT];
+            if (RED_MAP_COLOR == map->nodes[sibling].color) {
+                map->nodes[sibling].color = BLACK_MAP_COLOR;
+                map->nodes[map->nodes[child].parent].color = RED_MAP_COLOR;
+                { // RIGHT ROTATE
+                    const RED_BLACK_MAP_INDEX_TYPE x = map->nodes[child].parent, y = map->nodes[x].child[RED_BLACK_MAP_LEFT], z = map->nodes[y].child[RED_BLACK_MAP_RIGHT];
+                    map->nodes[x].child[RED_BLACK_MAP_LEFT] = z;
+
+                    if (RED_BLACK_MAP_SIZE != z) {
+                        map->nodes[z].parent = x;
+                    }
+
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                        map->root = y;
+                    } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                    } else {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                    }
+
+                    map->nodes[y].child[RED_BLACK_MAP_RIGHT] = x;
+                    map->nodes[x].parent = y;
+                }
+                sibling = map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_LEFT];
+            }
+
+            const RED_BLACK_MAP_INDEX_TYPE left_nibling = map->nodes[sibling].child[RED_BLACK_MAP_LEFT];
+            const RED_BLACK_MAP_INDEX_TYPE right_nibling = map->nodes[sibling].child[RED_BLACK_MAP_RIGHT];
+
+            if (BLACK_MAP_COLOR == map->nodes[left_nibling].color && BLACK_MAP_COLOR == map->nodes[right_nibling].color) {
+                map->nodes[sibling].color = RED_MAP_COLOR;
+                child = map->nodes[child].parent;
+            } else {
+                if (BLACK_MAP_COLOR == map->nodes[map->nodes[sibling].child[RED_BLACK_MAP_LEFT]].color) {
+                    map->nodes[map->nodes[sibling].child[RED_BLACK_MAP_LEFT]].color = BLACK_MAP_COLOR;
+                    map->nodes[sibling].color = RED_MAP_COLOR;
+                    { // LEFT ROTATE
+                        const RED_BLACK_MAP_INDEX_TYPE x = sibling, y = map->nodes[x].child[RED_BLACK_MAP_RIGHT], z = map->nodes[y].child[RED_BLACK_MAP_LEFT];
+                        map->nodes[x].child[RED_BLACK_MAP_RIGHT] = z;
+
+                        if (RED_BLACK_MAP_SIZE != z) {
+                            map->nodes[z].parent = x;
+                        }
+
+                        map->nodes[y].parent = map->nodes[x].parent;
+
+                        if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                            map->root = y;
+                        } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                            map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                        } else {
+                            map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                        }
+
+                        map->nodes[y].child[RED_BLACK_MAP_LEFT] = x;
+                        map->nodes[x].parent = y;
+                    }
+                    sibling = map->nodes[map->nodes[child].parent].child[RED_BLACK_MAP_LEFT];
+                }
+
+                map->nodes[sibling].color = map->nodes[map->nodes[child].parent].color;
+                map->nodes[map->nodes[child].parent].color = BLACK_MAP_COLOR;
+                map->nodes[map->nodes[sibling].child[RED_BLACK_MAP_LEFT]].color = BLACK_MAP_COLOR;
+                { // RIGHT ROTATE
+                    const RED_BLACK_MAP_INDEX_TYPE x = map->nodes[child].parent, y = map->nodes[x].child[RED_BLACK_MAP_LEFT], z = map->nodes[y].child[RED_BLACK_MAP_RIGHT];
+                    map->nodes[x].child[RED_BLACK_MAP_LEFT] = z;
+
+                    if (RED_BLACK_MAP_SIZE != z) {
+                        map->nodes[z].parent = x;
+                    }
+
+                    map->nodes[y].parent = map->nodes[x].parent;
+
+                    if (RED_BLACK_MAP_SIZE == map->nodes[x].parent) {
+                        map->root = y;
+                    } else if (x == map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT]) {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_LEFT] = y;
+                    } else {
+                        map->nodes[map->nodes[x].parent].child[RED_BLACK_MAP_RIGHT] = y;
+                    }
+
+                    map->nodes[y].child[RED_BLACK_MAP_RIGHT] = x;
+                    map->nodes[x].parent = y;
+                }
+                child = map->root;
+            }
+        }
+    }
+
+    // fix NIL node
+    map->nodes[RED_BLACK_MAP_SIZE].color = BLACK_MAP_COLOR;
+    map->nodes[RED_BLACK_MAP_SIZE].parent = RED_BLACK_MAP_SIZE;
+    map->nodes[RED_BLACK_MAP_SIZE].child[RED_BLACK_MAP_LEFT] = RED_BLACK_MAP_SIZE;
+    map->nodes[RED_BLACK_MAP_SIZE].child[RED_BLACK_MAP_RIGHT] = RED_BLACK_MAP_SIZE;
+
+    map->nodes[child].color = BLACK_MAP_COLOR;
+
+    const red_black_map_pair_s removed = { .key = map->keys[node], .value = map->values[node], };
+    map->size--;
+    const RED_BLACK_MAP_INDEX_TYPE hole = node; // index of hole in map arrays left behind by key removal
+
+    if (map->size && map->root == map->size) { // if head node is last array key then change index to removed one
+        map->root = hole;
+    }
+
+    // cut hole node from the rest of the map
+    map->nodes[hole].child[RED_BLACK_MAP_LEFT] = map->nodes[hole].child[RED_BLACK_MAP_RIGHT] = map->nodes[hole].parent = hole;
+
+    // replace removed key and value with rightmost array ones (or fill hole with valid key)
+    map->keys[hole] = map->keys[map->size];
+    map->values[hole] = map->values[map->size];
+    map->nodes[hole] = map->nodes[map->size];
+
+    // redirect parent and children of rightmost array node if they don't overlap with removed index
+    const RED_BLACK_MAP_INDEX_TYPE left_last = map->nodes[map->size].child[RED_BLACK_MAP_LEFT];
+    if (RED_BLACK_MAP_SIZE != left_last) {
+        map->nodes[left_last].parent = hole;
+    }
+
+    const RED_BLACK_MAP_INDEX_TYPE right_last = map->nodes[map->size].child[RED_BLACK_MAP_RIGHT];
+    if (RED_BLACK_MAP_SIZE != right_last) {
+        map->nodes[right_last].parent = hole;
+    }
+
+    const RED_BLACK_MAP_INDEX_TYPE parent_last = map->nodes[map->size].parent;
+    if (RED_BLACK_MAP_SIZE != parent_last) {
+        const RED_BLACK_MAP_INDEX_TYPE node_index = map->size == map->nodes[parent_last].child[RED_BLACK_MAP_LEFT] ? RED_BLACK_MAP_LEFT : RED_BLACK_MAP_RIGHT;
+        map->nodes[parent_last].child[node_index] = hole;
+    }
+
+    return removed;
+}
+
+static inline void inorder_red_black_map(const red_black_map_s map, const operate_red_black_map_fn operate, void * args) {
+    RED_BLACK_MAP_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    RED_BLACK_MAP_ASSERT(map.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_MAP_ASSERT(map.keys && "[ERROR] 'keys' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.values && "[ERROR] 'values' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_MAP_ASSERT(map.size <= RED_BLACK_MAP_SIZE && "[ERROR] Invalid map size.");
+
+    bool left_done = false;
+    RED_BLACK_MAP_INDEX_TYPE node = map.root;
+    while (RED_BLACK_MAP_SIZE != node) {
+        while (!left_done && RED_BLACK_MAP_SIZE != map.nodes[node].child[RED_BLACK_MAP_LEFT]) {
+            node = map.nodes[node].child[RED_BLACK_MAP_LEFT];
+        }
+
+        if (!operate(map.keys + node, map.values + node, args)) {
+            break;
+        }
+
+        left_done = true;
+        if (RED_BLACK_MAP_SIZE != map.nodes[node].child[RED_BLACK_MAP_RIGHT]) {
+            left_done = false;
+            node = map.nodes[node].child[RED_BLACK_MAP_RIGHT];
+        } else if (RED_BLACK_MAP_SIZE != map.nodes[node].parent) {
+            while (RED_BLACK_MAP_SIZE != map.nodes[node].parent && node == map.nodes[map.nodes[node].parent].child[RED_BLACK_MAP_RIGHT]) {
+                node = map.nodes[node].parent;
+            }
+
+            if (RED_BLACK_MAP_SIZE == map.nodes[node].parent) {
+                break;
+            }
+
+            node = map.nodes[node].parent;
+        } else {
+            break;
+        }
+    }
+}
+
+#endif // RED_BLACK_MAP_H
@@ -59,6 +59,52 @@
 #   error Size cannot be zero.
 #endif
 
+#ifndef RED_BLACK_TREE_INDEX_TYPE
+// redefine using #define RED_BLACK_TREE_INDEX_TYPE [unsigned type], e.g. uint32_t to halve node size if size allows it
+#   define RED_BLACK_TREE_INDEX_TYPE size_t
+#endif
+
+#ifdef RED_BLACK_TREE_COMPARE
+// compare macro is expanded in place of 'compare' function pointer calls, thus the pointer is removed from tree structure
+#   define RED_BLACK_TREE_COMPARE_WITH(function, one, two) RED_BLACK_TREE_COMPARE(one, two)
+#   define RED_BLACK_TREE_COMPARE_FUNCTION(function) NULL
+#   define RED_BLACK_TREE_COMPARE_ASSERT(expression)
+#else
+// redefine using #define RED_BLACK_TREE_COMPARE(one, two) [expression], e.g. (((one) > (two)) - ((one) < (two))) for scalar types
+#   define RED_BLACK_TREE_COMPARE_WITH(function, one, two) (function)(one, two)
+#   define RED_BLACK_TREE_COMPARE_FUNCTION(function) (function)
+#   define RED_BLACK_TREE_COMPARE_ASSERT(expression) RED_BLACK_TREE_ASSERT(expression)
+#endif
+
+// define RED_BLACK_TREE_SNAPSHOT to share arrays between a tree and its snapshots in fixed-size chunks, each chunk is shared
+// until one of the trees changes it, thus a change copies only the chunks it touches instead of whole arrays
+// elements are shared shallowly, thus once a tree and its snapshot diverge, elements owning memory must be destroyed through only one of them
+#ifdef RED_BLACK_TREE_SNAPSHOT
+#   if !defined(RED_BLACK_TREE_REFERENCE_TYPE) && !defined(RED_BLACK_TREE_REFERENCE_ACQUIRE) && !defined(RED_BLACK_TREE_REFERENCE_RELEASE)
+// default counter is NOT atomic, thus a tree and its snapshots must stay on one thread unless all three are redefined using
+// atomics, e.g. _Atomic size_t with atomic_fetch_add(count, 1) + 1 and atomic_fetch_sub(count, 1) - 1
+#       define RED_BLACK_TREE_REFERENCE_TYPE size_t
+#       define RED_BLACK_TREE_REFERENCE_ACQUIRE(count) (++(*(count)))
+#       define RED_BLACK_TREE_REFERENCE_RELEASE(count) (--(*(count)))
+#   elif !defined(RED_BLACK_TREE_REFERENCE_TYPE)
+#       error Must also define RED_BLACK_TREE_REFERENCE_TYPE.
+#   elif !defined(RED_BLACK_TREE_REFERENCE_ACQUIRE)
+#       error Must also define RED_BLACK_TREE_REFERENCE_ACQUIRE.
+#   elif !defined(RED_BLACK_TREE_REFERENCE_RELEASE)
+#       error Must also define RED_BLACK_TREE_REFERENCE_RELEASE.
+#   endif
+
+#   ifndef RED_BLACK_TREE_CHUNK_SIZE
+// redefine using #define RED_BLACK_TREE_CHUNK_SIZE [size], smaller chunks copy less per change but take longer to snapshot
+#       define RED_BLACK_TREE_CHUNK_SIZE (1 << 6)
+#   elif RED_BLACK_TREE_CHUNK_SIZE <= 0
+#       error Chunk size cannot be zero.
+#   endif
+
+// chunks cover every index including the NIL node at RED_BLACK_TREE_SIZE
+#   define RED_BLACK_TREE_CHUNK_COUNT ((RED_BLACK_TREE_SIZE / RED_BLACK_TREE_CHUNK_SIZE) + 1)
+#endif
+
 /// Function pointer that creates a deep element copy.
 typedef RED_BLACK_TREE_DATA_TYPE (*copy_red_black_tree_fn)    (const RED_BLACK_TREE_DATA_TYPE element);
 /// Function pointer that destroys a deep element.
@@ -75,56 +121,302 @@ typedef void                     (*manage_red_black_tree_fn)  (RED_BLACK_TREE_DA
 #define RED_BLACK_TREE_RIGHT 1
 #define RED_TREE_COLOR   true
 #define BLACK_TREE_COLOR false
+typedef struct red_black_tree_node {
+    RED_BLACK_TREE_INDEX_TYPE child[RED_BLACK_TREE_CHILD_COUNT], parent;
+    bool color;
+} red_black_tree_node_s;
+
+#ifdef RED_BLACK_TREE_SNAPSHOT
+typedef struct red_black_tree_element_chunk {
+    RED_BLACK_TREE_REFERENCE_TYPE references; // number of trees sharing chunk
+    RED_BLACK_TREE_DATA_TYPE elements[RED_BLACK_TREE_CHUNK_SIZE];
+} red_black_tree_element_chunk_s;
+
+typedef struct red_black_tree_node_chunk {
+    RED_BLACK_TREE_REFERENCE_TYPE references; // number of trees sharing chunk
+    red_black_tree_node_s nodes[RED_BLACK_TREE_CHUNK_SIZE];
+} red_black_tree_node_chunk_s;
+#endif
+
 typedef struct red_black_tree {
+#ifndef RED_BLACK_TREE_COMPARE
     compare_red_black_tree_fn compare;
+#endif
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    red_black_tree_element_chunk_s ** elements; // chunk tables belong only to tree, while chunks may be shared with snapshots
+    red_black_tree_node_chunk_s ** nodes;
+#else
     RED_BLACK_TREE_DATA_TYPE * elements;
-    size_t * node[RED_BLACK_TREE_CHILD_COUNT];
-    size_t * parent;
-    bool * color;
-    size_t size, root;
+    red_black_tree_node_s * nodes;
+#endif
+    size_t size;
+    RED_BLACK_TREE_INDEX_TYPE root;
+    RED_BLACK_TREE_INDEX_TYPE maximum; // cached rightmost node, thus appending monotonic keys needs a single comparison
 } red_black_tree_s;
 
+typedef struct red_black_tree_cursor {
+    RED_BLACK_TREE_DATA_TYPE * element;
+    RED_BLACK_TREE_INDEX_TYPE node;
+} red_black_tree_cursor_s;
+
+#ifdef RED_BLACK_TREE_SNAPSHOT
+// returns element at index, its chunk may still be shared with snapshots and must not be changed through it
+static inline RED_BLACK_TREE_DATA_TYPE * element_red_black_tree(const red_black_tree_s * tree, const size_t index) {
+    return tree->elements[index / RED_BLACK_TREE_CHUNK_SIZE]->elements + (index % RED_BLACK_TREE_CHUNK_SIZE);
+}
+
+// returns node at index, its chunk may still be shared with snapshots and must not be changed through it
+static inline red_black_tree_node_s * node_red_black_tree(const red_black_tree_s * tree, const size_t index) {
+    return tree->nodes[index / RED_BLACK_TREE_CHUNK_SIZE]->nodes + (index % RED_BLACK_TREE_CHUNK_SIZE);
+}
+
+// returns writable element at index, tree gets its own copy of the element's chunk first if snapshots still share it
+static inline RED_BLACK_TREE_DATA_TYPE * write_element_red_black_tree(red_black_tree_s * tree, const size_t index) {
+    red_black_tree_element_chunk_s ** chunk = tree->elements + (index / RED_BLACK_TREE_CHUNK_SIZE);
+    if (1 != (*chunk)->references) {
+        red_black_tree_element_chunk_s * copy = RED_BLACK_TREE_ALLOC(sizeof(red_black_tree_element_chunk_s));
+        RED_BLACK_TREE_ASSERT(copy && "[ERROR] Memory allocation failed.");
+
+        memcpy(copy->elements, (*chunk)->elements, sizeof(copy->elements));
+        copy->references = 1;
+
+        if (!RED_BLACK_TREE_REFERENCE_RELEASE(&((*chunk)->references))) { // snapshots may have been released in the meantime
+            RED_BLACK_TREE_FREE((*chunk));
+        }
+        (*chunk) = copy;
+    }
+
+    return (*chunk)->elements + (index % RED_BLACK_TREE_CHUNK_SIZE);
+}
+
+// returns writable node at index, tree gets its own copy of the node's chunk first if snapshots still share it
+static inline red_black_tree_node_s * write_node_red_black_tree(red_black_tree_s * tree, const size_t index) {
+    red_black_tree_node_chunk_s ** chunk = tree->nodes + (index / RED_BLACK_TREE_CHUNK_SIZE);
+    if (1 != (*chunk)->references) {
+        red_black_tree_node_chunk_s * copy = RED_BLACK_TREE_ALLOC(sizeof(red_black_tree_node_chunk_s));
+        RED_BLACK_TREE_ASSERT(copy && "[ERROR] Memory allocation failed.");
+
+        memcpy(copy->nodes, (*chunk)->nodes, sizeof(copy->nodes));
+        copy->references = 1;
+
+        if (!RED_BLACK_TREE_REFERENCE_RELEASE(&((*chunk)->references))) { // snapshots may have been released in the meantime
+            RED_BLACK_TREE_FREE((*chunk));
+        }
+        (*chunk) = copy;
+    }
+
+    return (*chunk)->nodes + (index % RED_BLACK_TREE_CHUNK_SIZE);
+}
+
+// releases tree's chunks and tables, the last tree holding a chunk frees it and destroys its elements if destroy isn't NULL
+static inline void release_red_black_tree(red_black_tree_s * tree, const destroy_red_black_tree_fn destroy) {
+    for (size_t i = 0; i < RED_BLACK_TREE_CHUNK_COUNT; ++i) {
+        if (!RED_BLACK_TREE_REFERENCE_RELEASE(&(tree->elements[i]->references))) {
+            for (size_t j = i * RED_BLACK_TREE_CHUNK_SIZE; destroy && j < tree->size && j < (i + 1) * RED_BLACK_TREE_CHUNK_SIZE; ++j) {
+                destroy(tree->elements[i]->elements + (j % RED_BLACK_TREE_CHUNK_SIZE));
+            }
+            RED_BLACK_TREE_FREE(tree->elements[i]);
+        }
+
+        if (!RED_BLACK_TREE_REFERENCE_RELEASE(&(tree->nodes[i]->references))) {
+            RED_BLACK_TREE_FREE(tree->nodes[i]);
+        }
+    }
+
+    RED_BLACK_TREE_FREE(tree->elements);
+    RED_BLACK_TREE_FREE(tree->nodes);
+}
+
+#   define RED_BLACK_TREE_ELEMENT(tree, index)       (*element_red_black_tree(&(tree), (index)))
+#   define RED_BLACK_TREE_NODE(tree, index)          (*node_red_black_tree(&(tree), (index)))
+#   define RED_BLACK_TREE_WRITE_ELEMENT(tree, index) (*write_element_red_black_tree(&(tree), (index)))
+#   define RED_BLACK_TREE_WRITE_NODE(tree, index)    (*write_node_red_black_tree(&(tree), (index)))
+#else
+// arrays belong only to tree, thus both reads and writes index them directly
+#   define RED_BLACK_TREE_ELEMENT(tree, index)       ((tree).elements[index])
+#   define RED_BLACK_TREE_NODE(tree, index)          ((tree).nodes[index])
+#   define RED_BLACK_TREE_WRITE_ELEMENT(tree, index) ((tree).elements[index])
+#   define RED_BLACK_TREE_WRITE_NODE(tree, index)    ((tree).nodes[index])
+#endif
+
 static inline red_black_tree_s create_red_black_tree(const compare_red_black_tree_fn compare) {
-    RED_BLACK_TREE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+#ifdef RED_BLACK_TREE_COMPARE
+    (void)(compare); // compare macro is used instead, thus parameter is ignored and may be NULL
+#endif
+    RED_BLACK_TREE_ASSERT((RED_BLACK_TREE_INDEX_TYPE)(RED_BLACK_TREE_SIZE) == RED_BLACK_TREE_SIZE && "[ERROR] 'RED_BLACK_TREE_INDEX_TYPE' can't hold tree size.");
 
     // initialize and allocate memory for tree plus its NIL node (RED_BLACK_TREE_SIZE + 1)
-    const red_black_tree_s tree = {
+    red_black_tree_s tree = {
+#ifdef RED_BLACK_TREE_SNAPSHOT
+        .elements = RED_BLACK_TREE_ALLOC(RED_BLACK_TREE_CHUNK_COUNT * sizeof(red_black_tree_element_chunk_s *)),
+        .nodes = RED_BLACK_TREE_ALLOC(RED_BLACK_TREE_CHUNK_COUNT * sizeof(red_black_tree_node_chunk_s *)),
+#else
         .elements = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(RED_BLACK_TREE_DATA_TYPE)),
-        .node[RED_BLACK_TREE_LEFT]  = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(size_t)),
-        .node[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(size_t)),
-        .parent = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(size_t)),
-        .color = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(bool)),
-        .size = 0, .compare = compare, .root = RED_BLACK_TREE_SIZE,
+        .nodes = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(red_black_tree_node_s)),
+#endif
+        .size = 0, .root = RED_BLACK_TREE_SIZE, .maximum = RED_BLACK_TREE_SIZE,
+#ifndef RED_BLACK_TREE_COMPARE
+        .compare = compare,
+#endif
     };
 
     // check if memory allocation succeeded
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] Memory allocation failed.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] Memory allocation failed.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] Memory allocation failed.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] Memory allocation failed.");
-    RED_BLACK_TREE_ASSERT(tree.color && "[ERROR] Memory allocation failed.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] Memory allocation failed.");
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    for (size_t i = 0; i < RED_BLACK_TREE_CHUNK_COUNT; ++i) { // every chunk starts out belonging only to tree
+        tree.elements[i] = RED_BLACK_TREE_ALLOC(sizeof(red_black_tree_element_chunk_s));
+        tree.nodes[i] = RED_BLACK_TREE_ALLOC(sizeof(red_black_tree_node_chunk_s));
+
+        RED_BLACK_TREE_ASSERT(tree.elements[i] && "[ERROR] Memory allocation failed.");
+        RED_BLACK_TREE_ASSERT(tree.nodes[i] && "[ERROR] Memory allocation failed.");
+
+        tree.elements[i]->references = tree.nodes[i]->references = 1;
+    }
+#endif
 
     // initialize NIL node
-    tree.color[RED_BLACK_TREE_SIZE] = BLACK_TREE_COLOR;
-    tree.parent[RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree.node[RED_BLACK_TREE_LEFT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree.node[RED_BLACK_TREE_RIGHT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(tree, RED_BLACK_TREE_SIZE).color = BLACK_TREE_COLOR;
+    RED_BLACK_TREE_WRITE_NODE(tree, RED_BLACK_TREE_SIZE).parent = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(tree, RED_BLACK_TREE_SIZE).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(tree, RED_BLACK_TREE_SIZE).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_SIZE;
+
+    return tree;
+}
+
+// links tree's elements, which must already be sorted, into a balanced tree with each array index as in-order position
+static inline void link_sorted_red_black_tree(red_black_tree_s * tree) {
+    RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    if (!tree->size) {
+        tree->root = tree->maximum = RED_BLACK_TREE_SIZE;
+        return;
+    }
+
+    // nodes on the deepest level of an incomplete last level are colored red to keep black heights equal
+    size_t max_depth = 0;
+    for (size_t s = tree->size; s > 1; s >>= 1) {
+        max_depth++;
+    }
+
+    // pending subtree ranges never exceed tree height, which is less than the bit count of RED_BLACK_TREE_INDEX_TYPE
+    struct build_range { RED_BLACK_TREE_INDEX_TYPE low, high, parent, depth; } stack[sizeof(RED_BLACK_TREE_INDEX_TYPE) << 3];
+    size_t stack_size = 0;
+    stack[stack_size++] = (struct build_range) { .low = 0, .high = (RED_BLACK_TREE_INDEX_TYPE)tree->size, .parent = RED_BLACK_TREE_SIZE, .depth = 0, };
+
+    while (stack_size) {
+        // pop range and make its middle element the subtree's root, so that both subtree sizes differ at most by one
+        const struct build_range range = stack[--stack_size];
+        const RED_BLACK_TREE_INDEX_TYPE middle = (RED_BLACK_TREE_INDEX_TYPE)(range.low + (range.high - range.low) / 2);
+
+        RED_BLACK_TREE_WRITE_NODE(*tree, middle).parent = range.parent;
+        RED_BLACK_TREE_WRITE_NODE(*tree, middle).child[RED_BLACK_TREE_LEFT] = (RED_BLACK_TREE_INDEX_TYPE)(range.low < middle ? range.low + (middle - range.low) / 2 : RED_BLACK_TREE_SIZE);
+        RED_BLACK_TREE_WRITE_NODE(*tree, middle).child[RED_BLACK_TREE_RIGHT] = (RED_BLACK_TREE_INDEX_TYPE)(middle + 1 < range.high ? (middle + 1) + (range.high - middle - 1) / 2 : RED_BLACK_TREE_SIZE);
+        RED_BLACK_TREE_WRITE_NODE(*tree, middle).color = (range.depth && range.depth == max_depth) ? RED_TREE_COLOR : BLACK_TREE_COLOR;
+
+        if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, middle).child[RED_BLACK_TREE_LEFT]) {
+            stack[stack_size++] = (struct build_range) { .low = range.low, .high = middle, .parent = middle, .depth = range.depth + 1, };
+        }
+
+        if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, middle).child[RED_BLACK_TREE_RIGHT]) {
+            stack[stack_size++] = (struct build_range) { .low = middle + 1, .high = range.high, .parent = middle, .depth = range.depth + 1, };
+        }
+    }
+
+    tree->root = (RED_BLACK_TREE_INDEX_TYPE)(tree->size / 2);
+    tree->maximum = (RED_BLACK_TREE_INDEX_TYPE)(tree->size - 1);
+}
+
+static inline red_black_tree_s create_red_black_tree_from_sorted(const compare_red_black_tree_fn compare, const RED_BLACK_TREE_DATA_TYPE * sorted, const size_t size) {
+    RED_BLACK_TREE_COMPARE_ASSERT(compare && "[ERROR] 'compare' parameter is NULL.");
+    RED_BLACK_TREE_ASSERT((sorted || !size) && "[ERROR] 'sorted' parameter is NULL.");
+    RED_BLACK_TREE_ASSERT(size <= RED_BLACK_TREE_SIZE && "[ERROR] 'size' parameter exceeds maximum tree size.");
+
+    for (size_t i = 1; i < size; ++i) {
+        RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_COMPARE_WITH(compare, sorted[i - 1], sorted[i]) <= 0 && "[ERROR] 'sorted' array isn't sorted.");
+    }
+
+    red_black_tree_s tree = create_red_black_tree(compare);
+    if (!size) {
+        return tree;
+    }
+
+    // elements stay in sorted order, thus each array index is also the node's in-order position
+    for (size_t i = 0; i < size; ++i) {
+        RED_BLACK_TREE_WRITE_ELEMENT(tree, i) = sorted[i];
+    }
+    tree.size = size;
+    link_sorted_red_black_tree(&tree);
 
     return tree;
 }
 
+#ifdef RED_BLACK_TREE_SNAPSHOT
+static inline red_black_tree_s snapshot_red_black_tree(const red_black_tree_s tree) {
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // snapshot gets its own chunk tables, but shares every chunk with tree until either one changes it
+    red_black_tree_s snapshot = tree;
+    snapshot.elements = RED_BLACK_TREE_ALLOC(RED_BLACK_TREE_CHUNK_COUNT * sizeof(red_black_tree_element_chunk_s *));
+    snapshot.nodes = RED_BLACK_TREE_ALLOC(RED_BLACK_TREE_CHUNK_COUNT * sizeof(red_black_tree_node_chunk_s *));
+
+    RED_BLACK_TREE_ASSERT(snapshot.elements && "[ERROR] Memory allocation failed.");
+    RED_BLACK_TREE_ASSERT(snapshot.nodes && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < RED_BLACK_TREE_CHUNK_COUNT; ++i) {
+        RED_BLACK_TREE_REFERENCE_ACQUIRE(&(tree.elements[i]->references));
+        RED_BLACK_TREE_REFERENCE_ACQUIRE(&(tree.nodes[i]->references));
+
+        snapshot.elements[i] = tree.elements[i];
+        snapshot.nodes[i] = tree.nodes[i];
+    }
+
+    return snapshot;
+}
+
+// gives tree its own copy of element chunks shared with snapshots, call it before changing elements in place through map or traversals
+static inline void detach_red_black_tree(red_black_tree_s * tree) {
+    RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+
+    RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // writing to a chunk's first element copies the whole chunk only if it is still shared
+    for (size_t i = 0; i < tree->size; i += RED_BLACK_TREE_CHUNK_SIZE) {
+        write_element_red_black_tree(tree, i);
+    }
+}
+
+// checks if no snapshot shares tree's elements, thus they may be changed in place
+static inline bool is_detached_red_black_tree(const red_black_tree_s tree) {
+    bool is_detached = true;
+    for (size_t i = 0; is_detached && i < tree.size; i += RED_BLACK_TREE_CHUNK_SIZE) {
+        is_detached = (1 == tree.elements[i / RED_BLACK_TREE_CHUNK_SIZE]->references);
+    }
+
+    return is_detached;
+}
+#endif
+
 static inline void destroy_red_black_tree(red_black_tree_s * tree, const destroy_red_black_tree_fn destroy) {
     RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     RED_BLACK_TREE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
 
-    RED_BLACK_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->color && "[ERROR] 'color' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
 
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    // chunks shared with snapshots and their elements are destroyed only by the last tree that releases them
+    release_red_black_tree(tree, destroy);
+#else
     // for each element in tree elements array call destroy function
     for (RED_BLACK_TREE_DATA_TYPE * e = tree->elements; e < tree->elements + tree->size; e++) {
         destroy(e);
@@ -132,21 +424,19 @@ static inline void destroy_red_black_tree(red_black_tree_s * tree, const destroy
 
     // free allocated memory
     RED_BLACK_TREE_FREE(tree->elements);
-    RED_BLACK_TREE_FREE(tree->node[RED_BLACK_TREE_LEFT]);
-    RED_BLACK_TREE_FREE(tree->node[RED_BLACK_TREE_RIGHT]);
-    RED_BLACK_TREE_FREE(tree->parent);
-    RED_BLACK_TREE_FREE(tree->color);
+    RED_BLACK_TREE_FREE(tree->nodes);
+#endif
 
     // set pointers to NULL
     tree->elements = NULL;
-    tree->node[RED_BLACK_TREE_LEFT] = NULL;
-    tree->node[RED_BLACK_TREE_RIGHT] = NULL;
-    tree->parent = NULL;
-    tree->color = NULL;
+    tree->nodes = NULL;
 
     // other cleanup stuff
     tree->root = RED_BLACK_TREE_SIZE;
+    tree->maximum = RED_BLACK_TREE_SIZE;
+#ifndef RED_BLACK_TREE_COMPARE
     tree->compare = NULL;
+#endif
     tree->size = 0;
 }
 
@@ -154,246 +444,446 @@ static inline void clear_red_black_tree(red_black_tree_s * tree, const destroy_r
     RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     RED_BLACK_TREE_ASSERT(destroy && "[ERROR] 'destroy' parameter is NULL.");
 
-    RED_BLACK_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->color && "[ERROR] 'color' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
 
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    for (size_t i = 0; i < tree->size; ++i) {
+        if (1 == tree->elements[i / RED_BLACK_TREE_CHUNK_SIZE]->references) { // elements of chunks still shared with snapshots belong to them
+            destroy(element_red_black_tree(tree, i));
+        }
+    }
+#else
     // since the elements are continuosly in an array just iterate through each and call destroy on it
     for (RED_BLACK_TREE_DATA_TYPE * e = tree->elements; e < tree->elements + tree->size; e++) {
         destroy(e);
     }
+#endif
 
     // clearing cleanup
     tree->root = RED_BLACK_TREE_SIZE;
+    tree->maximum = RED_BLACK_TREE_SIZE;
     tree->size = 0;
 }
 
 static inline red_black_tree_s copy_red_black_tree(const red_black_tree_s tree, const copy_red_black_tree_fn copy) {
     RED_BLACK_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.color && "[ERROR] 'color' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
 
-    // create replica/copy to return
-    const red_black_tree_s replica = {
-        .compare = tree.compare, .root = tree.root, .size = tree.size,
-        .elements = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(RED_BLACK_TREE_DATA_TYPE)),
-        .parent = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(size_t)),
-        .node[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(size_t)),
-        .node[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(size_t)),
-        .color = RED_BLACK_TREE_ALLOC((RED_BLACK_TREE_SIZE + 1) * sizeof(bool)),
-    };
-
-    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] Memory allocation failed.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] Memory allocation failed.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] Memory allocation failed.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] Memory allocation failed.");
-    RED_BLACK_TREE_ASSERT(tree.color && "[ERROR] Memory allocation failed.");
-
-    // initialize NIL node
-    tree.color[RED_BLACK_TREE_SIZE] = BLACK_TREE_COLOR;
-    tree.parent[RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree.node[RED_BLACK_TREE_LEFT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree.node[RED_BLACK_TREE_RIGHT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
+    // create replica/copy to return, it starts with its own NIL node and arrays
+    red_black_tree_s replica = create_red_black_tree(RED_BLACK_TREE_COMPARE_FUNCTION(tree.compare));
+    replica.root = tree.root;
+    replica.maximum = tree.maximum;
+    replica.size = tree.size;
 
     // copy each element either as a deep or shallow copy based on function pointer
     for (size_t i = 0; i < tree.size; ++i) {
-        replica.elements[i] = copy(tree.elements[i]);
+        RED_BLACK_TREE_WRITE_ELEMENT(replica, i) = copy(RED_BLACK_TREE_ELEMENT(tree, i));
     }
 
-    // copy node and parent indexes, and color since everything is continuous in memory
-    const size_t copy_size = tree.size * sizeof(size_t);
-    memcpy(replica.node[RED_BLACK_TREE_LEFT], tree.node[RED_BLACK_TREE_LEFT], copy_size);
-    memcpy(replica.node[RED_BLACK_TREE_RIGHT], tree.node[RED_BLACK_TREE_RIGHT], copy_size);
-    memcpy(replica.parent, tree.parent, copy_size);
-    memcpy(replica.color, tree.color, tree.size * sizeof(bool));
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    // node records are split into chunks, thus they are copied one by one
+    for (size_t i = 0; i < tree.size; ++i) {
+        RED_BLACK_TREE_WRITE_NODE(replica, i) = RED_BLACK_TREE_NODE(tree, i);
+    }
+#else
+    // copy node records since everything is continuous in memory
+    memcpy(replica.nodes, tree.nodes, tree.size * sizeof(red_black_tree_node_s));
+#endif
 
     return replica;
 }
 
 static inline bool is_empty_red_black_tree(const red_black_tree_s tree) {
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.color && "[ERROR] 'color' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     return !(tree.size);
 }
 
 static inline bool is_full_red_black_tree(const red_black_tree_s tree) {
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.color && "[ERROR] 'color' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
 
     return (RED_BLACK_TREE_SIZE == tree.size);
 }
 
+// caches tree's rightmost node, called after changes that may remove or move the maximum
+static inline void update_maximum_red_black_tree(red_black_tree_s * tree) {
+    tree->maximum = tree->root;
+    if (RED_BLACK_TREE_SIZE == tree->maximum) {
+        return;
+    }
+
+    while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, tree->maximum).child[RED_BLACK_TREE_RIGHT]) {
+        tree->maximum = RED_BLACK_TREE_NODE(*tree, tree->maximum).child[RED_BLACK_TREE_RIGHT];
+    }
+}
+
 static inline void insert_red_black_tree(red_black_tree_s * tree, const RED_BLACK_TREE_DATA_TYPE element) {
     RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
     RED_BLACK_TREE_ASSERT(tree->size != RED_BLACK_TREE_SIZE && "[ERROR] Can't insert into full tree.");
 
-    RED_BLACK_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    RED_BLACK_TREE_INDEX_TYPE previous = RED_BLACK_TREE_SIZE; // initially invalid for the head case when tree is empty
+    RED_BLACK_TREE_INDEX_TYPE node = tree->root, node_index = RED_BLACK_TREE_LEFT; // empty child and its side under previous are linked later
+    if (RED_BLACK_TREE_SIZE != tree->maximum && RED_BLACK_TREE_COMPARE_WITH(tree->compare, element, RED_BLACK_TREE_ELEMENT(*tree, tree->maximum)) > 0) { // monotonic keys append after the cached maximum, thus check it with a single comparison before descending from root
+        previous = tree->maximum;
+        node = RED_BLACK_TREE_SIZE;
+        node_index = RED_BLACK_TREE_RIGHT;
+    }
+
+    while (RED_BLACK_TREE_SIZE != node) {
+        // calculate and determine next child node, i.e. if left or right child
+        const int comparison = RED_BLACK_TREE_COMPARE_WITH(tree->compare, element, RED_BLACK_TREE_ELEMENT(*tree, node));
+        node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+
+        previous = node; // change parent to child
+        node = RED_BLACK_TREE_NODE(*tree, node).child[node_index]; // change child to proper gradnchild
+    }
+
+    // new node becomes the maximum if tree was empty or if it hangs right of the old maximum
+    if (RED_BLACK_TREE_SIZE == tree->maximum || (previous == tree->maximum && RED_BLACK_TREE_RIGHT == node_index)) {
+        tree->maximum = (RED_BLACK_TREE_INDEX_TYPE)tree->size;
+    }
+
+    node = (RED_BLACK_TREE_INDEX_TYPE)tree->size; // change child index from invalid value to next empty index in array
+    if (RED_BLACK_TREE_SIZE == previous) {
+        tree->root = node;
+    } else {
+        RED_BLACK_TREE_WRITE_NODE(*tree, previous).child[node_index] = node;
+    }
+    RED_BLACK_TREE_WRITE_NODE(*tree, node).parent = previous; // make child's parent into parent
+    RED_BLACK_TREE_WRITE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_WRITE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_SIZE; // make child's left and right indexes invalid
+    RED_BLACK_TREE_WRITE_NODE(*tree, node).color = RED_TREE_COLOR;
+
+    memcpy(&RED_BLACK_TREE_WRITE_ELEMENT(*tree, node), &element, sizeof(RED_BLACK_TREE_DATA_TYPE));
+    tree->size++;
+
+    for (RED_BLACK_TREE_INDEX_TYPE child = node; child != tree->root && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;) {
+        if (RED_BLACK_TREE_NODE(*tree, child).parent == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_LEFT]) {
+            const RED_BLACK_TREE_INDEX_TYPE uncle = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_RIGHT];
+
+            if (RED_BLACK_TREE_SIZE != uncle && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, uncle).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_BLACK_TREE_WRITE_NODE(*tree, uncle).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent;
+            } else {
+                if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT]) {
+                    child = RED_BLACK_TREE_NODE(*tree, child).parent;
+                    { // LEFT ROTATE
+                        const RED_BLACK_TREE_INDEX_TYPE x = child, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
+
+                        if (RED_BLACK_TREE_SIZE != z) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
+                        }
+
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
+
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
+                            tree->root = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
+                        } else {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
+                        }
+
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
+                    }
+                }
+
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                { // RIGHT ROTATE
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
+
+                    if (RED_BLACK_TREE_SIZE != z) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
+                    }
+
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
+
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
+                        tree->root = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
+                    } else {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
+                    }
+
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
+                }
+            }
+        } else {
+            const RED_BLACK_TREE_INDEX_TYPE uncle = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_LEFT];
+
+            if (RED_BLACK_TREE_SIZE != uncle && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, uncle).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_BLACK_TREE_WRITE_NODE(*tree, uncle).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent;
+            } else {
+                if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT]) {
+                    child = RED_BLACK_TREE_NODE(*tree, child).parent;
+                    { // RIGHT ROTATE
+                        const RED_BLACK_TREE_INDEX_TYPE x = child, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
+
+                        if (RED_BLACK_TREE_SIZE != z) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
+                        }
+
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
+
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
+                            tree->root = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
+                        } else {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
+                        }
+
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
+                    }
+                }
+
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                { // LEFT ROTATE
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
+
+                    if (RED_BLACK_TREE_SIZE != z) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
+                    }
+
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
+
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
+                        tree->root = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
+                    } else {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
+                    }
+
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
+                }
+            }
+        }
+    }
+
+    RED_BLACK_TREE_WRITE_NODE(*tree, tree->root).color = BLACK_TREE_COLOR;
+}
+
+static inline red_black_tree_cursor_s insert_hint_red_black_tree(red_black_tree_s * tree, const red_black_tree_cursor_s hint, const RED_BLACK_TREE_DATA_TYPE element) {
+    RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->size != RED_BLACK_TREE_SIZE && "[ERROR] Can't insert into full tree.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->color && "[ERROR] 'color' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+    RED_BLACK_TREE_ASSERT((RED_BLACK_TREE_SIZE == hint.node || hint.node < tree->size) && "[ERROR] Invalid hint node index.");
+
+    // climb from hint until element falls between the nearest lesser and greater ancestors of the start node's subtree
+    RED_BLACK_TREE_INDEX_TYPE start = RED_BLACK_TREE_SIZE == hint.node ? tree->root : hint.node;
+    if (RED_BLACK_TREE_SIZE != start) {
+        bool has_low = false, has_high = false; // farther ancestors don't need checks once both nearest bounds hold
+        for (RED_BLACK_TREE_INDEX_TYPE child = start; RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, child).parent && !(has_low && has_high); child = RED_BLACK_TREE_NODE(*tree, child).parent) {
+            const RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_NODE(*tree, child).parent;
+            const bool is_left = (child == RED_BLACK_TREE_NODE(*tree, parent).child[RED_BLACK_TREE_LEFT]);
+            if (is_left ? has_high : has_low) { // only the nearest ancestor on each side bounds the subtree
+                continue;
+            }
+
+            const int comparison = RED_BLACK_TREE_COMPARE_WITH(tree->compare, element, RED_BLACK_TREE_ELEMENT(*tree, parent));
+            if (is_left ? comparison > 0 : comparison <= 0) { // if element is outside subtree then restart from ancestor with a wider range
+                start = parent;
+                has_low = has_high = false;
+            } else if (is_left) {
+                has_high = true;
+            } else {
+                has_low = true;
+            }
+        }
+    }
+
+    // descend from start node as usual
+    RED_BLACK_TREE_INDEX_TYPE previous = RED_BLACK_TREE_SIZE == start ? RED_BLACK_TREE_SIZE : RED_BLACK_TREE_NODE(*tree, start).parent;
+    RED_BLACK_TREE_INDEX_TYPE node = start, node_index = RED_BLACK_TREE_LEFT; // empty child and its side under previous are linked later
+    if (RED_BLACK_TREE_SIZE != previous) {
+        node_index = start == RED_BLACK_TREE_NODE(*tree, previous).child[RED_BLACK_TREE_LEFT] ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+    }
 
-    size_t previous = RED_BLACK_TREE_SIZE; // initially invalid for the head case when tree is empty
-    size_t * node = &(tree->root); // pointer to later change actual index of the empty child
-    while (RED_BLACK_TREE_SIZE != (*node)) {
+    while (RED_BLACK_TREE_SIZE != node) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree->compare(element, tree->elements[(*node)]);
-        const size_t node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+        const int comparison = RED_BLACK_TREE_COMPARE_WITH(tree->compare, element, RED_BLACK_TREE_ELEMENT(*tree, node));
+        node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+
+        previous = node; // change parent to child
+        node = RED_BLACK_TREE_NODE(*tree, node).child[node_index]; // change child to proper gradnchild
+    }
 
-        previous = (*node); // change parent to child
-        node = tree->node[node_index] + (*node); // change child to proper gradnchild
+    // new node becomes the maximum if tree was empty or if it hangs right of the old maximum
+    if (RED_BLACK_TREE_SIZE == tree->maximum || (previous == tree->maximum && RED_BLACK_TREE_RIGHT == node_index)) {
+        tree->maximum = (RED_BLACK_TREE_INDEX_TYPE)tree->size;
     }
 
-    (*node) = tree->size; // change child index from invalid value to next empty index in array
-    tree->parent[(*node)] = previous; // make child's parent into parent
-    tree->node[RED_BLACK_TREE_LEFT][(*node)] = tree->node[RED_BLACK_TREE_RIGHT][(*node)] = RED_BLACK_TREE_SIZE; // make child's left and right indexes invalid
-    tree->color[(*node)] = RED_TREE_COLOR;
+    const RED_BLACK_TREE_INDEX_TYPE inserted = (RED_BLACK_TREE_INDEX_TYPE)tree->size; // new node is pushed at the end of the arrays
+    node = inserted; // change child index from invalid value to next empty index in array
+    if (RED_BLACK_TREE_SIZE == previous) {
+        tree->root = node;
+    } else {
+        RED_BLACK_TREE_WRITE_NODE(*tree, previous).child[node_index] = node;
+    }
+    RED_BLACK_TREE_WRITE_NODE(*tree, node).parent = previous; // make child's parent into parent
+    RED_BLACK_TREE_WRITE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_WRITE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_SIZE; // make child's left and right indexes invalid
+    RED_BLACK_TREE_WRITE_NODE(*tree, node).color = RED_TREE_COLOR;
 
-    memcpy(tree->elements + (*node), &element, sizeof(RED_BLACK_TREE_DATA_TYPE));
+    memcpy(&RED_BLACK_TREE_WRITE_ELEMENT(*tree, node), &element, sizeof(RED_BLACK_TREE_DATA_TYPE));
     tree->size++;
 
-    for (size_t child = (*node); child != tree->root && RED_TREE_COLOR == tree->color[tree->parent[child]];) {
-        if (tree->parent[child] == tree->node[RED_BLACK_TREE_LEFT][tree->parent[tree->parent[child]]]) {
-            const size_t uncle = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[tree->parent[child]]];
+    for (RED_BLACK_TREE_INDEX_TYPE child = node; child != tree->root && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;) {
+        if (RED_BLACK_TREE_NODE(*tree, child).parent == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_LEFT]) {
+            const RED_BLACK_TREE_INDEX_TYPE uncle = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_RIGHT];
 
-            if (RED_BLACK_TREE_SIZE != uncle && RED_TREE_COLOR == tree->color[uncle]) {
-                tree->color[tree->parent[child]] = tree->color[uncle] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[tree->parent[child]]] = RED_TREE_COLOR;
-                child = tree->parent[tree->parent[child]];
+            if (RED_BLACK_TREE_SIZE != uncle && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, uncle).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_BLACK_TREE_WRITE_NODE(*tree, uncle).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent;
             } else {
-                if (child == tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]]) {
-                    child = tree->parent[child];
+                if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT]) {
+                    child = RED_BLACK_TREE_NODE(*tree, child).parent;
                     { // LEFT ROTATE
-                        const size_t x = child, y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                        tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                        const RED_BLACK_TREE_INDEX_TYPE x = child, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                         if (RED_BLACK_TREE_SIZE != z) {
-                            tree->parent[z] = x;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                         }
 
-                        tree->parent[y] = tree->parent[x];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                        if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                             tree->root = y;
-                        } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                            tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                         } else {
-                            tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                         }
 
-                        tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                        tree->parent[x] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                     }
                 }
 
-                tree->color[tree->parent[child]] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[tree->parent[child]]] = RED_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
                 { // RIGHT ROTATE
-                    const size_t x = tree->parent[tree->parent[child]], y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                    tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
             }
         } else {
-            const size_t uncle = tree->node[RED_BLACK_TREE_LEFT][tree->parent[tree->parent[child]]];
+            const RED_BLACK_TREE_INDEX_TYPE uncle = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_LEFT];
 
-            if (RED_BLACK_TREE_SIZE != uncle && RED_TREE_COLOR == tree->color[uncle]) {
-                tree->color[tree->parent[child]] = tree->color[uncle] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[tree->parent[child]]] = RED_TREE_COLOR;
-                child = tree->parent[tree->parent[child]];
+            if (RED_BLACK_TREE_SIZE != uncle && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, uncle).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_BLACK_TREE_WRITE_NODE(*tree, uncle).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent;
             } else {
-                if (child == tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]]) {
-                    child = tree->parent[child];
+                if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT]) {
+                    child = RED_BLACK_TREE_NODE(*tree, child).parent;
                     { // RIGHT ROTATE
-                        const size_t x = child, y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                        tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                        const RED_BLACK_TREE_INDEX_TYPE x = child, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                         if (RED_BLACK_TREE_SIZE != z) {
-                            tree->parent[z] = x;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                         }
 
-                        tree->parent[y] = tree->parent[x];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                        if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                             tree->root = y;
-                        } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                            tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                         } else {
-                            tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                         }
 
-                        tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                        tree->parent[x] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                     }
                 }
 
-                tree->color[tree->parent[child]] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[tree->parent[child]]] = RED_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
                 { // LEFT ROTATE
-                    const size_t x = tree->parent[tree->parent[child]], y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                    tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
             }
         }
     }
 
-    tree->color[tree->root] = BLACK_TREE_COLOR;
+    RED_BLACK_TREE_WRITE_NODE(*tree, tree->root).color = BLACK_TREE_COLOR;
+
+    return (red_black_tree_cursor_s) { .element = &RED_BLACK_TREE_ELEMENT(*tree, inserted), .node = inserted, };
 }
 
 static inline RED_BLACK_TREE_DATA_TYPE remove_red_black_tree(red_black_tree_s * tree, const RED_BLACK_TREE_DATA_TYPE element) {
@@ -401,28 +891,26 @@ static inline RED_BLACK_TREE_DATA_TYPE remove_red_black_tree(red_black_tree_s *
     RED_BLACK_TREE_ASSERT(tree->size && "[ERROR] Can't remove from empty tree.");
     RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
 
-    RED_BLACK_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
     RED_BLACK_TREE_ASSERT(tree->root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
     RED_BLACK_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    RED_BLACK_TREE_ASSERT(tree->parent[tree->root] == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_NODE(*tree, tree->root).parent == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t node = tree->root; // pointer to later change actual index of the empty child
+    RED_BLACK_TREE_INDEX_TYPE node = tree->root; // pointer to later change actual index of the empty child
     while (RED_BLACK_TREE_SIZE != node) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree->compare(element, tree->elements[node]);
+        const int comparison = RED_BLACK_TREE_COMPARE_WITH(tree->compare, element, RED_BLACK_TREE_ELEMENT(*tree, node));
         if (!comparison) {
             break;
         }
 
-        const size_t node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+        const RED_BLACK_TREE_INDEX_TYPE node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
 
         // change parent to child and go to next child node
-        node = tree->node[node_index][node];
+        node = RED_BLACK_TREE_NODE(*tree, node).child[node_index];
     }
 
     if (RED_BLACK_TREE_SIZE == node) {
@@ -431,246 +919,245 @@ static inline RED_BLACK_TREE_DATA_TYPE remove_red_black_tree(red_black_tree_s *
         exit(EXIT_FAILURE);
     }
 
-    size_t current = node, child = RED_BLACK_TREE_SIZE;
-    bool original_color = tree->color[current];
+    RED_BLACK_TREE_INDEX_TYPE current = node, child = RED_BLACK_TREE_SIZE;
+    bool original_color = RED_BLACK_TREE_NODE(*tree, current).color;
 
-    if (RED_BLACK_TREE_SIZE == tree->node[RED_BLACK_TREE_LEFT][node]) {
-        child = tree->node[RED_BLACK_TREE_RIGHT][node];
+    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT]) {
+        child = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT];
 
         { // TRANSPLANT
-            const size_t u = node, v = tree->node[RED_BLACK_TREE_RIGHT][node];
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+            const RED_BLACK_TREE_INDEX_TYPE u = node, v = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT];
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
 
-            tree->parent[v] = tree->parent[u];
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
         }
-    } else if (RED_BLACK_TREE_SIZE == tree->node[RED_BLACK_TREE_RIGHT][node]) {
-        child = tree->node[RED_BLACK_TREE_LEFT][node];
+    } else if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT]) {
+        child = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT];
 
         { // TRANSPLANT
-            const size_t u = node, v = tree->node[RED_BLACK_TREE_LEFT][node];
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+            const RED_BLACK_TREE_INDEX_TYPE u = node, v = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT];
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
 
-            tree->parent[v] = tree->parent[u];
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
         }
     } else {
-        current = tree->node[RED_BLACK_TREE_RIGHT][node];
-        while (RED_BLACK_TREE_SIZE != tree->node[RED_BLACK_TREE_LEFT][current]) { // TREE MINIMUM
-            current = tree->node[RED_BLACK_TREE_LEFT][current];
+        current = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT];
+        while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT]) { // TREE MINIMUM
+            current = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT];
         }
 
-        original_color = tree->color[current];
-        child = tree->node[RED_BLACK_TREE_RIGHT][current];
+        original_color = RED_BLACK_TREE_NODE(*tree, current).color;
+        child = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT];
 
-        if (tree->parent[current] == node) {
-            tree->parent[child] = current;
+        if (RED_BLACK_TREE_NODE(*tree, current).parent == node) {
+            RED_BLACK_TREE_WRITE_NODE(*tree, child).parent = current;
         } else {
             { // TRANSPLANT
-                const size_t u = current, v = tree->node[RED_BLACK_TREE_RIGHT][current];
-                if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-                else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-                else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+                const RED_BLACK_TREE_INDEX_TYPE u = current, v = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT];
+                if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+                else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+                else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
 
-                tree->parent[v] = tree->parent[u];
+                RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
             }
 
-            tree->node[RED_BLACK_TREE_RIGHT][current] = tree->node[RED_BLACK_TREE_RIGHT][node];
-            tree->parent[tree->node[RED_BLACK_TREE_RIGHT][current]] = current;
-            child == RED_BLACK_TREE_SIZE ? tree->parent[current] : tree->parent[node];
+            RED_BLACK_TREE_WRITE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT];
+            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT]).parent = current;
         }
         { // TRANSPLANT
-            const size_t u = node, v = current;
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+            const RED_BLACK_TREE_INDEX_TYPE u = node, v = current;
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
 
-            tree->parent[v] = tree->parent[u];
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
         }
 
-        tree->node[RED_BLACK_TREE_LEFT][current] = tree->node[RED_BLACK_TREE_LEFT][node];
-        tree->parent[tree->node[RED_BLACK_TREE_LEFT][current]] = current;
-        tree->color[current] = tree->color[node];
+        RED_BLACK_TREE_WRITE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT];
+        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT]).parent = current;
+        RED_BLACK_TREE_WRITE_NODE(*tree, current).color = RED_BLACK_TREE_NODE(*tree, node).color;
     }
 
-    while (BLACK_TREE_COLOR == original_color && child != tree->root && BLACK_TREE_COLOR == tree->color[child]) {
-        if (child == tree->parent[child]) {
-            size_t sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
-            if (RED_TREE_COLOR == tree->color[sibling]) {
-                tree->color[sibling] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[child]] = RED_TREE_COLOR;
+    while (BLACK_TREE_COLOR == original_color && child != tree->root && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, child).color) {
+        if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT]) {
+            RED_BLACK_TREE_INDEX_TYPE sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
+            if (RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, sibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_TREE_COLOR;
                 { // LEFT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                    tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
-                sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
+                sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
             }
 
-            const size_t left_nibling = tree->node[RED_BLACK_TREE_LEFT][sibling];
-            const size_t right_nibling = tree->node[RED_BLACK_TREE_RIGHT][sibling];
+            const RED_BLACK_TREE_INDEX_TYPE left_nibling = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT];
+            const RED_BLACK_TREE_INDEX_TYPE right_nibling = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT];
 
-            if (BLACK_TREE_COLOR == tree->color[left_nibling] && BLACK_TREE_COLOR == tree->color[right_nibling]) {
-                tree->color[sibling] = RED_TREE_COLOR;
-                child = tree->parent[child];
+            if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, left_nibling).color && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, right_nibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, child).parent;
             } else {
-                if (BLACK_TREE_COLOR == tree->color[tree->node[RED_BLACK_TREE_RIGHT][sibling]]) {
-                    tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
-                    tree->color[sibling] = RED_TREE_COLOR;
+                if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT]).color) {
+                    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
                     { // RIGHT ROTATE
-                        const size_t x = sibling, y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                        tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                        const RED_BLACK_TREE_INDEX_TYPE x = sibling, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                         if (RED_BLACK_TREE_SIZE != z) {
-                            tree->parent[z] = x;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                         }
 
-                        tree->parent[y] = tree->parent[x];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                        if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                             tree->root = y;
-                        } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                            tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                         } else {
-                            tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                         }
 
-                        tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                        tree->parent[x] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                     }
-                    sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
+                    sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
                 }
 
-                tree->color[sibling] = tree->color[tree->parent[child]];
-                tree->color[tree->parent[child]] = BLACK_TREE_COLOR;
-                tree->color[tree->node[RED_BLACK_TREE_RIGHT][sibling]] = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT]).color = BLACK_TREE_COLOR;
                 { // LEFT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                    tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
                 child = tree->root;
             }
         } else {
-            size_t sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
-            if (RED_TREE_COLOR == tree->color[sibling]) {
-                tree->color[sibling] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[child]] = RED_TREE_COLOR;
+            RED_BLACK_TREE_INDEX_TYPE sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
+            if (RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, sibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_TREE_COLOR;
                 { // RIGHT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                    tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
-                sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
+                sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
             }
 
-            const size_t left_nibling = tree->node[RED_BLACK_TREE_LEFT][sibling];
-            const size_t right_nibling = tree->node[RED_BLACK_TREE_RIGHT][sibling];
+            const RED_BLACK_TREE_INDEX_TYPE left_nibling = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT];
+            const RED_BLACK_TREE_INDEX_TYPE right_nibling = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT];
 
-            if (BLACK_TREE_COLOR == tree->color[left_nibling] && BLACK_TREE_COLOR == tree->color[right_nibling]) {
-                tree->color[sibling] = RED_TREE_COLOR;
-                child = tree->parent[child];
+            if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, left_nibling).color && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, right_nibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, child).parent;
             } else {
-                if (BLACK_TREE_COLOR == tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]]) {
-                    tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
-                    tree->color[sibling] = RED_TREE_COLOR;
+                if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color) {
+                    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
                     { // LEFT ROTATE
-                        const size_t x = sibling, y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                        tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                        const RED_BLACK_TREE_INDEX_TYPE x = sibling, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                         if (RED_BLACK_TREE_SIZE != z) {
-                            tree->parent[z] = x;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                         }
 
-                        tree->parent[y] = tree->parent[x];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                        if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                             tree->root = y;
-                        } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                            tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                         } else {
-                            tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                         }
 
-                        tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                        tree->parent[x] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                     }
-                    sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
+                    sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
                 }
 
-                tree->color[sibling] = tree->color[tree->parent[child]];
-                tree->color[tree->parent[child]] = BLACK_TREE_COLOR;
-                tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
                 { // RIGHT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                    tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
                 child = tree->root;
             }
@@ -678,48 +1165,47 @@ static inline RED_BLACK_TREE_DATA_TYPE remove_red_black_tree(red_black_tree_s *
     }
 
     // fix NIL node
-    tree->color[RED_BLACK_TREE_SIZE] = BLACK_TREE_COLOR;
-    tree->parent[RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree->node[RED_BLACK_TREE_LEFT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree->node[RED_BLACK_TREE_RIGHT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).color = BLACK_TREE_COLOR;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).parent = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_SIZE;
 
-    tree->color[child] = BLACK_TREE_COLOR;
+    RED_BLACK_TREE_WRITE_NODE(*tree, child).color = BLACK_TREE_COLOR;
 
-    RED_BLACK_TREE_DATA_TYPE removed = tree->elements[node];
+    RED_BLACK_TREE_DATA_TYPE removed = RED_BLACK_TREE_ELEMENT(*tree, node);
     tree->size--;
-    const size_t hole = node; // index of hole in tree arrays left behind by element removal
+    const RED_BLACK_TREE_INDEX_TYPE hole = node; // index of hole in tree arrays left behind by element removal
 
     if (tree->size && tree->root == tree->size) { // if head node is last array element then change index to removed one
         tree->root = hole;
     }
 
     // cut hole node from the rest of the tree
-    tree->node[RED_BLACK_TREE_LEFT][hole] = tree->node[RED_BLACK_TREE_RIGHT][hole] = tree->parent[hole] = hole;
+    RED_BLACK_TREE_WRITE_NODE(*tree, hole).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_WRITE_NODE(*tree, hole).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_WRITE_NODE(*tree, hole).parent = hole;
 
     // replace removed element with rightmost array one (or fill hole with valid element)
-    tree->elements[hole] = tree->elements[tree->size];
-    tree->node[RED_BLACK_TREE_LEFT][hole] = tree->node[RED_BLACK_TREE_LEFT][tree->size];
-    tree->node[RED_BLACK_TREE_RIGHT][hole] = tree->node[RED_BLACK_TREE_RIGHT][tree->size];
-    tree->parent[hole] = tree->parent[tree->size];
+    RED_BLACK_TREE_WRITE_ELEMENT(*tree, hole) = RED_BLACK_TREE_ELEMENT(*tree, tree->size);
+    RED_BLACK_TREE_WRITE_NODE(*tree, hole) = RED_BLACK_TREE_NODE(*tree, tree->size);
 
     // redirect parent and children of rightmost array node if they don't overlap with removed index
-    const size_t left_last = tree->node[RED_BLACK_TREE_LEFT][tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE left_last = RED_BLACK_TREE_NODE(*tree, tree->size).child[RED_BLACK_TREE_LEFT];
     if (RED_BLACK_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole;
+        RED_BLACK_TREE_WRITE_NODE(*tree, left_last).parent = hole;
     }
 
-    const size_t right_last = tree->node[RED_BLACK_TREE_RIGHT][tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE right_last = RED_BLACK_TREE_NODE(*tree, tree->size).child[RED_BLACK_TREE_RIGHT];
     if (RED_BLACK_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole;
+        RED_BLACK_TREE_WRITE_NODE(*tree, right_last).parent = hole;
     }
 
-    const size_t parent_last = tree->parent[tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE parent_last = RED_BLACK_TREE_NODE(*tree, tree->size).parent;
     if (RED_BLACK_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole;
+        const RED_BLACK_TREE_INDEX_TYPE node_index = tree->size == RED_BLACK_TREE_NODE(*tree, parent_last).child[RED_BLACK_TREE_LEFT] ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+        RED_BLACK_TREE_WRITE_NODE(*tree, parent_last).child[node_index] = hole;
     }
 
+    update_maximum_red_black_tree(tree);
+
     return removed;
 }
 
@@ -727,25 +1213,23 @@ static inline bool contains_red_black_tree(const red_black_tree_s tree, const RE
     RED_BLACK_TREE_ASSERT(tree.size && "[ERROR] Can't check empty tree.");
     RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
     RED_BLACK_TREE_ASSERT(tree.root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
     RED_BLACK_TREE_ASSERT(tree.root < tree.size && "[ERROR] Invalid tree root index.");
-    RED_BLACK_TREE_ASSERT(tree.parent[tree.root] == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_NODE(tree, tree.root).parent == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    for (size_t node = tree.root; RED_BLACK_TREE_SIZE != node;) {
+    for (RED_BLACK_TREE_INDEX_TYPE node = tree.root; RED_BLACK_TREE_SIZE != node;) {
         // calculate and determine next child node, i.e. if left or right child
-        const int comparison = tree.compare(tree.elements[node], element);
+        const int comparison = RED_BLACK_TREE_COMPARE_WITH(tree.compare, element, RED_BLACK_TREE_ELEMENT(tree, node));
         if (!comparison) {
             return true;
         }
 
-        const size_t node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
-        node = tree.node[node_index][node]; // go to next child node
+        const RED_BLACK_TREE_INDEX_TYPE node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+        node = RED_BLACK_TREE_NODE(tree, node).child[node_index]; // go to next child node
     }
 
     return false;
@@ -755,306 +1239,449 @@ static inline RED_BLACK_TREE_DATA_TYPE get_min_red_black_tree(const red_black_tr
     RED_BLACK_TREE_ASSERT(tree.size && "[ERROR] Can't get from empty tree.");
     RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
     RED_BLACK_TREE_ASSERT(tree.root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
     RED_BLACK_TREE_ASSERT(tree.root < tree.size && "[ERROR] Invalid tree root index.");
-    RED_BLACK_TREE_ASSERT(tree.parent[tree.root] == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_NODE(tree, tree.root).parent == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t minimum_node = tree.root;
-    for (size_t i = tree.node[RED_BLACK_TREE_LEFT][minimum_node]; RED_BLACK_TREE_SIZE != i; i = tree.node[RED_BLACK_TREE_LEFT][i]) {
+    RED_BLACK_TREE_INDEX_TYPE minimum_node = tree.root;
+    for (RED_BLACK_TREE_INDEX_TYPE i = RED_BLACK_TREE_NODE(tree, minimum_node).child[RED_BLACK_TREE_LEFT]; RED_BLACK_TREE_SIZE != i; i = RED_BLACK_TREE_NODE(tree, i).child[RED_BLACK_TREE_LEFT]) {
         minimum_node = i;
     }
 
-    return tree.elements[minimum_node];
+    return RED_BLACK_TREE_ELEMENT(tree, minimum_node);
 }
 
 static inline RED_BLACK_TREE_DATA_TYPE get_max_red_black_tree(const red_black_tree_s tree) {
     RED_BLACK_TREE_ASSERT(tree.size && "[ERROR] Can't get from empty tree.");
     RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
     RED_BLACK_TREE_ASSERT(tree.root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
     RED_BLACK_TREE_ASSERT(tree.root < tree.size && "[ERROR] Invalid tree root index.");
-    RED_BLACK_TREE_ASSERT(tree.parent[tree.root] == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
-
-    size_t maximum_node = tree.root;
-    for (size_t i = tree.node[RED_BLACK_TREE_RIGHT][maximum_node]; RED_BLACK_TREE_SIZE != i; i = tree.node[RED_BLACK_TREE_RIGHT][i]) {
-        maximum_node = i;
-    }
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_NODE(tree, tree.root).parent == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    return tree.elements[maximum_node];
+    return RED_BLACK_TREE_ELEMENT(tree, tree.maximum);
 }
 
-static inline RED_BLACK_TREE_DATA_TYPE remove_min_red_black_tree(red_black_tree_s * tree) {
-    RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->size && "[ERROR] Can't remove from empty tree.");
-    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
+static inline RED_BLACK_TREE_DATA_TYPE floor_red_black_tree(const red_black_tree_s tree, const RED_BLACK_TREE_DATA_TYPE element) {
+    RED_BLACK_TREE_ASSERT(tree.size && "[ERROR] Can't get from empty tree.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-    RED_BLACK_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
-    RED_BLACK_TREE_ASSERT(tree->root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
-    RED_BLACK_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    RED_BLACK_TREE_ASSERT(tree->parent[tree->root] == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+    RED_BLACK_TREE_ASSERT(tree.root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
+    RED_BLACK_TREE_ASSERT(tree.root < tree.size && "[ERROR] Invalid tree root index.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_NODE(tree, tree.root).parent == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t minimum_node = tree->root;
-    for (size_t i = tree->node[RED_BLACK_TREE_LEFT][minimum_node]; RED_BLACK_TREE_SIZE != i; i = tree->node[RED_BLACK_TREE_LEFT][i]) {
-        minimum_node = i;
-    }
+    RED_BLACK_TREE_INDEX_TYPE floor_node = RED_BLACK_TREE_SIZE; // last visited node that is less than element
+    for (RED_BLACK_TREE_INDEX_TYPE node = tree.root; RED_BLACK_TREE_SIZE != node;) {
+        const int comparison = RED_BLACK_TREE_COMPARE_WITH(tree.compare, element, RED_BLACK_TREE_ELEMENT(tree, node));
+        if (!comparison) { // equal element is its own floor
+            return RED_BLACK_TREE_ELEMENT(tree, node);
+        }
 
-    size_t current = minimum_node, child = RED_BLACK_TREE_SIZE;
-    bool original_color = tree->color[current];
+        if (comparison > 0) { // node is less than element, so it's a candidate and a bigger one may be to the right
+            floor_node = node;
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+        } else {
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+        }
+    }
 
-    if (RED_BLACK_TREE_SIZE == tree->node[RED_BLACK_TREE_LEFT][minimum_node]) {
-        child = tree->node[RED_BLACK_TREE_RIGHT][minimum_node];
+    if (RED_BLACK_TREE_SIZE == floor_node) {
+        // every element is greater than element, thus return an error
+        RED_BLACK_TREE_ASSERT(false && "[ERROR] No element less than or equal to 'element' in tree.");
+        exit(EXIT_FAILURE);
+    }
 
-        { // TRANSPLANT
-            const size_t u = minimum_node, v = tree->node[RED_BLACK_TREE_RIGHT][minimum_node];
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+    return RED_BLACK_TREE_ELEMENT(tree, floor_node);
+}
 
-            tree->parent[v] = tree->parent[u];
-        }
-    } else if (RED_BLACK_TREE_SIZE == tree->node[RED_BLACK_TREE_RIGHT][minimum_node]) {
-        child = tree->node[RED_BLACK_TREE_LEFT][minimum_node];
+static inline RED_BLACK_TREE_DATA_TYPE ceiling_red_black_tree(const red_black_tree_s tree, const RED_BLACK_TREE_DATA_TYPE element) {
+    RED_BLACK_TREE_ASSERT(tree.size && "[ERROR] Can't get from empty tree.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree.root && "[ERROR] Invalid root node index.");
 
-        { // TRANSPLANT
-            const size_t u = minimum_node, v = tree->node[RED_BLACK_TREE_LEFT][minimum_node];
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+    RED_BLACK_TREE_ASSERT(tree.root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
+    RED_BLACK_TREE_ASSERT(tree.root < tree.size && "[ERROR] Invalid tree root index.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_NODE(tree, tree.root).parent == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-            tree->parent[v] = tree->parent[u];
-        }
-    } else {
-        current = tree->node[RED_BLACK_TREE_RIGHT][minimum_node];
-        while (RED_BLACK_TREE_SIZE != tree->node[RED_BLACK_TREE_LEFT][current]) { // TREE MINIMUM
-            current = tree->node[RED_BLACK_TREE_LEFT][current];
+    RED_BLACK_TREE_INDEX_TYPE ceiling_node = RED_BLACK_TREE_SIZE; // last visited node that is greater than element
+    for (RED_BLACK_TREE_INDEX_TYPE node = tree.root; RED_BLACK_TREE_SIZE != node;) {
+        const int comparison = RED_BLACK_TREE_COMPARE_WITH(tree.compare, element, RED_BLACK_TREE_ELEMENT(tree, node));
+        if (!comparison) { // equal element is its own ceiling
+            return RED_BLACK_TREE_ELEMENT(tree, node);
         }
 
-        original_color = tree->color[current];
-        child = tree->node[RED_BLACK_TREE_RIGHT][current];
-
-        if (tree->parent[current] == minimum_node) {
-            tree->parent[child] = current;
+        if (comparison < 0) { // node is greater than element, so it's a candidate and a smaller one may be to the left
+            ceiling_node = node;
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
         } else {
-            { // TRANSPLANT
-                const size_t u = current, v = tree->node[RED_BLACK_TREE_RIGHT][current];
-                if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-                else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-                else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
-
-                tree->parent[v] = tree->parent[u];
-            }
-
-            tree->node[RED_BLACK_TREE_RIGHT][current] = tree->node[RED_BLACK_TREE_RIGHT][minimum_node];
-            tree->parent[tree->node[RED_BLACK_TREE_RIGHT][current]] = current;
-            child == RED_BLACK_TREE_SIZE ? tree->parent[current] : tree->parent[minimum_node];
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
         }
-        { // TRANSPLANT
-            const size_t u = minimum_node, v = current;
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+    }
 
-            tree->parent[v] = tree->parent[u];
-        }
+    if (RED_BLACK_TREE_SIZE == ceiling_node) {
+        // every element is less than element, thus return an error
+        RED_BLACK_TREE_ASSERT(false && "[ERROR] No element greater than or equal to 'element' in tree.");
+        exit(EXIT_FAILURE);
+    }
+
+    return RED_BLACK_TREE_ELEMENT(tree, ceiling_node);
+}
+
+static inline RED_BLACK_TREE_DATA_TYPE * lower_bound_red_black_tree(const red_black_tree_s tree, const RED_BLACK_TREE_DATA_TYPE element) {
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // find the leftmost node that is not less than element, without stopping at equal ones since duplicates may be left
+    RED_BLACK_TREE_INDEX_TYPE bound = RED_BLACK_TREE_SIZE;
+    for (RED_BLACK_TREE_INDEX_TYPE node = tree.root; RED_BLACK_TREE_SIZE != node;) {
+        if (RED_BLACK_TREE_COMPARE_WITH(tree.compare, element, RED_BLACK_TREE_ELEMENT(tree, node)) <= 0) {
+            bound = node;
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+        } else {
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+        }
+    }
+
+    // pointer is only valid until the tree is changed, NULL means that every element is less than element
+    return RED_BLACK_TREE_SIZE == bound ? NULL : &RED_BLACK_TREE_ELEMENT(tree, bound);
+}
+
+static inline RED_BLACK_TREE_DATA_TYPE * upper_bound_red_black_tree(const red_black_tree_s tree, const RED_BLACK_TREE_DATA_TYPE element) {
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // find the leftmost node that is greater than element
+    RED_BLACK_TREE_INDEX_TYPE bound = RED_BLACK_TREE_SIZE;
+    for (RED_BLACK_TREE_INDEX_TYPE node = tree.root; RED_BLACK_TREE_SIZE != node;) {
+        if (RED_BLACK_TREE_COMPARE_WITH(tree.compare, element, RED_BLACK_TREE_ELEMENT(tree, node)) < 0) {
+            bound = node;
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+        } else {
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+        }
+    }
+
+    // pointer is only valid until the tree is changed, NULL means that no element is greater than element
+    return RED_BLACK_TREE_SIZE == bound ? NULL : &RED_BLACK_TREE_ELEMENT(tree, bound);
+}
+
+static inline void foreach_range_red_black_tree(const red_black_tree_s tree, const RED_BLACK_TREE_DATA_TYPE low, const RED_BLACK_TREE_DATA_TYPE high, const operate_red_black_tree_fn operate, void * args) {
+    RED_BLACK_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    RED_BLACK_TREE_ASSERT(is_detached_red_black_tree(tree) && "[ERROR] Can't operate on elements shared with a snapshot, detach tree first.");
+#endif
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_COMPARE_WITH(tree.compare, low, high) <= 0 && "[ERROR] 'low' can't be greater than 'high'.");
+
+    // descend to the leftmost node that is not less than low
+    RED_BLACK_TREE_INDEX_TYPE node = RED_BLACK_TREE_SIZE;
+    for (RED_BLACK_TREE_INDEX_TYPE n = tree.root; RED_BLACK_TREE_SIZE != n;) {
+        if (RED_BLACK_TREE_COMPARE_WITH(tree.compare, low, RED_BLACK_TREE_ELEMENT(tree, n)) <= 0) {
+            node = n;
+            n = RED_BLACK_TREE_NODE(tree, n).child[RED_BLACK_TREE_LEFT];
+        } else {
+            n = RED_BLACK_TREE_NODE(tree, n).child[RED_BLACK_TREE_RIGHT];
+        }
+    }
 
-        tree->node[RED_BLACK_TREE_LEFT][current] = tree->node[RED_BLACK_TREE_LEFT][minimum_node];
-        tree->parent[tree->node[RED_BLACK_TREE_LEFT][current]] = current;
-        tree->color[current] = tree->color[minimum_node];
+    // operate on in-order successors until an element greater than high is reached
+    while (RED_BLACK_TREE_SIZE != node && RED_BLACK_TREE_COMPARE_WITH(tree.compare, RED_BLACK_TREE_ELEMENT(tree, node), high) <= 0 && operate(&RED_BLACK_TREE_ELEMENT(tree, node), args)) {
+        if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT]) { // successor is leftmost node of right subtree
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+            while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT]) {
+                node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+            }
+        } else { // else successor is first ancestor whose left subtree contains node
+            RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_NODE(tree, node).parent;
+            while (RED_BLACK_TREE_SIZE != parent && node == RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT]) {
+                node = parent;
+                parent = RED_BLACK_TREE_NODE(tree, parent).parent;
+            }
+            node = parent;
+        }
     }
+}
 
-    while (BLACK_TREE_COLOR == original_color && child != tree->root && BLACK_TREE_COLOR == tree->color[child]) {
-        if (child == tree->parent[child]) {
-            size_t sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
-            if (RED_TREE_COLOR == tree->color[sibling]) {
-                tree->color[sibling] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[child]] = RED_TREE_COLOR;
+static inline RED_BLACK_TREE_DATA_TYPE remove_min_red_black_tree(red_black_tree_s * tree) {
+    RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->size && "[ERROR] Can't remove from empty tree.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+    RED_BLACK_TREE_ASSERT(tree->root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
+    RED_BLACK_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_NODE(*tree, tree->root).parent == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+
+    RED_BLACK_TREE_INDEX_TYPE minimum_node = tree->root;
+    for (RED_BLACK_TREE_INDEX_TYPE i = RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_LEFT]; RED_BLACK_TREE_SIZE != i; i = RED_BLACK_TREE_NODE(*tree, i).child[RED_BLACK_TREE_LEFT]) {
+        minimum_node = i;
+    }
+
+    RED_BLACK_TREE_INDEX_TYPE current = minimum_node, child = RED_BLACK_TREE_SIZE;
+    bool original_color = RED_BLACK_TREE_NODE(*tree, current).color;
+
+    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_LEFT]) {
+        child = RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_RIGHT];
+
+        { // TRANSPLANT
+            const RED_BLACK_TREE_INDEX_TYPE u = minimum_node, v = RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_RIGHT];
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
+
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
+        }
+    } else if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_RIGHT]) {
+        child = RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_LEFT];
+
+        { // TRANSPLANT
+            const RED_BLACK_TREE_INDEX_TYPE u = minimum_node, v = RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_LEFT];
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
+
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
+        }
+    } else {
+        current = RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_RIGHT];
+        while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT]) { // TREE MINIMUM
+            current = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT];
+        }
+
+        original_color = RED_BLACK_TREE_NODE(*tree, current).color;
+        child = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT];
+
+        if (RED_BLACK_TREE_NODE(*tree, current).parent == minimum_node) {
+            RED_BLACK_TREE_WRITE_NODE(*tree, child).parent = current;
+        } else {
+            { // TRANSPLANT
+                const RED_BLACK_TREE_INDEX_TYPE u = current, v = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT];
+                if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+                else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+                else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
+
+                RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
+            }
+
+            RED_BLACK_TREE_WRITE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_RIGHT];
+            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT]).parent = current;
+        }
+        { // TRANSPLANT
+            const RED_BLACK_TREE_INDEX_TYPE u = minimum_node, v = current;
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
+
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
+        }
+
+        RED_BLACK_TREE_WRITE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_NODE(*tree, minimum_node).child[RED_BLACK_TREE_LEFT];
+        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT]).parent = current;
+        RED_BLACK_TREE_WRITE_NODE(*tree, current).color = RED_BLACK_TREE_NODE(*tree, minimum_node).color;
+    }
+
+    while (BLACK_TREE_COLOR == original_color && child != tree->root && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, child).color) {
+        if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT]) {
+            RED_BLACK_TREE_INDEX_TYPE sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
+            if (RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, sibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_TREE_COLOR;
                 { // LEFT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                    tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
-                sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
+                sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
             }
 
-            const size_t left_nibling = tree->node[RED_BLACK_TREE_LEFT][sibling];
-            const size_t right_nibling = tree->node[RED_BLACK_TREE_RIGHT][sibling];
+            const RED_BLACK_TREE_INDEX_TYPE left_nibling = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT];
+            const RED_BLACK_TREE_INDEX_TYPE right_nibling = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT];
 
-            if (BLACK_TREE_COLOR == tree->color[left_nibling] && BLACK_TREE_COLOR == tree->color[right_nibling]) {
-                tree->color[sibling] = RED_TREE_COLOR;
-                child = tree->parent[child];
+            if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, left_nibling).color && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, right_nibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, child).parent;
             } else {
-                if (BLACK_TREE_COLOR == tree->color[tree->node[RED_BLACK_TREE_RIGHT][sibling]]) {
-                    tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
-                    tree->color[sibling] = RED_TREE_COLOR;
+                if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT]).color) {
+                    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
                     { // RIGHT ROTATE
-                        const size_t x = sibling, y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                        tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                        const RED_BLACK_TREE_INDEX_TYPE x = sibling, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                         if (RED_BLACK_TREE_SIZE != z) {
-                            tree->parent[z] = x;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                         }
 
-                        tree->parent[y] = tree->parent[x];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                        if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                             tree->root = y;
-                        } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                            tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                         } else {
-                            tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                         }
 
-                        tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                        tree->parent[x] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                     }
-                    sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
+                    sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
                 }
 
-                tree->color[sibling] = tree->color[tree->parent[child]];
-                tree->color[tree->parent[child]] = BLACK_TREE_COLOR;
-                tree->color[tree->node[RED_BLACK_TREE_RIGHT][sibling]] = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT]).color = BLACK_TREE_COLOR;
                 { // LEFT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                    tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
                 child = tree->root;
             }
         } else {
-            size_t sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
-            if (RED_TREE_COLOR == tree->color[sibling]) {
-                tree->color[sibling] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[child]] = RED_TREE_COLOR;
+            RED_BLACK_TREE_INDEX_TYPE sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
+            if (RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, sibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_TREE_COLOR;
                 { // RIGHT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                    tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
-                sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
+                sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
             }
 
-            const size_t wl = tree->node[RED_BLACK_TREE_LEFT][sibling];
-            const size_t wr = tree->node[RED_BLACK_TREE_RIGHT][sibling];
+            const RED_BLACK_TREE_INDEX_TYPE wl = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT];
+            const RED_BLACK_TREE_INDEX_TYPE wr = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT];
 
-            if (BLACK_TREE_COLOR == tree->color[wl] && BLACK_TREE_COLOR == tree->color[wr]) {
-                tree->color[sibling] = RED_TREE_COLOR;
-                child = tree->parent[child];
+            if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, wl).color && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, wr).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, child).parent;
             } else {
-                if (BLACK_TREE_COLOR == tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]]) {
-                    tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
-                    tree->color[sibling] = RED_TREE_COLOR;
+                if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color) {
+                    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
                     { // LEFT ROTATE
-                        const size_t x = sibling, y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                        tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                        const RED_BLACK_TREE_INDEX_TYPE x = sibling, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                         if (RED_BLACK_TREE_SIZE != z) {
-                            tree->parent[z] = x;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                         }
 
-                        tree->parent[y] = tree->parent[x];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                        if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                             tree->root = y;
-                        } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                            tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                         } else {
-                            tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                         }
 
-                        tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                        tree->parent[x] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                     }
-                    sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
+                    sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
                 }
 
-                tree->color[sibling] = tree->color[tree->parent[child]];
-                tree->color[tree->parent[child]] = BLACK_TREE_COLOR;
-                tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
                 { // RIGHT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                    tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
                 child = tree->root;
             }
@@ -1062,49 +1689,48 @@ static inline RED_BLACK_TREE_DATA_TYPE remove_min_red_black_tree(red_black_tree_
     }
 
     // fix NIL node
-    tree->color[RED_BLACK_TREE_SIZE] = BLACK_TREE_COLOR;
-    tree->parent[RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree->node[RED_BLACK_TREE_LEFT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree->node[RED_BLACK_TREE_RIGHT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).color = BLACK_TREE_COLOR;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).parent = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_SIZE;
 
-    tree->color[child] = BLACK_TREE_COLOR;
+    RED_BLACK_TREE_WRITE_NODE(*tree, child).color = BLACK_TREE_COLOR;
 
-    RED_BLACK_TREE_DATA_TYPE removed = tree->elements[minimum_node];
+    RED_BLACK_TREE_DATA_TYPE removed = RED_BLACK_TREE_ELEMENT(*tree, minimum_node);
     tree->size--;
 
-    const size_t hole = minimum_node; // index of hole in tree arrays left behind by element removal
+    const RED_BLACK_TREE_INDEX_TYPE hole = minimum_node; // index of hole in tree arrays left behind by element removal
 
     if (tree->size && tree->root == tree->size) { // if head node is last array element then change index to removed one
         tree->root = hole;
     }
 
     // cut hole node from the rest of the tree
-    tree->node[RED_BLACK_TREE_LEFT][hole] = tree->node[RED_BLACK_TREE_RIGHT][hole] = tree->parent[hole] = hole;
+    RED_BLACK_TREE_WRITE_NODE(*tree, hole).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_WRITE_NODE(*tree, hole).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_WRITE_NODE(*tree, hole).parent = hole;
 
     // replace removed element with rightmost array one (or fill hole with valid element)
-    tree->elements[hole] = tree->elements[tree->size];
-    tree->node[RED_BLACK_TREE_LEFT][hole] = tree->node[RED_BLACK_TREE_LEFT][tree->size];
-    tree->node[RED_BLACK_TREE_RIGHT][hole] = tree->node[RED_BLACK_TREE_RIGHT][tree->size];
-    tree->parent[hole] = tree->parent[tree->size];
+    RED_BLACK_TREE_WRITE_ELEMENT(*tree, hole) = RED_BLACK_TREE_ELEMENT(*tree, tree->size);
+    RED_BLACK_TREE_WRITE_NODE(*tree, hole) = RED_BLACK_TREE_NODE(*tree, tree->size);
 
     // redirect parent and children of rightmost array node if they don't overlap with removed index
-    const size_t left_last = tree->node[RED_BLACK_TREE_LEFT][tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE left_last = RED_BLACK_TREE_NODE(*tree, tree->size).child[RED_BLACK_TREE_LEFT];
     if (RED_BLACK_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole;
+        RED_BLACK_TREE_WRITE_NODE(*tree, left_last).parent = hole;
     }
 
-    const size_t right_last = tree->node[RED_BLACK_TREE_RIGHT][tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE right_last = RED_BLACK_TREE_NODE(*tree, tree->size).child[RED_BLACK_TREE_RIGHT];
     if (RED_BLACK_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole;
+        RED_BLACK_TREE_WRITE_NODE(*tree, right_last).parent = hole;
     }
 
-    const size_t parent_last = tree->parent[tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE parent_last = RED_BLACK_TREE_NODE(*tree, tree->size).parent;
     if (RED_BLACK_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole;
+        const RED_BLACK_TREE_INDEX_TYPE node_index = tree->size == RED_BLACK_TREE_NODE(*tree, parent_last).child[RED_BLACK_TREE_LEFT] ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+        RED_BLACK_TREE_WRITE_NODE(*tree, parent_last).child[node_index] = hole;
     }
 
+    update_maximum_red_black_tree(tree);
+
     return removed;
 }
 
@@ -1113,261 +1739,258 @@ static inline RED_BLACK_TREE_DATA_TYPE remove_max_red_black_tree(red_black_tree_
     RED_BLACK_TREE_ASSERT(tree->size && "[ERROR] Can't remove from empty tree.");
     RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_SIZE != tree->root && "[ERROR] Invalid root node index.");
 
-    RED_BLACK_TREE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree->parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
     RED_BLACK_TREE_ASSERT(tree->root != RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root index.");
     RED_BLACK_TREE_ASSERT(tree->root < tree->size && "[ERROR] Invalid tree root index.");
-    RED_BLACK_TREE_ASSERT(tree->parent[tree->root] == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
+    RED_BLACK_TREE_ASSERT(RED_BLACK_TREE_NODE(*tree, tree->root).parent == RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree root parent.");
 
-    size_t maximum_node = tree->root;
-    for (size_t i = tree->node[RED_BLACK_TREE_RIGHT][maximum_node]; RED_BLACK_TREE_SIZE != i; i = tree->node[RED_BLACK_TREE_RIGHT][i]) {
+    RED_BLACK_TREE_INDEX_TYPE maximum_node = tree->root;
+    for (RED_BLACK_TREE_INDEX_TYPE i = RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_RIGHT]; RED_BLACK_TREE_SIZE != i; i = RED_BLACK_TREE_NODE(*tree, i).child[RED_BLACK_TREE_RIGHT]) {
         maximum_node = i;
     }
 
-    size_t current = maximum_node, child = RED_BLACK_TREE_SIZE;
-    bool original_color = tree->color[current];
+    RED_BLACK_TREE_INDEX_TYPE current = maximum_node, child = RED_BLACK_TREE_SIZE;
+    bool original_color = RED_BLACK_TREE_NODE(*tree, current).color;
 
-    if (RED_BLACK_TREE_SIZE == tree->node[RED_BLACK_TREE_LEFT][maximum_node]) {
-        child = tree->node[RED_BLACK_TREE_RIGHT][maximum_node];
+    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_LEFT]) {
+        child = RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_RIGHT];
 
         { // TRANSPLANT
-            const size_t u = maximum_node, v = tree->node[RED_BLACK_TREE_RIGHT][maximum_node];
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+            const RED_BLACK_TREE_INDEX_TYPE u = maximum_node, v = RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_RIGHT];
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
 
-            tree->parent[v] = tree->parent[u];
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
         }
-    } else if (RED_BLACK_TREE_SIZE == tree->node[RED_BLACK_TREE_RIGHT][maximum_node]) {
-        child = tree->node[RED_BLACK_TREE_LEFT][maximum_node];
+    } else if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_RIGHT]) {
+        child = RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_LEFT];
 
         { // TRANSPLANT
-            const size_t u = maximum_node, v = tree->node[RED_BLACK_TREE_LEFT][maximum_node];
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+            const RED_BLACK_TREE_INDEX_TYPE u = maximum_node, v = RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_LEFT];
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
 
-            tree->parent[v] = tree->parent[u];
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
         }
     } else {
-        current = tree->node[RED_BLACK_TREE_RIGHT][maximum_node];
-        while (RED_BLACK_TREE_SIZE != tree->node[RED_BLACK_TREE_LEFT][current]) { // TREE MINIMUM
-            current = tree->node[RED_BLACK_TREE_LEFT][current];
+        current = RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_RIGHT];
+        while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT]) { // TREE MINIMUM
+            current = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT];
         }
 
-        original_color = tree->color[current];
-        child = tree->node[RED_BLACK_TREE_RIGHT][current];
+        original_color = RED_BLACK_TREE_NODE(*tree, current).color;
+        child = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT];
 
-        if (tree->parent[current] == maximum_node) {
-            tree->parent[child] = current;
+        if (RED_BLACK_TREE_NODE(*tree, current).parent == maximum_node) {
+            RED_BLACK_TREE_WRITE_NODE(*tree, child).parent = current;
         } else {
             { // TRANSPLANT
-                const size_t u = current, v = tree->node[RED_BLACK_TREE_RIGHT][current];
-                if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-                else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-                else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+                const RED_BLACK_TREE_INDEX_TYPE u = current, v = RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT];
+                if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+                else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+                else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
 
-                tree->parent[v] = tree->parent[u];
+                RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
             }
 
-            tree->node[RED_BLACK_TREE_RIGHT][current] = tree->node[RED_BLACK_TREE_RIGHT][maximum_node];
-            tree->parent[tree->node[RED_BLACK_TREE_RIGHT][current]] = current;
-            child == RED_BLACK_TREE_SIZE ? tree->parent[current] : tree->parent[maximum_node];
+            RED_BLACK_TREE_WRITE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_RIGHT];
+            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_RIGHT]).parent = current;
         }
         { // TRANSPLANT
-            const size_t u = maximum_node, v = current;
-            if (RED_BLACK_TREE_SIZE == tree->parent[u]) tree->root = v;
-            else if (u == tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]]) tree->node[RED_BLACK_TREE_LEFT][tree->parent[u]] = v;
-            else tree->node[RED_BLACK_TREE_RIGHT][tree->parent[u]] = v;
+            const RED_BLACK_TREE_INDEX_TYPE u = maximum_node, v = current;
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, u).parent) tree->root = v;
+            else if (u == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_LEFT] = v;
+            else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, u).parent).child[RED_BLACK_TREE_RIGHT] = v;
 
-            tree->parent[v] = tree->parent[u];
+            RED_BLACK_TREE_WRITE_NODE(*tree, v).parent = RED_BLACK_TREE_NODE(*tree, u).parent;
         }
 
-        tree->node[RED_BLACK_TREE_LEFT][current] = tree->node[RED_BLACK_TREE_LEFT][maximum_node];
-        tree->parent[tree->node[RED_BLACK_TREE_LEFT][current]] = current;
-        tree->color[current] = tree->color[maximum_node];
+        RED_BLACK_TREE_WRITE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_NODE(*tree, maximum_node).child[RED_BLACK_TREE_LEFT];
+        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, current).child[RED_BLACK_TREE_LEFT]).parent = current;
+        RED_BLACK_TREE_WRITE_NODE(*tree, current).color = RED_BLACK_TREE_NODE(*tree, maximum_node).color;
     }
 
-    while (BLACK_TREE_COLOR == original_color && child != tree->root && BLACK_TREE_COLOR == tree->color[child]) {
-        if (child == tree->parent[child]) {
-            size_t sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
-            if (RED_TREE_COLOR == tree->color[sibling]) {
-                tree->color[sibling] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[child]] = RED_TREE_COLOR;
+    while (BLACK_TREE_COLOR == original_color && child != tree->root && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, child).color) {
+        if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT]) {
+            RED_BLACK_TREE_INDEX_TYPE sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
+            if (RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, sibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_TREE_COLOR;
                 { // LEFT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                    tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
-                sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
+                sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
             }
 
-            const size_t wl = tree->node[RED_BLACK_TREE_LEFT][sibling];
-            const size_t wr = tree->node[RED_BLACK_TREE_RIGHT][sibling];
+            const RED_BLACK_TREE_INDEX_TYPE wl = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT];
+            const RED_BLACK_TREE_INDEX_TYPE wr = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT];
 
-            if (BLACK_TREE_COLOR == tree->color[wl] && BLACK_TREE_COLOR == tree->color[wr]) {
-                tree->color[sibling] = RED_TREE_COLOR;
-                child = tree->parent[child];
+            if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, wl).color && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, wr).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, child).parent;
             } else {
-                if (BLACK_TREE_COLOR == tree->color[tree->node[RED_BLACK_TREE_RIGHT][sibling]]) {
-                    tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
-                    tree->color[sibling] = RED_TREE_COLOR;
+                if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT]).color) {
+                    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
                     { // RIGHT ROTATE
-                        const size_t x = sibling, y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                        tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                        const RED_BLACK_TREE_INDEX_TYPE x = sibling, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                         if (RED_BLACK_TREE_SIZE != z) {
-                            tree->parent[z] = x;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                         }
 
-                        tree->parent[y] = tree->parent[x];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                        if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                             tree->root = y;
-                        } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                            tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                         } else {
-                            tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                         }
 
-                        tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                        tree->parent[x] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                     }
-                    sibling = tree->node[RED_BLACK_TREE_RIGHT][tree->parent[child]];
+                    sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT];
                 }
 
-                tree->color[sibling] = tree->color[tree->parent[child]];
-                tree->color[tree->parent[child]] = BLACK_TREE_COLOR;
-                tree->color[tree->node[RED_BLACK_TREE_RIGHT][sibling]] = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT]).color = BLACK_TREE_COLOR;
                 { // LEFT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                    tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
                 child = tree->root;
             }
         } else {
-            size_t sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
-            if (RED_TREE_COLOR == tree->color[sibling]) {
-                tree->color[sibling] = BLACK_TREE_COLOR;
-                tree->color[tree->parent[child]] = RED_TREE_COLOR;
+            RED_BLACK_TREE_INDEX_TYPE sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
+            if (RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, sibling).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_TREE_COLOR;
                 { // RIGHT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                    tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
-                sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
+                sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
             }
 
-            const size_t wl = tree->node[RED_BLACK_TREE_LEFT][sibling];
-            const size_t wr = tree->node[RED_BLACK_TREE_RIGHT][sibling];
+            const RED_BLACK_TREE_INDEX_TYPE wl = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT];
+            const RED_BLACK_TREE_INDEX_TYPE wr = RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_RIGHT];
 
-            if (BLACK_TREE_COLOR == tree->color[wl] && BLACK_TREE_COLOR == tree->color[wr]) {
-                tree->color[sibling] = RED_TREE_COLOR;
-                child = tree->parent[child];
+            if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, wl).color && BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, wr).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, child).parent;
             } else {
-                if (BLACK_TREE_COLOR == tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]]) {
-                    tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
-                    tree->color[sibling] = RED_TREE_COLOR;
+                if (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color) {
+                    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_TREE_COLOR;
                     { // LEFT ROTATE
-                        const size_t x = sibling, y = tree->node[RED_BLACK_TREE_RIGHT][x], z = tree->node[RED_BLACK_TREE_LEFT][y];
-                        tree->node[RED_BLACK_TREE_RIGHT][x] = z;
+                        const RED_BLACK_TREE_INDEX_TYPE x = sibling, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
 
                         if (RED_BLACK_TREE_SIZE != z) {
-                            tree->parent[z] = x;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                         }
 
-                        tree->parent[y] = tree->parent[x];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                        if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                             tree->root = y;
-                        } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                            tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                         } else {
-                            tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                         }
 
-                        tree->node[RED_BLACK_TREE_LEFT][y] = x;
-                        tree->parent[x] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                     }
-                    sibling = tree->node[RED_BLACK_TREE_LEFT][tree->parent[child]];
+                    sibling = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT];
                 }
 
-                tree->color[sibling] = tree->color[tree->parent[child]];
-                tree->color[tree->parent[child]] = BLACK_TREE_COLOR;
-                tree->color[tree->node[RED_BLACK_TREE_LEFT][sibling]] = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, sibling).color = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, sibling).child[RED_BLACK_TREE_LEFT]).color = BLACK_TREE_COLOR;
                 { // RIGHT ROTATE
-                    const size_t x = tree->parent[child], y = tree->node[RED_BLACK_TREE_LEFT][x], z = tree->node[RED_BLACK_TREE_RIGHT][y];
-                    tree->node[RED_BLACK_TREE_LEFT][x] = z;
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, child).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
 
                     if (RED_BLACK_TREE_SIZE != z) {
-                        tree->parent[z] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
                     }
 
-                    tree->parent[y] = tree->parent[x];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
 
-                    if (RED_BLACK_TREE_SIZE == tree->parent[x]) {
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
                         tree->root = y;
-                    } else if (x == tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]]) {
-                        tree->node[RED_BLACK_TREE_LEFT][tree->parent[x]] = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
                     } else {
-                        tree->node[RED_BLACK_TREE_RIGHT][tree->parent[x]] = y;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
                     }
 
-                    tree->node[RED_BLACK_TREE_RIGHT][y] = x;
-                    tree->parent[x] = y;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
                 }
                 child = tree->root;
             }
@@ -1375,87 +1998,784 @@ static inline RED_BLACK_TREE_DATA_TYPE remove_max_red_black_tree(red_black_tree_
     }
 
     // fix NIL node
-    tree->color[RED_BLACK_TREE_SIZE] = BLACK_TREE_COLOR;
-    tree->parent[RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree->node[RED_BLACK_TREE_LEFT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
-    tree->node[RED_BLACK_TREE_RIGHT][RED_BLACK_TREE_SIZE] = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).color = BLACK_TREE_COLOR;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).parent = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_SIZE;
+    RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_SIZE).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_SIZE;
 
-    tree->color[child] = BLACK_TREE_COLOR;
+    RED_BLACK_TREE_WRITE_NODE(*tree, child).color = BLACK_TREE_COLOR;
 
-    RED_BLACK_TREE_DATA_TYPE removed = tree->elements[maximum_node];
+    RED_BLACK_TREE_DATA_TYPE removed = RED_BLACK_TREE_ELEMENT(*tree, maximum_node);
     tree->size--;
 
-    const size_t hole = maximum_node; // index of hole in tree arrays left behind by element removal
+    const RED_BLACK_TREE_INDEX_TYPE hole = maximum_node; // index of hole in tree arrays left behind by element removal
 
     if (tree->size && tree->root == tree->size) { // if head node is last array element then change index to removed one
         tree->root = hole;
     }
 
     // cut hole node from the rest of the tree
-    tree->node[RED_BLACK_TREE_LEFT][hole] = tree->node[RED_BLACK_TREE_RIGHT][hole] = tree->parent[hole] = hole;
+    RED_BLACK_TREE_WRITE_NODE(*tree, hole).child[RED_BLACK_TREE_LEFT] = RED_BLACK_TREE_WRITE_NODE(*tree, hole).child[RED_BLACK_TREE_RIGHT] = RED_BLACK_TREE_WRITE_NODE(*tree, hole).parent = hole;
 
     // replace removed element with rightmost array one (or fill hole with valid element)
-    tree->elements[hole] = tree->elements[tree->size];
-    tree->node[RED_BLACK_TREE_LEFT][hole] = tree->node[RED_BLACK_TREE_LEFT][tree->size];
-    tree->node[RED_BLACK_TREE_RIGHT][hole] = tree->node[RED_BLACK_TREE_RIGHT][tree->size];
-    tree->parent[hole] = tree->parent[tree->size];
+    RED_BLACK_TREE_WRITE_ELEMENT(*tree, hole) = RED_BLACK_TREE_ELEMENT(*tree, tree->size);
+    RED_BLACK_TREE_WRITE_NODE(*tree, hole) = RED_BLACK_TREE_NODE(*tree, tree->size);
 
     // redirect parent and children of rightmost array node if they don't overlap with removed index
-    const size_t left_last = tree->node[RED_BLACK_TREE_LEFT][tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE left_last = RED_BLACK_TREE_NODE(*tree, tree->size).child[RED_BLACK_TREE_LEFT];
     if (RED_BLACK_TREE_SIZE != left_last) {
-        tree->parent[left_last] = hole;
+        RED_BLACK_TREE_WRITE_NODE(*tree, left_last).parent = hole;
     }
 
-    const size_t right_last = tree->node[RED_BLACK_TREE_RIGHT][tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE right_last = RED_BLACK_TREE_NODE(*tree, tree->size).child[RED_BLACK_TREE_RIGHT];
     if (RED_BLACK_TREE_SIZE != right_last) {
-        tree->parent[right_last] = hole;
+        RED_BLACK_TREE_WRITE_NODE(*tree, right_last).parent = hole;
     }
 
-    const size_t parent_last = tree->parent[tree->size];
+    const RED_BLACK_TREE_INDEX_TYPE parent_last = RED_BLACK_TREE_NODE(*tree, tree->size).parent;
     if (RED_BLACK_TREE_SIZE != parent_last) {
-        const int comparison = tree->compare(tree->elements[tree->size], tree->elements[parent_last]);
-        const size_t node_index = comparison <= 0 ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
-        tree->node[node_index][parent_last] = hole;
+        const RED_BLACK_TREE_INDEX_TYPE node_index = tree->size == RED_BLACK_TREE_NODE(*tree, parent_last).child[RED_BLACK_TREE_LEFT] ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT;
+        RED_BLACK_TREE_WRITE_NODE(*tree, parent_last).child[node_index] = hole;
     }
 
+    update_maximum_red_black_tree(tree);
+
     return removed;
 }
 
+// joins left and right subtrees, whose nodes are already in tree's arrays, with pivot node between them into tree's root
+static inline void join_pivot_red_black_tree(red_black_tree_s * tree, const RED_BLACK_TREE_INDEX_TYPE left, const RED_BLACK_TREE_INDEX_TYPE pivot, const RED_BLACK_TREE_INDEX_TYPE right) {
+    RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+    RED_BLACK_TREE_ASSERT(pivot < RED_BLACK_TREE_SIZE && "[ERROR] Invalid pivot node.");
+
+    // detach both roots and make them black, then count black heights along leftmost paths
+    if (RED_BLACK_TREE_SIZE != left) {
+        RED_BLACK_TREE_WRITE_NODE(*tree, left).parent = RED_BLACK_TREE_SIZE;
+        RED_BLACK_TREE_WRITE_NODE(*tree, left).color = BLACK_TREE_COLOR;
+    }
+    if (RED_BLACK_TREE_SIZE != right) {
+        RED_BLACK_TREE_WRITE_NODE(*tree, right).parent = RED_BLACK_TREE_SIZE;
+        RED_BLACK_TREE_WRITE_NODE(*tree, right).color = BLACK_TREE_COLOR;
+    }
+
+    size_t left_black = 0, right_black = 0;
+    for (RED_BLACK_TREE_INDEX_TYPE n = left; RED_BLACK_TREE_SIZE != n; n = RED_BLACK_TREE_NODE(*tree, n).child[RED_BLACK_TREE_LEFT]) {
+        left_black += (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, n).color);
+    }
+    for (RED_BLACK_TREE_INDEX_TYPE n = right; RED_BLACK_TREE_SIZE != n; n = RED_BLACK_TREE_NODE(*tree, n).child[RED_BLACK_TREE_LEFT]) {
+        right_black += (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, n).color);
+    }
+
+    RED_BLACK_TREE_WRITE_NODE(*tree, pivot).color = RED_TREE_COLOR;
+    if (left_black == right_black) { // if black heights are equal then pivot becomes black root of both trees
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).child[RED_BLACK_TREE_LEFT] = left;
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).child[RED_BLACK_TREE_RIGHT] = right;
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).parent = RED_BLACK_TREE_SIZE;
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).color = BLACK_TREE_COLOR;
+
+        if (RED_BLACK_TREE_SIZE != left) RED_BLACK_TREE_WRITE_NODE(*tree, left).parent = pivot;
+        if (RED_BLACK_TREE_SIZE != right) RED_BLACK_TREE_WRITE_NODE(*tree, right).parent = pivot;
+        tree->root = pivot;
+    } else if (left_black > right_black) { // else if left tree is higher then red pivot replaces black node with right's black height on left's right spine
+        RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_SIZE, node = left;
+        for (size_t black = left_black; RED_BLACK_TREE_SIZE != node && (RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, node).color || black > right_black); node = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT]) {
+            black -= (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, node).color);
+            parent = node;
+        }
+
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).child[RED_BLACK_TREE_LEFT] = node;
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).child[RED_BLACK_TREE_RIGHT] = right;
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).parent = parent;
+        RED_BLACK_TREE_WRITE_NODE(*tree, parent).child[RED_BLACK_TREE_RIGHT] = pivot;
+
+        if (RED_BLACK_TREE_SIZE != node) RED_BLACK_TREE_WRITE_NODE(*tree, node).parent = pivot;
+        if (RED_BLACK_TREE_SIZE != right) RED_BLACK_TREE_WRITE_NODE(*tree, right).parent = pivot;
+        tree->root = left;
+    } else { // else right tree is higher and red pivot replaces black node with left's black height on right's left spine
+        RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_SIZE, node = right;
+        for (size_t black = right_black; RED_BLACK_TREE_SIZE != node && (RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, node).color || black > left_black); node = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT]) {
+            black -= (BLACK_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, node).color);
+            parent = node;
+        }
+
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).child[RED_BLACK_TREE_LEFT] = left;
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).child[RED_BLACK_TREE_RIGHT] = node;
+        RED_BLACK_TREE_WRITE_NODE(*tree, pivot).parent = parent;
+        RED_BLACK_TREE_WRITE_NODE(*tree, parent).child[RED_BLACK_TREE_LEFT] = pivot;
+
+        if (RED_BLACK_TREE_SIZE != left) RED_BLACK_TREE_WRITE_NODE(*tree, left).parent = pivot;
+        if (RED_BLACK_TREE_SIZE != node) RED_BLACK_TREE_WRITE_NODE(*tree, node).parent = pivot;
+        tree->root = right;
+    }
+
+    // red pivot may have a red parent, thus fix it like an inserted node
+    for (RED_BLACK_TREE_INDEX_TYPE child = pivot; child != tree->root && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color;) {
+        if (RED_BLACK_TREE_NODE(*tree, child).parent == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_LEFT]) {
+            const RED_BLACK_TREE_INDEX_TYPE uncle = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_RIGHT];
+
+            if (RED_BLACK_TREE_SIZE != uncle && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, uncle).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_BLACK_TREE_WRITE_NODE(*tree, uncle).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent;
+            } else {
+                if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_RIGHT]) {
+                    child = RED_BLACK_TREE_NODE(*tree, child).parent;
+                    { // LEFT ROTATE
+                        const RED_BLACK_TREE_INDEX_TYPE x = child, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
+
+                        if (RED_BLACK_TREE_SIZE != z) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
+                        }
+
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
+
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
+                            tree->root = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
+                        } else {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
+                        }
+
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
+                    }
+                }
+
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                { // RIGHT ROTATE
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
+
+                    if (RED_BLACK_TREE_SIZE != z) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
+                    }
+
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
+
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
+                        tree->root = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
+                    } else {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
+                    }
+
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
+                }
+            }
+        } else {
+            const RED_BLACK_TREE_INDEX_TYPE uncle = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).child[RED_BLACK_TREE_LEFT];
+
+            if (RED_BLACK_TREE_SIZE != uncle && RED_TREE_COLOR == RED_BLACK_TREE_NODE(*tree, uncle).color) {
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = RED_BLACK_TREE_WRITE_NODE(*tree, uncle).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                child = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent;
+            } else {
+                if (child == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).child[RED_BLACK_TREE_LEFT]) {
+                    child = RED_BLACK_TREE_NODE(*tree, child).parent;
+                    { // RIGHT ROTATE
+                        const RED_BLACK_TREE_INDEX_TYPE x = child, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT];
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_LEFT] = z;
+
+                        if (RED_BLACK_TREE_SIZE != z) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
+                        }
+
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
+
+                        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
+                            tree->root = y;
+                        } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
+                        } else {
+                            RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
+                        }
+
+                        RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_RIGHT] = x;
+                        RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
+                    }
+                }
+
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).color = BLACK_TREE_COLOR;
+                RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent).color = RED_TREE_COLOR;
+                { // LEFT ROTATE
+                    const RED_BLACK_TREE_INDEX_TYPE x = RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, child).parent).parent, y = RED_BLACK_TREE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT], z = RED_BLACK_TREE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT];
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).child[RED_BLACK_TREE_RIGHT] = z;
+
+                    if (RED_BLACK_TREE_SIZE != z) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, z).parent = x;
+                    }
+
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).parent = RED_BLACK_TREE_NODE(*tree, x).parent;
+
+                    if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, x).parent) {
+                        tree->root = y;
+                    } else if (x == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT]) {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_LEFT] = y;
+                    } else {
+                        RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, x).parent).child[RED_BLACK_TREE_RIGHT] = y;
+                    }
+
+                    RED_BLACK_TREE_WRITE_NODE(*tree, y).child[RED_BLACK_TREE_LEFT] = x;
+                    RED_BLACK_TREE_WRITE_NODE(*tree, x).parent = y;
+                }
+            }
+        }
+    }
+
+    RED_BLACK_TREE_WRITE_NODE(*tree, tree->root).color = BLACK_TREE_COLOR;
+}
+
+// returns node's in-order neighbour, successor if direction is right and predecessor if left, or NIL node if there is none
+static inline RED_BLACK_TREE_INDEX_TYPE step_red_black_tree(const red_black_tree_s tree, RED_BLACK_TREE_INDEX_TYPE node, const RED_BLACK_TREE_INDEX_TYPE direction) {
+    const RED_BLACK_TREE_INDEX_TYPE opposite = (RED_BLACK_TREE_INDEX_TYPE)(!direction);
+    if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[direction]) { // neighbour is the outermost opposite node of direction's subtree
+        node = RED_BLACK_TREE_NODE(tree, node).child[direction];
+        while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[opposite]) {
+            node = RED_BLACK_TREE_NODE(tree, node).child[opposite];
+        }
+
+        return node;
+    }
+
+    // else neighbour is the first ancestor whose opposite subtree contains node
+    RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_NODE(tree, node).parent;
+    while (RED_BLACK_TREE_SIZE != parent && node == RED_BLACK_TREE_NODE(tree, parent).child[direction]) {
+        node = parent;
+        parent = RED_BLACK_TREE_NODE(tree, parent).parent;
+    }
+
+    return parent;
+}
+
+static inline void join_red_black_tree(red_black_tree_s * restrict destination, red_black_tree_s * restrict source) {
+    RED_BLACK_TREE_ASSERT(destination && "[ERROR] 'destination' parameter is NULL.");
+    RED_BLACK_TREE_ASSERT(source && "[ERROR] 'source' parameter is NULL.");
+    RED_BLACK_TREE_ASSERT(destination != source && "[ERROR] Trees can't be the same.");
+    RED_BLACK_TREE_ASSERT(destination->size + source->size <= RED_BLACK_TREE_SIZE && "[ERROR] Join will exceed maximum size.");
+    RED_BLACK_TREE_COMPARE_ASSERT(destination->compare == source->compare && "[ERROR] Compare functions must be the same.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(destination->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(destination->elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(destination->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(destination->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(source->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(source->elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(source->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(source->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // smaller tree is appended into larger one's arrays, thus both trees swap if source is larger
+    if (source->size > destination->size) {
+        const red_black_tree_s temp = (*destination);
+        (*destination) = (*source);
+        (*source) = temp;
+    }
+
+    if (!source->size) {
+        return;
+    }
+
+    // source's elements must either all be not less or all be not greater than destination's
+    bool is_greater = true;
+    if (destination->size) {
+        is_greater = RED_BLACK_TREE_COMPARE_WITH(destination->compare, get_max_red_black_tree(*destination), get_min_red_black_tree(*source)) <= 0;
+        RED_BLACK_TREE_ASSERT((is_greater || RED_BLACK_TREE_COMPARE_WITH(destination->compare, get_max_red_black_tree(*source), get_min_red_black_tree(*destination)) <= 0) && "[ERROR] Trees' element ranges overlap.");
+    }
+
+    // source's element bordering destination is taken out to become the pivot node joining both trees
+    const RED_BLACK_TREE_DATA_TYPE element = is_greater ? remove_min_red_black_tree(source) : remove_max_red_black_tree(source);
+
+    // append source's nodes behind destination's by shifting all their valid indexes
+    const RED_BLACK_TREE_INDEX_TYPE offset = (RED_BLACK_TREE_INDEX_TYPE)destination->size;
+    for (size_t i = 0; i < source->size; ++i) {
+        RED_BLACK_TREE_WRITE_ELEMENT(*destination, offset + i) = RED_BLACK_TREE_ELEMENT(*source, i);
+
+        red_black_tree_node_s record = RED_BLACK_TREE_NODE(*source, i);
+        if (RED_BLACK_TREE_SIZE != record.child[RED_BLACK_TREE_LEFT]) record.child[RED_BLACK_TREE_LEFT] += offset;
+        if (RED_BLACK_TREE_SIZE != record.child[RED_BLACK_TREE_RIGHT]) record.child[RED_BLACK_TREE_RIGHT] += offset;
+        if (RED_BLACK_TREE_SIZE != record.parent) record.parent += offset;
+        RED_BLACK_TREE_WRITE_NODE(*destination, offset + i) = record;
+    }
+
+    const RED_BLACK_TREE_INDEX_TYPE appended = source->size ? (RED_BLACK_TREE_INDEX_TYPE)(source->root + offset) : RED_BLACK_TREE_SIZE;
+    const RED_BLACK_TREE_INDEX_TYPE pivot = (RED_BLACK_TREE_INDEX_TYPE)(destination->size + source->size);
+    memcpy(&RED_BLACK_TREE_WRITE_ELEMENT(*destination, pivot), &element, sizeof(RED_BLACK_TREE_DATA_TYPE));
+
+    destination->size += source->size + 1;
+    source->size = 0;
+    source->root = source->maximum = RED_BLACK_TREE_SIZE;
+
+    const RED_BLACK_TREE_INDEX_TYPE left = is_greater ? destination->root : appended;
+    const RED_BLACK_TREE_INDEX_TYPE right = is_greater ? appended : destination->root;
+    join_pivot_red_black_tree(destination, left, pivot, right);
+    update_maximum_red_black_tree(destination);
+}
+
+static inline red_black_tree_s split_red_black_tree(red_black_tree_s * tree, const RED_BLACK_TREE_DATA_TYPE element) {
+    RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // highest node less than element ends lesser side and lowest node not less than element starts greater side
+    RED_BLACK_TREE_INDEX_TYPE highest = RED_BLACK_TREE_SIZE, lowest = RED_BLACK_TREE_SIZE;
+    for (RED_BLACK_TREE_INDEX_TYPE n = tree->root; RED_BLACK_TREE_SIZE != n;) {
+        if (RED_BLACK_TREE_COMPARE_WITH(tree->compare, element, RED_BLACK_TREE_ELEMENT(*tree, n)) <= 0) {
+            lowest = n;
+            n = RED_BLACK_TREE_NODE(*tree, n).child[RED_BLACK_TREE_LEFT];
+        } else {
+            highest = n;
+            n = RED_BLACK_TREE_NODE(*tree, n).child[RED_BLACK_TREE_RIGHT];
+        }
+    }
+
+    // both sides are walked outwards in lockstep until one ends, thus only the smaller side is moved out of tree's arrays
+    RED_BLACK_TREE_INDEX_TYPE lesser_node = highest, greater_node = lowest;
+    while (RED_BLACK_TREE_SIZE != lesser_node && RED_BLACK_TREE_SIZE != greater_node) {
+        lesser_node = step_red_black_tree(*tree, lesser_node, RED_BLACK_TREE_LEFT);
+        greater_node = step_red_black_tree(*tree, greater_node, RED_BLACK_TREE_RIGHT);
+    }
+    const bool is_greater_moved = (RED_BLACK_TREE_SIZE == greater_node);
+
+    // moved side is collected in order, lesser side starts at tree's leftmost node and ends right before greater side
+    red_black_tree_s moved = create_red_black_tree(RED_BLACK_TREE_COMPARE_FUNCTION(tree->compare));
+    RED_BLACK_TREE_INDEX_TYPE node = lowest, end = RED_BLACK_TREE_SIZE;
+    if (!is_greater_moved) {
+        for (node = tree->root; RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT];) {
+            node = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT];
+        }
+        end = lowest;
+    }
+
+    for (; end != node; node = step_red_black_tree(*tree, node, RED_BLACK_TREE_RIGHT)) {
+        // moved tree's node records are built at the end, thus they temporarily store the moved node's index
+        RED_BLACK_TREE_WRITE_ELEMENT(moved, moved.size) = RED_BLACK_TREE_ELEMENT(*tree, node);
+        RED_BLACK_TREE_WRITE_NODE(moved, moved.size++).parent = node;
+    }
+
+    // nodes on the search path that stay are the only ones that lose a subtree, tree height is below twice the bit count
+    RED_BLACK_TREE_INDEX_TYPE path[sizeof(RED_BLACK_TREE_INDEX_TYPE) << 4];
+    size_t path_size = 0;
+    for (RED_BLACK_TREE_INDEX_TYPE n = tree->root; RED_BLACK_TREE_SIZE != n;) {
+        const bool is_greater = RED_BLACK_TREE_COMPARE_WITH(tree->compare, element, RED_BLACK_TREE_ELEMENT(*tree, n)) <= 0;
+        if (is_greater != is_greater_moved) {
+            path[path_size++] = n;
+        }
+        n = RED_BLACK_TREE_NODE(*tree, n).child[is_greater ? RED_BLACK_TREE_LEFT : RED_BLACK_TREE_RIGHT];
+    }
+
+    // join path nodes bottom up with their kept subtrees, since everything joined below a path node is on its moved side
+    tree->root = RED_BLACK_TREE_SIZE;
+    while (path_size) {
+        const RED_BLACK_TREE_INDEX_TYPE pivot = path[--path_size];
+        if (is_greater_moved) {
+            join_pivot_red_black_tree(tree, RED_BLACK_TREE_NODE(*tree, pivot).child[RED_BLACK_TREE_LEFT], pivot, tree->root);
+        } else {
+            join_pivot_red_black_tree(tree, tree->root, pivot, RED_BLACK_TREE_NODE(*tree, pivot).child[RED_BLACK_TREE_RIGHT]);
+        }
+    }
+
+    // mark moved nodes as holes by making them their own parent
+    for (size_t i = 0; i < moved.size; ++i) {
+        const RED_BLACK_TREE_INDEX_TYPE hole = RED_BLACK_TREE_NODE(moved, i).parent;
+        RED_BLACK_TREE_WRITE_NODE(*tree, hole).parent = hole;
+    }
+
+    // fill holes below remaining size with remaining nodes above it
+    const size_t size = tree->size - moved.size;
+    RED_BLACK_TREE_INDEX_TYPE hole = 0;
+    for (RED_BLACK_TREE_INDEX_TYPE last = (RED_BLACK_TREE_INDEX_TYPE)size; last < tree->size; ++last) {
+        if (last == RED_BLACK_TREE_NODE(*tree, last).parent) {
+            continue;
+        }
+
+        while (hole != RED_BLACK_TREE_NODE(*tree, hole).parent) {
+            hole++;
+        }
+
+        RED_BLACK_TREE_WRITE_ELEMENT(*tree, hole) = RED_BLACK_TREE_ELEMENT(*tree, last);
+        RED_BLACK_TREE_WRITE_NODE(*tree, hole) = RED_BLACK_TREE_NODE(*tree, last);
+
+        if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, last).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, last).child[RED_BLACK_TREE_LEFT]).parent = hole;
+        if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, last).child[RED_BLACK_TREE_RIGHT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, last).child[RED_BLACK_TREE_RIGHT]).parent = hole;
+
+        if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(*tree, last).parent) tree->root = hole;
+        else if (last == RED_BLACK_TREE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, last).parent).child[RED_BLACK_TREE_LEFT]) RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, last).parent).child[RED_BLACK_TREE_LEFT] = hole;
+        else RED_BLACK_TREE_WRITE_NODE(*tree, RED_BLACK_TREE_NODE(*tree, last).parent).child[RED_BLACK_TREE_RIGHT] = hole;
+
+        hole++;
+    }
+    tree->size = size;
+    update_maximum_red_black_tree(tree);
+
+    // build moved tree from its sorted elements
+    link_sorted_red_black_tree(&moved);
+
+    if (is_greater_moved) {
+        return moved;
+    }
+
+    // tree keeps lesser elements, thus it swaps with moved lesser tree and returns its own greater one
+    const red_black_tree_s greater = (*tree);
+    (*tree) = moved;
+
+    return greater;
+}
+
+static inline red_black_tree_cursor_s begin_red_black_tree(const red_black_tree_s tree) {
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    red_black_tree_cursor_s cursor = { .element = NULL, .node = tree.root, };
+    if (RED_BLACK_TREE_SIZE == cursor.node) { // if tree is empty then cursor is past the end
+        return cursor;
+    }
+
+    // first element is the leftmost node
+    while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, cursor.node).child[RED_BLACK_TREE_LEFT]) {
+        cursor.node = RED_BLACK_TREE_NODE(tree, cursor.node).child[RED_BLACK_TREE_LEFT];
+    }
+    cursor.element = &RED_BLACK_TREE_ELEMENT(tree, cursor.node);
+
+    return cursor;
+}
+
+static inline red_black_tree_cursor_s rbegin_red_black_tree(const red_black_tree_s tree) {
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // last element is the cached rightmost node, if tree is empty then cursor is past the end
+    const red_black_tree_cursor_s cursor = { .element = RED_BLACK_TREE_SIZE == tree.maximum ? NULL : &RED_BLACK_TREE_ELEMENT(tree, tree.maximum), .node = tree.maximum, };
+
+    return cursor;
+}
+
+static inline red_black_tree_cursor_s next_red_black_tree(const red_black_tree_s tree, const red_black_tree_cursor_s cursor) {
+    RED_BLACK_TREE_ASSERT(cursor.element && "[ERROR] Can't move cursor that is past the end.");
+    RED_BLACK_TREE_ASSERT(cursor.node < tree.size && "[ERROR] Invalid cursor node index.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    red_black_tree_cursor_s next = { .element = NULL, .node = RED_BLACK_TREE_NODE(tree, cursor.node).child[RED_BLACK_TREE_RIGHT], };
+    if (RED_BLACK_TREE_SIZE != next.node) { // successor is the leftmost node of right subtree
+        while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, next.node).child[RED_BLACK_TREE_LEFT]) {
+            next.node = RED_BLACK_TREE_NODE(tree, next.node).child[RED_BLACK_TREE_LEFT];
+        }
+    } else { // else successor is the first ancestor whose left subtree contains node
+        RED_BLACK_TREE_INDEX_TYPE child = cursor.node;
+        next.node = RED_BLACK_TREE_NODE(tree, child).parent;
+        while (RED_BLACK_TREE_SIZE != next.node && child == RED_BLACK_TREE_NODE(tree, next.node).child[RED_BLACK_TREE_RIGHT]) {
+            child = next.node;
+            next.node = RED_BLACK_TREE_NODE(tree, next.node).parent;
+        }
+    }
+
+    if (RED_BLACK_TREE_SIZE != next.node) {
+        next.element = &RED_BLACK_TREE_ELEMENT(tree, next.node);
+    }
+
+    return next;
+}
+
+static inline red_black_tree_cursor_s prev_red_black_tree(const red_black_tree_s tree, const red_black_tree_cursor_s cursor) {
+    RED_BLACK_TREE_ASSERT(cursor.element && "[ERROR] Can't move cursor that is past the end.");
+    RED_BLACK_TREE_ASSERT(cursor.node < tree.size && "[ERROR] Invalid cursor node index.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    red_black_tree_cursor_s prev = { .element = NULL, .node = RED_BLACK_TREE_NODE(tree, cursor.node).child[RED_BLACK_TREE_LEFT], };
+    if (RED_BLACK_TREE_SIZE != prev.node) { // predecessor is the rightmost node of left subtree
+        while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, prev.node).child[RED_BLACK_TREE_RIGHT]) {
+            prev.node = RED_BLACK_TREE_NODE(tree, prev.node).child[RED_BLACK_TREE_RIGHT];
+        }
+    } else { // else predecessor is the first ancestor whose right subtree contains node
+        RED_BLACK_TREE_INDEX_TYPE child = cursor.node;
+        prev.node = RED_BLACK_TREE_NODE(tree, child).parent;
+        while (RED_BLACK_TREE_SIZE != prev.node && child == RED_BLACK_TREE_NODE(tree, prev.node).child[RED_BLACK_TREE_LEFT]) {
+            child = prev.node;
+            prev.node = RED_BLACK_TREE_NODE(tree, prev.node).parent;
+        }
+    }
+
+    if (RED_BLACK_TREE_SIZE != prev.node) {
+        prev.element = &RED_BLACK_TREE_ELEMENT(tree, prev.node);
+    }
+
+    return prev;
+}
+
+static inline red_black_tree_cursor_s seek_red_black_tree(const red_black_tree_s tree, const RED_BLACK_TREE_DATA_TYPE element) {
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    // find the leftmost node that is not less than element, without stopping at equal ones since duplicates may be left
+    red_black_tree_cursor_s cursor = { .element = NULL, .node = RED_BLACK_TREE_SIZE, };
+    for (RED_BLACK_TREE_INDEX_TYPE node = tree.root; RED_BLACK_TREE_SIZE != node;) {
+        if (RED_BLACK_TREE_COMPARE_WITH(tree.compare, element, RED_BLACK_TREE_ELEMENT(tree, node)) <= 0) {
+            cursor.node = node;
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+        } else {
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+        }
+    }
+
+    if (RED_BLACK_TREE_SIZE != cursor.node) {
+        cursor.element = &RED_BLACK_TREE_ELEMENT(tree, cursor.node);
+    }
+
+    return cursor;
+}
+
+static inline red_black_tree_s union_red_black_tree(const red_black_tree_s tree_one, const red_black_tree_s tree_two, const copy_red_black_tree_fn copy) {
+    RED_BLACK_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    red_black_tree_s tree_union = create_red_black_tree(RED_BLACK_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    red_black_tree_cursor_s one = begin_red_black_tree(tree_one), two = begin_red_black_tree(tree_two);
+    while (one.element || two.element) {
+        const int comparison = !one.element ? 1 : !two.element ? -1 : RED_BLACK_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        RED_BLACK_TREE_ASSERT(tree_union.size < RED_BLACK_TREE_SIZE && "[ERROR] Union exceeds maximum tree size.");
+        RED_BLACK_TREE_WRITE_ELEMENT(tree_union, tree_union.size++) = copy(comparison <= 0 ? (*one.element) : (*two.element));
+
+        if (comparison <= 0) one = next_red_black_tree(tree_one, one);
+        if (comparison >= 0) two = next_red_black_tree(tree_two, two);
+    }
+    link_sorted_red_black_tree(&tree_union);
+
+    return tree_union;
+}
+
+static inline red_black_tree_s intersect_red_black_tree(const red_black_tree_s tree_one, const red_black_tree_s tree_two, const copy_red_black_tree_fn copy) {
+    RED_BLACK_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    red_black_tree_s tree_intersect = create_red_black_tree(RED_BLACK_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    red_black_tree_cursor_s one = begin_red_black_tree(tree_one), two = begin_red_black_tree(tree_two);
+    while (one.element && two.element) {
+        const int comparison = RED_BLACK_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (!comparison) {
+            RED_BLACK_TREE_WRITE_ELEMENT(tree_intersect, tree_intersect.size++) = copy((*one.element));
+        }
+
+        if (comparison <= 0) one = next_red_black_tree(tree_one, one);
+        if (comparison >= 0) two = next_red_black_tree(tree_two, two);
+    }
+    link_sorted_red_black_tree(&tree_intersect);
+
+    return tree_intersect;
+}
+
+static inline red_black_tree_s subtract_red_black_tree(const red_black_tree_s tree_one, const red_black_tree_s tree_two, const copy_red_black_tree_fn copy) {
+    RED_BLACK_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    red_black_tree_s tree_subtract = create_red_black_tree(RED_BLACK_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    red_black_tree_cursor_s one = begin_red_black_tree(tree_one), two = begin_red_black_tree(tree_two);
+    while (one.element) {
+        const int comparison = !two.element ? -1 : RED_BLACK_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (comparison < 0) {
+            RED_BLACK_TREE_WRITE_ELEMENT(tree_subtract, tree_subtract.size++) = copy((*one.element));
+        }
+
+        if (comparison <= 0) one = next_red_black_tree(tree_one, one);
+        if (comparison >= 0) two = next_red_black_tree(tree_two, two);
+    }
+    link_sorted_red_black_tree(&tree_subtract);
+
+    return tree_subtract;
+}
+
+static inline red_black_tree_s exclude_red_black_tree(const red_black_tree_s tree_one, const red_black_tree_s tree_two, const copy_red_black_tree_fn copy) {
+    RED_BLACK_TREE_ASSERT(copy && "[ERROR] 'copy' parameter is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_one.compare == tree_two.compare && "[ERROR] Compare functions must be the same.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_one.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_one.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree_two.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree_two.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    red_black_tree_s tree_exclude = create_red_black_tree(RED_BLACK_TREE_COMPARE_FUNCTION(tree_one.compare));
+
+    // merge both trees' in-order streams, equal elements are paired up one to one
+    red_black_tree_cursor_s one = begin_red_black_tree(tree_one), two = begin_red_black_tree(tree_two);
+    while (one.element || two.element) {
+        const int comparison = !one.element ? 1 : !two.element ? -1 : RED_BLACK_TREE_COMPARE_WITH(tree_one.compare, (*one.element), (*two.element));
+        if (comparison) {
+            RED_BLACK_TREE_ASSERT(tree_exclude.size < RED_BLACK_TREE_SIZE && "[ERROR] Exclude exceeds maximum tree size.");
+            RED_BLACK_TREE_WRITE_ELEMENT(tree_exclude, tree_exclude.size++) = copy(comparison < 0 ? (*one.element) : (*two.element));
+        }
+
+        if (comparison <= 0) one = next_red_black_tree(tree_one, one);
+        if (comparison >= 0) two = next_red_black_tree(tree_two, two);
+    }
+    link_sorted_red_black_tree(&tree_exclude);
+
+    return tree_exclude;
+}
+
+static inline void compact_red_black_tree(red_black_tree_s * tree) {
+    RED_BLACK_TREE_ASSERT(tree && "[ERROR] 'tree' parameter is NULL.");
+
+    RED_BLACK_TREE_COMPARE_ASSERT(tree->compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->elements && "[ERROR] 'elements' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->nodes && "[ERROR] 'nodes' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree->size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+
+    if (!tree->size) {
+        return;
+    }
+
+    // each node's in-order position becomes its new array index, thus in-order scans walk memory sequentially
+    RED_BLACK_TREE_INDEX_TYPE * position = RED_BLACK_TREE_ALLOC(tree->size * sizeof(RED_BLACK_TREE_INDEX_TYPE));
+    RED_BLACK_TREE_ASSERT(position && "[ERROR] Memory allocation failed.");
+
+    RED_BLACK_TREE_INDEX_TYPE node = tree->root;
+    while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT]) {
+        node = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT];
+    }
+
+    for (RED_BLACK_TREE_INDEX_TYPE rank = 0; RED_BLACK_TREE_SIZE != node; ++rank) {
+        position[node] = rank;
+
+        if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT]) { // successor is leftmost node of right subtree
+            node = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_RIGHT];
+            while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT]) {
+                node = RED_BLACK_TREE_NODE(*tree, node).child[RED_BLACK_TREE_LEFT];
+            }
+        } else { // else successor is first ancestor whose left subtree contains node
+            RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_NODE(*tree, node).parent;
+            while (RED_BLACK_TREE_SIZE != parent && node == RED_BLACK_TREE_NODE(*tree, parent).child[RED_BLACK_TREE_RIGHT]) {
+                node = parent;
+                parent = RED_BLACK_TREE_NODE(*tree, parent).parent;
+            }
+            node = parent;
+        }
+    }
+
+    // scatter elements and node records into a new tree while renaming every valid link, tree shape stays the same
+    red_black_tree_s compacted = create_red_black_tree(RED_BLACK_TREE_COMPARE_FUNCTION(tree->compare));
+    for (size_t i = 0; i < tree->size; ++i) {
+        red_black_tree_node_s record = RED_BLACK_TREE_NODE(*tree, i);
+        if (RED_BLACK_TREE_SIZE != record.child[RED_BLACK_TREE_LEFT]) record.child[RED_BLACK_TREE_LEFT] = position[record.child[RED_BLACK_TREE_LEFT]];
+        if (RED_BLACK_TREE_SIZE != record.child[RED_BLACK_TREE_RIGHT]) record.child[RED_BLACK_TREE_RIGHT] = position[record.child[RED_BLACK_TREE_RIGHT]];
+        if (RED_BLACK_TREE_SIZE != record.parent) record.parent = position[record.parent];
+
+        RED_BLACK_TREE_WRITE_NODE(compacted, position[i]) = record;
+        RED_BLACK_TREE_WRITE_ELEMENT(compacted, position[i]) = RED_BLACK_TREE_ELEMENT(*tree, i);
+    }
+
+    compacted.size = tree->size;
+    compacted.root = position[tree->root];
+
+    // elements moved into compacted tree, thus old arrays are dropped without destroying them
+    RED_BLACK_TREE_FREE(position);
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    release_red_black_tree(tree, NULL);
+#else
+    RED_BLACK_TREE_FREE(tree->elements);
+    RED_BLACK_TREE_FREE(tree->nodes);
+#endif
+
+    (*tree) = compacted;
+    update_maximum_red_black_tree(tree);
+}
+
 static inline void inorder_red_black_tree(const red_black_tree_s tree, const operate_red_black_tree_fn operate, void * args) {
     RED_BLACK_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    RED_BLACK_TREE_ASSERT(is_detached_red_black_tree(tree) && "[ERROR] Can't operate on elements shared with a snapshot, detach tree first.");
+#endif
 
     bool left_done = false;
-    size_t node = tree.root;
+    RED_BLACK_TREE_INDEX_TYPE node = tree.root;
     while (RED_BLACK_TREE_SIZE != node) {
-        while (!left_done && RED_BLACK_TREE_SIZE != tree.node[RED_BLACK_TREE_LEFT][node]) {
-            node = tree.node[RED_BLACK_TREE_LEFT][node];
+        while (!left_done && RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT]) {
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
         }
 
-        if (!operate(tree.elements + node, args)) {
+        if (!operate(&RED_BLACK_TREE_ELEMENT(tree, node), args)) {
             break;
         }
 
         left_done = true;
-        if (RED_BLACK_TREE_SIZE != tree.node[RED_BLACK_TREE_RIGHT][node]) {
+        if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT]) {
             left_done = false;
-            node = tree.node[RED_BLACK_TREE_RIGHT][node];
-        } else if (RED_BLACK_TREE_SIZE != tree.parent[node]) {
-            while (RED_BLACK_TREE_SIZE != tree.parent[node] && node == tree.node[RED_BLACK_TREE_RIGHT][tree.parent[node]]) {
-                node = tree.parent[node];
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+        } else if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).parent) {
+            while (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).parent && node == RED_BLACK_TREE_NODE(tree, RED_BLACK_TREE_NODE(tree, node).parent).child[RED_BLACK_TREE_RIGHT]) {
+                node = RED_BLACK_TREE_NODE(tree, node).parent;
             }
 
-            if (RED_BLACK_TREE_SIZE == tree.parent[node]) {
+            if (RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(tree, node).parent) {
                 break;
             }
 
-            node = tree.parent[node];
+            node = RED_BLACK_TREE_NODE(tree, node).parent;
         } else {
             break;
         }
@@ -1465,135 +2785,150 @@ static inline void inorder_red_black_tree(const red_black_tree_s tree, const ope
 static inline void preorder_red_black_tree(const red_black_tree_s tree, const operate_red_black_tree_fn operate, void * args) {
     RED_BLACK_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    RED_BLACK_TREE_ASSERT(is_detached_red_black_tree(tree) && "[ERROR] Can't operate on elements shared with a snapshot, detach tree first.");
+#endif
 
-    // create simple stack to manage depth first in-order traversal of node indexes
-    struct pre_stack { size_t size; size_t * elements; } stack = {
-        .size = 0, .elements = RED_BLACK_TREE_ALLOC(tree.size * sizeof(size_t)),
-    };
-    RED_BLACK_TREE_ASSERT(stack.elements && "[ERROR] Memory allocation failed.");
-
-    if (tree.size) {
-        stack.elements[stack.size++] = tree.root;
-    }
-
-    while (stack.size && operate(tree.elements + stack.elements[stack.size - 1], args)) {
-        const size_t node = stack.elements[--stack.size];
-
-        const size_t right_child = tree.node[RED_BLACK_TREE_RIGHT][node];
-        if (RED_BLACK_TREE_SIZE != right_child) {
-            stack.elements[stack.size++] = right_child;
-        }
+    RED_BLACK_TREE_INDEX_TYPE node = tree.root;
+    while (RED_BLACK_TREE_SIZE != node && operate(&RED_BLACK_TREE_ELEMENT(tree, node), args)) {
+        if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT]) { // go to left child first
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+        } else if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT]) { // else go to right child
+            node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+        } else { // else go up until an ancestor with a not yet visited right child is found
+            RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_NODE(tree, node).parent;
+            while (RED_BLACK_TREE_SIZE != parent && (node == RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT] || RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT])) {
+                node = parent;
+                parent = RED_BLACK_TREE_NODE(tree, parent).parent;
+            }
 
-        const size_t left_child = tree.node[RED_BLACK_TREE_LEFT][node];
-        if (RED_BLACK_TREE_SIZE != left_child) {
-            stack.elements[stack.size++] = left_child;
+            node = (RED_BLACK_TREE_SIZE == parent) ? RED_BLACK_TREE_SIZE : RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT];
         }
     }
-
-    RED_BLACK_TREE_FREE(stack.elements);
 }
 
 static inline void postorder_red_black_tree(const red_black_tree_s tree, const operate_red_black_tree_fn operate, void * args) {
     RED_BLACK_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    RED_BLACK_TREE_ASSERT(is_detached_red_black_tree(tree) && "[ERROR] Can't operate on elements shared with a snapshot, detach tree first.");
+#endif
 
-    // create simple stack to manage depth first in-order traversal of node indexes
-    struct post_stack { size_t size; size_t * elements; } stack = {
-        .size = 0, .elements = RED_BLACK_TREE_ALLOC(tree.size * sizeof(size_t)),
-    };
-    RED_BLACK_TREE_ASSERT(stack.elements && "[ERROR] Memory allocation failed.");
-
-    // push root node onto stack and initially save it into variable
-    size_t node = tree.root;
-    size_t last = RED_BLACK_TREE_SIZE;
-    while (stack.size || RED_BLACK_TREE_SIZE != node) { // while stack is not empty OR node is valid
-        if (RED_BLACK_TREE_SIZE != node) { // if node is valid push it onto the stack and go to node's left child
-            stack.elements[stack.size++] = node;
-            node = tree.node[RED_BLACK_TREE_LEFT][node];
-        } else { // else node is invalid, thus pop a new node from the stack, operate on element, and go to node's right child
-            const size_t peek = stack.elements[stack.size - 1];
-
-            const size_t peek_right_child = tree.node[RED_BLACK_TREE_RIGHT][peek];
-            if (RED_BLACK_TREE_SIZE != peek_right_child && peek_right_child != last) {
-                node = peek_right_child;
+    RED_BLACK_TREE_INDEX_TYPE node = tree.root;
+    if (RED_BLACK_TREE_SIZE != node) {
+        while (true) { // descend to the first node in post-order, preferring left children over right ones
+            if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT]) {
+                node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+            } else if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT]) {
+                node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
             } else {
-                if (!operate(tree.elements + node, args)) {
+                break;
+            }
+        }
+    }
+
+    while (RED_BLACK_TREE_SIZE != node && operate(&RED_BLACK_TREE_ELEMENT(tree, node), args)) {
+        const RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_NODE(tree, node).parent;
+        if (RED_BLACK_TREE_SIZE == parent || node == RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT] || RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT]) {
+            node = parent; // parent comes right after its last child
+        } else { // else continue with first node of parent's right subtree
+            node = RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT];
+            while (true) { // descend to the first node in post-order, preferring left children over right ones
+                if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT]) {
+                    node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+                } else if (RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT]) {
+                    node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+                } else {
                     break;
                 }
-
-                last = stack.elements[--stack.size];
             }
         }
     }
-
-    RED_BLACK_TREE_FREE(stack.elements);
 }
 
 static inline void level_order_red_black_tree(const red_black_tree_s tree, const operate_red_black_tree_fn operate, void * args) {
     RED_BLACK_TREE_ASSERT(operate && "[ERROR] 'operate' parameter is NULL.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    RED_BLACK_TREE_ASSERT(is_detached_red_black_tree(tree) && "[ERROR] Can't operate on elements shared with a snapshot, detach tree first.");
+#endif
 
-    // create simple queue to manage breath first level order traversal of node indexes
-    struct level_queue { size_t size, current; size_t * elements; } queue = {
-        .size = 0, .current = 0, .elements = RED_BLACK_TREE_ALLOC(tree.size * sizeof(size_t)),
-    };
-    RED_BLACK_TREE_ASSERT(queue.elements && "[ERROR] Memory allocation failed.");
-
-    if (tree.size) { // if tree isn't empty push root node
-        queue.elements[queue.current + queue.size++] = tree.root;
-    }
-
-    // while queue isn't empty operate on element, pop parent and push valid children
-    while (queue.size && operate(tree.elements + queue.elements[queue.current], args)) {
-        // pop index
-        const size_t popped_index = queue.elements[queue.current++];
-        queue.size--;
+    // walk the tree in pre-order once per level without going deeper than it, since balanced trees are only
+    // logarithmically high this avoids allocating a queue at the cost of revisiting the upper levels
+    bool found = true;
+    for (size_t level = 0; found; ++level) {
+        found = false;
+
+        size_t depth = 0;
+        RED_BLACK_TREE_INDEX_TYPE node = tree.root;
+        while (RED_BLACK_TREE_SIZE != node) {
+            if (depth == level) {
+                found = true;
+                if (!operate(&RED_BLACK_TREE_ELEMENT(tree, node), args)) {
+                    return;
+                }
+            }
 
-        // push left child of popped parent to the top of the queue
-        const size_t left_child = tree.node[RED_BLACK_TREE_LEFT][popped_index];
-        if (RED_BLACK_TREE_SIZE != left_child) {
-            queue.elements[queue.current + queue.size++] = left_child;
-        }
+            if (depth < level && RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT]) {
+                node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_LEFT];
+                depth++;
+            } else if (depth < level && RED_BLACK_TREE_SIZE != RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT]) {
+                node = RED_BLACK_TREE_NODE(tree, node).child[RED_BLACK_TREE_RIGHT];
+                depth++;
+            } else { // go up until an ancestor with a not yet visited right child is found, right child is on node's depth
+                RED_BLACK_TREE_INDEX_TYPE parent = RED_BLACK_TREE_NODE(tree, node).parent;
+                while (RED_BLACK_TREE_SIZE != parent && (node == RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT] || RED_BLACK_TREE_SIZE == RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT])) {
+                    node = parent;
+                    parent = RED_BLACK_TREE_NODE(tree, parent).parent;
+                    depth--;
+                }
 
-        // push right child of popped parent to the top of the queue
-        const size_t right_child = tree.node[RED_BLACK_TREE_RIGHT][popped_index];
-        if (RED_BLACK_TREE_SIZE != right_child) {
-            queue.elements[queue.current + queue.size++] = right_child;
+                node = (RED_BLACK_TREE_SIZE == parent) ? RED_BLACK_TREE_SIZE : RED_BLACK_TREE_NODE(tree, parent).child[RED_BLACK_TREE_RIGHT];
+            }
         }
     }
-
-    RED_BLACK_TREE_FREE(queue.elements);
 }
 
 static inline void map_red_black_tree(const red_black_tree_s tree, const manage_red_black_tree_fn manage, void * args) {
     RED_BLACK_TREE_ASSERT(manage && "[ERROR] 'manage' parameter is NULL.");
 
-    RED_BLACK_TREE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
+    RED_BLACK_TREE_COMPARE_ASSERT(tree.compare && "[ERROR] 'compare' function is NULL.");
     RED_BLACK_TREE_ASSERT(tree.elements && "[ERROR] 'elements' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_LEFT] && "[ERROR] 'node[RED_BLACK_TREE_LEFT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.node[RED_BLACK_TREE_RIGHT] && "[ERROR] 'node[RED_BLACK_TREE_RIGHT]' pointer is NULL.");
-    RED_BLACK_TREE_ASSERT(tree.parent && "[ERROR] 'parent' pointer is NULL.");
+    RED_BLACK_TREE_ASSERT(tree.nodes && "[ERROR] 'nodes' pointer is NULL.");
     RED_BLACK_TREE_ASSERT(tree.size <= RED_BLACK_TREE_SIZE && "[ERROR] Invalid tree size.");
+#ifdef RED_BLACK_TREE_SNAPSHOT
+    RED_BLACK_TREE_ASSERT(is_detached_red_black_tree(tree) && "[ERROR] Can't map elements shared with a snapshot, detach tree first.");
+
+    // elements are split into chunks, thus they're gathered into one array for manage and scattered back afterwards
+    RED_BLACK_TREE_DATA_TYPE * elements = RED_BLACK_TREE_ALLOC((tree.size ? tree.size : 1) * sizeof(RED_BLACK_TREE_DATA_TYPE));
+    RED_BLACK_TREE_ASSERT(elements && "[ERROR] Memory allocation failed.");
+
+    for (size_t i = 0; i < tree.size; ++i) {
+        elements[i] = RED_BLACK_TREE_ELEMENT(tree, i);
+    }
 
+    manage(elements, tree.size, args);
+
+    for (size_t i = 0; i < tree.size; ++i) {
+        RED_BLACK_TREE_ELEMENT(tree, i) = elements[i];
+    }
+
+    RED_BLACK_TREE_FREE(elements);
+#else
     manage(tree.elements, tree.size, args);
+#endif
 }
 
 #endif // RED_BLACK_TREE_H
@@ -32,6 +32,29 @@ bool operation_string(DATA_TYPE * element, void * args) {
     return true;
 }
 
+void expire_int(DATA_TYPE * element, void * args) {
+    *((int *)(args)) += element->sub_one;
+}
+
+bool collect_int(DATA_TYPE * element, void * cursor) {
+    int ** array = cursor;
+    *((*array)++) = element->sub_one;
+    return true;
+}
+
+int shuffle_int(const int index, const int size) {
+    return (index * 13) % size;
+}
+
+bool is_range_int(const int * array, const size_t size, const int low, const int high) {
+    bool valid = ((size_t)(high - low) == size);
+    for (int i = low; valid && i < high; ++i) {
+        valid = (i == array[i - low]);
+    }
+
+    return valid;
+}
+
 bool print_int(DATA_TYPE * element, void * format) {
     printf(format, element->sub_one);
     fflush(stdout);
@@ -87,6 +110,10 @@ size_t hash_int(const DATA_TYPE element) {
     return (size_t)(element.sub_one);
 }
 
+size_t key_int(const DATA_TYPE element) {
+    return (size_t)(element.sub_one);
+}
+
 size_t hash_string(const DATA_TYPE element) {
     // http://www.cse.yorku.ca/~oz/hash.html
     size_t hash = 5381;
@@ -26,6 +26,16 @@ DATA_TYPE copy_string(const DATA_TYPE element);
 bool operation_int(DATA_TYPE * element, void * args);
 bool operation_string(DATA_TYPE * element, void * args);
 
+void expire_int(DATA_TYPE * element, void * args);
+
+bool collect_int(DATA_TYPE * element, void * cursor);
+
+// 13 is coprime with every power of two size, thus 'shuffle_int(i, size)' for i in [0, size) visits every index once in shuffled order
+int shuffle_int(const int index, const int size);
+
+// checks if array holds exactly the integers from low up to but excluding high
+bool is_range_int(const int * array, const size_t size, const int low, const int high);
+
 bool print_int(DATA_TYPE * element, void * format);
 bool print_string(DATA_TYPE * element, void * format);
 
@@ -45,6 +55,8 @@ void sort_int(DATA_TYPE * elements, const size_t size, void * args);
 
 size_t hash_int(const DATA_TYPE element);
 
+size_t key_int(const DATA_TYPE element);
+
 size_t hash_string(const DATA_TYPE element);
 
 #endif // FUNCTIONS_H
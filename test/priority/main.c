@@ -6,7 +6,15 @@ int main(const int argc, char **argv) {
     GREATEST_MAIN_BEGIN();
 
     RUN_SUITE(binary_heap_test);
+    RUN_SUITE(binary_heap_arity_test);
+    RUN_SUITE(binary_heap_addressable_test);
     RUN_SUITE(sort_heap_test);
+    RUN_SUITE(sort_heap_compare_test);
+    RUN_SUITE(sort_heap_radix_test);
+    RUN_SUITE(radix_heap_test);
+    RUN_SUITE(timer_wheel_test);
+    RUN_SUITE(min_max_heap_test);
+    RUN_SUITE(multi_queue_test);
 
     GREATEST_MAIN_END();
 }
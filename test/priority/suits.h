@@ -6,6 +6,14 @@
 #include <helper/functions.h>
 
 SUITE_EXTERN(binary_heap_test);
+SUITE_EXTERN(binary_heap_arity_test);
+SUITE_EXTERN(binary_heap_addressable_test);
 SUITE_EXTERN(sort_heap_test);
+SUITE_EXTERN(sort_heap_compare_test);
+SUITE_EXTERN(sort_heap_radix_test);
+SUITE_EXTERN(radix_heap_test);
+SUITE_EXTERN(timer_wheel_test);
+SUITE_EXTERN(min_max_heap_test);
+SUITE_EXTERN(multi_queue_test);
 
 #endif // SUITS_H
@@ -0,0 +1,283 @@
+#include <suits.h>
+
+#define BINARY_HEAP_DATA_TYPE DATA_TYPE
+#define BINARY_HEAP_SIZE (1 << 4)
+#define BINARY_HEAP_ADDRESSABLE
+#include <priority/binary_heap.h>
+
+// every element's handle must point back at the element's array index
+static bool is_addressable(const binary_heap_s heap) {
+    for (size_t i = 0; i < heap.size; ++i) {
+        if (heap.positions[heap.handles[i]] != i) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST PUSH_HANDLE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    size_t handles[BINARY_HEAP_SIZE] = { 0 };
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        handles[i] = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = BINARY_HEAP_SIZE - i, });
+    }
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        ASSERTm("[ERROR] Expected handle to be in heap.", contains_handle_binary_heap(test, handles[i]));
+        const BINARY_HEAP_DATA_TYPE a = get_handle_binary_heap(test, handles[i]);
+        ASSERT_EQm("[ERROR] Expected handle's element to be pushed one.", BINARY_HEAP_SIZE - i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_HANDLE_02(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    const size_t handle = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = 0, });
+    for (int i = 1; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    pop_binary_heap(&test);
+    ASSERT_FALSEm("[ERROR] Expected handle to not be in heap.", contains_handle_binary_heap(test, handle));
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DECREASE_KEY_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    size_t handle = 0;
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const size_t h = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i + 1, });
+        if (BINARY_HEAP_SIZE - 1 == i) {
+            handle = h;
+        }
+    }
+
+    const BINARY_HEAP_DATA_TYPE a = decrease_key_binary_heap(test, handle, (BINARY_HEAP_DATA_TYPE) { .sub_one = 0, });
+    ASSERT_EQm("[ERROR] Expected replaced element to be size.", BINARY_HEAP_SIZE, a.sub_one);
+
+    const BINARY_HEAP_DATA_TYPE b = pop_binary_heap(&test);
+    ASSERT_EQm("[ERROR] Expected poped element to be 0.", 0, b.sub_one);
+    ASSERT_FALSEm("[ERROR] Expected handle to not be in heap.", contains_handle_binary_heap(test, handle));
+
+    for (int i = 1; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE c = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, c.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INCREASE_KEY_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    size_t handle = 0;
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const size_t h = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+        if (0 == i) {
+            handle = h;
+        }
+    }
+
+    increase_key_binary_heap(test, handle, (BINARY_HEAP_DATA_TYPE) { .sub_one = BINARY_HEAP_SIZE, });
+
+    for (int i = 1; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    const BINARY_HEAP_DATA_TYPE b = get_handle_binary_heap(test, handle);
+    ASSERT_EQm("[ERROR] Expected handle's element to be size.", BINARY_HEAP_SIZE, b.sub_one);
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_HANDLE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    size_t handles[BINARY_HEAP_SIZE] = { 0 };
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        handles[i] = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; i += 2) {
+        const BINARY_HEAP_DATA_TYPE a = remove_handle_binary_heap(&test, handles[i]);
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, a.sub_one);
+    }
+
+    for (int i = 1; i < BINARY_HEAP_SIZE; i += 2) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_MANY_HANDLE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    const size_t handle = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = BINARY_HEAP_SIZE, });
+
+    BINARY_HEAP_DATA_TYPE array[BINARY_HEAP_SIZE - 1];
+    for (int i = 0; i < BINARY_HEAP_SIZE - 1; ++i) {
+        array[i] = (BINARY_HEAP_DATA_TYPE) { .sub_one = BINARY_HEAP_SIZE - 1 - i, };
+    }
+    push_many_binary_heap(&test, array, BINARY_HEAP_SIZE - 1);
+
+    ASSERTm("[ERROR] Expected handles to match positions.", is_addressable(test));
+    ASSERTm("[ERROR] Expected handle to be in heap.", contains_handle_binary_heap(test, handle));
+    const BINARY_HEAP_DATA_TYPE a = get_handle_binary_heap(test, handle);
+    ASSERT_EQm("[ERROR] Expected handle's element to be size.", BINARY_HEAP_SIZE, a.sub_one);
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REPLACE_HANDLE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    size_t handles[BINARY_HEAP_SIZE] = { 0 };
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        handles[i] = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i + 1, });
+    }
+
+    // replaced root's handle moves with the new element down the heap
+    replace_binary_heap(test, 0, (BINARY_HEAP_DATA_TYPE) { .sub_one = BINARY_HEAP_SIZE + 1, });
+
+    ASSERTm("[ERROR] Expected handles to match positions.", is_addressable(test));
+    const BINARY_HEAP_DATA_TYPE a = get_handle_binary_heap(test, handles[0]);
+    ASSERT_EQm("[ERROR] Expected handle's element to be replacement.", BINARY_HEAP_SIZE + 1, a.sub_one);
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_HANDLE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    size_t handles[BINARY_HEAP_SIZE] = { 0 };
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        handles[i] = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * 7) % BINARY_HEAP_SIZE, });
+    }
+
+    binary_heap_s copy = copy_binary_heap(test, copy_int);
+
+    ASSERTm("[ERROR] Expected handles to match positions.", is_addressable(copy));
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = get_handle_binary_heap(copy, handles[i]);
+        ASSERT_EQm("[ERROR] Expected copied handle's element to be pushed one.", (i * 7) % BINARY_HEAP_SIZE, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+    destroy_binary_heap(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST MELD_HANDLE_01(void) {
+    binary_heap_s one = create_binary_heap(compare_int);
+    binary_heap_s two = create_binary_heap(compare_int);
+
+    size_t handles[BINARY_HEAP_SIZE / 2] = { 0 };
+    for (int i = 0; i < BINARY_HEAP_SIZE / 2; ++i) {
+        handles[i] = push_handle_binary_heap(&one, (BINARY_HEAP_DATA_TYPE) { .sub_one = (2 * i) + 1, });
+        push_binary_heap(&two, (BINARY_HEAP_DATA_TYPE) { .sub_one = 2 * i, });
+    }
+
+    meld_binary_heap(&one, &two);
+
+    // destination's handles stay valid while source's elements take its free handles
+    ASSERTm("[ERROR] Expected handles to match positions.", is_addressable(one));
+    for (int i = 0; i < BINARY_HEAP_SIZE / 2; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = get_handle_binary_heap(one, handles[i]);
+        ASSERT_EQm("[ERROR] Expected handle's element to be pushed one.", (2 * i) + 1, a.sub_one);
+    }
+
+    destroy_binary_heap(&one, destroy_int);
+    destroy_binary_heap(&two, destroy_int);
+
+    PASS();
+}
+
+TEST OFFER_HANDLE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE * 4; ++i) {
+        offer_binary_heap(&test, BINARY_HEAP_SIZE / 2, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * 7) % (BINARY_HEAP_SIZE * 4), }, destroy_int);
+        ASSERTm("[ERROR] Expected handles to match positions.", is_addressable(test));
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SORT_HANDLE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    size_t handles[BINARY_HEAP_SIZE] = { 0 };
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        handles[i] = push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * 7) % BINARY_HEAP_SIZE, });
+    }
+
+    sort_binary_heap(&test);
+
+    ASSERTm("[ERROR] Expected handles to match positions.", is_addressable(test));
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = get_handle_binary_heap(test, handles[i]);
+        ASSERT_EQm("[ERROR] Expected handle's element to be pushed one.", (i * 7) % BINARY_HEAP_SIZE, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CLEAR_HANDLE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    clear_binary_heap(&test, destroy_int);
+
+    // every handle is free again after clear
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_handle_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+    ASSERTm("[ERROR] Expected handles to match positions.", is_addressable(test));
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (binary_heap_addressable_test) {
+    // push handle
+    RUN_TEST(PUSH_HANDLE_01); RUN_TEST(PUSH_HANDLE_02);
+    // decrease and increase key
+    RUN_TEST(DECREASE_KEY_01); RUN_TEST(INCREASE_KEY_01);
+    // remove handle
+    RUN_TEST(REMOVE_HANDLE_01);
+    // handles kept by other operations
+    RUN_TEST(PUSH_MANY_HANDLE_01); RUN_TEST(REPLACE_HANDLE_01); RUN_TEST(COPY_HANDLE_01); RUN_TEST(MELD_HANDLE_01);
+    RUN_TEST(OFFER_HANDLE_01); RUN_TEST(SORT_HANDLE_01); RUN_TEST(CLEAR_HANDLE_01);
+}
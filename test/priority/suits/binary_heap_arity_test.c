@@ -0,0 +1,219 @@
+#include <suits.h>
+
+#define BINARY_HEAP_DATA_TYPE DATA_TYPE
+#define BINARY_HEAP_SIZE (1 << 6)
+#define BINARY_HEAP_ARITY 4
+#include <priority/binary_heap.h>
+
+// coprime with size, thus 'i * BINARY_HEAP_STEP % BINARY_HEAP_SIZE' visits every element once in shuffled order
+#define BINARY_HEAP_STEP 37
+
+static bool is_heap(const binary_heap_s heap) {
+    for (size_t i = 1; i < heap.size; ++i) {
+        if (heap.compare(heap.elements[i], heap.elements[(i - 1) / BINARY_HEAP_ARITY]) < 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST PUSH_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * BINARY_HEAP_STEP) % BINARY_HEAP_SIZE, });
+        ASSERTm("[ERROR] Expected heap property to hold.", is_heap(test));
+    }
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = BINARY_HEAP_SIZE - 1; i >= 0; --i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_MANY_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    BINARY_HEAP_DATA_TYPE array[BINARY_HEAP_SIZE];
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        array[i] = (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * BINARY_HEAP_STEP) % BINARY_HEAP_SIZE, };
+    }
+
+    push_many_binary_heap(&test, array, BINARY_HEAP_SIZE);
+    ASSERTm("[ERROR] Expected heap property to hold.", is_heap(test));
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_MANY_02(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 2; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    const BINARY_HEAP_DATA_TYPE array[] = { { .sub_one = 1, }, { .sub_one = 0, }, };
+    push_many_binary_heap(&test, array, 2);
+    ASSERTm("[ERROR] Expected heap property to hold.", is_heap(test));
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_01(void) {
+    binary_heap_s test = create_binary_heap(compare_reverse_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * BINARY_HEAP_STEP) % BINARY_HEAP_SIZE, });
+    }
+
+    for (int i = BINARY_HEAP_SIZE - 1; i >= 0; --i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+        ASSERTm("[ERROR] Expected heap property to hold.", is_heap(test));
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REPLACE_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * BINARY_HEAP_STEP) % BINARY_HEAP_SIZE, });
+    }
+
+    // last element sifts up to root and root sifts down to a leaf
+    const BINARY_HEAP_DATA_TYPE a = replace_binary_heap(test, BINARY_HEAP_SIZE - 1, (BINARY_HEAP_DATA_TYPE) { .sub_one = -1, });
+    ASSERTm("[ERROR] Expected heap property to hold.", is_heap(test));
+    const BINARY_HEAP_DATA_TYPE b = replace_binary_heap(test, 0, (BINARY_HEAP_DATA_TYPE) { .sub_one = a.sub_one, });
+    ASSERT_EQm("[ERROR] Expected replaced root to be -1.", -1, b.sub_one);
+    ASSERTm("[ERROR] Expected heap property to hold.", is_heap(test));
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE c = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, c.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST MELD_01(void) {
+    binary_heap_s one = create_binary_heap(compare_int);
+    binary_heap_s two = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; i += 2) {
+        push_binary_heap(&one, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = BINARY_HEAP_SIZE - 1; i > 0; i -= 2) {
+        push_binary_heap(&two, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    meld_binary_heap(&one, &two);
+    ASSERTm("[ERROR] Expected heap property to hold.", is_heap(one));
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&one);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&one, destroy_int);
+    destroy_binary_heap(&two, destroy_int);
+
+    PASS();
+}
+
+TEST OFFER_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        offer_binary_heap(&test, BINARY_HEAP_SIZE / 4, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * BINARY_HEAP_STEP) % BINARY_HEAP_SIZE, }, destroy_int);
+        ASSERTm("[ERROR] Expected heap property to hold.", is_heap(test));
+    }
+
+    ASSERT_EQm("[ERROR] Expected size to be k.", BINARY_HEAP_SIZE / 4, test.size);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE / 4; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be one of k largest.", BINARY_HEAP_SIZE - (BINARY_HEAP_SIZE / 4) + i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SORT_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * BINARY_HEAP_STEP) % BINARY_HEAP_SIZE, });
+    }
+
+    sort_binary_heap(&test);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i.", i, test.elements[i].sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (binary_heap_arity_test) {
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02);
+    // push many
+    RUN_TEST(PUSH_MANY_01); RUN_TEST(PUSH_MANY_02);
+    // pop
+    RUN_TEST(POP_01);
+    // replace
+    RUN_TEST(REPLACE_01);
+    // meld
+    RUN_TEST(MELD_01);
+    // offer
+    RUN_TEST(OFFER_01);
+    // sort
+    RUN_TEST(SORT_01);
+}
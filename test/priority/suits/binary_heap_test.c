@@ -4,6 +4,13 @@
 #define BINARY_HEAP_SIZE (1 << 4)
 #include <priority/binary_heap.h>
 
+// counts destroyed elements, thus offer can be checked to destroy each evicted root
+static size_t destroyed = 0;
+static void destroy_count(BINARY_HEAP_DATA_TYPE * element) {
+    destroyed++;
+    destroy_int(element);
+}
+
 TEST CREATE_01(void) {
     binary_heap_s test = create_binary_heap(compare_int);
 
@@ -353,6 +360,46 @@ TEST PUSH_03(void) {
     PASS();
 }
 
+TEST PUSH_MANY_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    BINARY_HEAP_DATA_TYPE array[BINARY_HEAP_SIZE];
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        array[i] = (BINARY_HEAP_DATA_TYPE) { .sub_one = BINARY_HEAP_SIZE - 1 - i, };
+    }
+
+    push_many_binary_heap(&test, array, BINARY_HEAP_SIZE);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_MANY_02(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 1; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    const BINARY_HEAP_DATA_TYPE array[] = { { .sub_one = 0, }, };
+    push_many_binary_heap(&test, array, 1);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
 TEST POP_01(void) {
     binary_heap_s test = create_binary_heap(compare_int);
 
@@ -571,6 +618,146 @@ TEST MELD_02(void) {
     PASS();
 }
 
+TEST MELD_03(void) {
+    binary_heap_s one = create_binary_heap(compare_int);
+    binary_heap_s two = create_binary_heap(compare_int);
+
+    push_binary_heap(&two, (BINARY_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    meld_binary_heap(&one, &two);
+
+    ASSERT_EQm("[ERROR] Expected size to be one.", 1, one.size);
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, two.size);
+    const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&one);
+    ASSERT_EQm("[ERROR] Expected poped element to be 42.", 42, a.sub_one);
+
+    destroy_binary_heap(&one, destroy_int);
+    destroy_binary_heap(&two, destroy_int);
+
+    PASS();
+}
+
+TEST OFFER_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE * 4; ++i) {
+        offer_binary_heap(&test, BINARY_HEAP_SIZE / 2, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * 7) % (BINARY_HEAP_SIZE * 4), }, destroy_int);
+    }
+
+    ASSERT_EQm("[ERROR] Expected size to be k.", BINARY_HEAP_SIZE / 2, test.size);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE / 2; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be one of k largest.", (BINARY_HEAP_SIZE * 4) - (BINARY_HEAP_SIZE / 2) + i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST OFFER_02(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        ASSERTm("[ERROR] Expected element to be kept.", offer_binary_heap(&test, BINARY_HEAP_SIZE, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, }, destroy_int));
+    }
+
+    ASSERT_FALSEm("[ERROR] Expected least element to be rejected.", offer_binary_heap(&test, BINARY_HEAP_SIZE, (BINARY_HEAP_DATA_TYPE) { .sub_one = 0, }, destroy_int));
+    ASSERTm("[ERROR] Expected greatest element to be kept.", offer_binary_heap(&test, BINARY_HEAP_SIZE, (BINARY_HEAP_DATA_TYPE) { .sub_one = BINARY_HEAP_SIZE, }, destroy_int));
+
+    for (int i = 1; i <= BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST OFFER_03(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    // ascending elements are always kept, thus every offer past 'k' evicts and destroys the current root
+    destroyed = 0;
+    for (int i = 0; i < BINARY_HEAP_SIZE * 4; ++i) {
+        offer_binary_heap(&test, BINARY_HEAP_SIZE / 2, (BINARY_HEAP_DATA_TYPE) { .sub_one = i, }, destroy_count);
+    }
+    ASSERT_EQm("[ERROR] Expected every evicted root to be destroyed.", (BINARY_HEAP_SIZE * 4) - (BINARY_HEAP_SIZE / 2), destroyed);
+
+    // rejected element stays with caller and isn't destroyed
+    ASSERT_FALSEm("[ERROR] Expected least element to be rejected.", offer_binary_heap(&test, BINARY_HEAP_SIZE / 2, (BINARY_HEAP_DATA_TYPE) { .sub_one = 0, }, destroy_count));
+    ASSERT_EQm("[ERROR] Expected rejected element to not be destroyed.", (BINARY_HEAP_SIZE * 4) - (BINARY_HEAP_SIZE / 2), destroyed);
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST OFFER_MANY_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    BINARY_HEAP_DATA_TYPE array[BINARY_HEAP_SIZE * 4];
+    for (int i = 0; i < BINARY_HEAP_SIZE * 4; ++i) {
+        array[i] = (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * 7) % (BINARY_HEAP_SIZE * 4), };
+    }
+
+    offer_many_binary_heap(&test, BINARY_HEAP_SIZE / 2, array, BINARY_HEAP_SIZE * 4, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be k.", BINARY_HEAP_SIZE / 2, test.size);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE / 2; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be one of k largest.", (BINARY_HEAP_SIZE * 4) - (BINARY_HEAP_SIZE / 2) + i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST OFFER_MANY_02(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    BINARY_HEAP_DATA_TYPE array[BINARY_HEAP_SIZE * 4];
+    for (int i = 0; i < BINARY_HEAP_SIZE * 4; ++i) {
+        array[i] = (BINARY_HEAP_DATA_TYPE) { .sub_one = i, };
+    }
+
+    destroyed = 0;
+    ASSERT_EQm("[ERROR] Expected every element to be kept.", BINARY_HEAP_SIZE * 4, offer_many_binary_heap(&test, BINARY_HEAP_SIZE / 2, array, BINARY_HEAP_SIZE * 4, destroy_count));
+    ASSERT_EQm("[ERROR] Expected every evicted root to be destroyed.", (BINARY_HEAP_SIZE * 4) - (BINARY_HEAP_SIZE / 2), destroyed);
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SORT_01(void) {
+    binary_heap_s test = create_binary_heap(compare_int);
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_binary_heap(&test, (BINARY_HEAP_DATA_TYPE) { .sub_one = (i * 7) % BINARY_HEAP_SIZE, });
+    }
+
+    sort_binary_heap(&test);
+
+    ASSERT_EQm("[ERROR] Expected size to not change.", BINARY_HEAP_SIZE, test.size);
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i.", i, test.elements[i].sub_one);
+    }
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        const BINARY_HEAP_DATA_TYPE a = pop_binary_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_binary_heap(&test, destroy_int);
+
+    PASS();
+}
+
 SUITE (binary_heap_test) {
     // create
     RUN_TEST(CREATE_01);
@@ -585,6 +772,8 @@ SUITE (binary_heap_test) {
     RUN_TEST(COPY_01); RUN_TEST(COPY_02); RUN_TEST(COPY_03); RUN_TEST(COPY_04);
     // push
     RUN_TEST(PUSH_01); RUN_TEST(PUSH_02); RUN_TEST(PUSH_03);
+    // push many
+    RUN_TEST(PUSH_MANY_01); RUN_TEST(PUSH_MANY_02);
     // pop
     RUN_TEST(POP_01); RUN_TEST(POP_02); RUN_TEST(POP_03);
     // peep
@@ -592,5 +781,9 @@ SUITE (binary_heap_test) {
     // replace
     RUN_TEST(REPLACE_01); RUN_TEST(REPLACE_02); RUN_TEST(REPLACE_03); RUN_TEST(REPLACE_04);
     // meld
-    RUN_TEST(MELD_01); RUN_TEST(MELD_02);
+    RUN_TEST(MELD_01); RUN_TEST(MELD_02); RUN_TEST(MELD_03);
+    // offer
+    RUN_TEST(OFFER_01); RUN_TEST(OFFER_02); RUN_TEST(OFFER_03); RUN_TEST(OFFER_MANY_01); RUN_TEST(OFFER_MANY_02);
+    // sort
+    RUN_TEST(SORT_01);
 }
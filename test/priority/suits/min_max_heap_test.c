@@ -0,0 +1,366 @@
+#include <suits.h>
+
+#define MIN_MAX_HEAP_DATA_TYPE DATA_TYPE
+#define MIN_MAX_HEAP_SIZE (1 << 4)
+#include <priority/min_max_heap.h>
+
+TEST CREATE_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_NEQm("[ERROR] Expected function pointer to not be NULL.", NULL, test.compare);
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST DESTROY_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    clear_min_max_heap(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected heap to be empty.", is_empty_min_max_heap(test));
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    ASSERTm("[ERROR] Expected heap to be empty.", is_empty_min_max_heap(test));
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    ASSERT_FALSEm("[ERROR] Expected heap to not be empty.", is_empty_min_max_heap(test));
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_FULL_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    ASSERT_FALSEm("[ERROR] Expected heap to not be full.", is_full_min_max_heap(test));
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_FULL_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    ASSERTm("[ERROR] Expected heap to be full.", is_full_min_max_heap(test));
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    min_max_heap_s copy = copy_min_max_heap(test, copy_int);
+
+    ASSERT_EQm("[ERROR] Expected sizes to be equal.", test.size, copy.size);
+    ASSERT_EQm("[ERROR] Expected compare functions to be equal.", test.compare, copy.compare);
+
+    destroy_min_max_heap(&test, destroy_int);
+    destroy_min_max_heap(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    min_max_heap_s copy = copy_min_max_heap(test, copy_int);
+
+    ASSERT_EQm("[ERROR] Expected sizes to be equal.", test.size, copy.size);
+    ASSERT_EQm("[ERROR] Expected compare functions to be equal.", test.compare, copy.compare);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        const MIN_MAX_HEAP_DATA_TYPE a = pop_min_min_max_heap(&test);
+        const MIN_MAX_HEAP_DATA_TYPE b = pop_min_min_max_heap(&copy);
+        ASSERT_EQm("[ERROR] Expected poped elements to be equal.", a.sub_one, b.sub_one);
+    }
+
+    destroy_min_max_heap(&test, destroy_int);
+    destroy_min_max_heap(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    ASSERT_EQm("[ERROR] Expected size to be one.", 1, test.size);
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    ASSERT_EQm("[ERROR] Expected size to be MIN_MAX_HEAP_SIZE.", MIN_MAX_HEAP_SIZE, test.size);
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_MIN_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    const MIN_MAX_HEAP_DATA_TYPE a = pop_min_min_max_heap(&test);
+    ASSERT_EQm("[ERROR] Expected poped element to be 42.", 42, a.sub_one);
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_MIN_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = (MIN_MAX_HEAP_SIZE - 1) - i, });
+    }
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        const MIN_MAX_HEAP_DATA_TYPE a = pop_min_min_max_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_MAX_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    const MIN_MAX_HEAP_DATA_TYPE a = pop_max_min_max_heap(&test);
+    ASSERT_EQm("[ERROR] Expected poped element to be 42.", 42, a.sub_one);
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_MAX_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = MIN_MAX_HEAP_SIZE - 1; i >= 0; --i) {
+        const MIN_MAX_HEAP_DATA_TYPE a = pop_max_min_max_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_MIN_MAX_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = (i * 7) % MIN_MAX_HEAP_SIZE, });
+    }
+
+    // popping from both ends alternately meets in the middle
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE / 2; ++i) {
+        const MIN_MAX_HEAP_DATA_TYPE a = pop_min_min_max_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped least element to be i.", i, a.sub_one);
+        const MIN_MAX_HEAP_DATA_TYPE b = pop_max_min_max_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped greatest element to be MIN_MAX_HEAP_SIZE - 1 - i.", MIN_MAX_HEAP_SIZE - 1 - i, b.sub_one);
+    }
+
+    ASSERTm("[ERROR] Expected heap to be empty.", is_empty_min_max_heap(test));
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PEEP_MIN_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    const MIN_MAX_HEAP_DATA_TYPE a = peep_min_min_max_heap(test);
+    ASSERT_EQm("[ERROR] Expected peeped element to be 42.", 42, a.sub_one);
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PEEP_MIN_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = (MIN_MAX_HEAP_SIZE - 1) - i, });
+    }
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        const MIN_MAX_HEAP_DATA_TYPE a = peep_min_min_max_heap(test);
+        ASSERT_EQm("[ERROR] Expected peeped element to be i.", i, a.sub_one);
+        pop_min_min_max_heap(&test);
+    }
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PEEP_MAX_01(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    const MIN_MAX_HEAP_DATA_TYPE a = peep_max_min_max_heap(test);
+    ASSERT_EQm("[ERROR] Expected peeped element to be 42.", 42, a.sub_one);
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PEEP_MAX_02(void) {
+    min_max_heap_s test = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        push_min_max_heap(&test, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = MIN_MAX_HEAP_SIZE - 1; i >= 0; --i) {
+        const MIN_MAX_HEAP_DATA_TYPE a = peep_max_min_max_heap(test);
+        ASSERT_EQm("[ERROR] Expected peeped element to be i.", i, a.sub_one);
+        pop_max_min_max_heap(&test);
+    }
+
+    destroy_min_max_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST MELD_01(void) {
+    min_max_heap_s one = create_min_max_heap(compare_int);
+    min_max_heap_s two = create_min_max_heap(compare_int);
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; i += 2) {
+        push_min_max_heap(&one, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i, });
+        push_min_max_heap(&two, (MIN_MAX_HEAP_DATA_TYPE) { .sub_one = i + 1, });
+    }
+
+    meld_min_max_heap(&one, &two);
+
+    ASSERT_EQm("[ERROR] Expected size to be MIN_MAX_HEAP_SIZE.", MIN_MAX_HEAP_SIZE, one.size);
+    ASSERTm("[ERROR] Expected source heap to be empty.", is_empty_min_max_heap(two));
+
+    for (int i = 0; i < MIN_MAX_HEAP_SIZE; ++i) {
+        const MIN_MAX_HEAP_DATA_TYPE a = pop_min_min_max_heap(&one);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_min_max_heap(&one, destroy_int);
+    destroy_min_max_heap(&two, destroy_int);
+
+    PASS();
+}
+
+SUITE (min_max_heap_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01); RUN_TEST(DESTROY_02);
+    // clear
+    RUN_TEST(CLEAR_01);
+    // is empty
+    RUN_TEST(IS_EMPTY_01); RUN_TEST(IS_EMPTY_02);
+    // is full
+    RUN_TEST(IS_FULL_01); RUN_TEST(IS_FULL_02);
+    // copy
+    RUN_TEST(COPY_01); RUN_TEST(COPY_02);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02);
+    // pop min
+    RUN_TEST(POP_MIN_01); RUN_TEST(POP_MIN_02);
+    // pop max
+    RUN_TEST(POP_MAX_01); RUN_TEST(POP_MAX_02);
+    // pop min and max
+    RUN_TEST(POP_MIN_MAX_01);
+    // peep min
+    RUN_TEST(PEEP_MIN_01); RUN_TEST(PEEP_MIN_02);
+    // peep max
+    RUN_TEST(PEEP_MAX_01); RUN_TEST(PEEP_MAX_02);
+    // meld
+    RUN_TEST(MELD_01);
+}
@@ -0,0 +1,245 @@
+#include <suits.h>
+
+#define MULTI_QUEUE_DATA_TYPE DATA_TYPE
+#define MULTI_QUEUE_COUNT 4
+#define BINARY_HEAP_SIZE (1 << 4)
+#include <priority/multi_queue.h>
+
+#define MULTI_QUEUE_THREADS 4
+
+TEST CREATE_01(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    ASSERT_NEQm("[ERROR] Expected shards pointer to not be NULL.", NULL, test.shards);
+    ASSERT_NEQm("[ERROR] Expected function pointer to not be NULL.", NULL, test.compare);
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CREATE_02(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    // each shard must start on its own cache line, thus shards never share one
+    ASSERT_EQm("[ERROR] Expected shard size to be a multiple of cache line size.", 0, sizeof(multi_queue_shard_s) % MULTI_QUEUE_CACHE_LINE);
+    for (multi_queue_shard_s * s = test.shards; s < test.shards + MULTI_QUEUE_COUNT; s++) {
+        ASSERT_EQm("[ERROR] Expected shard to be aligned to cache line.", 0, (uintptr_t)(s) % MULTI_QUEUE_CACHE_LINE);
+    }
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    destroy_multi_queue(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected shards pointer to be NULL.", NULL, test.shards);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST DESTROY_02(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    uint64_t seed = 0;
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_multi_queue(&test, (MULTI_QUEUE_DATA_TYPE) { .sub_one = i, }, &seed);
+    }
+
+    destroy_multi_queue(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected shards pointer to be NULL.", NULL, test.shards);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    uint64_t seed = 0;
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_multi_queue(&test, (MULTI_QUEUE_DATA_TYPE) { .sub_one = i, }, &seed);
+    }
+
+    clear_multi_queue(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected queue to be empty.", is_empty_multi_queue(test));
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_01(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    ASSERTm("[ERROR] Expected queue to be empty.", is_empty_multi_queue(test));
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_02(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    uint64_t seed = 0;
+    push_multi_queue(&test, (MULTI_QUEUE_DATA_TYPE) { .sub_one = 42, }, &seed);
+
+    ASSERT_FALSEm("[ERROR] Expected queue to not be empty.", is_empty_multi_queue(test));
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    // every shard gets filled since full shards are skipped
+    uint64_t seed = 0;
+    for (int i = 0; i < MULTI_QUEUE_COUNT * BINARY_HEAP_SIZE; ++i) {
+        push_multi_queue(&test, (MULTI_QUEUE_DATA_TYPE) { .sub_one = i, }, &seed);
+    }
+
+    for (size_t i = 0; i < MULTI_QUEUE_COUNT; ++i) {
+        ASSERTm("[ERROR] Expected shard to be full.", is_full_binary_heap(test.shards[i].heap));
+    }
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_01(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    uint64_t seed = 0;
+    push_multi_queue(&test, (MULTI_QUEUE_DATA_TYPE) { .sub_one = 42, }, &seed);
+
+    MULTI_QUEUE_DATA_TYPE a = { 0 };
+    ASSERTm("[ERROR] Expected pop to succeed.", pop_multi_queue(&test, &a, &seed));
+    ASSERT_EQm("[ERROR] Expected poped element to be 42.", 42, a.sub_one);
+    ASSERT_FALSEm("[ERROR] Expected pop from empty queue to fail.", pop_multi_queue(&test, &a, &seed));
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_02(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    uint64_t seed = 0;
+    for (int i = 0; i < MULTI_QUEUE_COUNT * BINARY_HEAP_SIZE; ++i) {
+        push_multi_queue(&test, (MULTI_QUEUE_DATA_TYPE) { .sub_one = i, }, &seed);
+    }
+
+    // pops are relaxed, thus only check that each element comes out exactly once
+    bool seen[MULTI_QUEUE_COUNT * BINARY_HEAP_SIZE] = { 0 };
+    MULTI_QUEUE_DATA_TYPE a = { 0 };
+    for (int i = 0; i < MULTI_QUEUE_COUNT * BINARY_HEAP_SIZE; ++i) {
+        ASSERTm("[ERROR] Expected pop to succeed.", pop_multi_queue(&test, &a, &seed));
+        ASSERT_FALSEm("[ERROR] Expected element to not be poped twice.", seen[a.sub_one]);
+        seen[a.sub_one] = true;
+    }
+    ASSERT_FALSEm("[ERROR] Expected pop from empty queue to fail.", pop_multi_queue(&test, &a, &seed));
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_03(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    // a lone element must be found even if it is never sampled
+    for (uint64_t s = 0; s < 64; ++s) {
+        uint64_t seed = s;
+        push_multi_queue(&test, (MULTI_QUEUE_DATA_TYPE) { .sub_one = 42, }, &seed);
+
+        MULTI_QUEUE_DATA_TYPE a = { 0 };
+        seed = s * 31;
+        ASSERTm("[ERROR] Expected pop to succeed.", pop_multi_queue(&test, &a, &seed));
+        ASSERT_EQm("[ERROR] Expected poped element to be 42.", 42, a.sub_one);
+    }
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+struct multi_queue_worker {
+    multi_queue_s * queue;
+    int offset, sum;
+};
+
+static void * push_pop_worker(void * args) {
+    struct multi_queue_worker * worker = args;
+    uint64_t seed = (uint64_t)worker->offset;
+
+    for (int i = 0; i < BINARY_HEAP_SIZE; ++i) {
+        push_multi_queue(worker->queue, (MULTI_QUEUE_DATA_TYPE) { .sub_one = worker->offset + i, }, &seed);
+    }
+
+    MULTI_QUEUE_DATA_TYPE a = { 0 };
+    for (int i = 0; i < BINARY_HEAP_SIZE / 2 && pop_multi_queue(worker->queue, &a, &seed); ++i) {
+        worker->sum += a.sub_one;
+    }
+
+    return NULL;
+}
+
+TEST CONCURRENT_01(void) {
+    multi_queue_s test = create_multi_queue(compare_int);
+
+    pthread_t threads[MULTI_QUEUE_THREADS];
+    struct multi_queue_worker workers[MULTI_QUEUE_THREADS];
+    for (int i = 0; i < MULTI_QUEUE_THREADS; ++i) {
+        workers[i] = (struct multi_queue_worker) { .queue = &test, .offset = i * BINARY_HEAP_SIZE, .sum = 0, };
+        ASSERT_EQm("[ERROR] Expected thread to be created.", 0, pthread_create(threads + i, NULL, push_pop_worker, workers + i));
+    }
+
+    int sum = 0;
+    for (int i = 0; i < MULTI_QUEUE_THREADS; ++i) {
+        pthread_join(threads[i], NULL);
+        sum += workers[i].sum;
+    }
+
+    // elements left after concurrent pops are drained, each element must come out exactly once overall
+    uint64_t seed = 0;
+    MULTI_QUEUE_DATA_TYPE a = { 0 };
+    while (pop_multi_queue(&test, &a, &seed)) {
+        sum += a.sub_one;
+    }
+
+    const int count = MULTI_QUEUE_THREADS * BINARY_HEAP_SIZE;
+    ASSERT_EQm("[ERROR] Expected sum of poped elements to be sum of pushed ones.", (count * (count - 1)) / 2, sum);
+
+    destroy_multi_queue(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (multi_queue_test) {
+    // create
+    RUN_TEST(CREATE_01); RUN_TEST(CREATE_02);
+    // destroy
+    RUN_TEST(DESTROY_01); RUN_TEST(DESTROY_02);
+    // clear
+    RUN_TEST(CLEAR_01);
+    // is empty
+    RUN_TEST(IS_EMPTY_01); RUN_TEST(IS_EMPTY_02);
+    // push
+    RUN_TEST(PUSH_01);
+    // pop
+    RUN_TEST(POP_01); RUN_TEST(POP_02); RUN_TEST(POP_03);
+    // concurrent
+    RUN_TEST(CONCURRENT_01);
+}
@@ -0,0 +1,276 @@
+#include <suits.h>
+
+#define RADIX_HEAP_DATA_TYPE DATA_TYPE
+#define RADIX_HEAP_SIZE (1 << 4)
+#include <priority/radix_heap.h>
+
+TEST CREATE_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_NEQm("[ERROR] Expected function pointer to not be NULL.", NULL, test.key);
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    destroy_radix_heap(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.key);
+
+    PASS();
+}
+
+TEST DESTROY_02(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    destroy_radix_heap(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.key);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+    pop_radix_heap(&test);
+
+    clear_radix_heap(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected heap to be empty.", is_empty_radix_heap(test));
+
+    // clear also resets last minimum, thus keys less than the popped one can be pushed again
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        const RADIX_HEAP_DATA_TYPE a = pop_radix_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    ASSERTm("[ERROR] Expected heap to be empty.", is_empty_radix_heap(test));
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_02(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    ASSERT_FALSEm("[ERROR] Expected heap to not be empty.", is_empty_radix_heap(test));
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_FULL_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    ASSERT_FALSEm("[ERROR] Expected heap to not be full.", is_full_radix_heap(test));
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_FULL_02(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+
+    ASSERTm("[ERROR] Expected heap to be full.", is_full_radix_heap(test));
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    radix_heap_s copy = copy_radix_heap(test, copy_int);
+
+    ASSERT_EQm("[ERROR] Expected sizes to be equal.", test.size, copy.size);
+    ASSERT_EQm("[ERROR] Expected key functions to be equal.", test.key, copy.key);
+
+    destroy_radix_heap(&test, destroy_int);
+    destroy_radix_heap(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_02(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = (RADIX_HEAP_SIZE - 1) - i, });
+    }
+    pop_radix_heap(&test);
+
+    radix_heap_s copy = copy_radix_heap(test, copy_int);
+
+    ASSERT_EQm("[ERROR] Expected sizes to be equal.", test.size, copy.size);
+    ASSERT_EQm("[ERROR] Expected key functions to be equal.", test.key, copy.key);
+
+    for (int i = 1; i < RADIX_HEAP_SIZE; ++i) {
+        const RADIX_HEAP_DATA_TYPE a = pop_radix_heap(&test);
+        const RADIX_HEAP_DATA_TYPE b = pop_radix_heap(&copy);
+        ASSERT_EQm("[ERROR] Expected poped elements to be equal.", a.sub_one, b.sub_one);
+    }
+
+    destroy_radix_heap(&test, destroy_int);
+    destroy_radix_heap(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    ASSERT_EQm("[ERROR] Expected size to be one.", 1, test.size);
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_02(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = (RADIX_HEAP_SIZE - 1) - i, });
+    }
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        const RADIX_HEAP_DATA_TYPE a = pop_radix_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = 42, });
+
+    const RADIX_HEAP_DATA_TYPE a = pop_radix_heap(&test);
+    ASSERT_EQm("[ERROR] Expected poped element to be 42.", 42, a.sub_one);
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST POP_02(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    // keys pushed after a pop can't be less than the popped key, but can be equal to it
+    for (int i = 0; i < RADIX_HEAP_SIZE / 2; ++i) {
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = i * 3, });
+    }
+
+    for (int i = 0; i < RADIX_HEAP_SIZE / 2; ++i) {
+        const RADIX_HEAP_DATA_TYPE a = pop_radix_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i * 3.", i * 3, a.sub_one);
+
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = a.sub_one, });
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = a.sub_one + 1, });
+
+        const RADIX_HEAP_DATA_TYPE b = pop_radix_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i * 3.", i * 3, b.sub_one);
+        const RADIX_HEAP_DATA_TYPE c = pop_radix_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i * 3 + 1.", (i * 3) + 1, c.sub_one);
+    }
+
+    ASSERTm("[ERROR] Expected heap to be empty.", is_empty_radix_heap(test));
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PEEP_01(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = RADIX_HEAP_SIZE, });
+
+    const RADIX_HEAP_DATA_TYPE a = peep_radix_heap(test);
+    ASSERT_EQm("[ERROR] Expected peeped element to be RADIX_HEAP_SIZE.", RADIX_HEAP_SIZE, a.sub_one);
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PEEP_02(void) {
+    radix_heap_s test = create_radix_heap(key_int);
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        push_radix_heap(&test, (RADIX_HEAP_DATA_TYPE) { .sub_one = (RADIX_HEAP_SIZE - 1) - i, });
+    }
+
+    for (int i = 0; i < RADIX_HEAP_SIZE; ++i) {
+        const RADIX_HEAP_DATA_TYPE a = peep_radix_heap(test);
+        ASSERT_EQm("[ERROR] Expected peeped element to be i.", i, a.sub_one);
+        pop_radix_heap(&test);
+    }
+
+    destroy_radix_heap(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (radix_heap_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01); RUN_TEST(DESTROY_02);
+    // clear
+    RUN_TEST(CLEAR_01);
+    // is empty
+    RUN_TEST(IS_EMPTY_01); RUN_TEST(IS_EMPTY_02);
+    // is full
+    RUN_TEST(IS_FULL_01); RUN_TEST(IS_FULL_02);
+    // copy
+    RUN_TEST(COPY_01); RUN_TEST(COPY_02);
+    // push
+    RUN_TEST(PUSH_01); RUN_TEST(PUSH_02);
+    // pop
+    RUN_TEST(POP_01); RUN_TEST(POP_02);
+    // peep
+    RUN_TEST(PEEP_01); RUN_TEST(PEEP_02);
+}
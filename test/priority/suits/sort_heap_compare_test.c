@@ -0,0 +1,235 @@
+#include <suits.h>
+
+#define SORT_HEAP_DATA_TYPE DATA_TYPE
+#define SORT_HEAP_SIZE (1 << 4)
+#define SORT_HEAP_COMPARE(one, two) compare_int(one, two)
+#include <priority/sort_heap.h>
+
+// sort arguments that also count how many times sort was called, compare must stay first for 'sort_int'
+struct counted {
+    struct compare compare;
+    size_t calls;
+};
+
+static void sort_counted(SORT_HEAP_DATA_TYPE * elements, const size_t size, void * args) {
+    struct counted * counted = args;
+    counted->calls++;
+    sort_int(elements, size, &(counted->compare));
+}
+
+TEST PUSH_01(void) {
+    struct counted counted = { .compare = { .function = compare_int_generic, }, .calls = 0, };
+    sort_heap_s test = create_sort_heap(sort_counted, &counted);
+
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = SORT_HEAP_SIZE + i, });
+    }
+    pop_sort_heap(&test);
+    ASSERT_EQm("[ERROR] Expected first pop to sort once.", 1, counted.calls);
+
+    // pushes after a pop wait in binary heap behind sorted run instead of invalidating it
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected waiting pushes to not sort again.", 1, counted.calls);
+
+    for (int i = 1; i < SORT_HEAP_SIZE / 2; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be size plus i.", SORT_HEAP_SIZE + i, a.sub_one);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PEEP_01(void) {
+    struct compare cmp = { .function = compare_int_generic, };
+    sort_heap_s test = create_sort_heap(sort_int, &cmp);
+
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = SORT_HEAP_SIZE + i, });
+    }
+    pop_sort_heap(&test);
+
+    push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = SORT_HEAP_SIZE + 3, });
+    push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = 0, });
+
+    const SORT_HEAP_DATA_TYPE a = peep_sort_heap(&test);
+    ASSERT_EQm("[ERROR] Expected peeped element to be 0.", 0, a.sub_one);
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REPLACE_01(void) {
+    struct compare cmp = { .function = compare_int_generic, };
+    sort_heap_s test = create_sort_heap(sort_int, &cmp);
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = i + 1, });
+    }
+    pop_sort_heap(&test);
+    push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = 1, });
+
+    // index is in sort order, thus waiting elements are sorted into run before replacing
+    const SORT_HEAP_DATA_TYPE a = replace_sort_heap(&test, 0, (SORT_HEAP_DATA_TYPE) { .sub_one = 0, });
+    ASSERT_EQm("[ERROR] Expected replaced element to be 1.", 1, a.sub_one);
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        const SORT_HEAP_DATA_TYPE b = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i == 0 ? 0 : i + 1, b.sub_one);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST MELD_01(void) {
+    struct compare cmp = { .function = compare_int_generic, };
+    sort_heap_s one = create_sort_heap(sort_int, &cmp);
+    sort_heap_s two = create_sort_heap(sort_int, &cmp);
+
+    for (int i = 0; i < SORT_HEAP_SIZE; i += 2) {
+        push_sort_heap(&one, (SORT_HEAP_DATA_TYPE) { .sub_one = i, });
+        push_sort_heap(&two, (SORT_HEAP_DATA_TYPE) { .sub_one = i + 1, });
+    }
+    pop_sort_heap(&one);
+    pop_sort_heap(&two);
+    push_sort_heap(&one, (SORT_HEAP_DATA_TYPE) { .sub_one = 0, });
+    push_sort_heap(&two, (SORT_HEAP_DATA_TYPE) { .sub_one = 1, });
+
+    meld_sort_heap(&one, &two);
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&one);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+    ASSERTm("[ERROR] Expected source to be empty.", is_empty_sort_heap(two));
+
+    destroy_sort_heap(&one, destroy_int);
+    destroy_sort_heap(&two, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    struct compare cmp = { .function = compare_int_generic, };
+    sort_heap_s test = create_sort_heap(sort_int, &cmp);
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = SORT_HEAP_SIZE - i, });
+    }
+    pop_sort_heap(&test);
+    push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = SORT_HEAP_SIZE + 1, });
+
+    sort_heap_s copy = copy_sort_heap(test, copy_int);
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        const SORT_HEAP_DATA_TYPE b = pop_sort_heap(&copy);
+        ASSERT_EQm("[ERROR] Expected poped elements to be equal.", a.sub_one, b.sub_one);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+    destroy_sort_heap(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    struct compare cmp = { .function = compare_int_generic, };
+    sort_heap_s test = create_sort_heap(sort_int, &cmp);
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = i, });
+    }
+    pop_sort_heap(&test);
+
+    clear_sort_heap(&test, destroy_int);
+
+    push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = 1, });
+    push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = 0, });
+    const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+    ASSERT_EQm("[ERROR] Expected poped element to be 0.", 0, a.sub_one);
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_POP_01(void) {
+    struct compare cmp = { .function = compare_int_generic, };
+    sort_heap_s test = create_sort_heap(sort_int, &cmp);
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = (SORT_HEAP_SIZE - 1) - i, });
+    }
+
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, a.sub_one);
+    }
+
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = (SORT_HEAP_SIZE - 1) - (2 * i), });
+    }
+
+    int previous = 0;
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        ASSERTm("[ERROR] Expected poped element to not be less than previous.", previous <= a.sub_one);
+        previous = a.sub_one;
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_POP_02(void) {
+    struct compare cmp = { .function = compare_int_generic, };
+    sort_heap_s test = create_sort_heap(sort_int, &cmp);
+
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = i, });
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = SORT_HEAP_SIZE + i, });
+
+        const SORT_HEAP_DATA_TYPE a = peep_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected peeped element to be i.", i, a.sub_one);
+        const SORT_HEAP_DATA_TYPE b = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i.", i, b.sub_one);
+    }
+
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be size plus i.", SORT_HEAP_SIZE + i, a.sub_one);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (sort_heap_compare_test) {
+    // push
+    RUN_TEST(PUSH_01);
+    // peep
+    RUN_TEST(PEEP_01);
+    // replace
+    RUN_TEST(REPLACE_01);
+    // meld
+    RUN_TEST(MELD_01);
+    // copy
+    RUN_TEST(COPY_01);
+    // clear
+    RUN_TEST(CLEAR_01);
+    // push pop
+    RUN_TEST(PUSH_POP_01); RUN_TEST(PUSH_POP_02);
+}
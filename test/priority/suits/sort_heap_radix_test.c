@@ -0,0 +1,186 @@
+#include <suits.h>
+
+#include <float.h>
+#include <math.h>
+
+// counts radix key reads, a sort reads each key once to count digits, then once per pass it performs and one key per
+// pass it checks, thus skipped passes are visible as missing reads
+static size_t radix_reads = 0;
+
+#define SORT_HEAP_DATA_TYPE DATA_TYPE
+#define SORT_HEAP_SIZE (1 << 4)
+#define SORT_HEAP_RADIX_KEY_TYPE uint32_t
+#define SORT_HEAP_RADIX_KEY(element) (radix_reads++, int32_radix_key_sort_heap((element).sub_one))
+#include <priority/sort_heap.h>
+
+#define SORT_HEAP_RADIX_DIGITS ((int)(sizeof(SORT_HEAP_RADIX_KEY_TYPE)))
+
+TEST PUSH_POP_01(void) {
+    sort_heap_s test = create_sort_heap(NULL, NULL);
+
+    // shuffled keys from negative half of size to positive half
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = ((i * 7) % SORT_HEAP_SIZE) - (SORT_HEAP_SIZE / 2), });
+    }
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be i minus half of size.", i - (SORT_HEAP_SIZE / 2), a.sub_one);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST PUSH_POP_02(void) {
+    sort_heap_s test = create_sort_heap(NULL, NULL);
+
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = INT32_MAX - i, });
+    }
+    pop_sort_heap(&test);
+
+    // pushes after a pop are prepended before current index, sort must start there
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = INT32_MIN + i, });
+    }
+
+    for (int i = 0; i < SORT_HEAP_SIZE / 2; ++i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be minimum plus i.", INT32_MIN + i, a.sub_one);
+    }
+    for (int i = (SORT_HEAP_SIZE / 2) - 2; i >= 0; --i) {
+        const SORT_HEAP_DATA_TYPE a = pop_sort_heap(&test);
+        ASSERT_EQm("[ERROR] Expected poped element to be maximum minus i.", INT32_MAX - i, a.sub_one);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST RADIX_SORT_01(void) {
+    sort_heap_s test = create_sort_heap(NULL, NULL);
+
+    // keys only differ in least significant digit, thus every other pass is skipped
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = SORT_HEAP_SIZE - 1 - i, });
+    }
+
+    radix_reads = 0;
+    radix_sort_heap(&test);
+    ASSERT_EQm("[ERROR] Expected one performed pass.", (SORT_HEAP_SIZE * 2) + SORT_HEAP_RADIX_DIGITS, (int)(radix_reads));
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i.", i, test.elements[test.current + (size_t)(i)].sub_one);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST RADIX_SORT_02(void) {
+    sort_heap_s test = create_sort_heap(NULL, NULL);
+
+    // keys differ in two digits, thus even number of passes ends in elements array instead of buffer
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = ((SORT_HEAP_SIZE - 1 - i) << 8) | i, });
+    }
+
+    radix_reads = 0;
+    radix_sort_heap(&test);
+    ASSERT_EQm("[ERROR] Expected two performed passes.", (SORT_HEAP_SIZE * 3) + SORT_HEAP_RADIX_DIGITS, (int)(radix_reads));
+
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to have high digit i.", i, test.elements[test.current + (size_t)(i)].sub_one >> 8);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST RADIX_SORT_03(void) {
+    sort_heap_s test = create_sort_heap(NULL, NULL);
+
+    // negative and positive keys differ in every digit, thus no pass is skipped
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = (i % 2) ? i : -i, });
+    }
+
+    radix_reads = 0;
+    radix_sort_heap(&test);
+    ASSERT_EQm("[ERROR] Expected every pass to be performed.", SORT_HEAP_SIZE + ((SORT_HEAP_SIZE + 1) * SORT_HEAP_RADIX_DIGITS), (int)(radix_reads));
+
+    for (int i = 1; i < SORT_HEAP_SIZE; ++i) {
+        ASSERTm("[ERROR] Expected elements to be sorted.", test.elements[test.current + (size_t)(i) - 1].sub_one <= test.elements[test.current + (size_t)(i)].sub_one);
+    }
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST RADIX_SORT_04(void) {
+    sort_heap_s test = create_sort_heap(NULL, NULL);
+
+    // equal keys skip every pass
+    for (int i = 0; i < SORT_HEAP_SIZE; ++i) {
+        push_sort_heap(&test, (SORT_HEAP_DATA_TYPE) { .sub_one = -42, });
+    }
+
+    radix_reads = 0;
+    radix_sort_heap(&test);
+    ASSERT_EQm("[ERROR] Expected no performed pass.", SORT_HEAP_SIZE + SORT_HEAP_RADIX_DIGITS, (int)(radix_reads));
+
+    destroy_sort_heap(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INT32_KEY_01(void) {
+    const int32_t keys[] = { INT32_MIN, INT32_MIN + 1, -256, -1, 0, 1, 256, INT32_MAX - 1, INT32_MAX, };
+    for (size_t i = 1; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+        ASSERTm("[ERROR] Expected radix keys to keep order.", int32_radix_key_sort_heap(keys[i - 1]) < int32_radix_key_sort_heap(keys[i]));
+    }
+
+    PASS();
+}
+
+TEST INT64_KEY_01(void) {
+    const int64_t keys[] = { INT64_MIN, INT64_MIN + 1, INT32_MIN, -1, 0, 1, INT32_MAX, INT64_MAX - 1, INT64_MAX, };
+    for (size_t i = 1; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+        ASSERTm("[ERROR] Expected radix keys to keep order.", int64_radix_key_sort_heap(keys[i - 1]) < int64_radix_key_sort_heap(keys[i]));
+    }
+
+    PASS();
+}
+
+TEST FLOAT_KEY_01(void) {
+    const float keys[] = { -INFINITY, -FLT_MAX, -1.5f, -1.0f, -FLT_MIN, -0.0f, 0.0f, FLT_MIN, 1.0f, 1.5f, FLT_MAX, INFINITY, };
+    for (size_t i = 1; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+        ASSERTm("[ERROR] Expected radix keys to keep order.", float_radix_key_sort_heap(keys[i - 1]) < float_radix_key_sort_heap(keys[i]));
+    }
+
+    PASS();
+}
+
+TEST DOUBLE_KEY_01(void) {
+    const double keys[] = { -INFINITY, -DBL_MAX, -1.5, -1.0, -DBL_MIN, -0.0, 0.0, DBL_MIN, 1.0, 1.5, DBL_MAX, INFINITY, };
+    for (size_t i = 1; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+        ASSERTm("[ERROR] Expected radix keys to keep order.", double_radix_key_sort_heap(keys[i - 1]) < double_radix_key_sort_heap(keys[i]));
+    }
+
+    PASS();
+}
+
+SUITE (sort_heap_radix_test) {
+    // push pop
+    RUN_TEST(PUSH_POP_01); RUN_TEST(PUSH_POP_02);
+    // radix sort
+    RUN_TEST(RADIX_SORT_01); RUN_TEST(RADIX_SORT_02); RUN_TEST(RADIX_SORT_03); RUN_TEST(RADIX_SORT_04);
+    // radix keys
+    RUN_TEST(INT32_KEY_01); RUN_TEST(INT64_KEY_01); RUN_TEST(FLOAT_KEY_01); RUN_TEST(DOUBLE_KEY_01);
+}
@@ -0,0 +1,395 @@
+#include <suits.h>
+
+#define TIMER_WHEEL_DATA_TYPE DATA_TYPE
+#define TIMER_WHEEL_SIZE (1 << 4)
+#define TIMER_WHEEL_SLOT_BITS 2
+#define TIMER_WHEEL_LEVELS 2
+#include <priority/timer_wheel.h>
+
+TEST CREATE_01(void) {
+    timer_wheel_s test = create_timer_wheel(42);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected current tick to be 42.", 42, test.current);
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+
+    PASS();
+}
+
+TEST DESTROY_02(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        schedule_timer_wheel(&test, (size_t)(i * 7), (TIMER_WHEEL_DATA_TYPE) { .sub_one = i, });
+    }
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        schedule_timer_wheel(&test, (size_t)(i * 7), (TIMER_WHEEL_DATA_TYPE) { .sub_one = i, });
+    }
+
+    clear_timer_wheel(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected wheel to be empty.", is_empty_timer_wheel(test));
+
+    int sum = 0;
+    advance_timer_wheel(&test, TIMER_WHEEL_SIZE * 7, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected no timer to expire.", 0, sum);
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CLEAR_02(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    const size_t handle = schedule_timer_wheel(&test, 42, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+    clear_timer_wheel(&test, destroy_int);
+
+    // cleared timer's slot is reused, but its old handle must stay stale
+    const size_t reused = schedule_timer_wheel(&test, 42, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+    ASSERT_NEQm("[ERROR] Expected reused timer to get a new handle.", handle, reused);
+    ASSERT_FALSEm("[ERROR] Expected cleared handle to not be scheduled.", is_scheduled_timer_wheel(test, handle));
+    ASSERTm("[ERROR] Expected reused timer to be scheduled.", is_scheduled_timer_wheel(test, reused));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_01(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    ASSERTm("[ERROR] Expected wheel to be empty.", is_empty_timer_wheel(test));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_02(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    schedule_timer_wheel(&test, 42, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+
+    ASSERT_FALSEm("[ERROR] Expected wheel to not be empty.", is_empty_timer_wheel(test));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_FULL_01(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    ASSERT_FALSEm("[ERROR] Expected wheel to not be full.", is_full_timer_wheel(test));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_FULL_02(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        schedule_timer_wheel(&test, (size_t)(i), (TIMER_WHEEL_DATA_TYPE) { .sub_one = i, });
+    }
+
+    ASSERTm("[ERROR] Expected wheel to be full.", is_full_timer_wheel(test));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    timer_wheel_s copy = copy_timer_wheel(test, copy_int);
+
+    ASSERT_EQm("[ERROR] Expected sizes to be equal.", test.size, copy.size);
+    ASSERT_EQm("[ERROR] Expected current ticks to be equal.", test.current, copy.current);
+
+    destroy_timer_wheel(&test, destroy_int);
+    destroy_timer_wheel(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_02(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        schedule_timer_wheel(&test, (size_t)(i * 7), (TIMER_WHEEL_DATA_TYPE) { .sub_one = i, });
+    }
+
+    timer_wheel_s copy = copy_timer_wheel(test, copy_int);
+
+    ASSERT_EQm("[ERROR] Expected sizes to be equal.", test.size, copy.size);
+
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        int a = 0, b = 0;
+        advance_timer_wheel(&test, (size_t)(i * 7), expire_int, &a);
+        advance_timer_wheel(&copy, (size_t)(i * 7), expire_int, &b);
+        ASSERT_EQm("[ERROR] Expected expired elements to be equal.", a, b);
+    }
+
+    destroy_timer_wheel(&test, destroy_int);
+    destroy_timer_wheel(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST SCHEDULE_01(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    const size_t handle = schedule_timer_wheel(&test, 42, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+
+    ASSERT_EQm("[ERROR] Expected size to be one.", 1, test.size);
+    ASSERTm("[ERROR] Expected timer to be scheduled.", is_scheduled_timer_wheel(test, handle));
+    ASSERT_EQm("[ERROR] Expected deadline to be 42.", 42, get_deadline_timer_wheel(test, handle));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SCHEDULE_02(void) {
+    timer_wheel_s test = create_timer_wheel(42);
+
+    // passed deadline is moved to current tick
+    const size_t handle = schedule_timer_wheel(&test, 0, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+    ASSERT_EQm("[ERROR] Expected deadline to be 42.", 42, get_deadline_timer_wheel(test, handle));
+
+    int sum = 0;
+    advance_timer_wheel(&test, 42, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected timer to expire.", 42, sum);
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CANCEL_01(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    const size_t handle = schedule_timer_wheel(&test, 42, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+
+    const TIMER_WHEEL_DATA_TYPE a = cancel_timer_wheel(&test, handle);
+    ASSERT_EQm("[ERROR] Expected cancelled element to be 42.", 42, a.sub_one);
+    ASSERT_FALSEm("[ERROR] Expected timer to not be scheduled.", is_scheduled_timer_wheel(test, handle));
+
+    int sum = 0;
+    advance_timer_wheel(&test, 42, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected no timer to expire.", 0, sum);
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CANCEL_02(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    size_t handles[TIMER_WHEEL_SIZE] = { 0 };
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        handles[i] = schedule_timer_wheel(&test, (size_t)(i * 7), (TIMER_WHEEL_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < TIMER_WHEEL_SIZE; i += 2) {
+        cancel_timer_wheel(&test, handles[i]);
+    }
+
+    int sum = 0;
+    advance_timer_wheel(&test, TIMER_WHEEL_SIZE * 7, expire_int, &sum);
+
+    int expected = 0;
+    for (int i = 1; i < TIMER_WHEEL_SIZE; i += 2) {
+        expected += i;
+    }
+    ASSERT_EQm("[ERROR] Expected only odd timers to expire.", expected, sum);
+    ASSERTm("[ERROR] Expected wheel to be empty.", is_empty_timer_wheel(test));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CANCEL_03(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    const size_t stale = schedule_timer_wheel(&test, 42, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+    cancel_timer_wheel(&test, stale);
+
+    // freed timers are reused last in first out, thus next timer takes cancelled one's slot with a new generation
+    const size_t handle = schedule_timer_wheel(&test, 7, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 7, });
+    ASSERT_NEQm("[ERROR] Expected reused timer to get a new handle.", stale, handle);
+    ASSERT_FALSEm("[ERROR] Expected stale handle to not be scheduled.", is_scheduled_timer_wheel(test, stale));
+    ASSERTm("[ERROR] Expected new timer to be scheduled.", is_scheduled_timer_wheel(test, handle));
+    ASSERT_EQm("[ERROR] Expected deadline to be 7.", 7, get_deadline_timer_wheel(test, handle));
+
+    const TIMER_WHEEL_DATA_TYPE a = cancel_timer_wheel(&test, handle);
+    ASSERT_EQm("[ERROR] Expected cancelled element to be 7.", 7, a.sub_one);
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST ADVANCE_01(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    schedule_timer_wheel(&test, 42, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+
+    int sum = 0;
+    advance_timer_wheel(&test, 41, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected no timer to expire before deadline.", 0, sum);
+
+    advance_timer_wheel(&test, 42, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected timer to expire at deadline.", 42, sum);
+    ASSERTm("[ERROR] Expected wheel to be empty.", is_empty_timer_wheel(test));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST ADVANCE_02(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    // deadlines are beyond every level of the wheel and wait in overflow list
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        schedule_timer_wheel(&test, (size_t)(1000 + (i * 37)), (TIMER_WHEEL_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        int sum = 0;
+        advance_timer_wheel(&test, (size_t)(1000 + (i * 37)) - 1, expire_int, &sum);
+        ASSERT_EQm("[ERROR] Expected no timer to expire before deadline.", 0, sum);
+
+        sum = -1;
+        advance_timer_wheel(&test, (size_t)(1000 + (i * 37)), expire_int, &sum);
+        ASSERT_EQm("[ERROR] Expected timer i to expire at deadline.", i - 1, sum);
+    }
+
+    ASSERTm("[ERROR] Expected wheel to be empty.", is_empty_timer_wheel(test));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST ADVANCE_03(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    for (int i = 0; i < TIMER_WHEEL_SIZE; ++i) {
+        schedule_timer_wheel(&test, (size_t)(i % 3), (TIMER_WHEEL_DATA_TYPE) { .sub_one = 1, });
+    }
+
+    int sum = 0;
+    advance_timer_wheel(&test, 0, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected every timer with deadline zero to expire.", (TIMER_WHEEL_SIZE + 2) / 3, sum);
+
+    sum = 0;
+    advance_timer_wheel(&test, 2, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected remaining timers to expire.", TIMER_WHEEL_SIZE - ((TIMER_WHEEL_SIZE + 2) / 3), sum);
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+struct reschedule {
+    timer_wheel_s * wheel;
+    int sum;
+};
+
+// schedules a decremented element, which reuses the just expired timer, and only then reads the expired element
+static void expire_reschedule(TIMER_WHEEL_DATA_TYPE * element, void * args) {
+    struct reschedule * reschedule = args;
+    if (element->sub_one) {
+        schedule_timer_wheel(reschedule->wheel, reschedule->wheel->current, (TIMER_WHEEL_DATA_TYPE) { .sub_one = element->sub_one - 1, });
+    }
+    reschedule->sum += element->sub_one;
+}
+
+TEST ADVANCE_05(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    const size_t stale = schedule_timer_wheel(&test, 1, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 1, });
+
+    int sum = 0;
+    advance_timer_wheel(&test, 1, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected timer to expire.", 1, sum);
+
+    // expired timer's slot is reused, thus its stale handle must not match the new timer
+    const size_t handle = schedule_timer_wheel(&test, 42, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 42, });
+    ASSERT_FALSEm("[ERROR] Expected expired handle to not be scheduled.", is_scheduled_timer_wheel(test, stale));
+    ASSERTm("[ERROR] Expected new timer to be scheduled.", is_scheduled_timer_wheel(test, handle));
+
+    advance_timer_wheel(&test, 42, expire_int, &sum);
+    ASSERT_EQm("[ERROR] Expected new timer to expire.", 1 + 42, sum);
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+TEST ADVANCE_04(void) {
+    timer_wheel_s test = create_timer_wheel(0);
+
+    schedule_timer_wheel(&test, 1, (TIMER_WHEEL_DATA_TYPE) { .sub_one = 3, });
+
+    struct reschedule reschedule = { .wheel = &test, .sum = 0, };
+    advance_timer_wheel(&test, 10, expire_reschedule, &reschedule);
+
+    ASSERT_EQm("[ERROR] Expected expired element to survive reuse of its timer.", 3 + 2 + 1, reschedule.sum);
+    ASSERTm("[ERROR] Expected wheel to be empty.", is_empty_timer_wheel(test));
+
+    destroy_timer_wheel(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (timer_wheel_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01); RUN_TEST(DESTROY_02);
+    // clear
+    RUN_TEST(CLEAR_01); RUN_TEST(CLEAR_02);
+    // is empty
+    RUN_TEST(IS_EMPTY_01); RUN_TEST(IS_EMPTY_02);
+    // is full
+    RUN_TEST(IS_FULL_01); RUN_TEST(IS_FULL_02);
+    // copy
+    RUN_TEST(COPY_01); RUN_TEST(COPY_02);
+    // schedule
+    RUN_TEST(SCHEDULE_01); RUN_TEST(SCHEDULE_02);
+    // cancel
+    RUN_TEST(CANCEL_01); RUN_TEST(CANCEL_02); RUN_TEST(CANCEL_03);
+    // advance
+    RUN_TEST(ADVANCE_01); RUN_TEST(ADVANCE_02); RUN_TEST(ADVANCE_03); RUN_TEST(ADVANCE_04); RUN_TEST(ADVANCE_05);
+}
@@ -0,0 +1,20 @@
+#include <suits.h>
+
+GREATEST_MAIN_DEFS();
+
+int main(const int argc, char **argv) {
+    GREATEST_MAIN_BEGIN();
+
+    RUN_SUITE(avl_map_test);
+    RUN_SUITE(avl_tree_test);
+    RUN_SUITE(b_tree_test);
+    RUN_SUITE(bsearch_tree_test);
+    RUN_SUITE(bsearch_tree_scapegoat_test);
+    RUN_SUITE(red_black_map_test);
+    RUN_SUITE(red_black_tree_test);
+    RUN_SUITE(red_black_tree_snapshot_test);
+    RUN_SUITE(tree_compare_test);
+    RUN_SUITE(tree_index_test);
+
+    GREATEST_MAIN_END();
+}
@@ -0,0 +1,19 @@
+#ifndef SUITS_H
+#define SUITS_H
+
+#include <greatest.h>
+
+#include <helper/functions.h>
+
+SUITE_EXTERN(avl_map_test);
+SUITE_EXTERN(avl_tree_test);
+SUITE_EXTERN(b_tree_test);
+SUITE_EXTERN(bsearch_tree_test);
+SUITE_EXTERN(bsearch_tree_scapegoat_test);
+SUITE_EXTERN(red_black_map_test);
+SUITE_EXTERN(red_black_tree_test);
+SUITE_EXTERN(red_black_tree_snapshot_test);
+SUITE_EXTERN(tree_compare_test);
+SUITE_EXTERN(tree_index_test);
+
+#endif // SUITS_H
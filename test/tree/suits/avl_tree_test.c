@@ -0,0 +1,684 @@
+#include <suits.h>
+
+#define AVL_TREE_DATA_TYPE DATA_TYPE
+#define AVL_TREE_SIZE (1 << 5)
+#define AVL_TREE_ORDER_STATISTICS
+#include <tree/avl_tree.h>
+
+// returns height of node's subtree, or -1 if its parent links, balance, heights or counts are broken
+static int height(const avl_tree_s tree, const AVL_TREE_INDEX_TYPE node, const AVL_TREE_INDEX_TYPE parent) {
+    if (AVL_TREE_SIZE == node) {
+        return 0;
+    }
+
+    if (parent != tree.nodes[node].parent) {
+        return -1;
+    }
+
+    const AVL_TREE_INDEX_TYPE left_child = tree.nodes[node].child[AVL_TREE_LEFT];
+    const AVL_TREE_INDEX_TYPE right_child = tree.nodes[node].child[AVL_TREE_RIGHT];
+
+    const int left = height(tree, left_child, node);
+    const int right = height(tree, right_child, node);
+    if (left < 0 || right < 0 || left - right > 1 || right - left > 1) {
+        return -1;
+    }
+
+    const size_t count = 1 + (AVL_TREE_SIZE == left_child ? 0 : (size_t)(tree.nodes[left_child].count)) + (AVL_TREE_SIZE == right_child ? 0 : (size_t)(tree.nodes[right_child].count));
+    const int node_height = 1 + (left > right ? left : right);
+    if (count != tree.nodes[node].count || node_height != tree.heights[node]) {
+        return -1;
+    }
+
+    return node_height;
+}
+
+// checks avl properties, subtree counts, in-order sorting and cached maximum node
+static bool is_avl(const avl_tree_s tree) {
+    if (AVL_TREE_SIZE == tree.root) {
+        return !tree.size && AVL_TREE_SIZE == tree.maximum;
+    }
+
+    if (height(tree, tree.root, AVL_TREE_SIZE) < 0 || tree.size != tree.nodes[tree.root].count) {
+        return false;
+    }
+
+    int array[AVL_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_avl_tree(tree, collect_int, &cursor);
+    if (array + tree.size != cursor) {
+        return false;
+    }
+
+    for (size_t i = 1; i < tree.size; ++i) {
+        if (array[i - 1] > array[i]) {
+            return false;
+        }
+    }
+
+    return AVL_TREE_SIZE == tree.nodes[tree.maximum].child[AVL_TREE_RIGHT] && array[tree.size - 1] == tree.elements[tree.maximum].sub_one;
+}
+
+// checks if tree holds exactly the elements from low up to but excluding high
+static bool is_range(const avl_tree_s tree, const int low, const int high) {
+    int array[AVL_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_avl_tree(tree, collect_int, &cursor);
+
+    return (array + tree.size == cursor) && is_range_int(array, tree.size, low, high);
+}
+
+static avl_tree_s create_range(const int low, const int high) {
+    avl_tree_s tree = create_avl_tree(compare_int);
+    for (int i = low; i < high; ++i) {
+        insert_avl_tree(&tree, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    return tree;
+}
+
+TEST CREATE_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected root to be NIL.", AVL_TREE_SIZE, test.root);
+    ASSERT_EQm("[ERROR] Expected maximum to be NIL.", AVL_TREE_SIZE, test.maximum);
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_avl_tree(test));
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CREATE_FROM_SORTED_01(void) {
+    AVL_TREE_DATA_TYPE sorted[AVL_TREE_SIZE];
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        sorted[i] = (AVL_TREE_DATA_TYPE) { .sub_one = i, };
+    }
+
+    // every size must link into a valid tree, including sizes that leave an incomplete last level
+    for (int i = 0; i <= AVL_TREE_SIZE; ++i) {
+        avl_tree_s test = create_avl_tree_from_sorted(compare_int, sorted, (size_t)(i));
+
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+        ASSERTm("[ERROR] Expected tree to hold sorted elements.", is_range(test, 0, i));
+
+        destroy_avl_tree(&test, destroy_int);
+    }
+
+    PASS();
+}
+
+TEST CREATE_FROM_SORTED_02(void) {
+    AVL_TREE_DATA_TYPE sorted[AVL_TREE_SIZE / 2];
+    for (int i = 0; i < AVL_TREE_SIZE / 2; ++i) {
+        sorted[i] = (AVL_TREE_DATA_TYPE) { .sub_one = 2 * i, };
+    }
+
+    // linked tree must stay usable for later insertions and removals
+    avl_tree_s test = create_avl_tree_from_sorted(compare_int, sorted, AVL_TREE_SIZE / 2);
+    for (int i = 0; i < AVL_TREE_SIZE / 2; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = (2 * i) + 1, });
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, AVL_TREE_SIZE));
+
+    for (int i = 0; i < AVL_TREE_SIZE; i += 2) {
+        remove_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    avl_tree_s test = create_range(0, AVL_TREE_SIZE);
+
+    destroy_avl_tree(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected elements to be NULL.", NULL, test.elements);
+    ASSERT_EQm("[ERROR] Expected nodes to be NULL.", NULL, test.nodes);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    avl_tree_s test = create_range(0, AVL_TREE_SIZE);
+
+    clear_avl_tree(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_avl_tree(test));
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+
+    insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = 42, });
+    ASSERT_EQm("[ERROR] Expected maximum to be 42.", 42, get_max_avl_tree(test).sub_one);
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    avl_tree_s test = create_range(0, AVL_TREE_SIZE);
+    avl_tree_s copy = copy_avl_tree(test, copy_int);
+
+    ASSERT_NEQm("[ERROR] Expected elements to not be shared.", test.elements, copy.elements);
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(copy));
+    ASSERTm("[ERROR] Expected copy to hold every element.", is_range(copy, 0, AVL_TREE_SIZE));
+
+    destroy_avl_tree(&test, destroy_int);
+    destroy_avl_tree(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, AVL_TREE_SIZE), });
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to be full.", is_full_avl_tree(test));
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, AVL_TREE_SIZE));
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_02(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    // ascending elements are appended after the cached maximum
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+        ASSERT_EQm("[ERROR] Expected maximum to be i.", i, get_max_avl_tree(test).sub_one);
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_03(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    // duplicates are kept
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i / 2, });
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    ASSERT_EQm("[ERROR] Expected size to be maximum.", AVL_TREE_SIZE, test.size);
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    // ascending elements with the last element as hint
+    avl_tree_cursor_s hint = rbegin_avl_tree(test);
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        hint = insert_hint_avl_tree(&test, hint, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected returned cursor to point to i.", i, hint.element->sub_one);
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, AVL_TREE_SIZE));
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_02(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    // descending elements with the first element as hint
+    avl_tree_cursor_s hint = begin_avl_tree(test);
+    for (int i = AVL_TREE_SIZE - 1; i >= 0; --i) {
+        hint = insert_hint_avl_tree(&test, hint, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected returned cursor to point to i.", i, hint.element->sub_one);
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, AVL_TREE_SIZE));
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_03(void) {
+    avl_tree_s test = create_range(0, AVL_TREE_SIZE / 2);
+
+    // wrong hints must only cost time, every element still ends up in its proper place
+    for (int i = AVL_TREE_SIZE / 2; i < AVL_TREE_SIZE; ++i) {
+        const avl_tree_cursor_s hint = seek_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, AVL_TREE_SIZE / 2), });
+        insert_hint_avl_tree(&test, hint, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, AVL_TREE_SIZE));
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_04(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    // past the end hint starts from root
+    const avl_tree_cursor_s end = { .element = NULL, .node = AVL_TREE_SIZE, };
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_hint_avl_tree(&test, end, (AVL_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, AVL_TREE_SIZE), });
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, AVL_TREE_SIZE));
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_01(void) {
+    avl_tree_s test = create_range(0, AVL_TREE_SIZE);
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        const int element = shuffle_int(i, AVL_TREE_SIZE);
+        const AVL_TREE_DATA_TYPE removed = remove_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = element, });
+        ASSERT_EQm("[ERROR] Expected removed element to be equal.", element, removed.sub_one);
+        ASSERT_FALSEm("[ERROR] Expected element to not be contained.", test.size && contains_avl_tree(test, removed));
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_avl_tree(test));
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_MIN_01(void) {
+    avl_tree_s test = create_range(0, AVL_TREE_SIZE);
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected minimum to be i.", i, get_min_avl_tree(test).sub_one);
+        ASSERT_EQm("[ERROR] Expected removed minimum to be i.", i, remove_min_avl_tree(&test).sub_one);
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_MAX_01(void) {
+    avl_tree_s test = create_range(0, AVL_TREE_SIZE);
+
+    // cached maximum must move to predecessor
+    for (int i = AVL_TREE_SIZE - 1; i >= 0; --i) {
+        ASSERT_EQm("[ERROR] Expected maximum to be i.", i, get_max_avl_tree(test).sub_one);
+        ASSERT_EQm("[ERROR] Expected removed maximum to be i.", i, remove_max_avl_tree(&test).sub_one);
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CONTAINS_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    for (int i = 0; i < AVL_TREE_SIZE; i += 2) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected only even elements to be contained.", !(i % 2), contains_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SELECT_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, AVL_TREE_SIZE), });
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected selected element to be i.", i, select_avl_tree(test, (size_t)(i)).sub_one);
+    }
+
+    // counts must follow removals
+    for (int i = 0; i < AVL_TREE_SIZE; i += 2) {
+        remove_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE / 2; ++i) {
+        ASSERT_EQm("[ERROR] Expected selected element to be i-th odd number.", (2 * i) + 1, select_avl_tree(test, (size_t)(i)).sub_one);
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST RANK_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    for (int i = 0; i < AVL_TREE_SIZE; i += 2) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    // rank is the number of lesser elements, even for elements not in tree
+    for (int i = -1; i <= AVL_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected rank to be number of lesser even elements.", (size_t)((i + 1) / 2), rank_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST RANK_02(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected rank in empty tree to be zero.", 0, rank_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = 0, }));
+
+    // rank of duplicates is the index of the first one, thus select of rank returns element
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i / 4, });
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE / 4; ++i) {
+        const size_t rank = rank_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected rank to be four times i.", (size_t)(4 * i), rank);
+        ASSERT_EQm("[ERROR] Expected selected element to be i.", i, select_avl_tree(test, rank).sub_one);
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CURSOR_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected begin of empty tree to be past the end.", NULL, begin_avl_tree(test).element);
+    ASSERT_EQm("[ERROR] Expected rbegin of empty tree to be past the end.", NULL, rbegin_avl_tree(test).element);
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, AVL_TREE_SIZE), });
+    }
+
+    int i = 0;
+    for (avl_tree_cursor_s c = begin_avl_tree(test); c.element; c = next_avl_tree(test, c)) {
+        ASSERT_EQm("[ERROR] Expected cursor element to be i.", i++, c.element->sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", AVL_TREE_SIZE, i);
+
+    for (avl_tree_cursor_s c = rbegin_avl_tree(test); c.element; c = prev_avl_tree(test, c)) {
+        ASSERT_EQm("[ERROR] Expected cursor element to be i.", --i, c.element->sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", 0, i);
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SEEK_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    for (int i = 0; i < AVL_TREE_SIZE; i += 2) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE - 1; ++i) {
+        const avl_tree_cursor_s c = seek_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected seeked element to be least even not below i.", i + (i % 2), c.element->sub_one);
+    }
+
+    const avl_tree_cursor_s end = seek_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = AVL_TREE_SIZE, });
+    ASSERT_EQm("[ERROR] Expected cursor to be past the end.", NULL, end.element);
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST JOIN_01(void) {
+    avl_tree_s destination = create_range(0, AVL_TREE_SIZE / 4);
+    avl_tree_s source = create_range(AVL_TREE_SIZE / 4, AVL_TREE_SIZE);
+
+    // source is greater and taller than destination
+    join_avl_tree(&destination, &source);
+
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(destination));
+    ASSERTm("[ERROR] Expected destination to hold every element.", is_range(destination, 0, AVL_TREE_SIZE));
+    ASSERTm("[ERROR] Expected source to be empty.", is_empty_avl_tree(source));
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(source));
+
+    destroy_avl_tree(&destination, destroy_int);
+    destroy_avl_tree(&source, destroy_int);
+
+    PASS();
+}
+
+TEST JOIN_02(void) {
+    avl_tree_s destination = create_range(AVL_TREE_SIZE / 4, AVL_TREE_SIZE);
+    avl_tree_s source = create_range(0, AVL_TREE_SIZE / 4);
+
+    // source is lesser and shorter than destination
+    join_avl_tree(&destination, &source);
+
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(destination));
+    ASSERTm("[ERROR] Expected destination to hold every element.", is_range(destination, 0, AVL_TREE_SIZE));
+    ASSERTm("[ERROR] Expected source to be empty.", is_empty_avl_tree(source));
+
+    destroy_avl_tree(&destination, destroy_int);
+    destroy_avl_tree(&source, destroy_int);
+
+    PASS();
+}
+
+TEST JOIN_03(void) {
+    for (int i = 0; i <= AVL_TREE_SIZE; ++i) {
+        avl_tree_s destination = create_range(0, i);
+        avl_tree_s source = create_range(i, AVL_TREE_SIZE);
+
+        // every split point, including empty destination and empty source
+        join_avl_tree(&destination, &source);
+
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(destination));
+        ASSERTm("[ERROR] Expected destination to hold every element.", is_range(destination, 0, AVL_TREE_SIZE));
+
+        destroy_avl_tree(&destination, destroy_int);
+        destroy_avl_tree(&source, destroy_int);
+    }
+
+    PASS();
+}
+
+TEST SPLIT_01(void) {
+    for (int i = -1; i <= AVL_TREE_SIZE; ++i) {
+        avl_tree_s test = create_range(0, AVL_TREE_SIZE);
+
+        // split returns elements not less than i and leaves the lesser ones
+        avl_tree_s split = split_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+        const int pivot = i < 0 ? 0 : i;
+
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(split));
+        ASSERTm("[ERROR] Expected tree to hold lesser elements.", is_range(test, 0, pivot));
+        ASSERTm("[ERROR] Expected split to hold greater elements.", is_range(split, pivot, AVL_TREE_SIZE));
+
+        // joining both parts back must restore the tree
+        join_avl_tree(&test, &split);
+        ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+        ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, AVL_TREE_SIZE));
+
+        destroy_avl_tree(&test, destroy_int);
+        destroy_avl_tree(&split, destroy_int);
+    }
+
+    PASS();
+}
+
+TEST SET_01(void) {
+    avl_tree_s one = create_avl_tree(compare_int);
+    avl_tree_s two = create_avl_tree(compare_int);
+
+    // one holds multiples of two and two holds multiples of three
+    for (int i = 0; i < AVL_TREE_SIZE / 2; ++i) {
+        insert_avl_tree(&one, (AVL_TREE_DATA_TYPE) { .sub_one = 2 * i, });
+        if (i < AVL_TREE_SIZE / 3) {
+            insert_avl_tree(&two, (AVL_TREE_DATA_TYPE) { .sub_one = 3 * i, });
+        }
+    }
+
+    avl_tree_s tree_union = union_avl_tree(one, two, copy_int);
+    avl_tree_s tree_intersect = intersect_avl_tree(one, two, copy_int);
+    avl_tree_s tree_subtract = subtract_avl_tree(one, two, copy_int);
+    avl_tree_s tree_exclude = exclude_avl_tree(one, two, copy_int);
+
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(tree_union));
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(tree_intersect));
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(tree_subtract));
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(tree_exclude));
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        const AVL_TREE_DATA_TYPE element = { .sub_one = i, };
+        const bool in_one = !(i % 2) && i < 2 * (AVL_TREE_SIZE / 2), in_two = !(i % 3) && i < 3 * (AVL_TREE_SIZE / 3);
+
+        ASSERT_EQm("[ERROR] Expected union to hold elements in either tree.", in_one || in_two, contains_avl_tree(tree_union, element));
+        ASSERT_EQm("[ERROR] Expected intersect to hold elements in both trees.", in_one && in_two, contains_avl_tree(tree_intersect, element));
+        ASSERT_EQm("[ERROR] Expected subtract to hold elements only in first tree.", in_one && !in_two, contains_avl_tree(tree_subtract, element));
+        ASSERT_EQm("[ERROR] Expected exclude to hold elements in exactly one tree.", in_one != in_two, contains_avl_tree(tree_exclude, element));
+    }
+
+    destroy_avl_tree(&one, destroy_int);
+    destroy_avl_tree(&two, destroy_int);
+    destroy_avl_tree(&tree_union, destroy_int);
+    destroy_avl_tree(&tree_intersect, destroy_int);
+    destroy_avl_tree(&tree_subtract, destroy_int);
+    destroy_avl_tree(&tree_exclude, destroy_int);
+
+    PASS();
+}
+
+TEST SET_02(void) {
+    avl_tree_s one = create_range(0, AVL_TREE_SIZE / 2);
+    avl_tree_s two = create_avl_tree(compare_int);
+
+    // operations with an empty tree
+    avl_tree_s tree_union = union_avl_tree(one, two, copy_int);
+    avl_tree_s tree_intersect = intersect_avl_tree(one, two, copy_int);
+    avl_tree_s tree_subtract = subtract_avl_tree(two, one, copy_int);
+    avl_tree_s tree_exclude = exclude_avl_tree(two, one, copy_int);
+
+    ASSERTm("[ERROR] Expected union to be first tree.", is_range(tree_union, 0, AVL_TREE_SIZE / 2));
+    ASSERTm("[ERROR] Expected intersect to be empty.", is_empty_avl_tree(tree_intersect));
+    ASSERTm("[ERROR] Expected subtract to be empty.", is_empty_avl_tree(tree_subtract));
+    ASSERTm("[ERROR] Expected exclude to be first tree.", is_range(tree_exclude, 0, AVL_TREE_SIZE / 2));
+
+    destroy_avl_tree(&one, destroy_int);
+    destroy_avl_tree(&two, destroy_int);
+    destroy_avl_tree(&tree_union, destroy_int);
+    destroy_avl_tree(&tree_intersect, destroy_int);
+    destroy_avl_tree(&tree_subtract, destroy_int);
+    destroy_avl_tree(&tree_exclude, destroy_int);
+
+    PASS();
+}
+
+TEST COMPACT_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, AVL_TREE_SIZE), });
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE; i += 2) {
+        remove_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    // after compaction each element's array index is its in-order position
+    compact_avl_tree(&test);
+
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+    for (size_t i = 0; i < test.size; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i-th odd number.", (int)(2 * i + 1), test.elements[i].sub_one);
+    }
+
+    insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = 0, });
+    ASSERTm("[ERROR] Expected valid avl tree.", is_avl(test));
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST TRAVERSE_01(void) {
+    avl_tree_s test = create_range(0, AVL_TREE_SIZE);
+
+    // every traversal visits each element once
+    int array[AVL_TREE_SIZE] = { 0 }, * cursor = array;
+    preorder_avl_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected preorder to visit every element.", AVL_TREE_SIZE, (int)(cursor - array));
+
+    cursor = array;
+    postorder_avl_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected postorder to visit every element.", AVL_TREE_SIZE, (int)(cursor - array));
+
+    cursor = array;
+    level_order_avl_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected level order to visit every element.", AVL_TREE_SIZE, (int)(cursor - array));
+    ASSERT_EQm("[ERROR] Expected level order to start at root.", test.elements[test.root].sub_one, array[0]);
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (avl_tree_test) {
+    // create
+    RUN_TEST(CREATE_01); RUN_TEST(CREATE_FROM_SORTED_01); RUN_TEST(CREATE_FROM_SORTED_02);
+    // destroy, clear and copy
+    RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01); RUN_TEST(COPY_01);
+    // insert
+    RUN_TEST(INSERT_01); RUN_TEST(INSERT_02); RUN_TEST(INSERT_03);
+    RUN_TEST(INSERT_HINT_01); RUN_TEST(INSERT_HINT_02); RUN_TEST(INSERT_HINT_03); RUN_TEST(INSERT_HINT_04);
+    // remove
+    RUN_TEST(REMOVE_01); RUN_TEST(REMOVE_MIN_01); RUN_TEST(REMOVE_MAX_01);
+    // search
+    RUN_TEST(CONTAINS_01);
+    // select and rank
+    RUN_TEST(SELECT_01); RUN_TEST(RANK_01); RUN_TEST(RANK_02);
+    // cursor
+    RUN_TEST(CURSOR_01); RUN_TEST(SEEK_01);
+    // join and split
+    RUN_TEST(JOIN_01); RUN_TEST(JOIN_02); RUN_TEST(JOIN_03); RUN_TEST(SPLIT_01);
+    // set operations
+    RUN_TEST(SET_01); RUN_TEST(SET_02);
+    // compact
+    RUN_TEST(COMPACT_01);
+    // traverse
+    RUN_TEST(TRAVERSE_01);
+}
@@ -0,0 +1,446 @@
+#include <suits.h>
+
+#define B_TREE_DATA_TYPE DATA_TYPE
+#define B_TREE_SIZE (1 << 6)
+#define B_TREE_NODE_SIZE 4
+#include <tree/b_tree.h>
+
+// 7 and B_TREE_SIZE are coprime, thus '(i * 7) % B_TREE_SIZE' visits every element once in shuffled order
+#define B_TREE_STRIDE 7
+
+TEST CREATE_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected height to be zero.", 0, test.height);
+    ASSERT_NEQm("[ERROR] Expected function pointer to not be NULL.", NULL, test.compare);
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    destroy_b_tree(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+    ASSERT_EQm("[ERROR] Expected leaves to be NULL.", NULL, test.leaves);
+    ASSERT_EQm("[ERROR] Expected branches to be NULL.", NULL, test.branches);
+
+    PASS();
+}
+
+TEST DESTROY_02(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    destroy_b_tree(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    clear_b_tree(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_b_tree(test));
+
+    // every node must be free again, thus a full tree fits after clearing
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+    ASSERTm("[ERROR] Expected tree to be full.", is_full_b_tree(test));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_b_tree(test));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_EMPTY_02(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = 42, });
+
+    ASSERT_FALSEm("[ERROR] Expected tree to not be empty.", is_empty_b_tree(test));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_FULL_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    ASSERT_FALSEm("[ERROR] Expected tree to not be full.", is_full_b_tree(test));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST IS_FULL_02(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    ASSERTm("[ERROR] Expected tree to be full.", is_full_b_tree(test));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    b_tree_s copy = copy_b_tree(test, copy_int);
+
+    ASSERT_EQm("[ERROR] Expected sizes to be equal.", test.size, copy.size);
+    ASSERT_EQm("[ERROR] Expected compare functions to be equal.", test.compare, copy.compare);
+
+    destroy_b_tree(&test, destroy_int);
+    destroy_b_tree(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_02(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = (i * B_TREE_STRIDE) % B_TREE_SIZE, });
+    }
+
+    b_tree_s copy = copy_b_tree(test, copy_int);
+
+    ASSERT_EQm("[ERROR] Expected sizes to be equal.", test.size, copy.size);
+    ASSERT_EQm("[ERROR] Expected heights to be equal.", test.height, copy.height);
+
+    // copy must stay searchable after removing from the original
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        remove_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        ASSERTm("[ERROR] Expected copy to contain element.", contains_b_tree(copy, (B_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_b_tree(&test, destroy_int);
+    destroy_b_tree(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = 42, });
+
+    ASSERT_EQm("[ERROR] Expected size to be one.", 1, test.size);
+    ASSERTm("[ERROR] Expected tree to contain element.", contains_b_tree(test, (B_TREE_DATA_TYPE) { .sub_one = 42, }));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_02(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = (i * B_TREE_STRIDE) % B_TREE_SIZE, });
+    }
+
+    ASSERT_NEQm("[ERROR] Expected leaves to be split into branches.", 0, test.height);
+
+    int array[B_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_b_tree(test, collect_int, &cursor);
+
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", B_TREE_SIZE, cursor - array);
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected elements to be sorted.", i, array[i]);
+    }
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_03(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = B_TREE_SIZE - 1; i >= 0; --i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i / 2, });
+    }
+
+    int array[B_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_b_tree(test, collect_int, &cursor);
+
+    ASSERT_EQm("[ERROR] Expected duplicates to be kept.", B_TREE_SIZE, cursor - array);
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected elements to be sorted.", i / 2, array[i]);
+    }
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = 42, });
+
+    const B_TREE_DATA_TYPE a = remove_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = 42, });
+    ASSERT_EQm("[ERROR] Expected removed element to be 42.", 42, a.sub_one);
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_b_tree(test));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_02(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        const B_TREE_DATA_TYPE a = remove_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, a.sub_one);
+
+        if (!is_empty_b_tree(test)) {
+            ASSERT_EQm("[ERROR] Expected minimum to be next element.", i + 1, get_min_b_tree(test).sub_one);
+        }
+    }
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_b_tree(test));
+    ASSERT_EQm("[ERROR] Expected height to be zero.", 0, test.height);
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_03(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = B_TREE_SIZE - 1; i >= 0; --i) {
+        const B_TREE_DATA_TYPE a = remove_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, a.sub_one);
+
+        if (!is_empty_b_tree(test)) {
+            ASSERT_EQm("[ERROR] Expected maximum to be previous element.", i - 1, get_max_b_tree(test).sub_one);
+        }
+    }
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_b_tree(test));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_04(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    // remove in shuffled order to borrow from and merge with both siblings
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        const int removed = (i * B_TREE_STRIDE) % B_TREE_SIZE;
+        remove_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = removed, });
+
+        int array[B_TREE_SIZE] = { 0 }, * cursor = array;
+        inorder_b_tree(test, collect_int, &cursor);
+
+        ASSERT_EQm("[ERROR] Expected size to shrink by one.", (size_t)(B_TREE_SIZE - i - 1), test.size);
+        ASSERT_EQm("[ERROR] Expected every remaining element to be visited.", (long)(test.size), (long)(cursor - array));
+        for (int j = 1; j < cursor - array; ++j) {
+            ASSERTm("[ERROR] Expected elements to be sorted.", array[j - 1] < array[j]);
+        }
+        for (int j = 0; j < cursor - array; ++j) {
+            ASSERTm("[ERROR] Expected remaining element to be found.", contains_b_tree(test, (B_TREE_DATA_TYPE) { .sub_one = array[j], }));
+        }
+    }
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CONTAINS_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    ASSERT_FALSEm("[ERROR] Expected empty tree to not contain element.", contains_b_tree(test, (B_TREE_DATA_TYPE) { .sub_one = 42, }));
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CONTAINS_02(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = i * 2, });
+    }
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        ASSERTm("[ERROR] Expected tree to contain even element.", contains_b_tree(test, (B_TREE_DATA_TYPE) { .sub_one = i * 2, }));
+        ASSERT_FALSEm("[ERROR] Expected tree to not contain odd element.", contains_b_tree(test, (B_TREE_DATA_TYPE) { .sub_one = (i * 2) + 1, }));
+    }
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST GET_MIN_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = (i * B_TREE_STRIDE) % B_TREE_SIZE, });
+    }
+
+    ASSERT_EQm("[ERROR] Expected minimum to be zero.", 0, get_min_b_tree(test).sub_one);
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST GET_MAX_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = (i * B_TREE_STRIDE) % B_TREE_SIZE, });
+    }
+
+    ASSERT_EQm("[ERROR] Expected maximum to be B_TREE_SIZE - 1.", B_TREE_SIZE - 1, get_max_b_tree(test).sub_one);
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST FOREACH_RANGE_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = (i * B_TREE_STRIDE) % B_TREE_SIZE, });
+    }
+
+    int array[B_TREE_SIZE] = { 0 }, * cursor = array;
+    foreach_range_b_tree(test, (B_TREE_DATA_TYPE) { .sub_one = 10, }, (B_TREE_DATA_TYPE) { .sub_one = 20, }, collect_int, &cursor);
+
+    ASSERT_EQm("[ERROR] Expected eleven elements in range.", 11, cursor - array);
+    for (int i = 0; i < 11; ++i) {
+        ASSERT_EQm("[ERROR] Expected elements in range to be sorted.", 10 + i, array[i]);
+    }
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST FOREACH_RANGE_02(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = 42, });
+    }
+
+    // equal elements may be spread over several leaves, thus range must start at the first of them
+    int array[B_TREE_SIZE] = { 0 }, * cursor = array;
+    foreach_range_b_tree(test, (B_TREE_DATA_TYPE) { .sub_one = 42, }, (B_TREE_DATA_TYPE) { .sub_one = 42, }, collect_int, &cursor);
+
+    ASSERT_EQm("[ERROR] Expected every equal element in range.", B_TREE_SIZE, cursor - array);
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST MAP_01(void) {
+    b_tree_s test = create_b_tree(compare_int);
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        insert_b_tree(&test, (B_TREE_DATA_TYPE) { .sub_one = (i * B_TREE_STRIDE) % B_TREE_SIZE, });
+    }
+
+    // sorting reverses elements, sorting them back must leave a searchable tree
+    map_b_tree(test, sort_int, &(struct compare) { .function = compare_reverse_int_generic, });
+    map_b_tree(test, sort_int, &(struct compare) { .function = compare_int_generic, });
+
+    for (int i = 0; i < B_TREE_SIZE; ++i) {
+        ASSERTm("[ERROR] Expected tree to contain element.", contains_b_tree(test, (B_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_b_tree(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (b_tree_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy
+    RUN_TEST(DESTROY_01); RUN_TEST(DESTROY_02);
+    // clear
+    RUN_TEST(CLEAR_01);
+    // is empty
+    RUN_TEST(IS_EMPTY_01); RUN_TEST(IS_EMPTY_02);
+    // is full
+    RUN_TEST(IS_FULL_01); RUN_TEST(IS_FULL_02);
+    // copy
+    RUN_TEST(COPY_01); RUN_TEST(COPY_02);
+    // insert
+    RUN_TEST(INSERT_01); RUN_TEST(INSERT_02); RUN_TEST(INSERT_03);
+    // remove
+    RUN_TEST(REMOVE_01); RUN_TEST(REMOVE_02); RUN_TEST(REMOVE_03); RUN_TEST(REMOVE_04);
+    // contains
+    RUN_TEST(CONTAINS_01); RUN_TEST(CONTAINS_02);
+    // get min
+    RUN_TEST(GET_MIN_01);
+    // get max
+    RUN_TEST(GET_MAX_01);
+    // foreach range
+    RUN_TEST(FOREACH_RANGE_01); RUN_TEST(FOREACH_RANGE_02);
+    // map
+    RUN_TEST(MAP_01);
+}
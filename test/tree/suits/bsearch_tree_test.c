@@ -0,0 +1,409 @@
+#include <suits.h>
+
+#define BSEARCH_TREE_DATA_TYPE DATA_TYPE
+#define BSEARCH_TREE_SIZE (1 << 5)
+#include <tree/bsearch_tree.h>
+
+// returns number of nodes in node's subtree, or -1 if its parent links are broken
+static int count(const bsearch_tree_s tree, const BSEARCH_TREE_INDEX_TYPE node, const BSEARCH_TREE_INDEX_TYPE parent) {
+    if (BSEARCH_TREE_SIZE == node) {
+        return 0;
+    }
+
+    if (parent != tree.nodes[node].parent) {
+        return -1;
+    }
+
+    const int left = count(tree, tree.nodes[node].child[BSEARCH_TREE_LEFT], node);
+    const int right = count(tree, tree.nodes[node].child[BSEARCH_TREE_RIGHT], node);
+    if (left < 0 || right < 0) {
+        return -1;
+    }
+
+    return left + right + 1;
+}
+
+// checks parent links and in-order sorting
+static bool is_bsearch(const bsearch_tree_s tree) {
+    if ((int)(tree.size) != count(tree, tree.root, BSEARCH_TREE_SIZE)) {
+        return false;
+    }
+
+    int array[BSEARCH_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_bsearch_tree(tree, collect_int, &cursor);
+    if (array + tree.size != cursor) {
+        return false;
+    }
+
+    for (size_t i = 1; i < tree.size; ++i) {
+        if (array[i - 1] > array[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// checks if tree holds exactly the elements from low up to but excluding high
+static bool is_range(const bsearch_tree_s tree, const int low, const int high) {
+    int array[BSEARCH_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_bsearch_tree(tree, collect_int, &cursor);
+
+    return (array + tree.size == cursor) && is_range_int(array, tree.size, low, high);
+}
+
+static bsearch_tree_s create_range(const int low, const int high) {
+    bsearch_tree_s tree = create_bsearch_tree(compare_int);
+    for (int i = low; i < high; ++i) {
+        insert_bsearch_tree(&tree, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    return tree;
+}
+
+TEST CREATE_01(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected root to be NIL.", BSEARCH_TREE_SIZE, test.root);
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_bsearch_tree(test));
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    bsearch_tree_s test = create_range(0, BSEARCH_TREE_SIZE);
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected elements to be NULL.", NULL, test.elements);
+    ASSERT_EQm("[ERROR] Expected nodes to be NULL.", NULL, test.nodes);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    bsearch_tree_s test = create_range(0, BSEARCH_TREE_SIZE);
+
+    clear_bsearch_tree(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_bsearch_tree(test));
+    ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+
+    insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = 42, });
+    ASSERT_EQm("[ERROR] Expected maximum to be 42.", 42, get_max_bsearch_tree(test).sub_one);
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    bsearch_tree_s test = create_range(0, BSEARCH_TREE_SIZE);
+    bsearch_tree_s copy = copy_bsearch_tree(test, copy_int);
+
+    ASSERT_NEQm("[ERROR] Expected elements to not be shared.", test.elements, copy.elements);
+    ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(copy));
+    ASSERTm("[ERROR] Expected copy to hold every element.", is_range(copy, 0, BSEARCH_TREE_SIZE));
+
+    destroy_bsearch_tree(&test, destroy_int);
+    destroy_bsearch_tree(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, BSEARCH_TREE_SIZE), });
+        ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to be full.", is_full_bsearch_tree(test));
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, BSEARCH_TREE_SIZE));
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_02(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    // ascending elements degenerate tree into a list
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+        ASSERT_EQm("[ERROR] Expected maximum to be i.", i, get_max_bsearch_tree(test).sub_one);
+    }
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_03(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    // duplicates are kept
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i / 2, });
+        ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+    }
+
+    ASSERT_EQm("[ERROR] Expected size to be maximum.", BSEARCH_TREE_SIZE, test.size);
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_01(void) {
+    bsearch_tree_s test = create_range(0, BSEARCH_TREE_SIZE);
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        const int element = shuffle_int(i, BSEARCH_TREE_SIZE);
+        const BSEARCH_TREE_DATA_TYPE removed = remove_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = element, });
+        ASSERT_EQm("[ERROR] Expected removed element to be equal.", element, removed.sub_one);
+        ASSERT_FALSEm("[ERROR] Expected element to not be contained.", test.size && contains_bsearch_tree(test, removed));
+        ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_bsearch_tree(test));
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_MIN_01(void) {
+    bsearch_tree_s test = create_range(0, BSEARCH_TREE_SIZE);
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected minimum to be i.", i, get_min_bsearch_tree(test).sub_one);
+        ASSERT_EQm("[ERROR] Expected removed minimum to be i.", i, remove_min_bsearch_tree(&test).sub_one);
+        ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+    }
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_MAX_01(void) {
+    bsearch_tree_s test = create_range(0, BSEARCH_TREE_SIZE);
+
+    for (int i = BSEARCH_TREE_SIZE - 1; i >= 0; --i) {
+        ASSERT_EQm("[ERROR] Expected maximum to be i.", i, get_max_bsearch_tree(test).sub_one);
+        ASSERT_EQm("[ERROR] Expected removed maximum to be i.", i, remove_max_bsearch_tree(&test).sub_one);
+        ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+    }
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CONTAINS_01(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; i += 2) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected only even elements to be contained.", !(i % 2), contains_bsearch_tree(test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CURSOR_01(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected begin of empty tree to be past the end.", NULL, begin_bsearch_tree(test).element);
+    ASSERT_EQm("[ERROR] Expected rbegin of empty tree to be past the end.", NULL, rbegin_bsearch_tree(test).element);
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, BSEARCH_TREE_SIZE), });
+    }
+
+    int i = 0;
+    for (bsearch_tree_cursor_s c = begin_bsearch_tree(test); c.element; c = next_bsearch_tree(test, c)) {
+        ASSERT_EQm("[ERROR] Expected cursor element to be i.", i++, c.element->sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", BSEARCH_TREE_SIZE, i);
+
+    for (bsearch_tree_cursor_s c = rbegin_bsearch_tree(test); c.element; c = prev_bsearch_tree(test, c)) {
+        ASSERT_EQm("[ERROR] Expected cursor element to be i.", --i, c.element->sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", 0, i);
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SEEK_01(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; i += 2) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE - 1; ++i) {
+        const bsearch_tree_cursor_s c = seek_bsearch_tree(test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected seeked element to be least even not below i.", i + (i % 2), c.element->sub_one);
+    }
+
+    const bsearch_tree_cursor_s end = seek_bsearch_tree(test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = BSEARCH_TREE_SIZE, });
+    ASSERT_EQm("[ERROR] Expected cursor to be past the end.", NULL, end.element);
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SET_01(void) {
+    bsearch_tree_s one = create_bsearch_tree(compare_int);
+    bsearch_tree_s two = create_bsearch_tree(compare_int);
+
+    // one holds multiples of two and two holds multiples of three
+    for (int i = 0; i < BSEARCH_TREE_SIZE / 2; ++i) {
+        insert_bsearch_tree(&one, (BSEARCH_TREE_DATA_TYPE) { .sub_one = 2 * i, });
+        if (i < BSEARCH_TREE_SIZE / 3) {
+            insert_bsearch_tree(&two, (BSEARCH_TREE_DATA_TYPE) { .sub_one = 3 * i, });
+        }
+    }
+
+    bsearch_tree_s tree_union = union_bsearch_tree(one, two, copy_int);
+    bsearch_tree_s tree_intersect = intersect_bsearch_tree(one, two, copy_int);
+    bsearch_tree_s tree_subtract = subtract_bsearch_tree(one, two, copy_int);
+    bsearch_tree_s tree_exclude = exclude_bsearch_tree(one, two, copy_int);
+
+    ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(tree_union));
+    ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(tree_intersect));
+    ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(tree_subtract));
+    ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(tree_exclude));
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        const BSEARCH_TREE_DATA_TYPE element = { .sub_one = i, };
+        const bool in_one = !(i % 2) && i < 2 * (BSEARCH_TREE_SIZE / 2), in_two = !(i % 3) && i < 3 * (BSEARCH_TREE_SIZE / 3);
+
+        ASSERT_EQm("[ERROR] Expected union to hold elements in either tree.", in_one || in_two, contains_bsearch_tree(tree_union, element));
+        ASSERT_EQm("[ERROR] Expected intersect to hold elements in both trees.", in_one && in_two, contains_bsearch_tree(tree_intersect, element));
+        ASSERT_EQm("[ERROR] Expected subtract to hold elements only in first tree.", in_one && !in_two, contains_bsearch_tree(tree_subtract, element));
+        ASSERT_EQm("[ERROR] Expected exclude to hold elements in exactly one tree.", in_one != in_two, contains_bsearch_tree(tree_exclude, element));
+    }
+
+    destroy_bsearch_tree(&one, destroy_int);
+    destroy_bsearch_tree(&two, destroy_int);
+    destroy_bsearch_tree(&tree_union, destroy_int);
+    destroy_bsearch_tree(&tree_intersect, destroy_int);
+    destroy_bsearch_tree(&tree_subtract, destroy_int);
+    destroy_bsearch_tree(&tree_exclude, destroy_int);
+
+    PASS();
+}
+
+TEST SET_02(void) {
+    bsearch_tree_s one = create_range(0, BSEARCH_TREE_SIZE / 2);
+    bsearch_tree_s two = create_bsearch_tree(compare_int);
+
+    // operations with an empty tree
+    bsearch_tree_s tree_union = union_bsearch_tree(one, two, copy_int);
+    bsearch_tree_s tree_intersect = intersect_bsearch_tree(one, two, copy_int);
+    bsearch_tree_s tree_subtract = subtract_bsearch_tree(two, one, copy_int);
+    bsearch_tree_s tree_exclude = exclude_bsearch_tree(two, one, copy_int);
+
+    ASSERTm("[ERROR] Expected union to be first tree.", is_range(tree_union, 0, BSEARCH_TREE_SIZE / 2));
+    ASSERTm("[ERROR] Expected intersect to be empty.", is_empty_bsearch_tree(tree_intersect));
+    ASSERTm("[ERROR] Expected subtract to be empty.", is_empty_bsearch_tree(tree_subtract));
+    ASSERTm("[ERROR] Expected exclude to be first tree.", is_range(tree_exclude, 0, BSEARCH_TREE_SIZE / 2));
+
+    destroy_bsearch_tree(&one, destroy_int);
+    destroy_bsearch_tree(&two, destroy_int);
+    destroy_bsearch_tree(&tree_union, destroy_int);
+    destroy_bsearch_tree(&tree_intersect, destroy_int);
+    destroy_bsearch_tree(&tree_subtract, destroy_int);
+    destroy_bsearch_tree(&tree_exclude, destroy_int);
+
+    PASS();
+}
+
+TEST COMPACT_01(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, BSEARCH_TREE_SIZE), });
+    }
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; i += 2) {
+        remove_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    // after compaction each element's array index is its in-order position
+    compact_bsearch_tree(&test);
+
+    ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+    for (size_t i = 0; i < test.size; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i-th odd number.", (int)(2 * i + 1), test.elements[i].sub_one);
+    }
+
+    insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = 0, });
+    ASSERTm("[ERROR] Expected valid binary search tree.", is_bsearch(test));
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST TRAVERSE_01(void) {
+    bsearch_tree_s test = create_range(0, BSEARCH_TREE_SIZE);
+
+    // every traversal visits each element once
+    int array[BSEARCH_TREE_SIZE] = { 0 }, * cursor = array;
+    preorder_bsearch_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected preorder to visit every element.", BSEARCH_TREE_SIZE, (int)(cursor - array));
+
+    cursor = array;
+    postorder_bsearch_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected postorder to visit every element.", BSEARCH_TREE_SIZE, (int)(cursor - array));
+
+    cursor = array;
+    level_order_bsearch_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected level order to visit every element.", BSEARCH_TREE_SIZE, (int)(cursor - array));
+    ASSERT_EQm("[ERROR] Expected level order to start at root.", test.elements[test.root].sub_one, array[0]);
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (bsearch_tree_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy, clear and copy
+    RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01); RUN_TEST(COPY_01);
+    // insert
+    RUN_TEST(INSERT_01); RUN_TEST(INSERT_02); RUN_TEST(INSERT_03);
+    // remove
+    RUN_TEST(REMOVE_01); RUN_TEST(REMOVE_MIN_01); RUN_TEST(REMOVE_MAX_01);
+    // search
+    RUN_TEST(CONTAINS_01);
+    // cursor
+    RUN_TEST(CURSOR_01); RUN_TEST(SEEK_01);
+    // set operations
+    RUN_TEST(SET_01); RUN_TEST(SET_02);
+    // compact
+    RUN_TEST(COMPACT_01);
+    // traverse
+    RUN_TEST(TRAVERSE_01);
+}
@@ -0,0 +1,270 @@
+#include <suits.h>
+
+#define RED_BLACK_MAP_KEY_TYPE DATA_TYPE
+#define RED_BLACK_MAP_VALUE_TYPE DATA_TYPE
+#define RED_BLACK_MAP_SIZE (1 << 5)
+#include <tree/red_black_map.h>
+
+// returns black height of node's subtree, or -1 if its parent links or colors are broken
+static int black_height(const red_black_map_s map, const RED_BLACK_MAP_INDEX_TYPE node, const RED_BLACK_MAP_INDEX_TYPE parent) {
+    if (RED_BLACK_MAP_SIZE == node) {
+        return 1;
+    }
+
+    if (parent != map.nodes[node].parent) {
+        return -1;
+    }
+
+    const bool is_red = RED_MAP_COLOR == map.nodes[node].color;
+    if (is_red && RED_BLACK_MAP_SIZE != parent && RED_MAP_COLOR == map.nodes[parent].color) {
+        return -1;
+    }
+
+    const int left = black_height(map, map.nodes[node].child[RED_BLACK_MAP_LEFT], node);
+    const int right = black_height(map, map.nodes[node].child[RED_BLACK_MAP_RIGHT], node);
+    if (left < 0 || left != right) {
+        return -1;
+    }
+
+    return left + (is_red ? 0 : 1);
+}
+
+// collects keys in order, or -1 for keys whose value isn't twice the key
+static bool collect_key(RED_BLACK_MAP_KEY_TYPE const * key, RED_BLACK_MAP_VALUE_TYPE * value, void * cursor) {
+    int ** array = cursor;
+    *((*array)++) = (2 * key->sub_one == value->sub_one) ? key->sub_one : -1;
+    return true;
+}
+
+// checks red black properties and that map holds exactly the keys from low up to but excluding high with doubled values
+static bool is_range(const red_black_map_s map, const int low, const int high) {
+    if (RED_BLACK_MAP_SIZE != map.root && (RED_MAP_COLOR == map.nodes[map.root].color || black_height(map, map.root, RED_BLACK_MAP_SIZE) < 0)) {
+        return false;
+    }
+
+    int array[RED_BLACK_MAP_SIZE] = { 0 }, * cursor = array;
+    inorder_red_black_map(map, collect_key, &cursor);
+
+    return (array + map.size == cursor) && is_range_int(array, map.size, low, high);
+}
+
+static red_black_map_s create_range(const int low, const int high) {
+    red_black_map_s map = create_red_black_map(compare_int);
+    for (int i = low; i < high; ++i) {
+        upsert_red_black_map(&map, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, }, (RED_BLACK_MAP_VALUE_TYPE) { .sub_one = 2 * i, });
+    }
+
+    return map;
+}
+
+TEST CREATE_01(void) {
+    red_black_map_s test = create_red_black_map(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected root to be NIL.", RED_BLACK_MAP_SIZE, test.root);
+    ASSERTm("[ERROR] Expected map to be empty.", is_empty_red_black_map(test));
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    red_black_map_s test = create_red_black_map(compare_int);
+
+    // string values must be freed by destroy function
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        upsert_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, }, copy_string((RED_BLACK_MAP_VALUE_TYPE) { .sub_two = TEST_STRING, }));
+    }
+
+    destroy_red_black_map(&test, destroy_int, destroy_string);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected keys to be NULL.", NULL, test.keys);
+    ASSERT_EQm("[ERROR] Expected values to be NULL.", NULL, test.values);
+    ASSERT_EQm("[ERROR] Expected nodes to be NULL.", NULL, test.nodes);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    red_black_map_s test = create_range(0, RED_BLACK_MAP_SIZE);
+
+    clear_red_black_map(&test, destroy_int, destroy_int);
+
+    ASSERTm("[ERROR] Expected map to be empty.", is_empty_red_black_map(test));
+    ASSERTm("[ERROR] Expected map to be usable after clear.", is_range(test, 0, 0));
+
+    upsert_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = 21, }, (RED_BLACK_MAP_VALUE_TYPE) { .sub_one = 42, });
+    ASSERTm("[ERROR] Expected map to hold one key.", is_range(test, 21, 22));
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    red_black_map_s test = create_range(0, RED_BLACK_MAP_SIZE);
+    red_black_map_s copy = copy_red_black_map(test, copy_int, copy_int);
+
+    ASSERT_NEQm("[ERROR] Expected keys to not be shared.", test.keys, copy.keys);
+    ASSERT_NEQm("[ERROR] Expected values to not be shared.", test.values, copy.values);
+    ASSERTm("[ERROR] Expected copy to hold every key.", is_range(copy, 0, RED_BLACK_MAP_SIZE));
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+    destroy_red_black_map(&copy, destroy_int, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_02(void) {
+    red_black_map_s test = create_red_black_map(compare_int);
+
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        upsert_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, }, copy_string((RED_BLACK_MAP_VALUE_TYPE) { .sub_two = TEST_STRING, }));
+    }
+
+    // copied string values must be independent from original ones
+    red_black_map_s copy = copy_red_black_map(test, copy_int, copy_string);
+    destroy_red_black_map(&test, destroy_int, destroy_string);
+
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        const RED_BLACK_MAP_VALUE_TYPE * value = get_ptr_red_black_map(copy, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, });
+        ASSERT_NEQm("[ERROR] Expected key to be found.", NULL, value);
+        ASSERT_STRN_EQm("[ERROR] Expected value to be test string.", TEST_STRING, value->sub_two, sizeof(TEST_STRING) - 1);
+    }
+
+    destroy_red_black_map(&copy, destroy_int, destroy_string);
+
+    PASS();
+}
+
+TEST UPSERT_01(void) {
+    red_black_map_s test = create_red_black_map(compare_int);
+
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        const int key = shuffle_int(i, RED_BLACK_MAP_SIZE);
+        const RED_BLACK_MAP_VALUE_TYPE * value = upsert_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = key, }, (RED_BLACK_MAP_VALUE_TYPE) { .sub_one = 2 * key, });
+        ASSERT_EQm("[ERROR] Expected inserted value to be twice the key.", 2 * key, value->sub_one);
+        ASSERT_EQm("[ERROR] Expected size to grow by one.", (size_t)(i + 1), test.size);
+    }
+
+    ASSERTm("[ERROR] Expected map to be full.", is_full_red_black_map(test));
+    ASSERTm("[ERROR] Expected map to hold every key.", is_range(test, 0, RED_BLACK_MAP_SIZE));
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+
+    PASS();
+}
+
+TEST UPSERT_02(void) {
+    red_black_map_s test = create_range(0, RED_BLACK_MAP_SIZE);
+
+    // upserting an existing key keeps its value and size, and returns its slot to be changed in place
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        RED_BLACK_MAP_VALUE_TYPE * value = upsert_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, }, (RED_BLACK_MAP_VALUE_TYPE) { .sub_one = -1, });
+        ASSERT_EQm("[ERROR] Expected existing value to be kept.", 2 * i, value->sub_one);
+        value->sub_one++;
+    }
+
+    ASSERT_EQm("[ERROR] Expected size to be unchanged.", RED_BLACK_MAP_SIZE, test.size);
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected value to be changed through slot.", (2 * i) + 1, get_ptr_red_black_map(test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, })->sub_one);
+    }
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_OR_ASSIGN_01(void) {
+    red_black_map_s test = create_range(0, RED_BLACK_MAP_SIZE / 2);
+
+    // existing keys get new values, missing keys are inserted
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        const RED_BLACK_MAP_VALUE_TYPE * value = insert_or_assign_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, }, (RED_BLACK_MAP_VALUE_TYPE) { .sub_one = -i, });
+        ASSERT_EQm("[ERROR] Expected value to be assigned.", -i, value->sub_one);
+    }
+
+    ASSERT_EQm("[ERROR] Expected size to be maximum.", RED_BLACK_MAP_SIZE, test.size);
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected value to be negative key.", -i, get_ptr_red_black_map(test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, })->sub_one);
+    }
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+
+    PASS();
+}
+
+TEST GET_PTR_01(void) {
+    red_black_map_s test = create_red_black_map(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected missing key in empty map.", NULL, get_ptr_red_black_map(test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = 0, }));
+
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; i += 2) {
+        upsert_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, }, (RED_BLACK_MAP_VALUE_TYPE) { .sub_one = 2 * i, });
+    }
+
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        const RED_BLACK_MAP_KEY_TYPE key = { .sub_one = i, };
+        const RED_BLACK_MAP_VALUE_TYPE * value = get_ptr_red_black_map(test, key);
+        ASSERT_EQm("[ERROR] Expected only even keys to be contained.", !(i % 2), contains_red_black_map(test, key));
+        ASSERT_EQm("[ERROR] Expected only even keys to be found.", !(i % 2), NULL != value);
+        ASSERTm("[ERROR] Expected found value to be twice the key.", !value || 2 * i == value->sub_one);
+    }
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_01(void) {
+    red_black_map_s test = create_range(0, RED_BLACK_MAP_SIZE);
+
+    for (int i = 0; i < RED_BLACK_MAP_SIZE; ++i) {
+        const int key = shuffle_int(i, RED_BLACK_MAP_SIZE);
+        const red_black_map_pair_s pair = remove_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = key, });
+        ASSERT_EQm("[ERROR] Expected removed key to be equal.", key, pair.key.sub_one);
+        ASSERT_EQm("[ERROR] Expected removed value to be twice the key.", 2 * key, pair.value.sub_one);
+        ASSERT_EQm("[ERROR] Expected key to not be found.", NULL, get_ptr_red_black_map(test, pair.key));
+    }
+
+    ASSERTm("[ERROR] Expected map to be empty.", is_empty_red_black_map(test));
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_02(void) {
+    red_black_map_s test = create_range(0, RED_BLACK_MAP_SIZE);
+
+    // remaining keys must keep their values while removed slots are filled by moved pairs
+    for (int i = 0; i < RED_BLACK_MAP_SIZE / 2; ++i) {
+        remove_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected map to hold remaining keys.", is_range(test, i + 1, RED_BLACK_MAP_SIZE));
+    }
+
+    for (int i = RED_BLACK_MAP_SIZE - 1; i >= RED_BLACK_MAP_SIZE / 2; --i) {
+        remove_red_black_map(&test, (RED_BLACK_MAP_KEY_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected map to hold remaining keys.", is_range(test, RED_BLACK_MAP_SIZE / 2, i));
+    }
+
+    destroy_red_black_map(&test, destroy_int, destroy_int);
+
+    PASS();
+}
+
+SUITE (red_black_map_test) {
+    // create
+    RUN_TEST(CREATE_01);
+    // destroy, clear and copy
+    RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01); RUN_TEST(COPY_01); RUN_TEST(COPY_02);
+    // upsert
+    RUN_TEST(UPSERT_01); RUN_TEST(UPSERT_02); RUN_TEST(INSERT_OR_ASSIGN_01);
+    // search
+    RUN_TEST(GET_PTR_01);
+    // remove
+    RUN_TEST(REMOVE_01); RUN_TEST(REMOVE_02);
+}
@@ -0,0 +1,320 @@
+#include <suits.h>
+
+#define RED_BLACK_TREE_DATA_TYPE DATA_TYPE
+#define RED_BLACK_TREE_SIZE (1 << 5)
+#define RED_BLACK_TREE_SNAPSHOT
+#define RED_BLACK_TREE_CHUNK_SIZE (1 << 2)
+#include <tree/red_black_tree.h>
+
+#define RED_BLACK_TREE_HALF (RED_BLACK_TREE_SIZE >> 1)
+
+static red_black_tree_s create_half(void) {
+    red_black_tree_s tree = create_red_black_tree(compare_int);
+    for (int i = 0; i < RED_BLACK_TREE_HALF; ++i) {
+        insert_red_black_tree(&tree, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    return tree;
+}
+
+static bool is_half(const red_black_tree_s tree) {
+    // cursors only read elements, thus unlike traversals they work on trees still sharing chunks
+    bool valid = (RED_BLACK_TREE_HALF == tree.size);
+    red_black_tree_cursor_s cursor = begin_red_black_tree(tree);
+    for (int i = 0; valid && i < RED_BLACK_TREE_HALF; ++i) {
+        valid = cursor.element && (i == cursor.element->sub_one);
+        cursor = valid ? next_red_black_tree(tree, cursor) : cursor;
+    }
+
+    return valid && !cursor.element;
+}
+
+static bool is_shared(const red_black_tree_s one, const red_black_tree_s two, const size_t chunk) {
+    return one.elements[chunk] == two.elements[chunk];
+}
+
+TEST SNAPSHOT_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    for (size_t i = 0; i < RED_BLACK_TREE_CHUNK_COUNT; ++i) {
+        ASSERT_EQm("[ERROR] Expected element chunk to be shared.", test.elements[i], snapshot.elements[i]);
+        ASSERT_EQm("[ERROR] Expected node chunk to be shared.", test.nodes[i], snapshot.nodes[i]);
+        ASSERT_EQm("[ERROR] Expected two references.", 2, test.elements[i]->references);
+    }
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+
+    for (size_t i = 0; i < RED_BLACK_TREE_CHUNK_COUNT; ++i) {
+        ASSERT_EQm("[ERROR] Expected one reference.", 1, test.elements[i]->references);
+        ASSERT_EQm("[ERROR] Expected one reference.", 1, test.nodes[i]->references);
+    }
+    ASSERTm("[ERROR] Expected tree to be unchanged.", is_half(test));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SNAPSHOT_02(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    // destroying the tree first must leave shared elements to the snapshot
+    destroy_red_black_tree(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+
+    PASS();
+}
+
+TEST DETACH_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    detach_red_black_tree(&test);
+
+    ASSERTm("[ERROR] Expected tree to be detached.", is_detached_red_black_tree(test));
+    ASSERTm("[ERROR] Expected snapshot to be detached.", is_detached_red_black_tree(snapshot));
+    for (size_t i = 0; i < RED_BLACK_TREE_HALF / RED_BLACK_TREE_CHUNK_SIZE; ++i) {
+        ASSERT_FALSEm("[ERROR] Expected element chunk to not be shared.", is_shared(test, snapshot, i));
+        ASSERT_EQm("[ERROR] Expected node chunk to stay shared.", test.nodes[i], snapshot.nodes[i]);
+    }
+    ASSERTm("[ERROR] Expected tree to be unchanged.", is_half(test));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    ASSERTm("[ERROR] Expected tree to be unchanged.", is_half(test));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    for (int i = RED_BLACK_TREE_HALF; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    ASSERT_EQm("[ERROR] Expected tree to be full.", RED_BLACK_TREE_SIZE, test.size);
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_02(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    // appended element lands in the first chunk past the half, thus chunks holding the half stay shared
+    insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = RED_BLACK_TREE_HALF, });
+
+    for (size_t i = 0; i < RED_BLACK_TREE_HALF / RED_BLACK_TREE_CHUNK_SIZE; ++i) {
+        ASSERTm("[ERROR] Expected untouched element chunk to be shared.", is_shared(test, snapshot, i));
+    }
+    ASSERT_FALSEm("[ERROR] Expected changed element chunk to not be shared.", is_shared(test, snapshot, RED_BLACK_TREE_HALF / RED_BLACK_TREE_CHUNK_SIZE));
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    insert_hint_red_black_tree(&test, rbegin_red_black_tree(test), (RED_BLACK_TREE_DATA_TYPE) { .sub_one = RED_BLACK_TREE_HALF, });
+
+    ASSERT_EQm("[ERROR] Expected tree to grow.", RED_BLACK_TREE_HALF + 1, test.size);
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    for (int i = 0; i < RED_BLACK_TREE_HALF; ++i) {
+        remove_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_red_black_tree(test));
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_MIN_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    ASSERT_EQm("[ERROR] Expected removed element to be minimum.", 0, remove_min_red_black_tree(&test).sub_one);
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_MAX_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    ASSERT_EQm("[ERROR] Expected removed element to be maximum.", RED_BLACK_TREE_HALF - 1, remove_max_red_black_tree(&test).sub_one);
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST JOIN_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    red_black_tree_s source = create_red_black_tree(compare_int);
+    for (int i = RED_BLACK_TREE_HALF; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&source, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    join_red_black_tree(&test, &source);
+
+    ASSERT_EQm("[ERROR] Expected tree to be full.", RED_BLACK_TREE_SIZE, test.size);
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&source, destroy_int);
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SPLIT_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    red_black_tree_s greater = split_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = RED_BLACK_TREE_HALF >> 1, });
+
+    ASSERT_EQm("[ERROR] Expected tree to keep lesser half.", RED_BLACK_TREE_HALF >> 1, test.size);
+    ASSERT_EQm("[ERROR] Expected greater tree to get greater half.", RED_BLACK_TREE_HALF >> 1, greater.size);
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&greater, destroy_int);
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    clear_red_black_tree(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_red_black_tree(test));
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 42, });
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COMPACT_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+    for (int i = RED_BLACK_TREE_HALF - 1; i >= 0; --i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    compact_red_black_tree(&test);
+
+    ASSERT_FALSEm("[ERROR] Expected elements to not be shared.", is_shared(test, snapshot, 0));
+    ASSERTm("[ERROR] Expected tree to be unchanged.", is_half(test));
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    ASSERTm("[ERROR] Expected tree to be unchanged.", is_half(test));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST MAP_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    detach_red_black_tree(&test);
+    struct compare cmp = { .function = compare_reverse_int_generic, };
+    map_red_black_tree(test, sort_int, &cmp);
+
+    ASSERT_EQm("[ERROR] Expected mapped element to be last.", RED_BLACK_TREE_HALF - 1, RED_BLACK_TREE_ELEMENT(test, 0).sub_one);
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INORDER_01(void) {
+    red_black_tree_s test = create_half();
+    red_black_tree_s snapshot = snapshot_red_black_tree(test);
+
+    // traversals hand out writable elements, thus tree must be detached first
+    detach_red_black_tree(&test);
+    int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_red_black_tree(test, collect_int, &cursor);
+
+    ASSERTm("[ERROR] Expected elements to be sorted.", is_range_int(array, (size_t)(cursor - array), 0, RED_BLACK_TREE_HALF));
+    ASSERTm("[ERROR] Expected snapshot to be unchanged.", is_half(snapshot));
+
+    destroy_red_black_tree(&snapshot, destroy_int);
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (red_black_tree_snapshot_test) {
+    // snapshot
+    RUN_TEST(SNAPSHOT_01); RUN_TEST(SNAPSHOT_02);
+    // detach
+    RUN_TEST(DETACH_01);
+    // insert
+    RUN_TEST(INSERT_01); RUN_TEST(INSERT_02); RUN_TEST(INSERT_HINT_01);
+    // remove
+    RUN_TEST(REMOVE_01); RUN_TEST(REMOVE_MIN_01); RUN_TEST(REMOVE_MAX_01);
+    // join and split
+    RUN_TEST(JOIN_01); RUN_TEST(SPLIT_01);
+    // clear
+    RUN_TEST(CLEAR_01);
+    // compact
+    RUN_TEST(COMPACT_01);
+    // map
+    RUN_TEST(MAP_01);
+    // inorder
+    RUN_TEST(INORDER_01);
+}
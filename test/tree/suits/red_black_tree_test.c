@@ -0,0 +1,725 @@
+#include <suits.h>
+
+#define RED_BLACK_TREE_DATA_TYPE DATA_TYPE
+#define RED_BLACK_TREE_SIZE (1 << 5)
+#include <tree/red_black_tree.h>
+
+// returns black height of node's subtree, or -1 if its parent links or colors are broken
+static int black_height(const red_black_tree_s tree, const RED_BLACK_TREE_INDEX_TYPE node, const RED_BLACK_TREE_INDEX_TYPE parent) {
+    if (RED_BLACK_TREE_SIZE == node) {
+        return 1;
+    }
+
+    if (parent != tree.nodes[node].parent) {
+        return -1;
+    }
+
+    const bool is_red = RED_TREE_COLOR == tree.nodes[node].color;
+    if (is_red && RED_BLACK_TREE_SIZE != parent && RED_TREE_COLOR == tree.nodes[parent].color) {
+        return -1;
+    }
+
+    const int left = black_height(tree, tree.nodes[node].child[RED_BLACK_TREE_LEFT], node);
+    const int right = black_height(tree, tree.nodes[node].child[RED_BLACK_TREE_RIGHT], node);
+    if (left < 0 || left != right) {
+        return -1;
+    }
+
+    return left + (is_red ? 0 : 1);
+}
+
+// checks red black properties, in-order sorting and cached maximum node
+static bool is_red_black(const red_black_tree_s tree) {
+    if (RED_BLACK_TREE_SIZE == tree.root) {
+        return !tree.size && RED_BLACK_TREE_SIZE == tree.maximum;
+    }
+
+    if (RED_TREE_COLOR == tree.nodes[tree.root].color || black_height(tree, tree.root, RED_BLACK_TREE_SIZE) < 0) {
+        return false;
+    }
+
+    int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_red_black_tree(tree, collect_int, &cursor);
+    if (array + tree.size != cursor) {
+        return false;
+    }
+
+    for (size_t i = 1; i < tree.size; ++i) {
+        if (array[i - 1] > array[i]) {
+            return false;
+        }
+    }
+
+    return RED_BLACK_TREE_SIZE == tree.nodes[tree.maximum].child[RED_BLACK_TREE_RIGHT] && array[tree.size - 1] == tree.elements[tree.maximum].sub_one;
+}
+
+// checks if tree holds exactly the elements from low up to but excluding high
+static bool is_range(const red_black_tree_s tree, const int low, const int high) {
+    int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_red_black_tree(tree, collect_int, &cursor);
+
+    return (array + tree.size == cursor) && is_range_int(array, tree.size, low, high);
+}
+
+static red_black_tree_s create_range(const int low, const int high) {
+    red_black_tree_s tree = create_red_black_tree(compare_int);
+    for (int i = low; i < high; ++i) {
+        insert_red_black_tree(&tree, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    return tree;
+}
+
+TEST CREATE_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected root to be NIL.", RED_BLACK_TREE_SIZE, test.root);
+    ASSERT_EQm("[ERROR] Expected maximum to be NIL.", RED_BLACK_TREE_SIZE, test.maximum);
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_red_black_tree(test));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CREATE_FROM_SORTED_01(void) {
+    RED_BLACK_TREE_DATA_TYPE sorted[RED_BLACK_TREE_SIZE];
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        sorted[i] = (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, };
+    }
+
+    // every size must link into a valid tree, including sizes that leave an incomplete last level
+    for (int i = 0; i <= RED_BLACK_TREE_SIZE; ++i) {
+        red_black_tree_s test = create_red_black_tree_from_sorted(compare_int, sorted, (size_t)(i));
+
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+        ASSERTm("[ERROR] Expected tree to hold sorted elements.", is_range(test, 0, i));
+
+        destroy_red_black_tree(&test, destroy_int);
+    }
+
+    PASS();
+}
+
+TEST CREATE_FROM_SORTED_02(void) {
+    RED_BLACK_TREE_DATA_TYPE sorted[RED_BLACK_TREE_SIZE / 2];
+    for (int i = 0; i < RED_BLACK_TREE_SIZE / 2; ++i) {
+        sorted[i] = (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 2 * i, };
+    }
+
+    // linked tree must stay usable for later insertions and removals
+    red_black_tree_s test = create_red_black_tree_from_sorted(compare_int, sorted, RED_BLACK_TREE_SIZE / 2);
+    for (int i = 0; i < RED_BLACK_TREE_SIZE / 2; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = (2 * i) + 1, });
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, RED_BLACK_TREE_SIZE));
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        remove_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST DESTROY_01(void) {
+    red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE);
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    ASSERT_EQm("[ERROR] Expected size to be zero.", 0, test.size);
+    ASSERT_EQm("[ERROR] Expected elements to be NULL.", NULL, test.elements);
+    ASSERT_EQm("[ERROR] Expected nodes to be NULL.", NULL, test.nodes);
+    ASSERT_EQm("[ERROR] Expected function pointer to be NULL.", NULL, test.compare);
+
+    PASS();
+}
+
+TEST CLEAR_01(void) {
+    red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE);
+
+    clear_red_black_tree(&test, destroy_int);
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_red_black_tree(test));
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+
+    insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 42, });
+    ASSERT_EQm("[ERROR] Expected maximum to be 42.", 42, get_max_red_black_tree(test).sub_one);
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST COPY_01(void) {
+    red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE);
+    red_black_tree_s copy = copy_red_black_tree(test, copy_int);
+
+    ASSERT_NEQm("[ERROR] Expected elements to not be shared.", test.elements, copy.elements);
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(copy));
+    ASSERTm("[ERROR] Expected copy to hold every element.", is_range(copy, 0, RED_BLACK_TREE_SIZE));
+
+    destroy_red_black_tree(&test, destroy_int);
+    destroy_red_black_tree(&copy, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, RED_BLACK_TREE_SIZE), });
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to be full.", is_full_red_black_tree(test));
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, RED_BLACK_TREE_SIZE));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_02(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    // ascending elements are appended after the cached maximum
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+        ASSERT_EQm("[ERROR] Expected maximum to be i.", i, get_max_red_black_tree(test).sub_one);
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_03(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    // duplicates are kept
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i / 2, });
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    ASSERT_EQm("[ERROR] Expected size to be maximum.", RED_BLACK_TREE_SIZE, test.size);
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    // ascending elements with the last element as hint
+    red_black_tree_cursor_s hint = rbegin_red_black_tree(test);
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        hint = insert_hint_red_black_tree(&test, hint, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected returned cursor to point to i.", i, hint.element->sub_one);
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, RED_BLACK_TREE_SIZE));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_02(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    // descending elements with the first element as hint
+    red_black_tree_cursor_s hint = begin_red_black_tree(test);
+    for (int i = RED_BLACK_TREE_SIZE - 1; i >= 0; --i) {
+        hint = insert_hint_red_black_tree(&test, hint, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected returned cursor to point to i.", i, hint.element->sub_one);
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, RED_BLACK_TREE_SIZE));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_03(void) {
+    red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE / 2);
+
+    // wrong hints must only cost time, every element still ends up in its proper place
+    for (int i = RED_BLACK_TREE_SIZE / 2; i < RED_BLACK_TREE_SIZE; ++i) {
+        const red_black_tree_cursor_s hint = seek_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, RED_BLACK_TREE_SIZE / 2), });
+        insert_hint_red_black_tree(&test, hint, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, RED_BLACK_TREE_SIZE));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST INSERT_HINT_04(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    // past the end hint starts from root
+    const red_black_tree_cursor_s end = { .element = NULL, .node = RED_BLACK_TREE_SIZE, };
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_hint_red_black_tree(&test, end, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, RED_BLACK_TREE_SIZE), });
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, RED_BLACK_TREE_SIZE));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_01(void) {
+    red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        const int element = shuffle_int(i, RED_BLACK_TREE_SIZE);
+        const RED_BLACK_TREE_DATA_TYPE removed = remove_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = element, });
+        ASSERT_EQm("[ERROR] Expected removed element to be equal.", element, removed.sub_one);
+        ASSERT_FALSEm("[ERROR] Expected element to not be contained.", test.size && contains_red_black_tree(test, removed));
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    ASSERTm("[ERROR] Expected tree to be empty.", is_empty_red_black_tree(test));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_MIN_01(void) {
+    red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected minimum to be i.", i, get_min_red_black_tree(test).sub_one);
+        ASSERT_EQm("[ERROR] Expected removed minimum to be i.", i, remove_min_red_black_tree(&test).sub_one);
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST REMOVE_MAX_01(void) {
+    red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE);
+
+    // cached maximum must move to predecessor
+    for (int i = RED_BLACK_TREE_SIZE - 1; i >= 0; --i) {
+        ASSERT_EQm("[ERROR] Expected maximum to be i.", i, get_max_red_black_tree(test).sub_one);
+        ASSERT_EQm("[ERROR] Expected removed maximum to be i.", i, remove_max_red_black_tree(&test).sub_one);
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CONTAINS_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected only even elements to be contained.", !(i % 2), contains_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST FLOOR_CEILING_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE - 1; ++i) {
+        const RED_BLACK_TREE_DATA_TYPE element = { .sub_one = i, };
+        ASSERT_EQm("[ERROR] Expected floor to be greatest even not above i.", i - (i % 2), floor_red_black_tree(test, element).sub_one);
+        ASSERT_EQm("[ERROR] Expected ceiling to be least even not below i.", i + (i % 2), ceiling_red_black_tree(test, element).sub_one);
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST BOUND_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = -1; i < RED_BLACK_TREE_SIZE - 2; ++i) {
+        const RED_BLACK_TREE_DATA_TYPE element = { .sub_one = i, };
+        const RED_BLACK_TREE_DATA_TYPE * lower = lower_bound_red_black_tree(test, element);
+        const RED_BLACK_TREE_DATA_TYPE * upper = upper_bound_red_black_tree(test, element);
+
+        ASSERT_NEQm("[ERROR] Expected lower bound to exist.", NULL, lower);
+        ASSERT_NEQm("[ERROR] Expected upper bound to exist.", NULL, upper);
+        ASSERT_EQm("[ERROR] Expected lower bound to be least even not below i.", i + ((i + 2) % 2), lower->sub_one);
+        ASSERT_EQm("[ERROR] Expected upper bound to be least even above i.", i + 2 - ((i + 2) % 2), upper->sub_one);
+    }
+
+    ASSERT_EQm("[ERROR] Expected no lower bound above maximum.", NULL, lower_bound_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = RED_BLACK_TREE_SIZE - 1, }));
+    ASSERT_EQm("[ERROR] Expected no upper bound at maximum.", NULL, upper_bound_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = RED_BLACK_TREE_SIZE - 2, }));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST BOUND_02(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected no lower bound in empty tree.", NULL, lower_bound_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 0, }));
+    ASSERT_EQm("[ERROR] Expected no upper bound in empty tree.", NULL, upper_bound_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 0, }));
+
+    // lower bound of duplicates is the first one in order, upper bound skips all of them
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i / 4, });
+    }
+
+    const red_black_tree_cursor_s first = seek_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 3, });
+    ASSERT_EQm("[ERROR] Expected lower bound to be first duplicate.", first.element, lower_bound_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 3, }));
+
+    const red_black_tree_cursor_s previous = prev_red_black_tree(test, first);
+    ASSERT_EQm("[ERROR] Expected previous element to be smaller.", 2, previous.element->sub_one);
+    ASSERT_EQm("[ERROR] Expected upper bound to be 4.", 4, upper_bound_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 3, })->sub_one);
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST FOREACH_RANGE_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, RED_BLACK_TREE_SIZE), });
+    }
+
+    // both range ends are inclusive
+    for (int low = 0; low < RED_BLACK_TREE_SIZE; low += 3) {
+        for (int high = low; high < RED_BLACK_TREE_SIZE + 2; high += 5) {
+            int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+            foreach_range_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = low, }, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = high, }, collect_int, &cursor);
+
+            const int last = high < RED_BLACK_TREE_SIZE ? high : RED_BLACK_TREE_SIZE - 1;
+            ASSERT_EQm("[ERROR] Expected range to hold every element from low to high.", last - low + 1, (int)(cursor - array));
+            for (int i = low; i <= last; ++i) {
+                ASSERT_EQm("[ERROR] Expected range element to be i.", i, array[i - low]);
+            }
+        }
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST FOREACH_RANGE_02(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    // range between two neighbouring elements holds nothing
+    int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+    foreach_range_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 3, }, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 3, }, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected empty range.", array, cursor);
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST CURSOR_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    ASSERT_EQm("[ERROR] Expected begin of empty tree to be past the end.", NULL, begin_red_black_tree(test).element);
+    ASSERT_EQm("[ERROR] Expected rbegin of empty tree to be past the end.", NULL, rbegin_red_black_tree(test).element);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, RED_BLACK_TREE_SIZE), });
+    }
+
+    int i = 0;
+    for (red_black_tree_cursor_s c = begin_red_black_tree(test); c.element; c = next_red_black_tree(test, c)) {
+        ASSERT_EQm("[ERROR] Expected cursor element to be i.", i++, c.element->sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", RED_BLACK_TREE_SIZE, i);
+
+    for (red_black_tree_cursor_s c = rbegin_red_black_tree(test); c.element; c = prev_red_black_tree(test, c)) {
+        ASSERT_EQm("[ERROR] Expected cursor element to be i.", --i, c.element->sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", 0, i);
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST SEEK_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE - 1; ++i) {
+        const red_black_tree_cursor_s c = seek_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+        ASSERT_EQm("[ERROR] Expected seeked element to be least even not below i.", i + (i % 2), c.element->sub_one);
+    }
+
+    const red_black_tree_cursor_s end = seek_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = RED_BLACK_TREE_SIZE, });
+    ASSERT_EQm("[ERROR] Expected cursor to be past the end.", NULL, end.element);
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST JOIN_01(void) {
+    red_black_tree_s destination = create_range(0, RED_BLACK_TREE_SIZE / 4);
+    red_black_tree_s source = create_range(RED_BLACK_TREE_SIZE / 4, RED_BLACK_TREE_SIZE);
+
+    // source is greater and taller than destination
+    join_red_black_tree(&destination, &source);
+
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(destination));
+    ASSERTm("[ERROR] Expected destination to hold every element.", is_range(destination, 0, RED_BLACK_TREE_SIZE));
+    ASSERTm("[ERROR] Expected source to be empty.", is_empty_red_black_tree(source));
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(source));
+
+    destroy_red_black_tree(&destination, destroy_int);
+    destroy_red_black_tree(&source, destroy_int);
+
+    PASS();
+}
+
+TEST JOIN_02(void) {
+    red_black_tree_s destination = create_range(RED_BLACK_TREE_SIZE / 4, RED_BLACK_TREE_SIZE);
+    red_black_tree_s source = create_range(0, RED_BLACK_TREE_SIZE / 4);
+
+    // source is lesser and shorter than destination
+    join_red_black_tree(&destination, &source);
+
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(destination));
+    ASSERTm("[ERROR] Expected destination to hold every element.", is_range(destination, 0, RED_BLACK_TREE_SIZE));
+    ASSERTm("[ERROR] Expected source to be empty.", is_empty_red_black_tree(source));
+
+    destroy_red_black_tree(&destination, destroy_int);
+    destroy_red_black_tree(&source, destroy_int);
+
+    PASS();
+}
+
+TEST JOIN_03(void) {
+    for (int i = 0; i <= RED_BLACK_TREE_SIZE; ++i) {
+        red_black_tree_s destination = create_range(0, i);
+        red_black_tree_s source = create_range(i, RED_BLACK_TREE_SIZE);
+
+        // every split point, including empty destination and empty source
+        join_red_black_tree(&destination, &source);
+
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(destination));
+        ASSERTm("[ERROR] Expected destination to hold every element.", is_range(destination, 0, RED_BLACK_TREE_SIZE));
+
+        destroy_red_black_tree(&destination, destroy_int);
+        destroy_red_black_tree(&source, destroy_int);
+    }
+
+    PASS();
+}
+
+TEST SPLIT_01(void) {
+    for (int i = -1; i <= RED_BLACK_TREE_SIZE; ++i) {
+        red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE);
+
+        // split returns elements not less than i and leaves the lesser ones
+        red_black_tree_s split = split_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+        const int pivot = i < 0 ? 0 : i;
+
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(split));
+        ASSERTm("[ERROR] Expected tree to hold lesser elements.", is_range(test, 0, pivot));
+        ASSERTm("[ERROR] Expected split to hold greater elements.", is_range(split, pivot, RED_BLACK_TREE_SIZE));
+
+        // joining both parts back must restore the tree
+        join_red_black_tree(&test, &split);
+        ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+        ASSERTm("[ERROR] Expected tree to hold every element.", is_range(test, 0, RED_BLACK_TREE_SIZE));
+
+        destroy_red_black_tree(&test, destroy_int);
+        destroy_red_black_tree(&split, destroy_int);
+    }
+
+    PASS();
+}
+
+TEST SET_01(void) {
+    red_black_tree_s one = create_red_black_tree(compare_int);
+    red_black_tree_s two = create_red_black_tree(compare_int);
+
+    // one holds multiples of two and two holds multiples of three
+    for (int i = 0; i < RED_BLACK_TREE_SIZE / 2; ++i) {
+        insert_red_black_tree(&one, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 2 * i, });
+        if (i < RED_BLACK_TREE_SIZE / 3) {
+            insert_red_black_tree(&two, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 3 * i, });
+        }
+    }
+
+    red_black_tree_s tree_union = union_red_black_tree(one, two, copy_int);
+    red_black_tree_s tree_intersect = intersect_red_black_tree(one, two, copy_int);
+    red_black_tree_s tree_subtract = subtract_red_black_tree(one, two, copy_int);
+    red_black_tree_s tree_exclude = exclude_red_black_tree(one, two, copy_int);
+
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(tree_union));
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(tree_intersect));
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(tree_subtract));
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(tree_exclude));
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        const RED_BLACK_TREE_DATA_TYPE element = { .sub_one = i, };
+        const bool in_one = !(i % 2) && i < 2 * (RED_BLACK_TREE_SIZE / 2), in_two = !(i % 3) && i < 3 * (RED_BLACK_TREE_SIZE / 3);
+
+        ASSERT_EQm("[ERROR] Expected union to hold elements in either tree.", in_one || in_two, contains_red_black_tree(tree_union, element));
+        ASSERT_EQm("[ERROR] Expected intersect to hold elements in both trees.", in_one && in_two, contains_red_black_tree(tree_intersect, element));
+        ASSERT_EQm("[ERROR] Expected subtract to hold elements only in first tree.", in_one && !in_two, contains_red_black_tree(tree_subtract, element));
+        ASSERT_EQm("[ERROR] Expected exclude to hold elements in exactly one tree.", in_one != in_two, contains_red_black_tree(tree_exclude, element));
+    }
+
+    destroy_red_black_tree(&one, destroy_int);
+    destroy_red_black_tree(&two, destroy_int);
+    destroy_red_black_tree(&tree_union, destroy_int);
+    destroy_red_black_tree(&tree_intersect, destroy_int);
+    destroy_red_black_tree(&tree_subtract, destroy_int);
+    destroy_red_black_tree(&tree_exclude, destroy_int);
+
+    PASS();
+}
+
+TEST SET_02(void) {
+    red_black_tree_s one = create_range(0, RED_BLACK_TREE_SIZE / 2);
+    red_black_tree_s two = create_red_black_tree(compare_int);
+
+    // operations with an empty tree
+    red_black_tree_s tree_union = union_red_black_tree(one, two, copy_int);
+    red_black_tree_s tree_intersect = intersect_red_black_tree(one, two, copy_int);
+    red_black_tree_s tree_subtract = subtract_red_black_tree(two, one, copy_int);
+    red_black_tree_s tree_exclude = exclude_red_black_tree(two, one, copy_int);
+
+    ASSERTm("[ERROR] Expected union to be first tree.", is_range(tree_union, 0, RED_BLACK_TREE_SIZE / 2));
+    ASSERTm("[ERROR] Expected intersect to be empty.", is_empty_red_black_tree(tree_intersect));
+    ASSERTm("[ERROR] Expected subtract to be empty.", is_empty_red_black_tree(tree_subtract));
+    ASSERTm("[ERROR] Expected exclude to be first tree.", is_range(tree_exclude, 0, RED_BLACK_TREE_SIZE / 2));
+
+    destroy_red_black_tree(&one, destroy_int);
+    destroy_red_black_tree(&two, destroy_int);
+    destroy_red_black_tree(&tree_union, destroy_int);
+    destroy_red_black_tree(&tree_intersect, destroy_int);
+    destroy_red_black_tree(&tree_subtract, destroy_int);
+    destroy_red_black_tree(&tree_exclude, destroy_int);
+
+    PASS();
+}
+
+TEST COMPACT_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, RED_BLACK_TREE_SIZE), });
+    }
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        remove_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, });
+    }
+
+    // after compaction each element's array index is its in-order position
+    compact_red_black_tree(&test);
+
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+    for (size_t i = 0; i < test.size; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i-th odd number.", (int)(2 * i + 1), test.elements[i].sub_one);
+    }
+
+    insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = 0, });
+    ASSERTm("[ERROR] Expected valid red black tree.", is_red_black(test));
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST TRAVERSE_01(void) {
+    red_black_tree_s test = create_range(0, RED_BLACK_TREE_SIZE);
+
+    // every traversal visits each element once
+    int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+    preorder_red_black_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected preorder to visit every element.", RED_BLACK_TREE_SIZE, (int)(cursor - array));
+
+    cursor = array;
+    postorder_red_black_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected postorder to visit every element.", RED_BLACK_TREE_SIZE, (int)(cursor - array));
+
+    cursor = array;
+    level_order_red_black_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected level order to visit every element.", RED_BLACK_TREE_SIZE, (int)(cursor - array));
+    ASSERT_EQm("[ERROR] Expected level order to start at root.", test.elements[test.root].sub_one, array[0]);
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (red_black_tree_test) {
+    // create
+    RUN_TEST(CREATE_01); RUN_TEST(CREATE_FROM_SORTED_01); RUN_TEST(CREATE_FROM_SORTED_02);
+    // destroy, clear and copy
+    RUN_TEST(DESTROY_01); RUN_TEST(CLEAR_01); RUN_TEST(COPY_01);
+    // insert
+    RUN_TEST(INSERT_01); RUN_TEST(INSERT_02); RUN_TEST(INSERT_03);
+    RUN_TEST(INSERT_HINT_01); RUN_TEST(INSERT_HINT_02); RUN_TEST(INSERT_HINT_03); RUN_TEST(INSERT_HINT_04);
+    // remove
+    RUN_TEST(REMOVE_01); RUN_TEST(REMOVE_MIN_01); RUN_TEST(REMOVE_MAX_01);
+    // search
+    RUN_TEST(CONTAINS_01); RUN_TEST(FLOOR_CEILING_01); RUN_TEST(BOUND_01); RUN_TEST(BOUND_02);
+    RUN_TEST(FOREACH_RANGE_01); RUN_TEST(FOREACH_RANGE_02);
+    // cursor
+    RUN_TEST(CURSOR_01); RUN_TEST(SEEK_01);
+    // join and split
+    RUN_TEST(JOIN_01); RUN_TEST(JOIN_02); RUN_TEST(JOIN_03); RUN_TEST(SPLIT_01);
+    // set operations
+    RUN_TEST(SET_01); RUN_TEST(SET_02);
+    // compact
+    RUN_TEST(COMPACT_01);
+    // traverse
+    RUN_TEST(TRAVERSE_01);
+}
@@ -0,0 +1,193 @@
+#include <suits.h>
+
+// counts compare macro calls, thus trees can be checked to use the macro instead of a function pointer
+static size_t compare_calls = 0;
+
+#define RED_BLACK_TREE_DATA_TYPE DATA_TYPE
+#define RED_BLACK_TREE_SIZE (1 << 5)
+#define RED_BLACK_TREE_COMPARE(one, two) (compare_calls++, compare_int(one, two))
+#include <tree/red_black_tree.h>
+
+#define AVL_TREE_DATA_TYPE DATA_TYPE
+#define AVL_TREE_SIZE (1 << 5)
+#define AVL_TREE_ORDER_STATISTICS
+#define AVL_TREE_COMPARE(one, two) (compare_calls++, compare_int(one, two))
+#include <tree/avl_tree.h>
+
+#define BSEARCH_TREE_DATA_TYPE DATA_TYPE
+#define BSEARCH_TREE_SIZE (1 << 5)
+#define BSEARCH_TREE_COMPARE(one, two) (compare_calls++, compare_int(one, two))
+#include <tree/bsearch_tree.h>
+
+TEST RED_BLACK_TREE_01(void) {
+    // compare parameter is ignored and may be NULL
+    red_black_tree_s test = create_red_black_tree(NULL);
+
+    compare_calls = 0;
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, RED_BLACK_TREE_SIZE), });
+    }
+    ASSERTm("[ERROR] Expected compare macro to be called.", compare_calls);
+
+    int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_red_black_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", RED_BLACK_TREE_SIZE, (int)(cursor - array));
+    ASSERTm("[ERROR] Expected elements to be sorted.", is_range_int(array, (size_t)(cursor - array), 0, RED_BLACK_TREE_SIZE));
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, remove_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, }).sub_one);
+    }
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected only odd elements to be contained.", (i % 2), contains_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST RED_BLACK_TREE_02(void) {
+    RED_BLACK_TREE_DATA_TYPE sorted[RED_BLACK_TREE_SIZE];
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        sorted[i] = (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, };
+    }
+
+    red_black_tree_s test = create_red_black_tree_from_sorted(NULL, sorted, RED_BLACK_TREE_SIZE);
+
+    // split and join back, then build a set operation result from both halves
+    red_black_tree_s split = split_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = RED_BLACK_TREE_SIZE / 2, });
+    ASSERT_EQm("[ERROR] Expected tree to hold lesser half.", RED_BLACK_TREE_SIZE / 2, test.size);
+    ASSERT_EQm("[ERROR] Expected split to hold greater half.", RED_BLACK_TREE_SIZE / 2, split.size);
+
+    red_black_tree_s tree_union = union_red_black_tree(test, split, copy_int);
+    join_red_black_tree(&test, &split);
+    compact_red_black_tree(&test);
+
+    int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_red_black_tree(tree_union, collect_int, &cursor);
+    ASSERTm("[ERROR] Expected union to hold every element.", is_range_int(array, (size_t)(cursor - array), 0, RED_BLACK_TREE_SIZE));
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i.", i, test.elements[i].sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected upper bound to be half.", RED_BLACK_TREE_SIZE / 2, upper_bound_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = (RED_BLACK_TREE_SIZE / 2) - 1, })->sub_one);
+
+    destroy_red_black_tree(&test, destroy_int);
+    destroy_red_black_tree(&split, destroy_int);
+    destroy_red_black_tree(&tree_union, destroy_int);
+
+    PASS();
+}
+
+TEST AVL_TREE_01(void) {
+    // compare parameter is ignored and may be NULL
+    avl_tree_s test = create_avl_tree(NULL);
+
+    compare_calls = 0;
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, AVL_TREE_SIZE), });
+    }
+    ASSERTm("[ERROR] Expected compare macro to be called.", compare_calls);
+
+    int array[AVL_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_avl_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", AVL_TREE_SIZE, (int)(cursor - array));
+    ASSERTm("[ERROR] Expected elements to be sorted.", is_range_int(array, (size_t)(cursor - array), 0, AVL_TREE_SIZE));
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected selected element to be i.", i, select_avl_tree(test, (size_t)(i)).sub_one);
+        ASSERT_EQm("[ERROR] Expected rank to be i.", (size_t)(i), rank_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE; i += 2) {
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, remove_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, }).sub_one);
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE / 2; ++i) {
+        ASSERT_EQm("[ERROR] Expected selected element to be i-th odd number.", (2 * i) + 1, select_avl_tree(test, (size_t)(i)).sub_one);
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST AVL_TREE_02(void) {
+    AVL_TREE_DATA_TYPE sorted[AVL_TREE_SIZE];
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        sorted[i] = (AVL_TREE_DATA_TYPE) { .sub_one = i, };
+    }
+
+    avl_tree_s test = create_avl_tree_from_sorted(NULL, sorted, AVL_TREE_SIZE);
+
+    // split and join back, then build a set operation result from both halves
+    avl_tree_s split = split_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = AVL_TREE_SIZE / 2, });
+    ASSERT_EQm("[ERROR] Expected tree to hold lesser half.", AVL_TREE_SIZE / 2, test.size);
+    ASSERT_EQm("[ERROR] Expected split to hold greater half.", AVL_TREE_SIZE / 2, split.size);
+
+    avl_tree_s tree_union = union_avl_tree(test, split, copy_int);
+    join_avl_tree(&test, &split);
+    compact_avl_tree(&test);
+
+    int array[AVL_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_avl_tree(tree_union, collect_int, &cursor);
+    ASSERTm("[ERROR] Expected union to hold every element.", is_range_int(array, (size_t)(cursor - array), 0, AVL_TREE_SIZE));
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i.", i, test.elements[i].sub_one);
+        ASSERT_EQm("[ERROR] Expected rank to be i.", (size_t)(i), rank_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+    destroy_avl_tree(&split, destroy_int);
+    destroy_avl_tree(&tree_union, destroy_int);
+
+    PASS();
+}
+
+TEST BSEARCH_TREE_01(void) {
+    // compare parameter is ignored and may be NULL
+    bsearch_tree_s test = create_bsearch_tree(NULL);
+
+    compare_calls = 0;
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, BSEARCH_TREE_SIZE), });
+    }
+    ASSERTm("[ERROR] Expected compare macro to be called.", compare_calls);
+
+    int array[BSEARCH_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_bsearch_tree(test, collect_int, &cursor);
+    ASSERT_EQm("[ERROR] Expected every element to be visited.", BSEARCH_TREE_SIZE, (int)(cursor - array));
+    ASSERTm("[ERROR] Expected elements to be sorted.", is_range_int(array, (size_t)(cursor - array), 0, BSEARCH_TREE_SIZE));
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; i += 2) {
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, remove_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, }).sub_one);
+    }
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected only odd elements to be contained.", (i % 2), contains_bsearch_tree(test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    // set operations and compaction only rebuild links, thus they must keep the odd elements sorted
+    bsearch_tree_s tree_union = union_bsearch_tree(test, test, copy_int);
+    compact_bsearch_tree(&test);
+    for (int i = 0; i < BSEARCH_TREE_SIZE / 2; ++i) {
+        ASSERT_EQm("[ERROR] Expected element at index i to be i-th odd number.", (2 * i) + 1, test.elements[i].sub_one);
+    }
+    ASSERT_EQm("[ERROR] Expected union with itself to keep size.", test.size, tree_union.size);
+
+    destroy_bsearch_tree(&test, destroy_int);
+    destroy_bsearch_tree(&tree_union, destroy_int);
+
+    PASS();
+}
+
+SUITE (tree_compare_test) {
+    // red black tree
+    RUN_TEST(RED_BLACK_TREE_01); RUN_TEST(RED_BLACK_TREE_02);
+    // avl tree
+    RUN_TEST(AVL_TREE_01); RUN_TEST(AVL_TREE_02);
+    // binary search tree
+    RUN_TEST(BSEARCH_TREE_01);
+}
@@ -0,0 +1,104 @@
+#include <suits.h>
+
+#include <stdint.h>
+
+// trees use the narrowest index type that still holds their size and NIL node, thus every index cast is exercised
+#define RED_BLACK_TREE_DATA_TYPE DATA_TYPE
+#define RED_BLACK_TREE_SIZE UINT8_MAX
+#define RED_BLACK_TREE_INDEX_TYPE uint8_t
+#include <tree/red_black_tree.h>
+
+#define AVL_TREE_DATA_TYPE DATA_TYPE
+#define AVL_TREE_SIZE UINT8_MAX
+#define AVL_TREE_INDEX_TYPE uint8_t
+#include <tree/avl_tree.h>
+
+#define BSEARCH_TREE_DATA_TYPE DATA_TYPE
+#define BSEARCH_TREE_SIZE UINT8_MAX
+#define BSEARCH_TREE_INDEX_TYPE uint8_t
+#include <tree/bsearch_tree.h>
+
+TEST RED_BLACK_TREE_01(void) {
+    red_black_tree_s test = create_red_black_tree(compare_int);
+
+    // 255 is coprime with 13 too, thus shuffled insertions fill the tree to its full capacity
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        insert_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, RED_BLACK_TREE_SIZE), });
+    }
+    ASSERTm("[ERROR] Expected tree to be full.", is_full_red_black_tree(test));
+
+    int array[RED_BLACK_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_red_black_tree(test, collect_int, &cursor);
+    ASSERTm("[ERROR] Expected elements to be sorted.", is_range_int(array, (size_t)(cursor - array), 0, RED_BLACK_TREE_SIZE));
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; i += 2) {
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, remove_red_black_tree(&test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, }).sub_one);
+    }
+
+    for (int i = 0; i < RED_BLACK_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected only odd elements to be contained.", (i % 2), contains_red_black_tree(test, (RED_BLACK_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_red_black_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST AVL_TREE_01(void) {
+    avl_tree_s test = create_avl_tree(compare_int);
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        insert_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, AVL_TREE_SIZE), });
+    }
+    ASSERTm("[ERROR] Expected tree to be full.", is_full_avl_tree(test));
+
+    int array[AVL_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_avl_tree(test, collect_int, &cursor);
+    ASSERTm("[ERROR] Expected elements to be sorted.", is_range_int(array, (size_t)(cursor - array), 0, AVL_TREE_SIZE));
+
+    for (int i = 0; i < AVL_TREE_SIZE; i += 2) {
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, remove_avl_tree(&test, (AVL_TREE_DATA_TYPE) { .sub_one = i, }).sub_one);
+    }
+
+    for (int i = 0; i < AVL_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected only odd elements to be contained.", (i % 2), contains_avl_tree(test, (AVL_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_avl_tree(&test, destroy_int);
+
+    PASS();
+}
+
+TEST BSEARCH_TREE_01(void) {
+    bsearch_tree_s test = create_bsearch_tree(compare_int);
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        insert_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = shuffle_int(i, BSEARCH_TREE_SIZE), });
+    }
+    ASSERTm("[ERROR] Expected tree to be full.", is_full_bsearch_tree(test));
+
+    int array[BSEARCH_TREE_SIZE] = { 0 }, * cursor = array;
+    inorder_bsearch_tree(test, collect_int, &cursor);
+    ASSERTm("[ERROR] Expected elements to be sorted.", is_range_int(array, (size_t)(cursor - array), 0, BSEARCH_TREE_SIZE));
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; i += 2) {
+        ASSERT_EQm("[ERROR] Expected removed element to be i.", i, remove_bsearch_tree(&test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, }).sub_one);
+    }
+
+    for (int i = 0; i < BSEARCH_TREE_SIZE; ++i) {
+        ASSERT_EQm("[ERROR] Expected only odd elements to be contained.", (i % 2), contains_bsearch_tree(test, (BSEARCH_TREE_DATA_TYPE) { .sub_one = i, }));
+    }
+
+    destroy_bsearch_tree(&test, destroy_int);
+
+    PASS();
+}
+
+SUITE (tree_index_test) {
+    // red black tree
+    RUN_TEST(RED_BLACK_TREE_01);
+    // avl tree
+    RUN_TEST(AVL_TREE_01);
+    // binary search tree
+    RUN_TEST(BSEARCH_TREE_01);
+}